@@ -0,0 +1,262 @@
+// Macrobenchmarks: ApiService gegen ein lokales Backend (eingebettetes Mock-Backend oder --api-url)
+#include "Bench.h"
+#include "Payloads.h"
+#include "../include/Services/ApiService.h"
+#include "../include/Services/JsonUtil.h"
+#include "../include/Services/RemoteExtractor.h"
+#include "../include/Services/UploadExtractPipeline.h"
+#ifdef TEF_BENCH_MOCK
+#include "../include/Mock/HttpServer.h"
+#include "../include/Mock/MockBackend.h"
+#endif
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <filesystem>
+#include <fstream>
+#include <memory>
+#include <thread>
+#include <vector>
+
+namespace Bench {
+
+namespace {
+
+// Startet das Mock-Backend auf einem freien Port und hält es bis zum Ende der Suite am Laufen
+class EmbeddedBackend {
+public:
+    ~EmbeddedBackend()
+    {
+#ifdef TEF_BENCH_MOCK
+        if (server_) server_->Stop();
+        if (thread_.joinable()) thread_.join();
+#endif
+    }
+
+    bool Start(const ApiOptions& options, bool quick, std::string& url, std::string& error)
+    {
+#ifdef TEF_BENCH_MOCK
+        Mock::DatasetOptions dataset;
+        dataset.documents = quick ? 2000 : 5000;
+        dataset.textBytes = 4000;
+        dataset.extractionMs = 50;  // Nur POST Extraction/{id}, damit sich Upload und Extraktion überlappen können
+        dataset.password = options.password;
+        Mock::NetworkProfile network;
+        network.latencyMs = options.latencyMs;
+        backend_ = std::make_unique<Mock::MockBackend>(dataset);
+        Mock::MockBackend* backend = backend_.get();
+        server_ = std::make_unique<Mock::HttpServer>(
+            [backend](const Mock::HttpRequest& request) { return backend->Handle(request); }, network);
+        if (!server_->Listen("127.0.0.1", 0, error)) return false;
+        thread_ = std::thread([this] { server_->Run(); });
+        url = "http://127.0.0.1:" + std::to_string(server_->Port()) + "/api";
+        return true;
+#else
+        (void)options;
+        (void)quick;
+        (void)url;
+        error = "Kein eingebettetes Mock-Backend auf dieser Plattform, bitte --api-url angeben";
+        return false;
+#endif
+    }
+
+private:
+#ifdef TEF_BENCH_MOCK
+    std::unique_ptr<Mock::MockBackend> backend_;
+    std::unique_ptr<Mock::HttpServer> server_;
+    std::thread thread_;
+#endif
+};
+
+// Dokument-IDs mit fertiger Extraktion aus der ersten Admin-Seite
+std::vector<std::string> ExtractedDocumentIds()
+{
+    std::vector<std::string> ids;
+    Services::HttpResponse resp = Services::ApiService::Get("Admin/extractions?pageSize=100&page=1");
+    if (!resp.isSuccess) return ids;
+    Services::ForEachFlatObject(resp.body, [&](const std::string& obj) {
+        std::string id = Services::ReadJsonValue(obj, "documentId");
+        if (!id.empty()) ids.push_back(id);
+    });
+    return ids;
+}
+
+} // namespace
+
+bool RunApiBenchmarks(Runner& runner, const ApiOptions& options, std::string& error)
+{
+    const bool quick = runner.Opts().quick;
+    const int requests = runner.Opts().requests;
+    const std::string parallelName = "macro/api/parallel-admin-page/" + std::to_string(options.threads) + "x";
+    if (!runner.AnyEnabled({"macro/api/ping", "macro/api/login", "macro/api/my-documents",
+                            "macro/api/admin-extractions-page", "macro/api/extraction-result",
+                            "macro/api/results-stream", "macro/api/upload-1M", "macro/api/ingest-sequential",
+                            "macro/api/ingest-pipeline", parallelName})) {
+        return true;
+    }
+
+    Services::ApiService::SetVerbose(false);
+    Services::ApiService::Initialize();
+    EmbeddedBackend embedded;
+    std::string url = options.apiUrl;
+    if (url.empty() && !embedded.Start(options, quick, url, error)) return false;
+    Services::ApiService::SetApiUrl(url);
+
+    if (!Services::ApiService::Get("ping").isSuccess) {
+        error = "Backend unter " + url + " nicht erreichbar";
+        return false;
+    }
+
+    runner.MeasureLatency("macro/api/ping", requests, 0,
+                          [](int) { return Services::ApiService::Get("ping").isSuccess; });
+
+    runner.MeasureLatency("macro/api/login", requests, 0, [&](int) {
+        return Services::ApiService::Login(options.user, options.password).isSuccess;
+    });
+    Services::ApiService::SetAuthCredentials(options.user, Services::ApiService::HashPassword(options.password));
+
+    // Dokumentliste wie beim Öffnen der Extraktionsansicht: Request und Zerlegung
+    size_t listBytes = Services::ApiService::Get("Upload/my-documents").body.size();
+    runner.MeasureLatency("macro/api/my-documents", requests, listBytes, [](int) {
+        Services::HttpResponse resp = Services::ApiService::Get("Upload/my-documents");
+        size_t count = 0;
+        Services::ForEachFlatObject(resp.body, [&](const std::string& obj) {
+            if (!Services::ExtractJsonField(obj, "id").empty()) ++count;
+        });
+        KeepAlive(count);
+        return resp.isSuccess;
+    });
+
+    runner.MeasureLatency("macro/api/admin-extractions-page", requests, 0, [](int i) {
+        return Services::ApiService::Get("Admin/extractions?pageSize=100&page=" + std::to_string(1 + i % 10)).isSuccess;
+    });
+
+    std::vector<std::string> ids = ExtractedDocumentIds();
+    if (ids.empty()) {
+        error = "Admin/extractions liefert keine Extraktionen";
+        return false;
+    }
+    size_t resultBytes = Services::ApiService::Get("Extraction/result/" + ids[0]).body.size();
+    runner.MeasureLatency("macro/api/extraction-result", requests, resultBytes, [&](int i) {
+        Services::HttpResponse resp = Services::ApiService::Get("Extraction/result/" + ids[static_cast<size_t>(i) % ids.size()]);
+        KeepAlive(Services::ReadJsonValue(resp.body, "extractedText").size());
+        return resp.isSuccess;
+    });
+
+    // Alle Ergebnisse als Strom (Export); Durchsatz zählt die tatsächlich empfangenen Bytes
+    if (runner.Enabled("macro/api/results-stream")) {
+        std::vector<double> samples;
+        size_t streamed = 0;
+        uint64_t errors = 0;
+        double seconds = 0.0;
+        for (int i = 0; i < (quick ? 2 : 5); ++i) {
+            auto start = std::chrono::steady_clock::now();
+            Services::HttpResponse resp = Services::ApiService::GetStream("Extraction/results", [&](const char*, size_t size) {
+                streamed += size;
+                return true;
+            });
+            double elapsed = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+            seconds += elapsed;
+            samples.push_back(elapsed * 1e6);
+            if (!resp.isSuccess) ++errors;
+        }
+        Result result = Runner::FromSamples("macro/api/results-stream", samples, seconds);
+        result.errors = errors;
+        Runner::SetThroughput(result, streamed / samples.size(), seconds);
+        runner.Add(std::move(result));
+    }
+
+    // Upload einer 1 MB großen Datei
+    if (runner.Enabled("macro/api/upload-1M")) {
+        std::filesystem::path file = std::filesystem::temp_directory_path() / "tef_bench_upload.pdf";
+        const size_t uploadBytes = 1u << 20;
+        {
+            std::ofstream out(file, std::ios::binary);
+            std::string text = GermanText(uploadBytes);
+            out << "%PDF-1.4\n" << text.substr(0, uploadBytes - 9);
+        }
+        runner.MeasureLatency("macro/api/upload-1M", std::min(requests, quick ? 10 : 50), uploadBytes,
+                              [&](int) { return Services::ApiService::UploadFile(file.string()).isSuccess; });
+        std::error_code ec;
+        std::filesystem::remove(file, ec);
+    }
+
+    // Hochladen + Extrahieren von 8 Dateien: nacheinander wie bisher in der GUI bzw. als Pipeline
+    if (runner.Enabled("macro/api/ingest-sequential") || runner.Enabled("macro/api/ingest-pipeline")) {
+        const size_t fileBytes = 256u << 10;
+        std::vector<std::string> paths;
+        std::string text = GermanText(fileBytes);
+        for (int i = 0; i < 8; ++i) {
+            std::filesystem::path file = std::filesystem::temp_directory_path() / ("tef_bench_ingest_" + std::to_string(i) + ".pdf");
+            std::ofstream out(file, std::ios::binary);
+            out << "%PDF-1.4\n" << text.substr(0, fileBytes - 9);
+            paths.push_back(file.string());
+        }
+        const int batches = std::min(requests, quick ? 3 : 10);
+        Core::ExtractionOptions extraction;
+        extraction.maxPages = 5;
+
+        runner.MeasureLatency("macro/api/ingest-sequential", batches, fileBytes * paths.size(), [&](int) {
+            Services::RemoteExtractor remote;
+            bool ok = true;
+            for (const auto& path : paths) {
+                Services::HttpResponse resp = Services::ApiService::UploadFile(path);
+                ok = ok && resp.isSuccess && remote.Extract(Services::ExtractJsonField(resp.body, "fileId"), extraction).success;
+            }
+            return ok;
+        }, "batch");
+
+        runner.MeasureLatency("macro/api/ingest-pipeline", batches, fileBytes * paths.size(), [&](int) {
+            Services::PipelineOptions pipelineOptions;
+            pipelineOptions.extraction = extraction;
+            Services::UploadExtractPipeline pipeline(pipelineOptions);
+            pipeline.Add(paths);
+            pipeline.Finish();
+            std::vector<Services::PipelineItem> completed;
+            pipeline.TakeCompleted(completed);
+            return completed.size() == paths.size() &&
+                   std::all_of(completed.begin(), completed.end(), [](const Services::PipelineItem& item) {
+                       return item.stage == Services::PipelineStage::Done;
+                   });
+        }, "batch");
+
+        for (const auto& path : paths) {
+            std::error_code ec;
+            std::filesystem::remove(path, ec);
+        }
+    }
+
+    // Parallele Last: mehrere Threads fragen gleichzeitig Admin-Seiten ab
+    if (runner.Enabled(parallelName)) {
+        int threads = std::max(1, options.threads);
+        std::vector<std::vector<double>> perThread(static_cast<size_t>(threads));
+        std::atomic<uint64_t> errors{0};
+        auto start = std::chrono::steady_clock::now();
+        std::vector<std::thread> workers;
+        for (int t = 0; t < threads; ++t) {
+            workers.emplace_back([&, t] {
+                auto& samples = perThread[static_cast<size_t>(t)];
+                for (int i = 0; i < requests; ++i) {
+                    auto begin = std::chrono::steady_clock::now();
+                    bool ok = Services::ApiService::Get("Admin/extractions?pageSize=100&page=" +
+                                                        std::to_string(1 + (i + t) % 10)).isSuccess;
+                    samples.push_back(std::chrono::duration<double>(std::chrono::steady_clock::now() - begin).count() * 1e6);
+                    if (!ok) ++errors;
+                }
+            });
+        }
+        for (auto& worker : workers) worker.join();
+        double wall = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+        std::vector<double> samples;
+        for (const auto& list : perThread) samples.insert(samples.end(), list.begin(), list.end());
+        Result result = Runner::FromSamples(parallelName, std::move(samples), wall);
+        result.errors = errors.load();
+        result.note = "nsPerOp = Wandzeit / Requests (Durchsatz), Perzentile je Request";
+        runner.Add(std::move(result));
+    }
+
+    Services::ApiService::ClearAuthCredentials();
+    return true;
+}
+
+} // namespace Bench
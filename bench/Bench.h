@@ -0,0 +1,167 @@
+#pragma once
+
+// Gemeinsames Gerüst für tef_bench: Messung, Tabelle und JSON-Ausgabe
+#include <algorithm>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <ostream>
+#include <string>
+#include <vector>
+
+namespace Bench {
+
+struct Result {
+    std::string name;           // z.B. "micro/json/ExtractJsonField"
+    std::string unit = "op";    // Was eine Iteration ist (op, request, frame, ...)
+    uint64_t iterations = 0;
+    double nsPerOp = 0.0;
+    double bytesPerOp = 0.0;    // 0 = kein Durchsatz
+    double mbPerSec = 0.0;
+    // Latenzverteilung in Mikrosekunden (nur bei MeasureLatency)
+    bool hasLatency = false;
+    double p50Us = 0.0;
+    double p95Us = 0.0;
+    double p99Us = 0.0;
+    double maxUs = 0.0;
+    uint64_t errors = 0;
+    std::string note;
+};
+
+struct Options {
+    std::string filter;         // Teilstring im Namen, leer = alle
+    double minSeconds = 0.5;    // Mindestlaufzeit je Microbenchmark
+    int requests = 200;         // Requests je Macrobenchmark
+    bool quick = false;         // Kleinere Payloads und kürzere Laufzeiten (Smoke-Test)
+};
+
+// Verhindert, dass der Compiler das Ergebnis eines Laufs wegoptimiert
+inline void KeepAlive(size_t value)
+{
+    static volatile size_t sink = 0;
+    sink = sink + value;
+}
+
+class Runner {
+public:
+    explicit Runner(Options options) : options_(std::move(options)) {}
+
+    const Options& Opts() const { return options_; }
+    bool Enabled(const std::string& name) const
+    {
+        return options_.filter.empty() || name.find(options_.filter) != std::string::npos;
+    }
+    // Für Suites mit teurer Vorbereitung: läuft mindestens einer der Benchmarks?
+    bool AnyEnabled(const std::vector<std::string>& names) const
+    {
+        return std::any_of(names.begin(), names.end(), [this](const std::string& name) { return Enabled(name); });
+    }
+
+    // Wiederholt fn in wachsenden Blöcken bis minSeconds erreicht sind; fn liefert einen Wert für KeepAlive
+    template <typename Fn>
+    void Measure(const std::string& name, size_t bytesPerOp, Fn&& fn)
+    {
+        if (!Enabled(name)) return;
+        using Clock = std::chrono::steady_clock;
+        fn(); // Aufwärmen (Caches, Puffer)
+        uint64_t iterations = 0;
+        uint64_t batch = 1;
+        double seconds = 0.0;
+        while (seconds < options_.minSeconds) {
+            auto start = Clock::now();
+            size_t acc = 0;
+            for (uint64_t i = 0; i < batch; ++i) acc += fn();
+            seconds += std::chrono::duration<double>(Clock::now() - start).count();
+            KeepAlive(acc);
+            iterations += batch;
+            if (batch < (1u << 20)) batch *= 2;
+        }
+        Result result;
+        result.name = name;
+        result.iterations = iterations;
+        result.nsPerOp = seconds * 1e9 / static_cast<double>(iterations);
+        SetThroughput(result, bytesPerOp, seconds);
+        Add(std::move(result));
+    }
+
+    // Misst jeden Aufruf einzeln (Requests); fn gibt false bei einem Fehler zurück
+    template <typename Fn>
+    void MeasureLatency(const std::string& name, int count, size_t bytesPerOp, Fn&& fn, const std::string& unit = "request")
+    {
+        if (!Enabled(name)) return;
+        using Clock = std::chrono::steady_clock;
+        std::vector<double> samples;
+        samples.reserve(static_cast<size_t>(count));
+        uint64_t errors = 0;
+        double seconds = 0.0;
+        for (int i = 0; i < count; ++i) {
+            auto start = Clock::now();
+            bool ok = fn(i);
+            double elapsed = std::chrono::duration<double>(Clock::now() - start).count();
+            seconds += elapsed;
+            samples.push_back(elapsed * 1e6);
+            if (!ok) ++errors;
+        }
+        Result result = FromSamples(name, samples, seconds);
+        result.unit = unit;
+        result.errors = errors;
+        SetThroughput(result, bytesPerOp, seconds);
+        Add(std::move(result));
+    }
+
+    // Fertiges Ergebnis aus Einzelmessungen (z.B. mehrere Threads), Latenzen in Mikrosekunden
+    static Result FromSamples(const std::string& name, std::vector<double> samplesUs, double wallSeconds)
+    {
+        Result result;
+        result.name = name;
+        result.iterations = samplesUs.size();
+        if (samplesUs.empty()) return result;
+        std::sort(samplesUs.begin(), samplesUs.end());
+        auto percentile = [&](double p) {
+            size_t index = static_cast<size_t>(p * static_cast<double>(samplesUs.size() - 1) + 0.5);
+            return samplesUs[std::min(index, samplesUs.size() - 1)];
+        };
+        result.hasLatency = true;
+        result.p50Us = percentile(0.50);
+        result.p95Us = percentile(0.95);
+        result.p99Us = percentile(0.99);
+        result.maxUs = samplesUs.back();
+        result.nsPerOp = wallSeconds * 1e9 / static_cast<double>(samplesUs.size());
+        return result;
+    }
+
+    static void SetThroughput(Result& result, size_t bytesPerOp, double seconds)
+    {
+        if (bytesPerOp == 0 || seconds <= 0.0) return;
+        result.bytesPerOp = static_cast<double>(bytesPerOp);
+        result.mbPerSec = static_cast<double>(bytesPerOp) * static_cast<double>(result.iterations) /
+                          (1024.0 * 1024.0) / seconds;
+    }
+
+    void Add(Result result);
+    const std::vector<Result>& Results() const { return results_; }
+
+    void PrintTable(std::ostream& out) const;
+    // label: freier Text zur Zuordnung (z.B. Commit), wird unverändert übernommen
+    std::string ToJson(const std::string& label) const;
+
+private:
+    Options options_;
+    std::vector<Result> results_;
+};
+
+// Einzelne Suites (jeweils eigene Übersetzungseinheit)
+bool RunUtf8Benchmarks(Runner& runner, std::string& error);
+void RunMicroBenchmarks(Runner& runner);
+
+struct ApiOptions {
+    std::string apiUrl;         // Leer = eingebettetes Mock-Backend starten
+    std::string user = "admin";
+    std::string password = "test";
+    int latencyMs = 0;          // Netzwerkverzögerung des eingebetteten Mock-Backends
+    int threads = 8;            // Parallelität für den Lastlauf
+};
+bool RunApiBenchmarks(Runner& runner, const ApiOptions& options, std::string& error);
+
+} // namespace Bench
@@ -0,0 +1,175 @@
+// tef_bench: Micro- und Macrobenchmarks der Client-Hotpaths mit Tabellen- oder JSON-Ausgabe
+#include "Bench.h"
+#include "../include/Services/JsonUtil.h"
+#include <algorithm>
+#include <cstdio>
+#include <cstdlib>
+#include <ctime>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <sstream>
+#include <thread>
+
+namespace Bench {
+
+void Runner::Add(Result result)
+{
+    std::cerr << "  " << result.name << std::endl;
+    results_.push_back(std::move(result));
+}
+
+void Runner::PrintTable(std::ostream& out) const
+{
+    out << std::left << std::setw(58) << "Benchmark" << std::right << std::setw(14) << "ns/op" << std::setw(11)
+        << "MB/s" << std::setw(11) << "p50 us" << std::setw(11) << "p99 us" << std::setw(8) << "Fehler" << "\n";
+    out << std::fixed;
+    for (const auto& r : results_) {
+        out << std::left << std::setw(58) << r.name << std::right << std::setprecision(1) << std::setw(14) << r.nsPerOp;
+        if (r.mbPerSec > 0.0) out << std::setw(11) << r.mbPerSec;
+        else out << std::setw(11) << "-";
+        if (r.hasLatency) out << std::setw(11) << r.p50Us << std::setw(11) << r.p99Us << std::setw(8) << r.errors;
+        out << "\n";
+    }
+    out.flush();
+}
+
+std::string Runner::ToJson(const std::string& label) const
+{
+    auto number = [](double value) {
+        char buffer[32];
+        std::snprintf(buffer, sizeof(buffer), "%.3f", value);
+        return std::string(buffer);
+    };
+
+    std::time_t now = std::time(nullptr);
+    char timestamp[32];
+    std::strftime(timestamp, sizeof(timestamp), "%Y-%m-%dT%H:%M:%SZ", std::gmtime(&now));
+
+    std::string compiler;
+#if defined(__clang__)
+    compiler = "clang " __clang_version__;
+#elif defined(__GNUC__)
+    compiler = "gcc " __VERSION__;
+#elif defined(_MSC_VER)
+    compiler = "msvc " + std::to_string(_MSC_VER);
+#endif
+#ifdef NDEBUG
+    const char* build = "release";
+#else
+    const char* build = "debug";
+#endif
+
+    std::string json = "{\"schema\":\"tef_bench/1\",\"label\":\"" + Services::EscapeJson(label) + "\",\"timestamp\":\"" +
+                       timestamp + "\",\"compiler\":\"" + Services::EscapeJson(compiler) + "\",\"build\":\"" + build +
+                       "\",\"cpus\":" + std::to_string(std::thread::hardware_concurrency()) +
+                       ",\"quick\":" + (options_.quick ? "true" : "false") + ",\"results\":[";
+    for (size_t i = 0; i < results_.size(); ++i) {
+        const Result& r = results_[i];
+        if (i) json += ",";
+        json += "\n  {\"name\":\"" + Services::EscapeJson(r.name) + "\",\"unit\":\"" + r.unit +
+                "\",\"iterations\":" + std::to_string(r.iterations) + ",\"nsPerOp\":" + number(r.nsPerOp);
+        if (r.bytesPerOp > 0.0) json += ",\"bytesPerOp\":" + number(r.bytesPerOp) + ",\"mbPerSec\":" + number(r.mbPerSec);
+        if (r.hasLatency) {
+            json += ",\"p50Us\":" + number(r.p50Us) + ",\"p95Us\":" + number(r.p95Us) + ",\"p99Us\":" + number(r.p99Us) +
+                    ",\"maxUs\":" + number(r.maxUs) + ",\"errors\":" + std::to_string(r.errors);
+        }
+        if (!r.note.empty()) json += ",\"note\":\"" + Services::EscapeJson(r.note) + "\"";
+        json += "}";
+    }
+    return json + "\n]}\n";
+}
+
+} // namespace Bench
+
+namespace {
+
+void PrintUsage()
+{
+    std::fprintf(stderr,
+        "Verwendung: tef_bench [Optionen]\n"
+        "\n"
+        "  --filter TEXT        Nur Benchmarks, deren Name TEXT enthält (z.B. micro/json, macro/)\n"
+        "  --json DATEI         Ergebnisse zusätzlich als JSON schreiben (- = stdout statt Tabelle)\n"
+        "  --label TEXT         Freitext im JSON, z.B. Commit oder Maschine\n"
+        "  --min-time-ms N      Mindestlaufzeit je Microbenchmark (Standard: 500)\n"
+        "  --requests N         Requests je Macrobenchmark (Standard: 200)\n"
+        "  --quick              Kleine Payloads und kurze Laufzeiten (Smoke-Test)\n"
+        "  --no-macro           Nur Microbenchmarks\n"
+        "  --api-url URL        Macrobenchmarks gegen dieses Backend statt gegen das eingebettete Mock-Backend\n"
+        "  --user NAME          Benutzer für --api-url (Standard: admin)\n"
+        "  --password PW        Passwort (Standard: test)\n"
+        "  --latency-ms N       Netzwerkverzögerung des eingebetteten Mock-Backends\n"
+        "  --threads N          Threads für den parallelen Lastlauf (Standard: 8)\n");
+}
+
+} // namespace
+
+int main(int argc, char** argv)
+{
+    Bench::Options options;
+    Bench::ApiOptions api;
+    std::string jsonPath;
+    std::string label;
+    bool macro = true;
+
+    for (int i = 1; i < argc; ++i) {
+        std::string arg = argv[i];
+        auto value = [&]() -> const char* {
+            if (i + 1 >= argc) {
+                std::fprintf(stderr, "Fehler: %s erwartet einen Wert\n", arg.c_str());
+                std::exit(2);
+            }
+            return argv[++i];
+        };
+        if (arg == "--filter") options.filter = value();
+        else if (arg == "--json") jsonPath = value();
+        else if (arg == "--label") label = value();
+        else if (arg == "--min-time-ms") options.minSeconds = std::max(1, std::atoi(value())) / 1000.0;
+        else if (arg == "--requests") options.requests = std::max(1, std::atoi(value()));
+        else if (arg == "--quick") options.quick = true;
+        else if (arg == "--no-macro") macro = false;
+        else if (arg == "--api-url") api.apiUrl = value();
+        else if (arg == "--user") api.user = value();
+        else if (arg == "--password") api.password = value();
+        else if (arg == "--latency-ms") api.latencyMs = std::max(0, std::atoi(value()));
+        else if (arg == "--threads") api.threads = std::max(1, std::atoi(value()));
+        else if (arg == "--help" || arg == "-h") {
+            PrintUsage();
+            return 0;
+        } else {
+            std::fprintf(stderr, "Fehler: Unbekannte Option: %s\n\n", arg.c_str());
+            PrintUsage();
+            return 2;
+        }
+    }
+    if (options.quick) {
+        options.minSeconds = std::min(options.minSeconds, 0.05);
+        options.requests = std::min(options.requests, 20);
+    }
+
+    // Fortschritt und Service-Meldungen auf stderr, damit stdout bei --json - reines JSON bleibt
+    std::streambuf* originalCout = std::cout.rdbuf(std::cerr.rdbuf());
+    Bench::Runner runner(options);
+    std::string error;
+    bool ok = Bench::RunUtf8Benchmarks(runner, error);
+    if (ok) Bench::RunMicroBenchmarks(runner);
+    if (ok && macro) ok = Bench::RunApiBenchmarks(runner, api, error);
+    if (!ok) std::cerr << "FEHLER: " << error << std::endl;
+    std::cout.rdbuf(originalCout);
+
+    if (jsonPath == "-") {
+        std::cout << runner.ToJson(label);
+    } else {
+        runner.PrintTable(std::cout);
+        if (!jsonPath.empty()) {
+            std::ofstream out(jsonPath, std::ios::binary);
+            out << runner.ToJson(label);
+            if (!out) {
+                std::cerr << "FEHLER: " << jsonPath << " kann nicht geschrieben werden" << std::endl;
+                return 1;
+            }
+        }
+    }
+    return ok ? 0 : 1;
+}
@@ -0,0 +1,167 @@
+// Microbenchmarks der Client-Hotpaths (JSON-Felder, Umbruch, UTF-8, Auth-Header, Statistik)
+#include "Bench.h"
+#include "Payloads.h"
+#include "../include/Services/AdminTables.h"
+#include "../include/Services/ApiService.h"
+#include "../include/Services/JsonUtil.h"
+#include "../include/Services/TableQuery.h"
+#include "../include/Services/Utf8Decoder.h"
+#include "../include/UI/TextLayout.h"
+#include <algorithm>
+#include <string>
+#include <vector>
+
+namespace Bench {
+
+namespace {
+
+// Ungefähre Glyphenbreiten eines 11px-Fonts, damit der Umbruch ohne SFML realistisch läuft
+UI::TextLayout::AdvanceFn SyntheticAdvance()
+{
+    return [](uint32_t prev, uint32_t cp) -> float {
+        float kerning = (prev == 'V' && cp == 'e') ? -0.5f : 0.f;
+        if (cp == ' ') return 3.f;
+        if (cp == '\t') return 12.f;
+        if (cp >= 'A' && cp <= 'Z') return kerning + 8.f;
+        if (cp < 0x80) return kerning + 6.f;
+        return kerning + 6.5f;
+    };
+}
+
+// ToSFMLString ohne sf::String: gleicher Dekoder, gleicher wiederverwendeter Puffer
+size_t DecodeLikeToSFMLString(const std::string& utf8)
+{
+    thread_local std::vector<uint32_t> buffer;
+    buffer.resize(utf8.size());
+    return Services::Utf8Decoder::Decode(utf8.data(), utf8.size(), buffer.data());
+}
+
+// Schleife der Dokumentliste in RunGui ohne Konsolenausgabe und LocalStore
+size_t SplitMyDocuments(const std::string& body)
+{
+    size_t count = 0;
+    Services::ForEachFlatObject(body, [&](const std::string& objStr) {
+        std::string fileId = Services::ExtractJsonField(objStr, "id");
+        std::string fileName = Services::ExtractJsonField(objStr, "fileName");
+        if (!fileId.empty()) count += fileName.size() + 1;
+    });
+    return count;
+}
+
+std::string SizeLabel(size_t bytes)
+{
+    if (bytes >= (1u << 20)) return std::to_string(bytes >> 20) + "M";
+    if (bytes >= 1024) return std::to_string(bytes >> 10) + "k";
+    return std::to_string(bytes);
+}
+
+} // namespace
+
+void RunMicroBenchmarks(Runner& runner)
+{
+    const bool quick = runner.Opts().quick;
+    const size_t largeText = quick ? (64u << 10) : (1u << 20);
+
+    // JSON-Felder
+    std::string docObject;
+    Services::ForEachFlatObject(MyDocumentsJson(1), [&](const std::string& obj) { docObject = obj; });
+    runner.Measure("micro/json/ExtractJsonField/document", docObject.size(),
+                   [&] { return Services::ExtractJsonField(docObject, "fileName").size(); });
+    for (size_t textBytes : {size_t(2000), largeText}) {
+        std::string result = ExtractionResultJson(textBytes);
+        // status steht vor dem Text, extractedText ist das letzte Feld
+        runner.Measure("micro/json/ExtractJsonField/result-" + SizeLabel(textBytes) + "/status", result.size(),
+                       [&] { return Services::ExtractJsonField(result, "status").size(); });
+        runner.Measure("micro/json/ReadJsonValue/result-" + SizeLabel(textBytes) + "/extractedText", result.size(),
+                       [&] { return Services::ReadJsonValue(result, "extractedText").size(); });
+    }
+
+    // Dokumentliste
+    for (size_t count : {size_t(50), size_t(quick ? 200 : 2000)}) {
+        std::string body = MyDocumentsJson(count);
+        runner.Measure("micro/json/my-documents-split/" + std::to_string(count), body.size(),
+                       [&] { return SplitMyDocuments(body); });
+    }
+
+    // Admin-Tabellen: Laden (Interning, Zeitstempel parsen) und ein Scan über eine Spalte
+    for (size_t count : {size_t(1000), size_t(quick ? 10000 : 100000)}) {
+        std::string body = MyDocumentsJson(count);
+        Services::DocumentTable table;
+        runner.Measure("micro/admin/DocumentTable/ingest-" + std::to_string(count), body.size(), [&] {
+            table.Clear();
+            return table.Ingest(body);
+        });
+        if (table.Empty()) table.Ingest(body);  // ingest-Fall per --filter ausgelassen
+        runner.Measure("micro/admin/DocumentTable/newest-" + std::to_string(count), 0, [&] {
+            int64_t newest = Services::kNoTimestamp;
+            for (size_t i = 0; i < table.Size(); ++i) newest = std::max(newest, table.UploadedAt(i));
+            return static_cast<size_t>(newest);
+        });
+
+        // Sortieren/Filtern wie im Admin-Tab (synchron, Threads nach Tabellengröße)
+        Services::TableQuerySpec byDate;
+        byDate.sorted = true;
+        byDate.descending = true;
+        Services::TableQuerySpec byName;
+        byName.sorted = true;
+        byName.column = Services::TableColumn::Name;
+        Services::TableQuerySpec grouped = byDate;
+        grouped.filter = "rechnung*";
+        grouped.groupByUser = true;
+        for (const auto& query : {std::make_pair("sort-date", &byDate), std::make_pair("sort-name", &byName),
+                                  std::make_pair("filter-group", &grouped)}) {
+            runner.Measure("micro/admin/TableQuery/" + std::string(query.first) + "-" + std::to_string(count), 0,
+                           [&] { return Services::TableQuery::Run(table, *query.second).rows.size(); });
+        }
+    }
+
+    // Umbruch (WrapText ist durch UI::TextLayout ersetzt)
+    for (size_t textBytes : {size_t(4096), largeText}) {
+        std::string text = GermanText(textBytes);
+        std::string label = SizeLabel(textBytes);
+        UI::TextLayout layout;
+        layout.SetAdvanceFunction(SyntheticAdvance(), 11u);
+        runner.Measure("micro/text/WrapText/" + label + "/set+wrap", text.size(), [&] {
+            layout.Clear();
+            layout.SetText(text, 1);
+            layout.Wrap(870.f);
+            return layout.LineCount();
+        });
+        // Fensterbreite ändert sich, Text bleibt: nur neu umbrechen
+        bool narrow = false;
+        runner.Measure("micro/text/WrapText/" + label + "/rewrap", text.size(), [&] {
+            narrow = !narrow;
+            layout.Wrap(narrow ? 600.f : 870.f);
+            return layout.LineCount();
+        });
+        runner.Measure("micro/text/CountWords/" + label, text.size(), [&] { return UI::CountWords(text); });
+    }
+
+    // ToSFMLString: viele kurze Beschriftungen pro Frame bzw. ein ganzer Text
+    std::vector<std::string> labels = {"Hochgeladene Dokumente", "Extraktion starten", "Größe: 482913 Bytes",
+                                       "Rechnung_2026_Übersicht.pdf", "< Zurück", "Öffnen", "Volltextsuche"};
+    size_t labelBytes = 0;
+    for (const auto& label : labels) labelBytes += label.size();
+    runner.Measure("micro/text/ToSFMLString/labels", labelBytes, [&] {
+        size_t total = 0;
+        for (const auto& label : labels) total += DecodeLikeToSFMLString(label);
+        return total;
+    });
+    std::string page = GermanText(64u << 10);
+    runner.Measure("micro/text/ToSFMLString/64k", page.size(), [&] { return DecodeLikeToSFMLString(page); });
+
+    // Authentifizierung
+    Services::ApiService::SetVerbose(false);
+    Services::ApiService::SetAuthCredentials("sachbearbeiter.mueller", Services::ApiService::HashPassword("geheim"));
+    runner.Measure("micro/auth/GetAuthHeader", 0, [] { return Services::ApiService::GetAuthHeader().size(); });
+    Services::ApiService::ClearAuthCredentials();
+    std::string password = "Korrekt-Pferd-Batterie-Heftklammer";
+    runner.Measure("micro/auth/HashPassword", password.size(),
+                   [&] { return Services::ApiService::HashPassword(password).size(); });
+    unsigned char digest[32];
+    for (unsigned i = 0; i < sizeof(digest); ++i) digest[i] = static_cast<unsigned char>(i * 37 + 11);
+    runner.Measure("micro/auth/BytesToHex", sizeof(digest),
+                   [&] { return Services::ApiService::BytesToHex(digest, sizeof(digest)).size(); });
+}
+
+} // namespace Bench
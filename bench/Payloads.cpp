@@ -0,0 +1,80 @@
+#include "Payloads.h"
+#include "../include/Services/JsonUtil.h"
+#include <vector>
+
+namespace Bench {
+
+namespace {
+
+// SplitMix64, wie im Mock-Backend
+uint64_t Next(uint64_t& state)
+{
+    uint64_t z = (state += 0x9E3779B97F4A7C15ull);
+    z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ull;
+    z = (z ^ (z >> 27)) * 0x94D049BB133111EBull;
+    return z ^ (z >> 31);
+}
+
+const std::vector<std::string> kWords = {
+    "Rechnung", "Vertrag", "Gebühren", "Übersicht", "Größe", "Straße", "Änderung", "Frist", "gemäß",
+    "Lieferung", "Angebot", "Steuer", "Mahnung", "Prüfung", "für", "und", "der", "die", "das", "mit",
+    "nach", "über", "zwischen", "Auftraggeber", "Leistungsbeschreibung", "Zahlungsbedingungen", "bzw.",
+    "Öffnungszeiten", "Kündigungsfrist", "Verbindlichkeiten", "Anlage", "Seite", "Menge", "Einheit"};
+
+const std::vector<std::string> kExtensions = {".pdf", ".pdf", ".pdf", ".png", ".jpg"};
+
+} // namespace
+
+std::string GermanText(size_t bytes, uint64_t seed)
+{
+    uint64_t state = seed;
+    std::string text;
+    text.reserve(bytes + 64);
+    size_t sentenceWords = 0;
+    while (text.size() < bytes) {
+        uint64_t r = Next(state);
+        if (sentenceWords == 0 && !text.empty()) text += (r % 7 == 0) ? "\n\n" : (r % 3 == 0 ? "\n" : " ");
+        if (r % 13 == 0) {
+            text += std::to_string(r % 100000) + "," + std::to_string(r % 100) + " €";
+        } else {
+            text += kWords[r % kWords.size()];
+        }
+        ++sentenceWords;
+        if (sentenceWords > 6 + (r >> 40) % 10) {
+            text += (r >> 20) % 5 == 0 ? ": \"Anlage\"." : ".";
+            sentenceWords = 0;
+        } else {
+            text += (r >> 12) % 9 == 0 ? ", " : " ";
+        }
+    }
+    return text;
+}
+
+std::string MyDocumentsJson(size_t count, uint64_t seed)
+{
+    uint64_t state = seed;
+    std::string json = "[";
+    for (size_t i = 0; i < count; ++i) {
+        uint64_t r = Next(state);
+        std::string id = "3f2a" + std::to_string(r % 1000000000ull) + "-" + std::to_string(i);
+        std::string name = kWords[r % kWords.size()] + "_" + std::to_string(2020 + r % 7) + "_" +
+                           std::to_string(i) + kExtensions[(r >> 8) % kExtensions.size()];
+        if (i) json += ",";
+        json += "{\"id\":\"" + id + "\",\"fileId\":\"" + id + "\",\"fileName\":\"" + Services::EscapeJson(name) +
+                "\",\"fileSize\":" + std::to_string(20000 + r % 5000000) +
+                ",\"contentType\":\"application/pdf\",\"uploadedBy\":\"user" + std::to_string(r % 20) +
+                "\",\"uploadedAt\":\"2026-0" + std::to_string(1 + r % 9) + "-1" + std::to_string(r % 10) +
+                "T10:15:30Z\",\"hasExtraction\":" + ((r >> 16) % 10 ? "true" : "false") + "}";
+    }
+    return json + "]";
+}
+
+std::string ExtractionResultJson(size_t textBytes, uint64_t seed)
+{
+    return "{\"id\":\"ext-" + std::to_string(seed) + "\",\"documentId\":\"doc-" + std::to_string(seed) +
+           "\",\"fileName\":\"Vertrag_2026.pdf\",\"extractionMethod\":\"PdfTextLayer\",\"status\":\"Completed\"" +
+           ",\"completedAt\":\"2026-03-01T12:00:00Z\",\"pageCount\":" + std::to_string(textBytes / 1800 + 1) +
+           ",\"extractedText\":\"" + Services::EscapeJson(GermanText(textBytes, seed)) + "\"}";
+}
+
+} // namespace Bench
@@ -0,0 +1,19 @@
+#pragma once
+
+// Realistische Eingaben für die Benchmarks, deterministisch aus einem Seed erzeugt
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+namespace Bench {
+
+// Deutscher Fließtext mit Umlauten, Satzzeichen, Absätzen und gelegentlich Zahlen/Beträgen
+std::string GermanText(size_t bytes, uint64_t seed = 1);
+
+// Antwort von GET Upload/my-documents mit count Dokumenten (Feldnamen wie im Backend)
+std::string MyDocumentsJson(size_t count, uint64_t seed = 1);
+
+// Antwort von GET Extraction/result/{id}; der Text enthält escapte Zeilenumbrüche und Anführungszeichen
+std::string ExtractionResultJson(size_t textBytes, uint64_t seed = 1);
+
+} // namespace Bench
@@ -0,0 +1,133 @@
+// Benchmark: Utf8Decoder gegen die bisherige std::wstring_convert-Konvertierung
+#include "Bench.h"
+#include "../include/Services/Utf8Decoder.h"
+#include <algorithm>
+#include <codecvt>
+#include <cstdint>
+#include <locale>
+#include <string>
+#include <vector>
+
+namespace Bench {
+
+namespace {
+
+#if defined(__GNUC__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wdeprecated-declarations"
+#endif
+// Bisherige ToSFMLString-Implementierung ohne SFML (gleiche Allokationen, gleicher Fallback)
+std::vector<uint32_t> LegacyConvert(const std::string& utf8String)
+{
+    std::wstring_convert<std::codecvt_utf8<char32_t>, char32_t> converter;
+    try {
+        std::u32string utf32 = converter.from_bytes(utf8String);
+        return std::vector<uint32_t>(utf32.begin(), utf32.end());
+    }
+    catch (...) {
+        // Fallback wie sf::String(std::string): Bytes als Latin-1
+        std::vector<uint32_t> result;
+        for (unsigned char c : utf8String) result.push_back(c);
+        return result;
+    }
+}
+#if defined(__GNUC__)
+#pragma GCC diagnostic pop
+#endif
+
+std::string Repeat(const std::string& text, size_t targetBytes)
+{
+    std::string result;
+    result.reserve(targetBytes + text.size());
+    while (result.size() < targetBytes) result += text;
+    return result;
+}
+
+struct Corpus {
+    std::string name;
+    std::vector<std::string> lines; // wie im GUI: viele kurze Strings pro Frame
+};
+
+Corpus MakeCorpus(const std::string& name, const std::string& sample, size_t lineLength, size_t totalBytes)
+{
+    Corpus corpus{name, {}};
+    std::string text = Repeat(sample, totalBytes);
+    size_t pos = 0;
+    while (pos < text.size()) {
+        // An Zeichengrenzen schneiden, damit die Zeilen gültiges UTF-8 bleiben
+        size_t end = std::min(text.size(), pos + lineLength);
+        while (end < text.size() && (static_cast<unsigned char>(text[end]) & 0xC0) == 0x80) ++end;
+        corpus.lines.push_back(text.substr(pos, end - pos));
+        pos = end;
+    }
+    return corpus;
+}
+
+size_t CorpusBytes(const Corpus& corpus)
+{
+    size_t bytes = 0;
+    for (const auto& line : corpus.lines) bytes += line.size();
+    return bytes;
+}
+
+} // namespace
+
+bool RunUtf8Benchmarks(Runner& runner, std::string& error)
+{
+    std::vector<std::string> names;
+    for (const char* corpus : {"ascii", "deutsch", "gemischt", "ungueltig", "deutsch-gross"}) {
+        for (const char* variant : {"/legacy", "/decoder"}) names.push_back(std::string("micro/utf8/") + corpus + variant);
+    }
+    if (!runner.AnyEnabled(names)) return true;
+    const size_t corpusBytes = runner.Opts().quick ? (256u << 10) : (4u << 20);
+
+    const std::string german =
+        "Die Größe der Übersichtstabelle hängt von der Anzahl extrahierter Seiten ab; "
+        "Straßenverkehrsämter prüfen Änderungen öfter als gewöhnlich. ";
+    const std::string mixed =
+        "Extraktion 完成 – Привет мир, Ελληνικά κείμενα, עברית, 日本語のテキスト 🙂 café ";
+    const std::string ascii =
+        "The quick brown fox jumps over the lazy dog while extracting text from documents. ";
+    const std::string invalid = german + "\xC3\x28 defekt \xFF\xFE Latin-1: \xE4\xF6\xFC ";
+
+    std::vector<Corpus> corpora = {
+        MakeCorpus("ascii", ascii, 110, corpusBytes),
+        MakeCorpus("deutsch", german, 110, corpusBytes),
+        MakeCorpus("gemischt", mixed, 110, corpusBytes),
+        MakeCorpus("ungueltig", invalid, 110, corpusBytes),
+        MakeCorpus("deutsch-gross", german, 256 * 1024, corpusBytes),
+    };
+
+    // Korrektheit: auf gültigem Input müssen beide identisch sein
+    std::vector<uint32_t> buffer;
+    for (const auto& corpus : corpora) {
+        if (corpus.name == "ungueltig") continue;
+        for (const auto& line : corpus.lines) {
+            Services::Utf8Decoder::Decode(line.data(), line.size(), buffer);
+            if (buffer != LegacyConvert(line)) {
+                error = "Utf8Decoder weicht im Korpus " + corpus.name + " von std::wstring_convert ab";
+                return false;
+            }
+        }
+    }
+
+    for (const auto& corpus : corpora) {
+        size_t bytes = CorpusBytes(corpus);
+        runner.Measure("micro/utf8/" + corpus.name + "/legacy", bytes, [&] {
+            size_t total = 0;
+            for (const auto& line : corpus.lines) total += LegacyConvert(line).size();
+            return total;
+        });
+        runner.Measure("micro/utf8/" + corpus.name + "/decoder", bytes, [&] {
+            size_t total = 0;
+            for (const auto& line : corpus.lines) {
+                Services::Utf8Decoder::Decode(line.data(), line.size(), buffer);
+                total += buffer.size();
+            }
+            return total;
+        });
+    }
+    return true;
+}
+
+} // namespace Bench
@@ -9,4 +9,25 @@ struct Document {
     std::string content;
 };
 
+// Entspricht dem ExtractionOptions-DTO des Backends
+struct ExtractionOptions {
+    bool enableOCR = false;
+    std::string language = "de";
+    int maxPages = 0; // 0 = alle Seiten
+    bool preserveFormatting = false;
+};
+
+struct ExtractionResult {
+    bool success = false;
+    bool hasTextLayer = false; // false = gescanntes Dokument, nur per Server-OCR lesbar
+    int pageCount = 0;
+    int pagesExtracted = 0;
+    std::string text;
+    std::string method;
+    std::string error;
+    bool backendUnreachable = false; // Remote: keine Antwort vom Server (Netzwerkfehler)
+    int statusCode = 0;              // Remote: HTTP-Status der Antwort
+    bool extractedLocally = false;   // Router: im Client extrahiert, der Server hat dazu noch keinen Eintrag
+};
+
 } // namespace Core
@@ -0,0 +1,16 @@
+#pragma once
+
+#include "Entity.h"
+#include <string>
+
+namespace Core {
+
+// Serverseitige Extraktion eines bereits hochgeladenen Dokuments
+struct IRemoteExtractor {
+    virtual ~IRemoteExtractor() = default;
+    virtual ExtractionResult Extract(const std::string &fileId, const ExtractionOptions &options) = 0;
+    // Anzahl wartender/laufender Jobs auf dem Server, -1 = unbekannt bzw. nicht erreichbar
+    virtual int QueueDepth() = 0;
+};
+
+} // namespace Core
@@ -0,0 +1,15 @@
+#pragma once
+
+#include "Entity.h"
+#include <string>
+
+namespace Core {
+
+struct ITextExtractor {
+    virtual ~ITextExtractor() = default;
+    virtual bool CanHandle(const std::string &path) const = 0;
+    virtual ExtractionResult Extract(const std::string &path, const ExtractionOptions &options) = 0;
+    virtual bool HasTextLayer(const std::string &path, int probePages) = 0;
+};
+
+} // namespace Core
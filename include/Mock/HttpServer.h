@@ -0,0 +1,101 @@
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <functional>
+#include <map>
+#include <string>
+
+namespace Mock {
+
+/// <summary>
+/// Eingehender Request; Header-Namen kleingeschrieben, Query bereits URL-dekodiert
+/// </summary>
+struct HttpRequest {
+    uint64_t sequence = 0;     // Laufende Nummer seit Start
+    std::string method;
+    std::string path;          // Ohne Query, URL-dekodiert
+    std::map<std::string, std::string> query;
+    std::map<std::string, std::string> headers;
+    std::string body;
+
+    std::string Query(const std::string& key, const std::string& fallback = "") const;
+    std::string Header(const std::string& name) const;
+};
+
+/// <summary>
+/// Antwort des Handlers; mit stream wird der Body stückweise (chunked) erzeugt statt gepuffert
+/// stream hängt an chunk an und gibt false zurück wenn nichts mehr folgt
+/// </summary>
+struct HttpReply {
+    int status = 200;
+    std::string contentType = "application/json; charset=utf-8";
+    std::map<std::string, std::string> headers;
+    std::string body;
+    std::function<bool(std::string& chunk)> stream;
+};
+
+/// <summary>
+/// Simulierte Netzwerkbedingungen, gelten für jeden Request
+/// Zufallsentscheidungen hängen nur von seed und der Request-Nummer ab, eine gleiche
+/// Request-Folge ergibt also immer dieselben Fehler und Verzögerungen.
+/// </summary>
+struct NetworkProfile {
+    int latencyMs = 0;              // Feste Verzögerung vor der Antwort
+    int jitterMs = 0;               // Zusätzlich gleichverteilt 0..jitterMs
+    int64_t bandwidthBytes = 0;     // Bytes pro Sekunde je Verbindung, 0 = unbegrenzt
+    double errorRate = 0.0;         // Anteil Antworten mit 500 (Handler läuft dann nicht)
+    double dropRate = 0.0;          // Anteil Verbindungen, die ohne Antwort geschlossen werden
+    uint64_t seed = 1;
+};
+
+/// <summary>
+/// Minimaler HTTP/1.1-Server (POSIX-Sockets) für den Mock-Backend
+/// Ein Thread je Verbindung, Keep-Alive wird unterstützt. Gedacht für lokale Last- und
+/// Latenztests, nicht für den Betrieb im Netz.
+/// </summary>
+class HttpServer {
+public:
+    using Handler = std::function<HttpReply(const HttpRequest&)>;
+
+    HttpServer(Handler handler, NetworkProfile profile);
+    ~HttpServer();
+    HttpServer(const HttpServer&) = delete;
+    HttpServer& operator=(const HttpServer&) = delete;
+
+    /// <summary>
+    /// Bindet den Port (0 = freien Port wählen, siehe Port())
+    /// </summary>
+    bool Listen(const std::string& address, int port, std::string& error);
+    int Port() const { return port_; }
+
+    /// <summary>
+    /// Nimmt Verbindungen an bis Stop() aufgerufen wird
+    /// </summary>
+    void Run();
+    void Stop() { stop_ = true; }
+
+    uint64_t Requests() const { return sequence_.load(); }
+    void SetAccessLog(bool enabled) { accessLog_ = enabled; }
+
+    /// <summary>
+    /// Zufallswert in [0,1) für Request sequence und Kanal salt (deterministisch)
+    /// </summary>
+    static double Random(uint64_t seed, uint64_t sequence, uint64_t salt);
+
+private:
+    Handler handler_;
+    NetworkProfile profile_;
+    int listenFd_ = -1;
+    int port_ = 0;
+    bool accessLog_ = false;
+    std::atomic<bool> stop_{false};
+    std::atomic<uint64_t> sequence_{0};
+    std::atomic<int> connections_{0};
+
+    void Serve(int fd);
+    bool SendAll(int fd, const char* data, size_t size, bool throttle);
+    bool SendReply(int fd, const HttpRequest& request, HttpReply& reply, bool keepAlive);
+};
+
+} // namespace Mock
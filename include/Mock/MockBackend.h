@@ -0,0 +1,125 @@
+#pragma once
+
+#include "HttpServer.h"
+#include <cstdint>
+#include <ctime>
+#include <deque>
+#include <map>
+#include <mutex>
+#include <set>
+#include <string>
+#include <vector>
+
+namespace Mock {
+
+/// <summary>
+/// Umfang und Verhalten des simulierten Datenbestands
+/// </summary>
+struct DatasetOptions {
+    size_t documents = 1000;        // Vorhandene Dokumente (werden bei Bedarf erzeugt, nicht gespeichert)
+    size_t users = 20;
+    size_t textBytes = 2000;        // Mittlere Textlänge einer Extraktion
+    int extractedPercent = 90;      // Anteil der Dokumente mit fertiger Extraktion
+    int dbLatencyMs = 0;            // Zusätzliche Verzögerung für Endpunkte mit Datenbankzugriff
+    int extractionMs = 0;           // Dauer von POST Extraction/{id}
+    std::string password = "test"; // Passwort aller Benutzer
+    bool requireAuth = true;
+    uint64_t seed = 1;
+};
+
+/// <summary>
+/// Nachbildung der REST-API aus Swagger-Docs.json (User, Upload, Extraction, Admin, Logging,
+/// Diagnostics, Plugin, Seed) ohne Datenbank
+/// Die Dokumente 0..documents-1 werden aus ihrem Index und dem Seed berechnet, sodass auch
+/// 100k Dokumente kaum Speicher brauchen; nur Änderungen (Uploads, Extraktionen, Löschungen,
+/// Benutzer) werden gehalten. Jeder Request außer Logging/* erzeugt einen Logeintrag.
+/// </summary>
+class MockBackend {
+public:
+    explicit MockBackend(DatasetOptions options);
+
+    HttpReply Handle(const HttpRequest& request);
+
+    static std::string HashPassword(const std::string& password);
+
+private:
+    struct User {
+        int id = 0;
+        std::string username;
+        std::string email;
+        std::string role;
+        std::string passwordHash;
+        std::time_t createdAt = 0;
+        std::time_t lastLogin = 0;
+        bool active = true;
+    };
+
+    struct Document {
+        size_t index = 0;
+        std::string fileName;
+        uint64_t fileSize = 0;
+        std::string uploadedBy;
+        std::time_t uploadedAt = 0;
+        bool extracted = false;
+        std::string method;
+        std::time_t completedAt = 0;
+    };
+
+    struct LogEntry {
+        uint64_t id = 0;
+        std::string timestamp;
+        std::string level;
+        std::string category;
+        std::string message;
+    };
+
+    struct Extraction {
+        std::string method;
+        std::time_t completedAt = 0;
+    };
+
+    DatasetOptions options_;
+    std::time_t baseTime_ = 0;
+
+    mutable std::mutex mutex_;
+    std::vector<User> users_;
+    std::vector<Document> uploaded_;                 // Index ab options_.documents
+    std::set<size_t> deleted_;
+    std::map<size_t, Extraction> extractions_;       // Nachträglich extrahiert
+    std::deque<LogEntry> logs_;
+    uint64_t nextLogId_ = 1;
+    std::map<std::string, std::string> logLevels_;   // Kategorie -> Level
+    std::vector<std::string> plugins_;
+
+    // Routing
+    HttpReply Route(const HttpRequest& request, const std::vector<std::string>& parts, std::string& callerName);
+    HttpReply HandleUser(const HttpRequest& request, const std::vector<std::string>& parts);
+    HttpReply HandleUpload(const HttpRequest& request, const std::vector<std::string>& parts, const User& caller);
+    HttpReply HandleExtraction(const HttpRequest& request, const std::vector<std::string>& parts);
+    HttpReply HandleAdmin(const HttpRequest& request, const std::vector<std::string>& parts);
+    HttpReply HandleLogging(const HttpRequest& request, const std::vector<std::string>& parts);
+    HttpReply HandleDiagnostics(const HttpRequest& request, const std::vector<std::string>& parts);
+    HttpReply HandlePlugin(const HttpRequest& request, const std::vector<std::string>& parts);
+    HttpReply HandleSeed(const HttpRequest& request, const std::vector<std::string>& parts);
+
+    // Daten
+    void SeedUsers();
+    void SeedLogs();
+    bool Authenticate(const HttpRequest& request, User& caller) const;
+    size_t DocumentCount() const;
+    // Indizes vorhandener Dokumente, optional nur extrahierte bzw. eines Besitzers (ohne Strings zu erzeugen)
+    std::vector<size_t> SelectDocuments(bool extractedOnly, const std::string& owner) const;
+    bool FindDocument(size_t index, Document& document) const;
+    bool ParseDocumentId(const std::string& id, size_t& index) const;
+    std::string DocumentText(size_t index) const;
+    void Log(const std::string& level, const std::string& category, const std::string& message);
+
+    // JSON
+    std::string UserJson(const User& user) const;
+    std::string DocumentJson(const Document& document) const;
+    std::string ExtractionJson(const Document& document, bool withText) const;
+    std::string LogJson(const LogEntry& entry) const;
+    std::string StatisticsJson() const;
+};
+
+} // namespace Mock
@@ -1,17 +1,40 @@
 #pragma once
 
 #include "../ViewModel/MainViewModel.h"
+#include "../../UI/BatchRenderer.h"
+#include "../../UI/EventRouter.h"
+#include "../../UI/FrameOverlay.h"
 #include "../../UI/Sidebar.h"
+#include "../../UI/TextBatch.h"
+#include "../../UI/TextLayout.h"
+#include "../../Services/AdminTables.h"
 #include "../../Services/ApiService.h"
+#include "../../Services/DiagnosticsMonitor.h"
+#include "../../Services/FrameProfiler.h"
 #include "../../Services/LoginService.h"
+#include "../../Services/JsonUtil.h"
+#include "../../Services/LocalStore.h"
+#include "../../Services/LogTail.h"
+#include "../../Services/RemoteExtractor.h"
+#include "../../Services/ResultPrefetcher.h"
+#include "../../Services/SearchIndex.h"
+#include "../../Services/StatisticsPoller.h"
+#include "../../Services/SyncService.h"
+#include "../../Services/TableQuery.h"
+#include "../../Services/TextFinder.h"
+#include "../../Services/Tracer.h"
+#include "../../Services/UploadExtractPipeline.h"
+#include "../../Services/Utf8Decoder.h"
 #include <iostream>
 #include <memory>
+#include <optional>
 #include <sstream>
 #include <fstream>
-#include <codecvt>
-#include <locale>
 #include <thread>
 #include <chrono>
+#include <algorithm>
+#include <iomanip>
+#include <ctime>
 
 #ifdef USE_SFML
 #include <SFML/Graphics.hpp>
@@ -20,98 +43,32 @@
 using namespace Presentation::ViewModel;
 
 // UTF-8 zu UTF-32 Konvertierungsfunktion für SFML
+// Dekodiert direkt in einen wiederverwendbaren Puffer, ungültige Bytes werden zu U+FFFD
 inline sf::String ToSFMLString(const std::string& utf8String)
 {
-    std::wstring_convert<std::codecvt_utf8<char32_t>, char32_t> converter;
-    try {
-        std::u32string utf32 = converter.from_bytes(utf8String);
-        // Konvertiere std::u32string zu std::basic_string<sf::Uint32>
-        std::basic_string<sf::Uint32> sfUtf32(utf32.begin(), utf32.end());
-        return sf::String(sfUtf32);
-    }
-    catch (...) {
-        // Fallback bei Conversion-Fehler
-        return sf::String(utf8String);
-    }
+    thread_local std::basic_string<sf::Uint32> buffer;
+    buffer.resize(utf8String.size());
+    size_t count = Services::Utf8Decoder::Decode(utf8String.data(), utf8String.size(),
+                                                 reinterpret_cast<uint32_t*>(&buffer[0]));
+    buffer.resize(count);
+    return sf::String(buffer);
 }
 
-// Extrahiere "message" Feld aus JSON Response
-inline std::string ExtractMessageFromJSON(const std::string& json)
+// Texteingabe für UTF-8-Felder: Codepoint anhängen bzw. letztes ganzes Zeichen entfernen
+inline void AppendUtf8(std::string& text, sf::Uint32 codepoint)
 {
-    size_t pos = json.find("\"message\":");
-    if (pos == std::string::npos) {
-        return json; // Fallback: ganze Response wenn kein message Feld
-    }
-    
-    pos = json.find("\"", pos + 10);
-    if (pos == std::string::npos) return json;
-    
-    size_t end = json.find("\"", pos + 1);
-    if (end == std::string::npos) return json;
-    
-    return json.substr(pos + 1, end - pos - 1);
+    std::basic_string<sf::Uint8> utf8 = sf::String(codepoint).toUtf8();
+    text.append(utf8.begin(), utf8.end());
 }
 
-// Extrahiere Wert aus JSON String für ein bestimmtes Feld (String oder Zahl)
-inline std::string ExtractJsonField(const std::string& jsonStr, const std::string& field)
+inline void PopUtf8(std::string& text)
 {
-    size_t pos = jsonStr.find("\"" + field + "\":");
-    if (pos == std::string::npos) return "";
-    
-    pos += field.length() + 3; // Springe über ":
-    
-    // Überspringe Whitespace
-    while (pos < jsonStr.length() && (jsonStr[pos] == ' ' || jsonStr[pos] == '\t')) {
-        pos++;
-    }
-    
-    // Check ob String (mit Anführungszeichen) oder Zahl
-    if (jsonStr[pos] == '"') {
-        // String-Wert
-        pos++;
-        size_t end = jsonStr.find("\"", pos);
-        if (end == std::string::npos) return "";
-        return jsonStr.substr(pos, end - pos);
-    } else {
-        // Numerischer Wert - lese bis zur nächsten Komma oder Klammer
-        size_t end = pos;
-        while (end < jsonStr.length() && jsonStr[end] != ',' && jsonStr[end] != '}' && jsonStr[end] != ']') {
-            end++;
-        }
-        std::string numStr = jsonStr.substr(pos, end - pos);
-        // Entferne Whitespace
-        size_t lastNonSpace = numStr.find_last_not_of(" \t");
-        if (lastNonSpace != std::string::npos) {
-            return numStr.substr(0, lastNonSpace + 1);
-        }
-        return numStr;
-    }
+    while (!text.empty() && (static_cast<unsigned char>(text.back()) & 0xC0) == 0x80) text.pop_back();
+    if (!text.empty()) text.pop_back();
 }
 
-// Text Wrapping für lange Nachrichten
-inline std::vector<std::string> WrapText(const std::string& text, size_t maxCharsPerLine = 60)
-{
-    std::vector<std::string> lines;
-    std::string currentLine;
-    std::istringstream stream(text);
-    std::string word;
-    
-    while (stream >> word) {
-        if ((currentLine + word).length() > maxCharsPerLine && !currentLine.empty()) {
-            lines.push_back(currentLine);
-            currentLine = word;
-        } else {
-            if (!currentLine.empty()) currentLine += " ";
-            currentLine += word;
-        }
-    }
-    
-    if (!currentLine.empty()) {
-        lines.push_back(currentLine);
-    }
-    
-    return lines;
-}
+using Services::ExtractMessageFromJSON;
+using Services::ExtractJsonField;
 
 void RunGui(Presentation::ViewModel::MainViewModel &vm)
 {
@@ -131,6 +88,8 @@ void RunGui(Presentation::ViewModel::MainViewModel &vm)
     
     // Initialize UI
     auto sidebar = std::make_unique<UI::Sidebar>(font, 250.f, 700.f);
+    // Gemeinsamer Batch für Sidebar, Kopfzeile und Listen; Puffer werden über Frames wiederverwendet
+    UI::BatchRenderer batch;
     
     // Add menu items to ribbons
     /*
@@ -162,6 +121,15 @@ void RunGui(Presentation::ViewModel::MainViewModel &vm)
     bool isUploading = false;
     bool showUploadSuccess = false;
     bool uploadButtonPressed = false; // Verhindert mehrfache Uploads beim Halten des Buttons
+    std::vector<std::string> selectedFilePaths;  // Mehrfachauswahl, selectedFilePath ist die erste Datei
+
+    // Hochladen + Extrahieren in einem Schritt: Datei N+1 lädt hoch, während Datei N extrahiert wird
+    Services::PipelineOptions uploadPipelineOptions;
+    uploadPipelineOptions.extraction.maxPages = 5;
+    Services::UploadExtractPipeline uploadPipeline(uploadPipelineOptions);
+    uint64_t uploadPipelineVersion = 0;
+    std::vector<Services::PipelineItem> uploadPipelineRows;       // Statusliste, nur bei neuer Version kopiert
+    std::vector<Services::PipelineItem> uploadPipelineCompleted;
     
     // Extraction State
     std::string extractionSelectedFileId = "";
@@ -170,6 +138,7 @@ void RunGui(Presentation::ViewModel::MainViewModel &vm)
     std::string extractionSelectedUploadDate = "";
     bool showExtractionDetail = false;
     std::string extractedText = "";
+    uint64_t extractedTextVersion = 0;  // Bei jeder Änderung von extractedText hochzählen, das Layout vergleicht nur die Version
     bool documentsLoaded = false;
     bool loadingDocuments = false;
     std::vector<std::pair<std::string, std::string>> myDocuments;  // fileId, fileName
@@ -178,29 +147,183 @@ void RunGui(Presentation::ViewModel::MainViewModel &vm)
     bool extractionCompleted = false;
     std::string extractionMethod = "";
     std::string completedAt = "";
+    bool extractionLocalOnly = false;  // Lokal extrahiert, der Server führt das Dokument noch nicht als extrahiert
+    bool extractionLoading = false;    // Ergebnis wird im Hintergrund geladen (resultPrefetcher.Request)
     float textScrollOffset = 0.f;  // Für scrollbare Text-Box
+    UI::TextLayout extractedLayout;  // Umbruch nach Glyphenbreiten, wird nur bei Text-/Breitenänderung neu berechnet
+    extractedLayout.SetAdvanceFunction(UI::MakeFontAdvance(font, 11u), 11u);
+    UI::TextBatch extractedBatch(font, 11u, 18.f);  // Glyphen der sichtbaren Zeilen, ein Draw-Call
+    UI::TextLayout uploadMessageLayout;
+    std::string uploadMessage;  // Angezeigter Text von uploadMessageLayout (das Layout kopiert ihn nicht)
+    uint64_t uploadMessageVersion = 0;
+    uploadMessageLayout.SetAdvanceFunction(UI::MakeFontAdvance(font, 12u), 12u);
     bool isDraggingScrollBar = false;
     float maxScrollOffset = 0.f;
+
+    // Lokaler Speicher pro Backend und Konto: Dokumentenliste und Extraktionen der letzten Sitzungen sofort verfügbar
+    Services::LocalStore localStore;
+    auto openLocalStore = [&]() {
+        localStore.Close();
+        myDocuments.clear();
+        documentsLoaded = false;
+        if (!Services::LoginService::IsLoggedIn()) return;
+        std::string path = Services::LocalStore::DefaultPath(Services::ApiService::GetApiUrl(),
+                                                             Services::LoginService::GetUsername());
+        if (localStore.Open(path)) {
+            localStore.ForEach(Services::StoreKind::Document, [&](std::string_view fileId, std::string_view json) {
+                myDocuments.push_back({std::string(fileId), ExtractJsonField(std::string(json), "fileName")});
+            });
+        }
+    };
+    openLocalStore();
+
+    // Offline-Modus: Schreiboperationen ohne Verbindung ins Journal, Sync im Hintergrund
+    Services::OfflineJournal offlineJournal;
+    offlineJournal.Open(Services::OfflineJournal::DefaultPath());
+    Services::SyncService syncService(offlineJournal);
+    syncService.Start();
+    bool wasOnline = true;
+    bool showConflicts = false;
+    uint64_t journalVersion = offlineJournal.Version();
+    std::vector<Services::SyncConflict> syncConflicts = offlineJournal.Conflicts();  // Nur bei neuer Journal-Version neu gelesen
+
+    // Laufende Latenzmessung (ping, Datenbank, Worker), nur solange die Einstellungen offen sind
+    Services::DiagnosticsMonitor diagnosticsMonitor;
+    diagnosticsMonitor.SetActive(false);
+    diagnosticsMonitor.Start(1000);
+    uint64_t diagnosticsVersion = 0;
+    std::vector<sf::VertexArray> diagnosticsSparklines;
+    std::vector<std::string> diagnosticsLines;
+
+    // Frame-Profiler: F12 blendet die Auswertung ein, F11 schreibt den Puffer als JSON auf die Platte
+    Services::FrameProfiler frameProfiler;
+    Services::FrameProfiler::SetCurrent(&frameProfiler);
+    UI::FrameOverlay frameOverlay(font);
+
+    // Trace-Aufzeichnung: TEF_TRACE=<Datei> bzw. 1 zeichnet ab Start auf, F10 startet/beendet eine Aufzeichnung
+    Services::Tracer::SetThreadName("GUI");
+    std::string tracePath;
+    if (Services::Tracer::StartFromEnvironment(tracePath)) {
+        std::cout << "Trace-Aufzeichnung aktiv, Ziel: " << tracePath << std::endl;
+    }
+    auto writeTrace = [&](const std::string& path) {
+        std::string traceError;
+        if (Services::Tracer::Write(path, traceError)) {
+            std::cout << "Trace gespeichert: " << path << " (" << Services::Tracer::EventCount() << " Ereignisse)" << std::endl;
+            frameOverlay.SetMessage("Trace gespeichert: " + path);
+        } else {
+            std::cout << "Trace: " << traceError << std::endl;
+            frameOverlay.SetMessage(traceError);
+        }
+    };
+    const int profEvents = Services::FrameProfiler::RegisterSection("Events");
+    const int profSidebar = Services::FrameProfiler::RegisterSection("Sidebar");
+    const int profHeader = Services::FrameProfiler::RegisterSection("Kopfzeile/Status");
+    const int profTabs[6] = {
+        Services::FrameProfiler::RegisterSection("Tab Home"),
+        Services::FrameProfiler::RegisterSection("Tab Upload"),
+        Services::FrameProfiler::RegisterSection("Tab Extraktion"),
+        Services::FrameProfiler::RegisterSection("Tab Admin"),
+        Services::FrameProfiler::RegisterSection("Tab Einstellungen"),
+        Services::FrameProfiler::RegisterSection("Tab Profil")};
+    const int profWrap = Services::FrameProfiler::RegisterSection("Textumbruch");
+    const int profOverlays = Services::FrameProfiler::RegisterSection("Overlays");
+    const int profDisplay = Services::FrameProfiler::RegisterSection("display()");
+
+    // Extraktion + Metadaten (Methode, Zeitpunkt) ablegen, danach ggf. im Hintergrund kompaktieren
+    auto storeExtractionFor = [&](const std::string& fileId, const std::string& text, const std::string& method,
+                                  const std::string& completed) {
+        if (!localStore.IsOpen() || fileId.empty()) return;
+        localStore.Put(Services::StoreKind::Extraction, fileId, text);
+        localStore.Put(Services::StoreKind::Meta, "extraction/" + fileId, method + "\n" + completed);
+        if (localStore.NeedsCompaction()) localStore.CompactAsync();
+    };
+    auto storeExtraction = [&]() {
+        if (!extractionCompleted) return;
+        storeExtractionFor(extractionSelectedFileId, extractedText, extractionMethod, completedAt);
+    };
+
+    // Volltextsuche über bereits geladene Extraktionen (lokaler Index)
+    Services::SearchIndex searchIndex;
+    searchIndex.Open(Services::SearchIndex::DefaultPath());
+    std::string searchQuery = "";
+    std::string lastSearchQuery = "";
+    bool searchFocused = false;
+    bool searchDirty = false;
+    std::vector<Services::SearchHit> searchResults;
+    std::string searchStatus = "";
+
+    // Vorabruf der Ergebnisse: Zeile unter der Maus zuerst, dann die übrigen sichtbaren Zeilen
+    Services::ResultPrefetcher resultPrefetcher;
+    std::vector<size_t> prefetchRows;       // Pro Frame neu gefüllt, Puffer bleibt
+    std::vector<std::string> prefetchIds;   // Zuletzt gemeldet
+    auto reportPrefetchRows = [&](const auto& idAt) {
+        // Nur bei geänderter Auswahl melden, sonst startet die Wartezeit jeden Frame neu
+        bool changed = prefetchIds.size() != prefetchRows.size();
+        for (size_t k = 0; !changed && k < prefetchRows.size(); ++k) changed = prefetchIds[k] != idAt(prefetchRows[k]);
+        if (!changed) return;
+        prefetchIds.clear();
+        for (size_t row : prefetchRows) prefetchIds.push_back(idAt(row));
+        resultPrefetcher.SetWanted(prefetchIds);
+    };
+
+    // Suche im Dokumenttext der Detailansicht (Worker-Thread)
+    Services::TextFinder textFinder;
+    std::shared_ptr<const std::string> findSnapshot;  // Kopie des Textes für den Worker, nur bei aktiver Suche
+    std::string findQuery = "";
+    bool findFocused = false;
+    bool findDirty = false;
+    bool findScrollPending = false;
+    std::vector<size_t> findHits;  // Byte-Offsets in extractedText
+    size_t findHitLength = 0;
+    size_t findCurrent = 0;
+    bool findTruncated = false;
+    double findMs = 0.0;
+
+    // Neue/geänderte Texte indizieren; gespeichert wird erst im Leerlauf oder beim Beenden,
+    // denn Save() kompaktiert den ganzen Index und würde den Frame blockieren
+    auto lastInputAt = std::chrono::steady_clock::now();
+    auto lastIndexChangeAt = lastInputAt;
+    auto indexExtractionFor = [&](const std::string& fileId, const std::string& fileName, const std::string& text) {
+        if (fileId.empty() || text.empty()) return;
+        if (searchIndex.AddDocument(fileId, fileName, text)) {
+            searchDirty = true; // Ergebnisse beim nächsten Frame neu berechnen
+            lastIndexChangeAt = std::chrono::steady_clock::now();
+        }
+    };
+    auto indexExtractedText = [&]() {
+        if (!extractionCompleted) return;
+        indexExtractionFor(extractionSelectedFileId, extractionSelectedFileName, extractedText);
+    };
     
     // Admin Page State
-    int adminSubTab = 0;  // 0 = Statistiken, 1 = Benutzer, 2 = Dokumente, 3 = Extraktionen
+    int adminSubTab = 0;  // 0 = Statistiken, 1 = Benutzer, 2 = Dokumente, 3 = Extraktionen, 4 = Logs
     
-    // Statistics State
-    std::string statisticsData = "";
-    bool statisticsLoaded = false;
-    bool loadingStatistics = false;
+    // Statistics State (Abfrage im Hintergrund, Texte nur bei neuer Snapshot-Version neu aufbauen)
+    Services::StatisticsPoller statisticsPoller;
+    const int statisticsIntervals[] = {5, 10, 30, 60};
+    int statisticsIntervalIndex = 1;
+    uint64_t statisticsVersion = 0;
+    std::string statsUsersLine;
+    std::string statsDocsLine;
+    std::string statsExtrLine;
+    std::string statsStatusLine;
+    std::vector<std::string> statsActivityLines;
+    
+    // Logs State (Ringpuffer im LogTail, gezeichnet werden nur die sichtbaren Zeilen)
+    Services::LogTail logTail;
+    uint16_t logLevelFilter = 0;
+    uint16_t logCategoryFilter = 0;
+    bool logFollow = true;
+    size_t logFirstRow = 0;
+    size_t logMatches = 0;
+    uint64_t logViewVersion = 0;
+    bool logViewDirty = true;
+    std::vector<Services::LogRecord> logRows;
     
     // Users State
-    struct UserInfo {
-        std::string userId;
-        std::string username;
-        std::string email;
-        std::string role;
-        std::string createdAt;
-        std::string lastLogin;
-        bool isActive;
-    };
-    std::vector<UserInfo> adminUsers;
+    // Admin-Tabellen spaltenweise, wiederkehrende Werte (Rolle, Methode, Benutzer) interniert
+    Services::UserTable adminUsers;
     bool usersLoaded = false;
     bool loadingUsers = false;
     bool showCreateUserForm = false;
@@ -218,29 +341,34 @@ void RunGui(Presentation::ViewModel::MainViewModel &vm)
     bool passwordFocusedForm = false;
     
     // Documents State
-    struct DocumentInfo {
-        std::string fileId;
-        std::string fileName;
-        std::string uploadedBy;
-        std::string uploadedAt;
-        std::string fileSize;
-    };
-    std::vector<DocumentInfo> adminDocuments;
+    std::shared_ptr<Services::DocumentTable> adminDocuments = std::make_shared<Services::DocumentTable>();
     bool adminDocsLoaded = false;
     bool adminDocsLoading = false;
     
     // Extractions State
-    struct ExtractionInfo {
-        std::string extractionId;
-        std::string fileName;
-        std::string extractionMethod;
-        std::string completedAt;
-        std::string status;
-        std::string uploadedBy;
-    };
-    std::vector<ExtractionInfo> adminExtractions;
+    std::shared_ptr<Services::ExtractionTable> adminExtractions = std::make_shared<Services::ExtractionTable>();
     bool adminExtrsLoaded = false;
     bool adminExtrsLoading = false;
+
+    // Sortierung, Filter und Gruppierung der Admin-Listen; die Permutation berechnet ein Worker
+    struct AdminListState {
+        Services::TableQuery query;
+        Services::TableQuerySpec spec;
+        Services::TableQueryResult view;
+        bool dirty = true;          // Tabelle oder spec geändert: Abfrage neu starten
+        bool hasView = false;
+        size_t firstRow = 0;        // Erste sichtbare Anzeigezeile
+        bool filterFocused = false;
+    };
+    AdminListState adminDocsList;
+    AdminListState adminExtrsList;
+    AdminListState* adminLists[] = {&adminDocsList, &adminExtrsList};
+    const size_t adminListRows = 7;
+    const Services::TableColumn adminListColumns[2][4] = {
+        {Services::TableColumn::Name, Services::TableColumn::User, Services::TableColumn::Date, Services::TableColumn::Size},
+        {Services::TableColumn::Name, Services::TableColumn::Method, Services::TableColumn::Date, Services::TableColumn::Status}};
+    const char* const adminListLabels[2][4] = {{"Name", "Benutzer", "Datum", "Größe"},
+                                               {"Name", "Methode", "Datum", "Status"}};
     
     // Login State
     std::string loginUsername = "";
@@ -277,13 +405,288 @@ void RunGui(Presentation::ViewModel::MainViewModel &vm)
         sidebar->setRibbonVisible(5, true);       // Profil - immer sichtbar
     };
     updateRibbonVisibility(); // Initial setzen
-    
+
+    // Zeigt die Antwort von Extraction/result/{id} an; statusCode 0 = Server nicht erreichbar, dann lokale Kopie
+    auto applyExtractionResult = [&](const Services::HttpResponse& resp) {
+        const std::string& fileId = extractionSelectedFileId;
+        if (resp.isSuccess && !resp.body.empty()) {
+            // Parse JSON Response
+            extractedText = ExtractJsonField(resp.body, "extractedText");
+            ++extractedTextVersion;
+            extractionMethod = ExtractJsonField(resp.body, "extractionMethod");
+            completedAt = ExtractJsonField(resp.body, "completedAt");
+            
+            if (!extractedText.empty()) {
+                extractionStatus = "Vorhandene Extraktion geladen";
+                extractionCompleted = true;
+                indexExtractedText();
+                storeExtraction();
+                std::cout << "Vorhandene Extraktion geladen für: " << extractionSelectedFileName << std::endl;
+                std::cout << "ExtractionMethod: " << extractionMethod << std::endl;
+                std::cout << "CompletedAt: " << completedAt << std::endl;
+            } else {
+                extractionStatus = "Keine Extraktion vorhanden";
+                extractionCompleted = false;
+            }
+        } else if (resp.statusCode == 0 && localStore.Get(Services::StoreKind::Extraction, fileId)) {
+            // Server nicht erreichbar: lokale Kopie anzeigen
+            extractedText = std::string(*localStore.Get(Services::StoreKind::Extraction, fileId));
+            ++extractedTextVersion;
+            if (auto stored = localStore.Get(Services::StoreKind::Meta, "extraction/" + fileId)) {
+                std::string_view meta = stored->View();
+                size_t split = meta.find('\n');
+                extractionMethod = std::string(meta.substr(0, split));
+                completedAt = split == std::string_view::npos ? "" : std::string(meta.substr(split + 1));
+            }
+            extractionStatus = "Offline - lokale Kopie";
+            extractionCompleted = !extractedText.empty();
+            std::cout << "Server nicht erreichbar, lokale Extraktion geladen für: " << extractionSelectedFileName << std::endl;
+        } else {
+            extractedText = "";
+            ++extractedTextVersion;
+            extractionStatus = "";
+            extractionCompleted = false;
+            std::cout << "Keine vorhandene Extraktion für: " << extractionSelectedFileName << " (Status: " << resp.statusCode << ")" << std::endl;
+        }
+        
+        std::cout << "Extraction Detail für: " << extractionSelectedFileName << " (ID: " << extractionSelectedFileId << ")" << std::endl;
+    };
+
+    // Öffnet die Detailansicht und lädt eine vorhandene Extraktion (Dokumentenliste + Suchergebnisse)
+    auto openExtractionDetail = [&](const std::string& fileId, const std::string& fileName) {
+        extractionSelectedFileId = fileId;
+        extractionSelectedFileName = fileName;
+        extractionLocalOnly = false;
+        extractionLoading = false;
+        extractionSelectedFileSize = "";
+        extractionSelectedUploadDate = "";
+        extractedText = "";
+        ++extractedTextVersion;
+        extractionStatus = "";
+        extractionCompleted = false;
+        extractionMethod = "";
+        completedAt = "";
+        textScrollOffset = 0.f;
+        showExtractionDetail = true;
+        
+        // Vorgeladen: sofort anzeigen; sonst im Hintergrund laden, ohne die GUI anzuhalten
+        // Offline direkt aus dem lokalen Speicher lesen statt auf den Timeout zu warten
+        Services::HttpResponse resp;
+        if (resultPrefetcher.Take(fileId, resp)) {
+            std::cout << "Extraktion aus Vorabruf: " << fileName << std::endl;
+        } else if (syncService.IsOnline()) {
+            if (!resultPrefetcher.IsRunning()) resultPrefetcher.Start();
+            resultPrefetcher.Request(fileId);
+            extractionLoading = true;
+            extractionStatus = "Lade Extraktion...";
+            return;
+        }
+        applyExtractionResult(resp);
+    };
+
+    // Klickbare Bereiche werden beim Zeichnen registriert und beim nächsten pollEvent verteilt;
+    // die Handler bekommen den Zeilenindex aus AddRegion
+    UI::EventRouter router(static_cast<float>(window.getSize().x), static_cast<float>(window.getSize().y));
+    const size_t openDocumentHandler = router.AddHandler([&](size_t i) {
+        if (i < myDocuments.size()) openExtractionDetail(myDocuments[i].first, myDocuments[i].second);
+    });
+    const size_t openSearchHitHandler = router.AddHandler([&](size_t i) {
+        if (i < searchResults.size()) openExtractionDetail(searchResults[i].docId, searchResults[i].name);
+    });
+    const size_t adminSubTabHandler = router.AddHandler([&](size_t i) {
+        adminSubTab = static_cast<int>(i);
+    });
+    const size_t toggleUserHandler = router.AddHandler([&](size_t i) {
+        if (i >= adminUsers.Size()) return;
+        std::string userId(adminUsers.UserId(i));
+        std::string endpoint = adminUsers.IsActive(i) ?
+            "Admin/users/" + userId + "/deactivate" :
+            "Admin/users/" + userId + "/activate";
+        std::cout << "DEBUG: Toggle user - endpoint: " << endpoint << ", userId: [" << userId << "]" << std::endl;
+        std::string toggleText = (adminUsers.IsActive(i) ? "Benutzer deaktivieren: " : "Benutzer aktivieren: ") +
+                                 std::string(adminUsers.Username(i));
+        Services::HttpResponse resp = syncService.Submit("POST", endpoint, "{}", toggleText);
+        std::cout << "DEBUG: Response - status: " << resp.statusCode << ", success: " << resp.isSuccess << std::endl;
+        if (resp.isSuccess || resp.queued) {
+            adminUsers.SetActive(i, !adminUsers.IsActive(i));
+        }
+    });
+    const size_t editUserHandler = router.AddHandler([&](size_t i) {
+        if (i >= adminUsers.Size()) return;
+        showEditUserForm = true;
+        editUsername = std::string(adminUsers.Username(i));
+        editUserId = std::string(adminUsers.UserId(i));
+        newEmail = std::string(adminUsers.Email(i));
+        newRole = adminUsers.Role(i);
+        newPassword = "";
+        userFormMessage = "";
+    });
+    const size_t createUserHandler = router.AddHandler([&](size_t) {
+        showCreateUserForm = true;
+    });
+    // Lokales Ergebnis nur auf ausdrücklichen Wunsch auf dem Server nachziehen (der Server extrahiert selbst,
+    // die API nimmt keinen Text vom Client an); offline landet der Auftrag im Journal
+    const size_t serverExtractionHandler = router.AddHandler([&](size_t) {
+        Core::ExtractionOptions options;
+        options.maxPages = 5;
+        Services::HttpResponse resp = syncService.Submit("POST", "Extraction/" + extractionSelectedFileId,
+                                                         Services::RemoteExtractor::BuildOptionsJson(options),
+                                                         "Server-Extraktion: " + extractionSelectedFileName);
+        if (resp.isSuccess || resp.queued) {
+            extractionLocalOnly = false;
+            extractionStatus = resp.queued ? "Offline gespeichert - Server-Extraktion startet bei Verbindung"
+                                           : "Server-Extraktion angestoßen";
+        } else {
+            extractionStatus = "Server-Extraktion fehlgeschlagen: " + ExtractMessageFromJSON(resp.body);
+        }
+    });
+    const size_t conflictBadgeHandler = router.AddHandler([&](size_t) {
+        showConflicts = !showConflicts;
+    });
+    const size_t conflictDismissHandler = router.AddHandler([&](size_t) {
+        offlineJournal.ClearConflicts();
+        syncConflicts.clear();
+        showConflicts = false;
+    });
+    const size_t statisticsIntervalHandler = router.AddHandler([&](size_t) {
+        statisticsIntervalIndex = (statisticsIntervalIndex + 1) % 4;
+        statisticsPoller.SetInterval(statisticsIntervals[statisticsIntervalIndex]);
+    });
+    const size_t statisticsRefreshHandler = router.AddHandler([&](size_t) {
+        statisticsPoller.RefreshNow();
+    });
+    const size_t logButtonHandler = router.AddHandler([&](size_t b) {
+        // Filter: Level und Kategorie zyklisch durchschalten (0 = alle)
+        auto nextFilter = [](const std::vector<uint16_t>& ids, uint16_t current) -> uint16_t {
+            if (ids.empty()) return 0;
+            auto it = std::find(ids.begin(), ids.end(), current);
+            if (current == 0) return ids.front();
+            if (it == ids.end() || it + 1 == ids.end()) return 0;
+            return *(it + 1);
+        };
+        if (b == 0) logLevelFilter = nextFilter(logTail.Levels(), logLevelFilter);
+        if (b == 1) logCategoryFilter = nextFilter(logTail.Categories(), logCategoryFilter);
+        if (b == 2) logFollow = !logFollow;
+        if (b == 3) logTail.Clear();
+        logViewDirty = true;
+    });
+    // Admin-Listen: index = Liste (0 = Dokumente, 1 = Extraktionen) * 4 + Spalte
+    const size_t adminSortHandler = router.AddHandler([&](size_t i) {
+        Services::TableQuerySpec& spec = adminLists[i / 4]->spec;
+        Services::TableColumn column = adminListColumns[i / 4][i % 4];
+        // Wiederholte Klicks: aufsteigend, absteigend, Serverreihenfolge
+        if (!spec.sorted || spec.column != column) {
+            spec.sorted = true;
+            spec.column = column;
+            spec.descending = false;
+        } else if (!spec.descending) {
+            spec.descending = true;
+        } else {
+            spec.sorted = false;
+        }
+        adminLists[i / 4]->dirty = true;
+        adminLists[i / 4]->firstRow = 0;
+    });
+    const size_t adminGroupHandler = router.AddHandler([&](size_t i) {
+        adminLists[i]->spec.groupByUser = !adminLists[i]->spec.groupByUser;
+        adminLists[i]->dirty = true;
+        adminLists[i]->firstRow = 0;
+    });
+    const size_t adminFilterHandler = router.AddHandler([&](size_t i) {
+        adminLists[i]->filterFocused = true;
+    });
+
+    // Neue Abfrage starten wenn nötig und fertige Sicht übernehmen; bis dahin bleibt die alte stehen
+    auto refreshAdminList = [&](AdminListState& list, const auto& table) {
+        if (list.dirty && !table->Empty()) {
+            list.query.Start(table, list.spec);
+            list.dirty = false;
+        }
+        if (list.query.TakeResult(list.view)) {
+            list.hasView = true;
+            size_t maxFirst = list.view.DisplayRows() > adminListRows ? list.view.DisplayRows() - adminListRows : 0;
+            list.firstRow = std::min(list.firstRow, maxFirst);
+        }
+    };
+
+    // Filterfeld, Sortier-Buttons, Gruppierung und Statuszeile einer Admin-Liste
+    auto drawAdminListControls = [&](size_t listIndex, float sidebarWidth) {
+        AdminListState& list = *adminLists[listIndex];
+        const float x = sidebarWidth;
+        batch.AddRect(sf::FloatRect(x + 240.f, 130.f, 180.f, 26.f), sf::Color::White,
+                      list.filterFocused ? sf::Color(70, 130, 180) : sf::Color(180, 180, 180), list.filterFocused ? 2.f : 1.f);
+        bool placeholder = list.spec.filter.empty() && !list.filterFocused;
+        batch.AddText(placeholder ? ToSFMLString("Filter (Name, Präfix*)") : ToSFMLString(list.spec.filter + (list.filterFocused ? "|" : "")),
+                      font, 12u, sf::Vector2f(x + 248.f, 135.f), placeholder ? sf::Color(150, 150, 150) : sf::Color::Black);
+        router.AddRegion(sf::FloatRect(x + 240.f, 130.f, 180.f, 26.f), adminFilterHandler, listIndex);
+
+        for (size_t b = 0; b < 4; ++b) {
+            bool active = list.spec.sorted && list.spec.column == adminListColumns[listIndex][b];
+            float bx = x + 430.f + b * 85.f;
+            batch.AddRect(sf::FloatRect(bx, 130.f, 80.f, 26.f), active ? sf::Color(70, 130, 180) : sf::Color(200, 200, 200));
+            std::string label = std::string(adminListLabels[listIndex][b]) + (active ? (list.spec.descending ? " v" : " ^") : "");
+            batch.AddText(ToSFMLString(label), font, 12u, sf::Vector2f(bx + 8.f, 135.f), active ? sf::Color::White : sf::Color::Black);
+            router.AddRegion(sf::FloatRect(bx, 130.f, 80.f, 26.f), adminSortHandler, listIndex * 4 + b);
+        }
+
+        bool grouped = list.spec.groupByUser;
+        batch.AddRect(sf::FloatRect(x + 775.f, 130.f, 145.f, 26.f), grouped ? sf::Color(70, 130, 180) : sf::Color(200, 200, 200));
+        batch.AddText(ToSFMLString("Nach Benutzer"), font, 12u, sf::Vector2f(x + 783.f, 135.f), grouped ? sf::Color::White : sf::Color::Black);
+        router.AddRegion(sf::FloatRect(x + 775.f, 130.f, 145.f, 26.f), adminGroupHandler, listIndex);
+
+        if (list.hasView) {
+            std::ostringstream status;
+            status << list.view.rows.size() << " von " << list.view.totalRows << " Zeilen";
+            if (list.view.DisplayRows() > adminListRows) {
+                status << ", " << list.firstRow + 1 << "-" << std::min(list.firstRow + adminListRows, list.view.DisplayRows())
+                       << " angezeigt (Mausrad)";
+            }
+            status << ", " << std::fixed << std::setprecision(1) << list.view.elapsedMs << " ms";
+            if (list.query.IsRunning()) status << ", wird aktualisiert...";
+            batch.AddText(ToSFMLString(status.str()), font, 11u, sf::Vector2f(x + 20.f, 675.f), sf::Color(100, 100, 100));
+        }
+    };
+
+    auto drawAdminGroupHeader = [&](const Services::TableGroup& group, const char* noun, float sidebarWidth, float itemY) {
+        batch.AddRect(sf::FloatRect(sidebarWidth + 25.f, itemY, 890.f, 70.f), sf::Color(225, 235, 245), sf::Color(200, 200, 200));
+        std::string user = group.user.empty() ? "(ohne Benutzer)" : group.user;
+        batch.AddText(ToSFMLString(user + "  -  " + std::to_string(group.count) + " " + noun), font, 14u,
+                      sf::Vector2f(sidebarWidth + 35.f, itemY + 24.f), sf::Color(50, 80, 120));
+    };
+
     while (window.isOpen()) {
+        frameProfiler.BeginFrame();
         float sidebarWidth = sidebar->getWidth();
         
         sf::Event event;
+        std::optional<Services::FrameProfiler::Scope> eventScope(std::in_place, profEvents);
         while (window.pollEvent(event)) {
+            lastInputAt = std::chrono::steady_clock::now();
             if (event.type == sf::Event::Closed) window.close();
+
+            if (event.type == sf::Event::KeyPressed && event.key.code == sf::Keyboard::F12) {
+                frameOverlay.Toggle();
+            } else if (event.type == sf::Event::KeyPressed && event.key.code == sf::Keyboard::F11) {
+                std::string dumpPath = Services::FrameProfiler::DefaultDumpPath();
+                std::string dumpError;
+                if (frameProfiler.Dump(dumpPath, dumpError)) {
+                    std::cout << "Frame-Profil gespeichert: " << dumpPath << std::endl;
+                    frameOverlay.SetMessage("Gespeichert: " + dumpPath);
+                } else {
+                    std::cout << "Frame-Profil: " << dumpError << std::endl;
+                    frameOverlay.SetMessage(dumpError);
+                }
+            } else if (event.type == sf::Event::KeyPressed && event.key.code == sf::Keyboard::F10) {
+                if (Services::Tracer::IsEnabled()) {
+                    Services::Tracer::Stop();
+                    writeTrace(tracePath.empty() ? Services::Tracer::DefaultPath() : tracePath);
+                    tracePath.clear();
+                } else {
+                    Services::Tracer::Start();
+                    std::cout << "Trace-Aufzeichnung gestartet (F10 beendet)" << std::endl;
+                    frameOverlay.SetMessage("Trace läuft (F10 beendet)");
+                }
+            }
             
             // Pass events to UI
             sidebar->handleEvent(event);
@@ -294,8 +697,10 @@ void RunGui(Presentation::ViewModel::MainViewModel &vm)
                     urlInput.pop_back();
                 } else if (event.text.unicode == 13) { // Enter
                     Services::ApiService::SetApiUrl(urlInput);
-                    apiUrl = urlInput;
+                    apiUrl = Services::ApiService::GetApiUrl(); // Mehrere Knoten normalisiert ("a, b")
                     showApiUrlInput = false;
+                    openLocalStore(); // Anderes Backend, anderer Speicher
+                    diagnosticsMonitor.Reset(); // Messungen des alten Servers verwerfen
                 } else if (event.text.unicode == 27) { // Escape
                     showApiUrlInput = false;
                     urlInput = apiUrl;
@@ -304,6 +709,45 @@ void RunGui(Presentation::ViewModel::MainViewModel &vm)
                 }
             }
             
+            // Suchfeld der Dokumentenliste (UTF-8, Umlaute erlaubt)
+            if (activeTab == 2 && !showExtractionDetail && searchFocused && event.type == sf::Event::TextEntered) {
+                sf::Uint32 cp = event.text.unicode;
+                if (cp == 8) { // Backspace - ganzes UTF-8-Zeichen entfernen
+                    PopUtf8(searchQuery);
+                } else if (cp == 27) { // Escape
+                    searchQuery.clear();
+                    searchFocused = false;
+                } else if (cp >= 32 && cp != 127 && searchQuery.size() < 200) {
+                    AppendUtf8(searchQuery, cp);
+                }
+            }
+
+            // Suchleiste der Detailansicht: Strg+F fokussiert, Enter/Umschalt+Enter springt zum nächsten/vorherigen Treffer
+            if (activeTab == 2 && showExtractionDetail) {
+                if (event.type == sf::Event::KeyPressed && event.key.control && event.key.code == sf::Keyboard::F) {
+                    findFocused = true;
+                } else if (findFocused && event.type == sf::Event::TextEntered) {
+                    sf::Uint32 cp = event.text.unicode;
+                    if (cp == 8) {
+                        PopUtf8(findQuery);
+                        findDirty = true;
+                    } else if (cp == 13) {
+                        if (!findHits.empty()) {
+                            bool backwards = sf::Keyboard::isKeyPressed(sf::Keyboard::LShift) || sf::Keyboard::isKeyPressed(sf::Keyboard::RShift);
+                            findCurrent = backwards ? (findCurrent + findHits.size() - 1) % findHits.size() : (findCurrent + 1) % findHits.size();
+                            findScrollPending = true;
+                        }
+                    } else if (cp == 27) {
+                        findQuery.clear();
+                        findFocused = false;
+                        findDirty = true;
+                    } else if (cp >= 32 && cp != 127 && findQuery.size() < 200) {
+                        AppendUtf8(findQuery, cp);
+                        findDirty = true;
+                    }
+                }
+            }
+
             // Handle text input for login
             if (activeTab == 5 && isLoginInputMode && event.type == sf::Event::TextEntered) {
                 if (event.text.unicode == 9) { // Tab key - switch fields
@@ -356,6 +800,7 @@ void RunGui(Presentation::ViewModel::MainViewModel &vm)
                         }
                         isLoginInputMode = false;
                         loginError = "";
+                        openLocalStore();
                         updateRibbonVisibility(); // Aktualisiere Sichtbarkeit nach Login
                     } else {
                         loginError = "Login failed: " + std::to_string(resp.statusCode);
@@ -367,6 +812,10 @@ void RunGui(Presentation::ViewModel::MainViewModel &vm)
                 if (event.mouseButton.x >= sidebarWidth + 50.f && event.mouseButton.x <= sidebarWidth + 170.f &&
                     event.mouseButton.y >= 280.f && event.mouseButton.y <= 315.f) {
                     Services::LoginService::ClearLogin();
+                    openLocalStore(); // Schließt den Speicher des abgemeldeten Kontos
+                    resultPrefetcher.Clear();
+                    prefetchIds.clear();
+                    extractionLoading = false;
                     isLoginInputMode = true;
                     loginUsername = "";
                     loginPassword = "";
@@ -436,11 +885,11 @@ void RunGui(Presentation::ViewModel::MainViewModel &vm)
                         if (!newUsername.empty() && !newEmail.empty() && !newPassword.empty()) {
                             std::string createUserJson = "{\"username\":\"" + newUsername + "\",\"email\":\"" + newEmail + 
                                                        "\",\"password\":\"" + newPassword + "\",\"role\":\"" + newRole + "\"}";
-                            Services::HttpResponse resp = Services::ApiService::Post("Admin/users", createUserJson);
+                            Services::HttpResponse resp = syncService.Submit("POST", "Admin/users", createUserJson, "Benutzer anlegen: " + newUsername);
                             
-                            if (resp.isSuccess) {
+                            if (resp.isSuccess || resp.queued) {
                                 userFormSuccess = true;
-                                userFormMessage = "Benutzer erfolgreich erstellt!";
+                                userFormMessage = resp.queued ? "Offline gespeichert - wird bei Verbindung übertragen" : "Benutzer erfolgreich erstellt!";
                                 newUsername = "";
                                 newEmail = "";
                                 newPassword = "";
@@ -461,15 +910,15 @@ void RunGui(Presentation::ViewModel::MainViewModel &vm)
                         if (!newEmail.empty()) {
                             std::string updateUserJson = "{\"email\":\"" + newEmail + "\",\"role\":\"" + newRole + "\"";
                             if (!newPassword.empty()) {
-                                updateUserJson += ",\"newPassword\":\"" + newPassword;
+                                updateUserJson += ",\"newPassword\":\"" + newPassword + "\"";
                             }
                             updateUserJson += "}";
                             
-                            Services::HttpResponse resp = Services::ApiService::Put("Admin/users/" + editUserId, updateUserJson);
+                            Services::HttpResponse resp = syncService.Submit("PUT", "Admin/users/" + editUserId, updateUserJson, "Benutzer ändern: " + editUsername);
                             
-                            if (resp.isSuccess) {
+                            if (resp.isSuccess || resp.queued) {
                                 userFormSuccess = true;
-                                userFormMessage = "Benutzer erfolgreich aktualisiert!";
+                                userFormMessage = resp.queued ? "Offline gespeichert - wird bei Verbindung übertragen" : "Benutzer erfolgreich aktualisiert!";
                                 newUsername = "";
                                 newEmail = "";
                                 newPassword = "";
@@ -504,50 +953,37 @@ void RunGui(Presentation::ViewModel::MainViewModel &vm)
                 }
             }
             
-            // Handle users list interactions (toggle button, edit button)
-            if (activeTab == 3 && adminSubTab == 1 && !showCreateUserForm && !showEditUserForm && event.type == sf::Event::MouseButtonPressed) {
-                float userY = 190.f;
-                for (size_t i = 0; i < adminUsers.size(); ++i) {
-                    float itemY = userY + (i * 75.f);
-                    if (itemY > 650.f) break;
-                    
-                    // Click handler for toggle button (Activate/Deactivate)
-                    if (event.mouseButton.x >= sidebarWidth + 580.f && event.mouseButton.x <= sidebarWidth + 670.f &&
-                        event.mouseButton.y >= itemY + 20.f && event.mouseButton.y <= itemY + 50.f) {
-                        std::string endpoint = adminUsers[i].isActive ? 
-                            "Admin/users/" + adminUsers[i].userId + "/deactivate" :
-                            "Admin/users/" + adminUsers[i].userId + "/activate";
-                        std::cout << "DEBUG: Toggle user - endpoint: " << endpoint << ", userId: [" << adminUsers[i].userId << "]" << std::endl;
-                        Services::HttpResponse resp = Services::ApiService::Post(endpoint, "{}");
-                        std::cout << "DEBUG: Response - status: " << resp.statusCode << ", success: " << resp.isSuccess << std::endl;
-                        if (resp.isSuccess) {
-                            adminUsers[i].isActive = !adminUsers[i].isActive;
-                        }
-                        break; // Nur einen Button pro Event handhaben
-                    }
-                    
-                    // Click handler for edit button
-                    if (event.mouseButton.x >= sidebarWidth + 690.f && event.mouseButton.x <= sidebarWidth + 830.f &&
-                        event.mouseButton.y >= itemY + 20.f && event.mouseButton.y <= itemY + 50.f) {
-                        showEditUserForm = true;
-                        editUsername = adminUsers[i].username;
-                        editUserId = adminUsers[i].userId;
-                        newEmail = adminUsers[i].email;
-                        newRole = adminUsers[i].role;
-                        newPassword = "";
-                        userFormMessage = "";
-                        break; // Nur einen Button pro Event handhaben
+            // Admin-Listen: Filtereingabe und Scrollen
+            if (activeTab == 3 && (adminSubTab == 2 || adminSubTab == 3)) {
+                AdminListState& list = *adminLists[adminSubTab - 2];
+                if (list.filterFocused && event.type == sf::Event::TextEntered) {
+                    sf::Uint32 cp = event.text.unicode;
+                    if (cp == 8) {
+                        PopUtf8(list.spec.filter);
+                        list.dirty = true;
+                    } else if (cp == 27) {
+                        list.spec.filter.clear();
+                        list.filterFocused = false;
+                        list.dirty = true;
+                    } else if (cp == 13) {
+                        list.filterFocused = false;
+                    } else if (cp >= 32 && cp != 127 && list.spec.filter.size() < 100) {
+                        AppendUtf8(list.spec.filter, cp);
+                        list.dirty = true;
                     }
+                    if (list.dirty) list.firstRow = 0;
+                } else if (event.type == sf::Event::MouseWheelScrolled && list.hasView &&
+                           event.mouseWheelScroll.x >= sidebarWidth + 20.f && event.mouseWheelScroll.y >= 170.f) {
+                    long target = static_cast<long>(list.firstRow) - static_cast<long>(event.mouseWheelScroll.delta * 3.f);
+                    long maxFirst = static_cast<long>(list.view.DisplayRows() > adminListRows ? list.view.DisplayRows() - adminListRows : 0);
+                    list.firstRow = static_cast<size_t>(std::max(0L, std::min(target, maxFirst)));
                 }
+                // Ein Klick auf das Feld fokussiert über den Router wieder
+                if (event.type == sf::Event::MouseButtonPressed) list.filterFocused = false;
             }
-            
-            // Handle create user button click
-            if (activeTab == 3 && adminSubTab == 1 && !showCreateUserForm && !showEditUserForm && event.type == sf::Event::MouseButtonPressed) {
-                if (event.mouseButton.x >= sidebarWidth + 750.f && event.mouseButton.x <= sidebarWidth + 930.f &&
-                    event.mouseButton.y >= 135.f && event.mouseButton.y <= 170.f) {
-                    showCreateUserForm = true;
-                }
-            }
+
+            // Klicks auf registrierte Bereiche (Listen, Buttons) nach den Formular-Handlern verteilen
+            router.Dispatch(event);
         }
         
         // Check if a ribbon was clicked to change tab
@@ -558,24 +994,102 @@ void RunGui(Presentation::ViewModel::MainViewModel &vm)
             sidebar->resetClickedRibbon();
         }
         
+        eventScope.reset();
+        router.BeginFrame();
+        
         window.clear(sf::Color::White);
         
-        // Draw sidebar
-        sidebar->draw(window);
+        // Draw sidebar (Sidebar, Inhaltsfläche und Kopfzeile gehen als ein Batch raus)
+        {
+            Services::FrameProfiler::Scope scope(profSidebar);
+            sidebar->draw(batch);
+        }
+        std::optional<Services::FrameProfiler::Scope> headerScope(std::in_place, profHeader);
         
         // Draw main content area
-        sf::RectangleShape contentArea(sf::Vector2f(1200.f - sidebarWidth, 700.f));
-        contentArea.setPosition(sidebarWidth, 0.f);
-        contentArea.setFillColor(sf::Color(240, 240, 240));
-        window.draw(contentArea);
+        batch.AddRect(sf::FloatRect(sidebarWidth, 0.f, 1200.f - sidebarWidth, 700.f), sf::Color(240, 240, 240));
         
         // Draw header text
-        sf::Text header("Text Extraction System", font, 28u);
-        header.setFillColor(sf::Color::Black);
-        header.setPosition(sidebarWidth + 20.f, 20.f);
-        window.draw(header);
+        batch.AddText("Text Extraction System", font, 28u, sf::Vector2f(sidebarWidth + 20.f, 20.f), sf::Color::Black);
+
+        // Statistik nur abfragen solange der Tab sichtbar ist
+        statisticsPoller.SetActive(activeTab == 3 && adminSubTab == 0);
+        logTail.SetActive(activeTab == 3 && adminSubTab == 4);
+        diagnosticsMonitor.SetActive(activeTab == 4);
+
+        // Index sichern, wenn der Nutzer seit 5 s nichts getan hat und keine Texte mehr nachkommen
+        if (searchIndex.PendingChanges() > 0) {
+            auto now = std::chrono::steady_clock::now();
+            if (now - lastInputAt >= std::chrono::seconds(5) && now - lastIndexChangeAt >= std::chrono::seconds(2)) {
+                searchIndex.Save();
+            }
+        }
+
+        // Verbindungsstatus und Offline-Journal
+        bool isOnline = syncService.IsOnline();
+        resultPrefetcher.SetActive(activeTab == 2 && !showExtractionDetail && isOnline);
+
+        // Im Hintergrund geladene Extraktion übernehmen, sobald sie da ist
+        if (extractionLoading) {
+            Services::HttpResponse resp;
+            if (resultPrefetcher.TakeRequested(extractionSelectedFileId, resp)) {
+                extractionLoading = false;
+                if (resp.statusCode == 0) syncService.ReportOffline();
+                if (showExtractionDetail && !isExtracting) applyExtractionResult(resp);
+            }
+        }
+
+        // Fertige Dateien der Pipeline wie eine geöffnete Extraktion speichern und indizieren (auch in anderen Tabs)
+        if (uploadPipeline.TakeCompleted(uploadPipelineCompleted)) {
+            for (const auto& item : uploadPipelineCompleted) {
+                if (item.stage != Services::PipelineStage::Done) {
+                    if (item.statusCode == 0) syncService.ReportOffline();
+                    std::cout << "Hochladen + Extrahieren fehlgeschlagen: " << item.fileName << ": " << item.error << std::endl;
+                    continue;
+                }
+                vm.RememberUpload(item.fileId, item.path);
+                storeExtractionFor(item.fileId, item.text, item.method, item.completedAt);
+                indexExtractionFor(item.fileId, item.fileName, item.text);
+                resultPrefetcher.Invalidate(item.fileId);
+                std::cout << "Hochgeladen und extrahiert: " << item.fileName << " (" << item.method << ", Upload "
+                          << static_cast<int>(item.uploadMs) << " ms, Extraktion " << static_cast<int>(item.extractMs) << " ms)" << std::endl;
+            }
+            documentsLoaded = false; // Neue Dokumente in der Extraktionsliste
+        }
+        if (isOnline && !wasOnline) {
+            documentsLoaded = false; // Nach Wiederverbindung frische Daten laden
+        }
+        wasOnline = isOnline;
+        if (syncService.TakeCompleted()) {
+            documentsLoaded = false;
+            usersLoaded = false;
+        }
+        if (offlineJournal.Version() != journalVersion) {
+            journalVersion = offlineJournal.Version();
+            syncConflicts = offlineJournal.Conflicts();
+        }
+        size_t pendingOps = syncService.PendingCount();
+        {
+            std::string badgeText = isOnline ? (syncService.IsSyncing() ? "Synchronisiere..." : "Online") : "Offline";
+            if (pendingOps > 0) badgeText += " | " + std::to_string(pendingOps) + " ausstehend";
+            if (!syncConflicts.empty()) badgeText += " | " + std::to_string(syncConflicts.size()) + " Konflikte";
+
+            batch.AddRect(sf::FloatRect(1200.f - 275.f, 24.f, 260.f, 26.f),
+                          !syncConflicts.empty() ? sf::Color(255, 225, 200) : isOnline ? sf::Color(220, 245, 220) : sf::Color(250, 235, 190),
+                          sf::Color(180, 180, 180));
+            batch.AddText(ToSFMLString(badgeText), font, 11u, sf::Vector2f(1200.f - 268.f, 29.f), sf::Color(60, 60, 60));
+
+            if (!syncConflicts.empty()) {
+                router.AddRegion(sf::FloatRect(1200.f - 275.f, 24.f, 260.f, 26.f), conflictBadgeHandler);
+            }
+        }
+        batch.Flush(window);
+        
+        headerScope.reset();
         
         // Content based on active tab
+        std::optional<Services::FrameProfiler::Scope> tabScope;
+        if (activeTab >= 0 && activeTab < 6) tabScope.emplace(profTabs[activeTab]);
         if (activeTab == 0) { // Home - Show API Response
             sf::Text apiLabel("API Status:", font, 16u);
             apiLabel.setFillColor(sf::Color::Black);
@@ -633,9 +1147,11 @@ void RunGui(Presentation::ViewModel::MainViewModel &vm)
             window.draw(selectText);
             
             // Dateiname anzeigen
+            float pipelineListY = 360.f;  // Unter der Meldungsbox, falls eine angezeigt wird
             if (!selectedFilePath.empty()) {
                 size_t lastSlash = selectedFilePath.find_last_of("/\\");
                 std::string fileName = (lastSlash != std::string::npos) ? selectedFilePath.substr(lastSlash + 1) : selectedFilePath;
+                if (selectedFilePaths.size() > 1) fileName += " (+" + std::to_string(selectedFilePaths.size() - 1) + " weitere)";
                 
                 sf::Text fileLabel(ToSFMLString("Gewählte Datei:"), font, 12u);
                 fileLabel.setFillColor(sf::Color::Black);
@@ -657,6 +1173,27 @@ void RunGui(Presentation::ViewModel::MainViewModel &vm)
                 uploadBtnText.setFillColor(sf::Color::White);
                 uploadBtnText.setPosition(sidebarWidth + 40.f, 230.f);
                 window.draw(uploadBtnText);
+
+                // Hochladen + Extrahieren (alle gewählten Dateien); offline nicht möglich, die Extraktion braucht die fileId
+                bool pipelineAvailable = !syncService.ShouldQueue();
+                sf::RectangleShape pipelineBtn(sf::Vector2f(230.f, 40.f));
+                pipelineBtn.setPosition(sidebarWidth + 190.f, 220.f);
+                pipelineBtn.setFillColor(pipelineAvailable ? sf::Color(70, 130, 180) : sf::Color(150, 150, 150));
+                window.draw(pipelineBtn);
+
+                sf::Text pipelineBtnText(ToSFMLString("Hochladen + Extrahieren"), font, 14u);
+                pipelineBtnText.setFillColor(sf::Color::White);
+                pipelineBtnText.setPosition(sidebarWidth + 205.f, 230.f);
+                window.draw(pipelineBtnText);
+
+                if (pipelineAvailable && event.type == sf::Event::MouseButtonPressed && !uploadButtonPressed &&
+                    event.mouseButton.x >= sidebarWidth + 190.f && event.mouseButton.x <= sidebarWidth + 420.f &&
+                    event.mouseButton.y >= 220.f && event.mouseButton.y <= 260.f) {
+                    uploadButtonPressed = true;
+                    uploadPipeline.ClearFinished();
+                    uploadPipeline.Add(selectedFilePaths.empty() ? std::vector<std::string>{selectedFilePath} : selectedFilePaths);
+                    std::cout << "Hochladen + Extrahieren: " << std::max<size_t>(1, selectedFilePaths.size()) << " Datei(en)" << std::endl;
+                }
                 
                 // Fortschrittsbalken
                 if (isUploading || uploadProgress > 0.0) {
@@ -696,13 +1233,21 @@ void RunGui(Presentation::ViewModel::MainViewModel &vm)
                         displayMessage = ExtractMessageFromJSON(uploadStatus);
                     }
                     
-                    // Wrapper für lange Texte
-                    auto wrappedLines = WrapText(displayMessage, 65);
-                    
                     // Berechne Box-Größe
                     float boxWidth = 550.f;
                     float lineHeight = 20.f;
-                    float boxHeight = (wrappedLines.size() * lineHeight) + 30.f;
+                    
+                    // Wrapper für lange Texte
+                    {
+                        Services::FrameProfiler::Scope scope(profWrap);
+                        if (displayMessage != uploadMessage) {
+                            uploadMessage.swap(displayMessage);
+                            ++uploadMessageVersion;
+                        }
+                        uploadMessageLayout.SetText(uploadMessage, uploadMessageVersion);
+                        uploadMessageLayout.Wrap(boxWidth - 30.f);
+                    }
+                    float boxHeight = (uploadMessageLayout.LineCount() * lineHeight) + 30.f;
                     float boxX = sidebarWidth + 20.f;
                     float boxY = 360.f;
                     
@@ -716,13 +1261,78 @@ void RunGui(Presentation::ViewModel::MainViewModel &vm)
                     
                     // Zeichne Text zeilenweise
                     float textY = boxY + 10.f;
-                    for (const auto& line : wrappedLines) {
-                        sf::Text lineText(ToSFMLString(line), font, 12u);
+                    for (size_t i = 0; i < uploadMessageLayout.LineCount(); ++i) {
+                        sf::Text lineText(UI::LineString(uploadMessageLayout, i), font, 12u);
                         lineText.setFillColor(showUploadSuccess ? sf::Color(50, 150, 50) : sf::Color(200, 50, 50));
                         lineText.setPosition(boxX + 15.f, textY);
                         window.draw(lineText);
                         textY += lineHeight;
                     }
+                    pipelineListY = boxY + boxHeight + 20.f;
+                }
+            }
+
+            // Status von Hochladen + Extrahieren, eine Zeile pro Datei
+            if (uploadPipeline.Version() != uploadPipelineVersion) {
+                uploadPipelineVersion = uploadPipeline.Version();
+                uploadPipelineRows = uploadPipeline.Snapshot();
+            }
+            if (!uploadPipelineRows.empty()) {
+                size_t pipelinePending = 0;
+                for (const auto& item : uploadPipelineRows) {
+                    if (item.stage < Services::PipelineStage::Done) ++pipelinePending;
+                }
+                std::string pipelineTitle = "Hochladen + Extrahieren: " +
+                                            std::to_string(uploadPipelineRows.size() - pipelinePending) + "/" +
+                                            std::to_string(uploadPipelineRows.size()) + " abgeschlossen";
+                sf::Text pipelineTitleText(ToSFMLString(pipelineTitle), font, 14u);
+                pipelineTitleText.setFillColor(sf::Color::Black);
+                pipelineTitleText.setPosition(sidebarWidth + 20.f, pipelineListY);
+                window.draw(pipelineTitleText);
+
+                if (pipelinePending > 0) {
+                    sf::RectangleShape cancelBtn(sf::Vector2f(100.f, 24.f));
+                    cancelBtn.setPosition(sidebarWidth + 450.f, pipelineListY - 2.f);
+                    cancelBtn.setFillColor(sf::Color(200, 80, 80));
+                    window.draw(cancelBtn);
+
+                    sf::Text cancelText(ToSFMLString("Abbrechen"), font, 12u);
+                    cancelText.setFillColor(sf::Color::White);
+                    cancelText.setPosition(sidebarWidth + 468.f, pipelineListY + 2.f);
+                    window.draw(cancelText);
+
+                    if (event.type == sf::Event::MouseButtonPressed && event.mouseButton.x >= sidebarWidth + 450.f &&
+                        event.mouseButton.x <= sidebarWidth + 550.f && event.mouseButton.y >= pipelineListY - 2.f &&
+                        event.mouseButton.y <= pipelineListY + 22.f) {
+                        uploadPipeline.Cancel();
+                    }
+                }
+
+                float rowY = pipelineListY + 28.f;
+                for (const auto& item : uploadPipelineRows) {
+                    if (rowY > window.getSize().y - 20.f) break;  // Rest liegt außerhalb des Fensters
+                    std::string name = item.fileName.length() > 40 ? item.fileName.substr(0, 37) + "..." : item.fileName;
+                    std::string state = Services::PipelineStageName(item.stage);
+                    if (item.stage == Services::PipelineStage::Uploading) {
+                        state += " " + std::to_string(static_cast<int>(item.uploadProgress * 100)) + "%";
+                    } else if (item.stage == Services::PipelineStage::Done) {
+                        state += " (" + item.method + ", " + std::to_string(static_cast<int>(item.uploadMs + item.extractMs)) + " ms)";
+                    } else if (item.stage == Services::PipelineStage::Failed) {
+                        state += ": " + item.error;
+                    }
+
+                    sf::Text nameText(ToSFMLString(name), font, 12u);
+                    nameText.setFillColor(sf::Color(50, 50, 50));
+                    nameText.setPosition(sidebarWidth + 20.f, rowY);
+                    window.draw(nameText);
+
+                    sf::Text stateText(ToSFMLString(state), font, 12u);
+                    stateText.setFillColor(item.stage == Services::PipelineStage::Failed ? sf::Color(200, 50, 50)
+                                           : item.stage == Services::PipelineStage::Done ? sf::Color(50, 150, 50)
+                                                                                         : sf::Color(100, 100, 100));
+                    stateText.setPosition(sidebarWidth + 340.f, rowY);
+                    window.draw(stateText);
+                    rowY += 20.f;
                 }
             }
             
@@ -734,10 +1344,10 @@ void RunGui(Presentation::ViewModel::MainViewModel &vm)
                     std::string command;
                     #ifdef _WIN32
                         // Windows: PowerShell Datei-Dialog
-                        command = "powershell -Command \"[System.Reflection.Assembly]::LoadWithPartialName('System.windows.forms') | Out-Null; $f = New-Object System.Windows.Forms.OpenFileDialog; $f.ShowDialog() | Out-Null; Write-Host $f.FileName\" > /tmp/selected_file.txt 2>/dev/null";
+                        command = "powershell -Command \"[System.Reflection.Assembly]::LoadWithPartialName('System.windows.forms') | Out-Null; $f = New-Object System.Windows.Forms.OpenFileDialog; $f.Multiselect = $true; $f.ShowDialog() | Out-Null; Write-Host ($f.FileNames -join '|')\" > /tmp/selected_file.txt 2>/dev/null";
                     #else
                         // Linux/macOS: zenity - stderr zu /dev/null um GTK Warnings auszufiltern
-                        command = "zenity --file-selection --title='Datei auswählen' > /tmp/selected_file.txt 2>/dev/null";
+                        command = "zenity --file-selection --multiple --separator='|' --title='Datei auswählen' > /tmp/selected_file.txt 2>/dev/null";
                     #endif
                     
                     int ret = system(command.c_str());
@@ -760,6 +1370,14 @@ void RunGui(Presentation::ViewModel::MainViewModel &vm)
                             selectedFilePath.pop_back();
                         }
                         
+                        // Mehrfachauswahl kommt als "a|b|c"
+                        selectedFilePaths.clear();
+                        std::istringstream paths(selectedFilePath);
+                        for (std::string path; std::getline(paths, path, '|');) {
+                            if (!path.empty()) selectedFilePaths.push_back(path);
+                        }
+                        selectedFilePath = selectedFilePaths.empty() ? "" : selectedFilePaths.front();
+
                         std::cout << "DEBUG: selectedFilePath nach Bereinigung: [" << selectedFilePath << "]" << std::endl;
                         
                         if (!selectedFilePath.empty()) {
@@ -790,16 +1408,32 @@ void RunGui(Presentation::ViewModel::MainViewModel &vm)
                         isUploading = false;
                         std::cout << "Upload abgebrochen: selectedFilePath ist leer" << std::endl;
                     } else {
-                        // Upload mit Progress-Callback
-                        Services::HttpResponse resp = Services::ApiService::UploadFile(selectedFilePath,
-                            [&uploadProgress](double progress) {
-                                uploadProgress = progress;
-                            });
+                        // Upload mit Progress-Callback, offline ins Journal
+                        std::string uploadText = "Upload: " + selectedFilePath.substr(selectedFilePath.find_last_of("/\\") + 1);
+                        Services::HttpResponse resp;
+                        if (syncService.ShouldQueue()) {
+                            resp = syncService.Enqueue("UPLOAD", "Upload", selectedFilePath, uploadText);
+                        } else {
+                            resp = Services::ApiService::UploadFile(selectedFilePath,
+                                [&uploadProgress](double progress) {
+                                    uploadProgress = progress;
+                                });
+                            if (resp.statusCode == 0 && resp.body.rfind("CURL Error", 0) == 0) {
+                                syncService.ReportOffline();
+                                resp = syncService.Enqueue("UPLOAD", "Upload", selectedFilePath, uploadText);
+                            }
+                        }
                         
                         isUploading = false;
-                        if (resp.isSuccess) {
+                        if (resp.queued) {
+                            showUploadSuccess = false;
+                            uploadStatus = "Offline gespeichert - Upload folgt bei Verbindung";
+                        } else if (resp.isSuccess) {
                             showUploadSuccess = true;
                             uploadStatus = "";
+                            // Lokalen Pfad merken, damit der Router später lokal extrahieren kann
+                            vm.RememberUpload(ExtractJsonField(resp.body, "fileId"), selectedFilePath);
+                            documentsLoaded = false; // Dokumentenliste beim nächsten Öffnen neu laden
                             std::cout << "Upload erfolgreich!" << std::endl;
                         } else {
                             showUploadSuccess = false;
@@ -824,6 +1458,9 @@ void RunGui(Presentation::ViewModel::MainViewModel &vm)
                 window.draw(extractionTitle);
                 
                 // Lade Dokumente beim ersten Mal
+                if (!documentsLoaded && !loadingDocuments && !syncService.IsOnline()) {
+                    documentsLoaded = true; // Offline: Liste aus dem lokalen Speicher
+                }
                 if (!documentsLoaded && !loadingDocuments) {
                     loadingDocuments = true;
                     // GET /api/Upload/my-documents/
@@ -834,36 +1471,144 @@ void RunGui(Presentation::ViewModel::MainViewModel &vm)
                     if (resp.isSuccess && !resp.body.empty()) {
                         myDocuments.clear();
                         // Parse JSON Array - vereinfacht für [{fileId, fileName, uploadDate, fileSize}, ...]
-                        size_t pos = 0;
                         int docCount = 0;
-                        while ((pos = resp.body.find("{", pos)) != std::string::npos) {
-                            size_t endPos = resp.body.find("}", pos);
-                            if (endPos == std::string::npos) break;
-                            
-                            std::string objStr = resp.body.substr(pos, endPos - pos + 1);
-                            
-                            std::string fileId = ExtractJsonField(objStr, "id");
-                            std::string fileName = ExtractJsonField(objStr, "fileName");
-                            
-                            if (!fileId.empty()) {
-                                myDocuments.push_back({fileId, fileName});
-                                docCount++;
-                                std::cout << "Dokument " << docCount << " geladen: " << fileName << " (ID: " << fileId << ")" << std::endl;
-                            }
-                            
-                            pos = endPos + 1;
+                        {
+                            Services::TraceSpan parseSpan("json", "my-documents dekodieren");
+                            Services::ForEachFlatObject(resp.body, [&](const std::string& objStr) {
+                                std::string fileId = ExtractJsonField(objStr, "id");
+                                std::string fileName = ExtractJsonField(objStr, "fileName");
+                                
+                                if (!fileId.empty()) {
+                                    myDocuments.push_back({fileId, fileName});
+                                    localStore.Put(Services::StoreKind::Document, fileId, objStr);
+                                    docCount++;
+                                    std::cout << "Dokument " << docCount << " geladen: " << fileName << " (ID: " << fileId << ")" << std::endl;
+                                }
+                            });
+                            parseSpan.SetDetail(std::to_string(resp.body.size()) + " Bytes");
                         }
                         std::cout << "Total Dokumente geladen: " << docCount << std::endl;
+
+                        // Auf dem Server gelöschte Dokumente auch lokal entfernen
+                        std::vector<std::string> removedIds;
+                        localStore.ForEach(Services::StoreKind::Document, [&](std::string_view fileId, std::string_view) {
+                            bool present = std::any_of(myDocuments.begin(), myDocuments.end(),
+                                                       [&](const auto& doc) { return doc.first == fileId; });
+                            if (!present) removedIds.emplace_back(fileId);
+                        });
+                        for (const auto& fileId : removedIds) {
+                            localStore.Remove(Services::StoreKind::Document, fileId);
+                            localStore.Remove(Services::StoreKind::Extraction, fileId);
+                            localStore.Remove(Services::StoreKind::Meta, "extraction/" + fileId);
+                        }
+                        localStore.Flush();
                     } else {
+                        if (resp.statusCode == 0) syncService.ReportOffline();
                         std::cout << "Fehler beim Laden der Dokumente. Status: " << resp.statusCode << std::endl;
                     }
                     documentsLoaded = true;
                     loadingDocuments = false;
                 }
                 
+                // Suchfeld
+                sf::RectangleShape searchBox(sf::Vector2f(400.f, 30.f));
+                searchBox.setPosition(sidebarWidth + 520.f, 68.f);
+                searchBox.setFillColor(sf::Color::White);
+                searchBox.setOutlineColor(searchFocused ? sf::Color(70, 130, 180) : sf::Color(180, 180, 180));
+                searchBox.setOutlineThickness(searchFocused ? 2.f : 1.f);
+                window.draw(searchBox);
+
+                sf::Text searchText(searchQuery.empty() && !searchFocused ? ToSFMLString("Volltextsuche (\"Phrase\", Präfix*)")
+                                                                          : ToSFMLString(searchQuery + (searchFocused ? "|" : "")), font, 13u);
+                searchText.setFillColor(searchQuery.empty() && !searchFocused ? sf::Color(150, 150, 150) : sf::Color::Black);
+                searchText.setPosition(sidebarWidth + 528.f, 74.f);
+                window.draw(searchText);
+
+                if (event.type == sf::Event::MouseButtonPressed) {
+                    searchFocused = event.mouseButton.x >= sidebarWidth + 520.f && event.mouseButton.x <= sidebarWidth + 920.f &&
+                                    event.mouseButton.y >= 68.f && event.mouseButton.y <= 98.f;
+                }
+
+                // Suche nur bei geänderter Anfrage ausführen
+                if (searchQuery != lastSearchQuery || searchDirty) {
+                    lastSearchQuery = searchQuery;
+                    searchDirty = false;
+                    searchResults.clear();
+                    searchStatus = "";
+                    if (!searchQuery.empty()) {
+                        auto searchStart = std::chrono::steady_clock::now();
+                        searchResults = searchIndex.Search(searchQuery);
+                        double searchMs = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - searchStart).count();
+                        std::ostringstream ss;
+                        ss << searchResults.size() << " Treffer in " << std::fixed << std::setprecision(1) << searchMs
+                           << " ms (" << searchIndex.DocumentCount() << " Dokumente indiziert)";
+                        searchStatus = ss.str();
+                    }
+                }
+
+                // Ergebnisse der sichtbaren Zeilen vorab laden (Thread erst beim ersten Besuch des Tabs)
+                if (!resultPrefetcher.IsRunning()) resultPrefetcher.Start();
+                sf::Vector2i mouse = sf::Mouse::getPosition(window);
+
+                if (!searchQuery.empty()) {
+                    sf::Text searchStatusText(ToSFMLString(searchStatus), font, 11u);
+                    searchStatusText.setFillColor(sf::Color(100, 100, 100));
+                    searchStatusText.setPosition(sidebarWidth + 520.f, 100.f);
+                    window.draw(searchStatusText);
+
+                    // Suchergebnisse statt Dokumentenliste
+                    float hitY = 120.f;
+                    prefetchRows.clear();
+                    for (const auto& hit : searchResults) {
+                        sf::RectangleShape hitBox(sf::Vector2f(900.f, 50.f));
+                        hitBox.setPosition(sidebarWidth + 20.f, hitY);
+                        hitBox.setFillColor(sf::Color(240, 240, 240));
+                        hitBox.setOutlineColor(sf::Color(180, 180, 180));
+                        hitBox.setOutlineThickness(1.f);
+                        window.draw(hitBox);
+
+                        std::string displayName = hit.name.empty() ? hit.docId : hit.name;
+                        if (displayName.length() > 50) {
+                            displayName = displayName.substr(0, 47) + "...";
+                        }
+                        sf::Text hitName(ToSFMLString(displayName), font, 14u);
+                        hitName.setFillColor(sf::Color::Black);
+                        hitName.setPosition(sidebarWidth + 30.f, hitY + 6.f);
+                        window.draw(hitName);
+
+                        sf::Text hitScore(ToSFMLString(std::to_string(hit.score) + " Vorkommen"), font, 11u);
+                        hitScore.setFillColor(sf::Color(100, 100, 100));
+                        hitScore.setPosition(sidebarWidth + 30.f, hitY + 28.f);
+                        window.draw(hitScore);
+
+                        sf::RectangleShape openBtn(sf::Vector2f(110.f, 34.f));
+                        openBtn.setPosition(sidebarWidth + 800.f, hitY + 8.f);
+                        openBtn.setFillColor(sf::Color(70, 130, 180));
+                        window.draw(openBtn);
+
+                        sf::Text openBtnText(ToSFMLString("Öffnen"), font, 12u);
+                        openBtnText.setFillColor(sf::Color::White);
+                        openBtnText.setPosition(sidebarWidth + 823.f, hitY + 15.f);
+                        window.draw(openBtnText);
+
+                        size_t hitIndex = static_cast<size_t>(&hit - searchResults.data());
+                        router.AddRegion(sf::FloatRect(sidebarWidth + 800.f, hitY + 8.f, 110.f, 34.f), openSearchHitHandler, hitIndex);
+                        if (mouse.y >= hitY && mouse.y < hitY + 50.f && mouse.x >= sidebarWidth + 20.f && mouse.x < sidebarWidth + 920.f) {
+                            prefetchRows.insert(prefetchRows.begin(), hitIndex);
+                        } else {
+                            prefetchRows.push_back(hitIndex);
+                        }
+
+                        hitY += 60.f;
+                        if (hitY > window.getSize().y - 60.f) break;
+                    }
+                    reportPrefetchRows([&](size_t i) -> const std::string& { return searchResults[i].docId; });
+                }
+
                 // Zeichne Dokumentenliste
                 float docY = 120.f;
-                for (size_t i = 0; i < myDocuments.size(); ++i) {
+                if (searchQuery.empty()) prefetchRows.clear();
+                for (size_t i = 0; i < myDocuments.size() && searchQuery.empty(); ++i) {
                     const auto& doc = myDocuments[i];
                     
                     // Document Item Box (größer für Button)
@@ -907,58 +1652,21 @@ void RunGui(Presentation::ViewModel::MainViewModel &vm)
                     extractBtnText.setPosition(sidebarWidth + 823.f, docY + 20.f);
                     window.draw(extractBtnText);
                     
-                    // Click Handler für Extract Button
-                    if (event.type == sf::Event::MouseButtonPressed) {
-                        if (event.mouseButton.x >= sidebarWidth + 800.f && event.mouseButton.x <= sidebarWidth + 910.f &&
-                            event.mouseButton.y >= docY + 15.f && event.mouseButton.y <= docY + 55.f) {
-                            extractionSelectedFileId = doc.first;
-                            extractionSelectedFileName = doc.second;
-                            extractionSelectedFileSize = "";
-                            extractionSelectedUploadDate = "";
-                            extractedText = "";
-                            extractionStatus = "";
-                            extractionCompleted = false;
-                            extractionMethod = "";
-                            completedAt = "";
-                            textScrollOffset = 0.f;
-                            showExtractionDetail = true;
-                            
-                            // Lade vorhandene Extraktion vom Server
-                            std::string extractionUrl = "Extraction/result/" + doc.first;
-
-                            Services::HttpResponse resp = Services::ApiService::Get(extractionUrl);
-                            
-                            if (resp.isSuccess && !resp.body.empty()) {
-                                // Parse JSON Response
-                                extractedText = ExtractJsonField(resp.body, "extractedText");
-                                extractionMethod = ExtractJsonField(resp.body, "extractionMethod");
-                                completedAt = ExtractJsonField(resp.body, "completedAt");
-                                
-                                if (!extractedText.empty()) {
-                                    extractionStatus = "Vorhandene Extraktion geladen";
-                                    extractionCompleted = true;
-                                    std::cout << "Vorhandene Extraktion geladen für: " << extractionSelectedFileName << std::endl;
-                                    std::cout << "ExtractionMethod: " << extractionMethod << std::endl;
-                                    std::cout << "CompletedAt: " << completedAt << std::endl;
-                                } else {
-                                    extractionStatus = "Keine Extraktion vorhanden";
-                                    extractionCompleted = false;
-                                }
-                            } else {
-                                extractedText = "";
-                                extractionStatus = "";
-                                extractionCompleted = false;
-                                std::cout << "Keine vorhandene Extraktion für: " << extractionSelectedFileName << " (Status: " << resp.statusCode << ")" << std::endl;
-                            }
-                            
-                            std::cout << "Extraction Detail für: " << extractionSelectedFileName << " (ID: " << extractionSelectedFileId << ")" << std::endl;
-                        }
+                    router.AddRegion(sf::FloatRect(sidebarWidth + 800.f, docY + 15.f, 110.f, 40.f), openDocumentHandler, i);
+                    if (mouse.y >= docY && mouse.y < docY + 70.f && mouse.x >= sidebarWidth + 20.f && mouse.x < sidebarWidth + 920.f) {
+                        prefetchRows.insert(prefetchRows.begin(), i);
+                    } else {
+                        prefetchRows.push_back(i);
                     }
                     
                 docY += 85.f;
+                if (docY > window.getSize().y) break;  // Rest liegt außerhalb des Fensters
+                }
+                if (searchQuery.empty()) {
+                    reportPrefetchRows([&](size_t i) -> const std::string& { return myDocuments[i].first; });
                 }
                 // "Keine Dokumente" Nachricht
-                if (myDocuments.empty() && documentsLoaded) {
+                if (myDocuments.empty() && documentsLoaded && searchQuery.empty()) {
                     sf::Text noDocsText(ToSFMLString("Keine hochgeladenen Dokumente vorhanden"), font, 14u);
                     noDocsText.setFillColor(sf::Color(150, 150, 150));
                     noDocsText.setPosition(sidebarWidth + 20.f, 150.f);
@@ -1009,40 +1717,60 @@ void RunGui(Presentation::ViewModel::MainViewModel &vm)
                     if (event.mouseButton.x >= sidebarWidth + 130.f && event.mouseButton.x <= sidebarWidth + 280.f &&
                         event.mouseButton.y >= 110.f && event.mouseButton.y <= 145.f) {
                         isExtracting = true;
+                        extractionLoading = false;  // Eine noch ladende alte Extraktion nicht mehr anzeigen
                         extractionStatus = "Starte Extraktion...";
                         extractionCompleted = false;
                         
-                        // POST Request: /api/Extraction/{documentId}
-                        std::string extractionUrl = "Extraction/" + extractionSelectedFileId;
-
-                        std::string jsonBody = R"({
-                            "enableOCR": false,
-                            "language": "de",
-                            "maxPages": 5,
-                            "preserveFormatting": false,
-                            "enableLanguageModel": false,
-                            "maxSummaryLength": 0
-                        })";
-                        
-                        Services::HttpResponse resp = Services::ApiService::Post(extractionUrl, jsonBody);
+                        // Router entscheidet zwischen lokaler Extraktion und POST /api/Extraction/{documentId}
+                        Core::ExtractionOptions options;
+                        options.maxPages = 5;
+                        std::string route;
+                        Core::ExtractionResult result = vm.ExtractDocument(extractionSelectedFileId, options, &route);
                         
-                        if (resp.isSuccess) {
-                            extractionStatus = "Extraktion erfolgreich!";
-                            extractedText = resp.body;
+                        if (result.success) {
+                            extractionStatus = "Extraktion erfolgreich! (" + route + ")";
+                            extractedText = result.text;
+                            ++extractedTextVersion;
+                            extractionMethod = result.method;
                             extractionCompleted = true;
-                            std::cout << "Extraction erfolgreich für: " << extractionSelectedFileName << std::endl;
-                            std::cout << "Response: " << resp.body << std::endl;
+                            textScrollOffset = 0.f;
+                            indexExtractedText();
+                            storeExtraction();
+                            resultPrefetcher.Invalidate(extractionSelectedFileId);
+                            extractionLocalOnly = result.extractedLocally;  // Bleibt lokal, bis der Nutzer es anders will
+                            std::cout << "Extraction erfolgreich für: " << extractionSelectedFileName << " (" << route << ")" << std::endl;
+                        } else if (result.backendUnreachable) {
+                            // Weder lokal möglich noch Server erreichbar: Extraktion später auf dem Server anstoßen
+                            syncService.ReportOffline();
+                            syncService.Enqueue("POST", "Extraction/" + extractionSelectedFileId,
+                                                Services::RemoteExtractor::BuildOptionsJson(options),
+                                                "Extraktion: " + extractionSelectedFileName);
+                            extractionStatus = "Offline gespeichert - Extraktion startet bei Verbindung";
                         } else {
-                            extractionStatus = "Fehler bei Extraktion: Status " + std::to_string(resp.statusCode);
+                            extractionStatus = "Fehler bei Extraktion: " + result.error;
                             extractedText = "Fehler beim Extrahieren des Textes.";
-                            std::cout << "Extraction fehlgeschlagen. Status: " << resp.statusCode << std::endl;
-                            std::cout << "Response: " << resp.body << std::endl;
+                            ++extractedTextVersion;
+                            std::cout << "Extraction fehlgeschlagen: " << result.error << std::endl;
                         }
                         
                         isExtracting = false;
                     }
                 }
                 
+                // Lokales Ergebnis auf Wunsch auch auf dem Server extrahieren lassen
+                if (extractionLocalOnly && extractionCompleted && !isExtracting) {
+                    sf::RectangleShape serverBtn(sf::Vector2f(170.f, 35.f));
+                    serverBtn.setPosition(sidebarWidth + 290.f, 110.f);
+                    serverBtn.setFillColor(sf::Color(70, 130, 180));
+                    window.draw(serverBtn);
+
+                    sf::Text serverBtnText(ToSFMLString("Auf Server extrahieren"), font, 12u);
+                    serverBtnText.setFillColor(sf::Color::White);
+                    serverBtnText.setPosition(sidebarWidth + 302.f, 118.f);
+                    window.draw(serverBtnText);
+                    router.AddRegion(sf::FloatRect(sidebarWidth + 290.f, 110.f, 170.f, 35.f), serverExtractionHandler);
+                }
+
                 // Document Info Panel
                 sf::RectangleShape infoPanel(sf::Vector2f(900.f, 70.f));
                 infoPanel.setPosition(sidebarWidth + 20.f, 160.f);
@@ -1135,12 +1863,121 @@ void RunGui(Presentation::ViewModel::MainViewModel &vm)
                 float textBoxY = extractionCompleted && !extractionMethod.empty() ? 310.f : 280.f;
                 float textBoxHeight = extractionCompleted && !extractionMethod.empty() ? 310.f : 330.f;
                 
-                sf::RectangleShape textBox(sf::Vector2f(900.f, textBoxHeight));
-                textBox.setPosition(sidebarWidth + 20.f, textBoxY);
-                textBox.setFillColor(sf::Color(255, 255, 255));
-                textBox.setOutlineColor(sf::Color(180, 180, 180));
-                textBox.setOutlineThickness(1.f);
-                window.draw(textBox);
+                // Umbruch nur neu berechnen wenn sich Text oder Breite geändert haben
+                float lineHeight = 18.f;
+                bool textChanged = false;
+                {
+                    Services::FrameProfiler::Scope scope(profWrap);
+                    textChanged = extractedLayout.SetText(extractedText, extractedTextVersion);
+                    extractedLayout.Wrap(870.f);
+                }
+                if (textChanged) extractedBatch.Invalidate();
+                float totalTextHeight = extractedLayout.LineCount() * lineHeight;
+                maxScrollOffset = std::max(0.f, totalTextHeight - textBoxHeight);
+
+                // Suche im Text: bei geändertem Text/Suchbegriff neu starten, Ergebnis vom Worker abholen
+                if (textChanged) {
+                    findSnapshot.reset();
+                    findHits.clear();
+                    findDirty = !findQuery.empty();
+                }
+                if (findDirty) {
+                    findDirty = false;
+                    findHits.clear();
+                    findCurrent = 0;
+                    if (findQuery.empty() || !extractionCompleted || extractedText.empty()) {
+                        textFinder.Cancel();
+                    } else {
+                        if (!findSnapshot) findSnapshot = std::make_shared<const std::string>(extractedText);
+                        textFinder.Start(findSnapshot, findQuery);
+                    }
+                }
+                Services::TextFinderResult findResult;
+                if (textFinder.TakeResult(findResult)) {
+                    findHits = std::move(findResult.hits);
+                    findHitLength = findResult.needleLength;
+                    findTruncated = findResult.truncated;
+                    findMs = findResult.elapsedMs;
+                    // Erster Treffer ab der aktuellen Scrollposition
+                    size_t topLine = static_cast<size_t>(textScrollOffset / lineHeight);
+                    findCurrent = 0;
+                    if (topLine < extractedLayout.LineCount()) {
+                        auto first = std::lower_bound(findHits.begin(), findHits.end(), extractedLayout.Line(topLine).byteOffset);
+                        if (first != findHits.end()) findCurrent = static_cast<size_t>(first - findHits.begin());
+                    }
+                    findScrollPending = !findHits.empty();
+                }
+                if (findScrollPending && findCurrent < findHits.size()) {
+                    float hitTop = extractedLayout.LineForByte(findHits[findCurrent]) * lineHeight;
+                    if (hitTop < textScrollOffset || hitTop + lineHeight > textScrollOffset + textBoxHeight - 20.f) {
+                        textScrollOffset = std::min(std::max(0.f, hitTop - textBoxHeight / 2.f), maxScrollOffset);
+                    }
+                }
+                findScrollPending = false;
+
+                // Suchleiste
+                if (extractionCompleted && !extractedText.empty()) {
+                    sf::RectangleShape findBox(sf::Vector2f(230.f, 24.f));
+                    findBox.setPosition(sidebarWidth + 520.f, 246.f);
+                    findBox.setFillColor(sf::Color::White);
+                    findBox.setOutlineColor(findFocused ? sf::Color(70, 130, 180) : sf::Color(180, 180, 180));
+                    findBox.setOutlineThickness(findFocused ? 2.f : 1.f);
+                    window.draw(findBox);
+
+                    bool findPlaceholder = findQuery.empty() && !findFocused;
+                    sf::Text findText(findPlaceholder ? ToSFMLString("Im Text suchen (Strg+F)") : ToSFMLString(findQuery + (findFocused ? "|" : "")), font, 12u);
+                    findText.setFillColor(findPlaceholder ? sf::Color(150, 150, 150) : sf::Color::Black);
+                    findText.setPosition(sidebarWidth + 526.f, 250.f);
+                    window.draw(findText);
+
+                    for (int b = 0; b < 2; ++b) {
+                        sf::RectangleShape navBtn(sf::Vector2f(28.f, 24.f));
+                        navBtn.setPosition(sidebarWidth + 755.f + b * 33.f, 246.f);
+                        navBtn.setFillColor(findHits.empty() ? sf::Color(200, 200, 200) : sf::Color(70, 130, 180));
+                        window.draw(navBtn);
+
+                        sf::Text navText(b == 0 ? "<" : ">", font, 13u);
+                        navText.setFillColor(sf::Color::White);
+                        navText.setPosition(sidebarWidth + 765.f + b * 33.f, 249.f);
+                        window.draw(navText);
+                    }
+
+                    std::string findStatus;
+                    if (textFinder.IsRunning()) {
+                        findStatus = "Suche...";
+                    } else if (!findQuery.empty() && findHits.empty()) {
+                        findStatus = "Keine Treffer";
+                    } else if (!findHits.empty()) {
+                        std::ostringstream ss;
+                        ss << (findCurrent + 1) << "/" << findHits.size() << (findTruncated ? "+" : "")
+                           << " (" << std::fixed << std::setprecision(0) << findMs << " ms)";
+                        findStatus = ss.str();
+                    }
+                    sf::Text findStatusText(ToSFMLString(findStatus), font, 10u);
+                    findStatusText.setFillColor(sf::Color(100, 100, 100));
+                    findStatusText.setPosition(sidebarWidth + 824.f, 251.f);
+                    window.draw(findStatusText);
+
+                    if (event.type == sf::Event::MouseButtonPressed) {
+                        float mx = event.mouseButton.x;
+                        float my = event.mouseButton.y;
+                        bool inRow = my >= 246.f && my <= 270.f;
+                        findFocused = inRow && mx >= sidebarWidth + 520.f && mx <= sidebarWidth + 750.f;
+                        if (inRow && !findHits.empty()) {
+                            if (mx >= sidebarWidth + 755.f && mx <= sidebarWidth + 783.f) {
+                                findCurrent = (findCurrent + findHits.size() - 1) % findHits.size();
+                                findScrollPending = true;
+                            } else if (mx >= sidebarWidth + 788.f && mx <= sidebarWidth + 816.f) {
+                                findCurrent = (findCurrent + 1) % findHits.size();
+                                findScrollPending = true;
+                            }
+                        }
+                    }
+                }
+                
+                // Textbox, Suchtreffer und Text gehen gebündelt raus (Flush vor dem Text, Rest am Ende)
+                batch.AddRect(sf::FloatRect(sidebarWidth + 20.f, textBoxY, 900.f, textBoxHeight), sf::Color(255, 255, 255),
+                              sf::Color(180, 180, 180));
                 
                 // Scroll-Handling mit Mausrad (weniger empfindlich)
                 if (event.type == sf::Event::MouseWheelScrolled && extractionCompleted && !extractedText.empty()) {
@@ -1155,9 +1992,8 @@ void RunGui(Presentation::ViewModel::MainViewModel &vm)
                 
                 // Scroll-Bar Mouse Input (Press & Drag)
                 if (event.type == sf::Event::MouseButtonPressed && extractionCompleted && !extractedText.empty()) {
-                    auto textLines = WrapText(extractedText, 110);
-                    if ((int)textLines.size() > (int)(textBoxHeight / 18.f) - 1) {
-                        float totalHeight = textLines.size() * 18.f;
+                    if ((int)extractedLayout.LineCount() > (int)(textBoxHeight / lineHeight) - 1) {
+                        float totalHeight = totalTextHeight;
                         float scrollRatio = textBoxHeight / totalHeight;
                         float scrollBarHeight = textBoxHeight * scrollRatio;
                         float scrollBarY = textBoxY + (textScrollOffset / totalHeight) * textBoxHeight;
@@ -1178,8 +2014,7 @@ void RunGui(Presentation::ViewModel::MainViewModel &vm)
                 
                 // Scroll-Bar Dragging (im Main Loop)
                 if (isDraggingScrollBar && extractionCompleted && !extractedText.empty()) {
-                    auto textLines = WrapText(extractedText, 110);
-                    float totalHeight = textLines.size() * 18.f;
+                    float totalHeight = totalTextHeight;
                     
                     // Berechne neue Scroll-Position basierend auf Maus-Position
                     float mouseY = sf::Mouse::getPosition(window).y;
@@ -1195,87 +2030,75 @@ void RunGui(Presentation::ViewModel::MainViewModel &vm)
                 
                 // Status Text (wenn noch nicht extrahiert)
                 if (!extractionCompleted && extractionStatus.empty()) {
-                    sf::Text placeholderText(ToSFMLString("Klicke auf 'Extraktion starten' um den Text zu extrahieren"), font, 12u);
-                    placeholderText.setFillColor(sf::Color(150, 150, 150));
-                    placeholderText.setPosition(sidebarWidth + 30.f, textBoxY + 20.f);
-                    window.draw(placeholderText);
+                    batch.AddText(ToSFMLString("Klicke auf 'Extraktion starten' um den Text zu extrahieren"), font, 12u,
+                                  sf::Vector2f(sidebarWidth + 30.f, textBoxY + 20.f), sf::Color(150, 150, 150));
                 } else if (extractionCompleted && !extractedText.empty()) {
                     // Zeige extrahierten Text mit Scrolling
-                    auto textLines = WrapText(extractedText, 110);
+                    float textX = sidebarWidth + 30.f;
                     float textY = textBoxY + 10.f - textScrollOffset;
-                    int lineCount = 0;
-                    int maxVisibleLines = (int)(textBoxHeight / 18.f) - 1;
-                    
-                    for (size_t i = 0; i < textLines.size(); ++i) {
-                        float adjustedY = textY + (i * 18.f);
-                        
-                        // Nur zeichnen wenn vertikal sichtbar
-                        if (adjustedY >= textBoxY - 20.f && adjustedY <= textBoxY + textBoxHeight) {
-                            // Begrenze Textlänge um sicherzustellen dass nichts hinausragt
-                            std::string displayLine = textLines[i];
-                            if (displayLine.length() > 110) {
-                                displayLine = displayLine.substr(0, 107) + "...";
-                            }
-                            
-                            sf::Text lineText(ToSFMLString(displayLine), font, 11u);
-                            lineText.setFillColor(sf::Color::Black);
-                            lineText.setPosition(sidebarWidth + 30.f, adjustedY);
-                            
-                            // Nur zeichnen wenn innerhalb der Box-Grenzen
-                            if (adjustedY >= textBoxY && adjustedY <= textBoxY + textBoxHeight - 5.f) {
-                                window.draw(lineText);
-                            }
-                            lineCount++;
+                    int maxVisibleLines = (int)(textBoxHeight / lineHeight) - 1;
+                    
+                    // Nur vollständig sichtbare Zeilen; die Geometrie wird nur bei geändertem Bereich neu zusammengesetzt
+                    size_t firstVisible = textScrollOffset > 0.f ? (size_t)(textScrollOffset / lineHeight) : 0;
+                    while (firstVisible < extractedLayout.LineCount() && textY + firstVisible * lineHeight < textBoxY) ++firstVisible;
+                    size_t lastVisible = firstVisible;
+                    while (lastVisible < extractedLayout.LineCount() &&
+                           textY + lastVisible * lineHeight <= textBoxY + textBoxHeight - 5.f) ++lastVisible;
+                    extractedBatch.SetVisibleLines(extractedLayout, firstVisible, lastVisible);
+
+                    // Suchtreffer nur in den sichtbaren Zeilen markieren (auch über Zeilenumbrüche hinweg)
+                    for (size_t i = firstVisible; i < lastVisible && !findHits.empty(); ++i) {
+                        float adjustedY = textY + (i * lineHeight);
+                        const UI::LineSpan& span = extractedLayout.Line(i);
+                        size_t lineStart = span.byteOffset;
+                        size_t lineEnd = lineStart + span.byteLength;
+                        size_t searchFrom = lineStart >= findHitLength ? lineStart - findHitLength + 1 : 0;
+                        for (auto hit = std::lower_bound(findHits.begin(), findHits.end(), searchFrom);
+                             hit != findHits.end() && *hit < lineEnd; ++hit) {
+                            size_t startChar = std::min<size_t>(extractedLayout.CharForByte(std::max(*hit, lineStart)) - span.firstChar, span.charCount);
+                            size_t endChar = std::min<size_t>(extractedLayout.CharForByte(std::min(*hit + findHitLength, lineEnd)) - span.firstChar, span.charCount);
+                            if (endChar <= startChar) continue;
+
+                            float markStart = textX + extractedBatch.CharX(extractedLayout, i, startChar);
+                            float markEnd = textX + extractedBatch.CharX(extractedLayout, i, endChar);
+                            bool current = static_cast<size_t>(hit - findHits.begin()) == findCurrent;
+                            batch.AddRect(sf::FloatRect(markStart, adjustedY, markEnd - markStart, lineHeight - 2.f),
+                                          current ? sf::Color(255, 165, 0) : sf::Color(255, 235, 120));
                         }
                     }
+                    batch.Flush(window);
+                    extractedBatch.Draw(window, sf::Vector2f(textX, textY));
                     
                     // Scrollbar-Indikator zeichnen wenn nötig
-                    if ((int)textLines.size() > maxVisibleLines) {
-                        float totalHeight = textLines.size() * 18.f;
+                    if ((int)extractedLayout.LineCount() > maxVisibleLines) {
+                        float totalHeight = totalTextHeight;
                         float scrollRatio = textBoxHeight / totalHeight;
                         float scrollBarHeight = textBoxHeight * scrollRatio;
                         float scrollBarY = textBoxY + (textScrollOffset / totalHeight) * textBoxHeight;
                         
-                        sf::RectangleShape scrollBar(sf::Vector2f(8.f, scrollBarHeight));
-                        scrollBar.setPosition(sidebarWidth + 910.f, scrollBarY);
-                        scrollBar.setFillColor(isDraggingScrollBar ? sf::Color(100, 100, 200) : sf::Color(150, 150, 150));
-                        scrollBar.setOutlineColor(sf::Color(100, 100, 100));
-                        scrollBar.setOutlineThickness(1.f);
-                        window.draw(scrollBar);
+                        batch.AddRect(sf::FloatRect(sidebarWidth + 910.f, scrollBarY, 8.f, scrollBarHeight),
+                                      isDraggingScrollBar ? sf::Color(100, 100, 200) : sf::Color(150, 150, 150),
+                                      sf::Color(100, 100, 100));
                     }
                     
                     // Text Statistics
                     int charCount = extractedText.length();
-                    int wordCount = 0;
-                    bool inWord = false;
-                    for (char c : extractedText) {
-                        if (std::isspace(c)) {
-                            inWord = false;
-                        } else if (!inWord) {
-                            wordCount++;
-                            inWord = true;
-                        }
-                    }
+                    size_t wordCount = UI::CountWords(extractedText);
                     
-                    sf::RectangleShape statsPanel(sf::Vector2f(900.f, 40.f));
-                    statsPanel.setPosition(sidebarWidth + 20.f, textBoxY + textBoxHeight + 5.f);
-                    statsPanel.setFillColor(sf::Color(240, 250, 240));
-                    statsPanel.setOutlineColor(sf::Color(150, 200, 150));
-                    statsPanel.setOutlineThickness(1.f);
-                    window.draw(statsPanel);
+                    batch.AddRect(sf::FloatRect(sidebarWidth + 20.f, textBoxY + textBoxHeight + 5.f, 900.f, 40.f),
+                                  sf::Color(240, 250, 240), sf::Color(150, 200, 150));
                     
-                    std::string statsText = "Zeichen: " + std::to_string(charCount) + " | Wörter: " + std::to_string(wordCount) + " | Zeilen: " + std::to_string(textLines.size());
-                    sf::Text statsLabel(ToSFMLString(statsText), font, 11u);
-                    statsLabel.setFillColor(sf::Color(50, 100, 50));
-                    statsLabel.setPosition(sidebarWidth + 30.f, textBoxY + textBoxHeight + 10.f);
-                    window.draw(statsLabel);
+                    std::string statsText = "Zeichen: " + std::to_string(charCount) + " | Wörter: " + std::to_string(wordCount) + " | Zeilen: " + std::to_string(extractedLayout.LineCount());
+                    batch.AddText(ToSFMLString(statsText), font, 11u, sf::Vector2f(sidebarWidth + 30.f, textBoxY + textBoxHeight + 10.f),
+                                  sf::Color(50, 100, 50));
                 }
+                batch.Flush(window);
             }
             
         } else if (activeTab == 3) { // Admin Panel - Verwaltung
             // Horizontales Menü für Admin-Sektionen
-            std::vector<std::string> adminTabs = {"Statistiken", "Benutzer", "Dokumente", "Extraktionen"};
-            float tabWidth = 180.f;
+            std::vector<std::string> adminTabs = {"Statistiken", "Benutzer", "Dokumente", "Extraktionen", "Logs"};
+            float tabWidth = 176.f;
             float tabHeight = 40.f;
             
             sf::RectangleShape tabMenuBackground(sf::Vector2f(sidebarWidth + 900.f - (sidebarWidth + 20.f), tabHeight));
@@ -1302,13 +2125,7 @@ void RunGui(Presentation::ViewModel::MainViewModel &vm)
                 tabLabel.setPosition(tabX + 15.f, 78.f);
                 window.draw(tabLabel);
                 
-                // Click Handler
-                if (event.type == sf::Event::MouseButtonPressed) {
-                    if (event.mouseButton.x >= tabX && event.mouseButton.x <= tabX + tabWidth &&
-                        event.mouseButton.y >= 70.f && event.mouseButton.y <= 110.f) {
-                        adminSubTab = i;
-                    }
-                }
+                router.AddRegion(sf::FloatRect(tabX, 70.f, tabWidth, 40.f), adminSubTabHandler, static_cast<size_t>(i));
             }
             
             // Content Area basierend auf adminSubTab
@@ -1319,22 +2136,70 @@ void RunGui(Presentation::ViewModel::MainViewModel &vm)
                 statsTitle.setPosition(sidebarWidth + 20.f, 130.f);
                 window.draw(statsTitle);
                 
-                // Lade Statistics beim ersten Mal
-                if (!statisticsLoaded && !loadingStatistics) {
-                    loadingStatistics = true;
-                    Services::HttpResponse resp = Services::ApiService::Get("Admin/statistics");
-                    if (resp.isSuccess && !resp.body.empty()) {
-                        statisticsData = resp.body;
-                        statisticsLoaded = true;
-                        std::cout << "Statistics geladen:" << std::endl << statisticsData << std::endl;
-                    } else {
-                        statisticsData = "Fehler beim Laden der Statistiken (Status: " + std::to_string(resp.statusCode) + ")";
-                        statisticsLoaded = true;
-                        std::cout << "Fehler beim Laden der Statistics. Status: " << resp.statusCode << std::endl;
+                // Abfrage beim ersten Öffnen starten, danach aktualisiert der Worker selbst
+                if (!statisticsPoller.IsRunning()) {
+                    statisticsPoller.Start(statisticsIntervals[statisticsIntervalIndex]);
+                }
+                
+                auto stats = statisticsPoller.Snapshot();
+                if (stats->version != statisticsVersion) {
+                    statisticsVersion = stats->version;
+                    statsUsersLine = "Gesamt: " + std::to_string(stats->usersTotal) + " | Aktiv: " + std::to_string(stats->usersActive) + " | Inaktiv: " + std::to_string(stats->usersInactive);
+                    statsDocsLine = "Gesamt: " + std::to_string(stats->documentsTotal) + " Dateien";
+                    statsExtrLine = "Gesamt: " + std::to_string(stats->extractionsTotal);
+                    
+                    statsActivityLines.clear();
+                    for (const auto& activity : stats->recentActivity) {
+                        if (statsActivityLines.size() >= 6) break;
+                        std::string timestamp = activity.timestamp.length() > 19 ? activity.timestamp.substr(0, 19) : activity.timestamp;
+                        std::string activityLine = activity.type + ": " + activity.fileName + " by " + activity.uploadedBy + " at " + timestamp;
+                        if (activityLine.length() > 80) {
+                            activityLine = activityLine.substr(0, 77) + "...";
+                        }
+                        statsActivityLines.push_back(activityLine);
+                    }
+                    
+                    statsStatusLine.clear();
+                    if (stats->fetchedAt > 0) {
+                        std::time_t fetched = static_cast<std::time_t>(stats->fetchedAt);
+                        std::ostringstream when;
+                        when << "Stand: " << std::put_time(std::localtime(&fetched), "%H:%M:%S");
+                        statsStatusLine = when.str();
+                    }
+                    if (!stats->error.empty()) {
+                        statsStatusLine += (statsStatusLine.empty() ? "" : " | ") + ("Fehler: " + stats->error);
                     }
-                    loadingStatistics = false;
                 }
                 
+                sf::Text statsStatus(ToSFMLString(statsStatusLine), font, 11u);
+                statsStatus.setFillColor(stats->error.empty() ? sf::Color(100, 100, 100) : sf::Color(180, 60, 60));
+                statsStatus.setPosition(sidebarWidth + 150.f, 136.f);
+                window.draw(statsStatus);
+                
+                // Abfrageintervall umschalten
+                sf::RectangleShape intervalBtn(sf::Vector2f(170.f, 26.f));
+                intervalBtn.setPosition(sidebarWidth + 640.f, 130.f);
+                intervalBtn.setFillColor(sf::Color(200, 200, 200));
+                window.draw(intervalBtn);
+                
+                sf::Text intervalText(ToSFMLString("Intervall: " + std::to_string(statisticsIntervals[statisticsIntervalIndex]) + " s"), font, 12u);
+                intervalText.setFillColor(sf::Color::Black);
+                intervalText.setPosition(sidebarWidth + 655.f, 135.f);
+                window.draw(intervalText);
+                
+                sf::RectangleShape refreshBtn(sf::Vector2f(100.f, 26.f));
+                refreshBtn.setPosition(sidebarWidth + 820.f, 130.f);
+                refreshBtn.setFillColor(sf::Color(70, 130, 180));
+                window.draw(refreshBtn);
+                
+                sf::Text refreshText(ToSFMLString("Aktualisieren"), font, 12u);
+                refreshText.setFillColor(sf::Color::White);
+                refreshText.setPosition(sidebarWidth + 828.f, 135.f);
+                window.draw(refreshText);
+                
+                router.AddRegion(sf::FloatRect(sidebarWidth + 640.f, 130.f, 170.f, 26.f), statisticsIntervalHandler);
+                router.AddRegion(sf::FloatRect(sidebarWidth + 820.f, 130.f, 100.f, 26.f), statisticsRefreshHandler);
+                
                 sf::RectangleShape statsBox(sf::Vector2f(900.f, 500.f));
                 statsBox.setPosition(sidebarWidth + 20.f, 170.f);
                 statsBox.setFillColor(sf::Color(250, 250, 250));
@@ -1342,12 +2207,8 @@ void RunGui(Presentation::ViewModel::MainViewModel &vm)
                 statsBox.setOutlineThickness(1.f);
                 window.draw(statsBox);
                 
-                if (statisticsLoaded) {
+                if (stats->loaded) {
                     // === USERS PANEL ===
-                    int totalUsers = std::stoi(ExtractJsonField(statisticsData, "total"));
-                    int activeUsers = std::stoi(ExtractJsonField(statisticsData, "active"));
-                    int inactiveUsers = std::stoi(ExtractJsonField(statisticsData, "inactive"));
-                    
                     sf::RectangleShape usersPanel(sf::Vector2f(280.f, 120.f));
                     usersPanel.setPosition(sidebarWidth + 30.f, 180.f);
                     usersPanel.setFillColor(sf::Color(220, 245, 220));
@@ -1360,29 +2221,12 @@ void RunGui(Presentation::ViewModel::MainViewModel &vm)
                     usersLabel.setPosition(sidebarWidth + 40.f, 190.f);
                     window.draw(usersLabel);
                     
-                    std::string userStats = "Gesamt: " + std::to_string(totalUsers) + " | Aktiv: " + std::to_string(activeUsers) + " | Inaktiv: " + std::to_string(inactiveUsers);
-                    sf::Text userStatsText(ToSFMLString(userStats), font, 11u);
+                    sf::Text userStatsText(ToSFMLString(statsUsersLine), font, 11u);
                     userStatsText.setFillColor(sf::Color(50, 100, 50));
                     userStatsText.setPosition(sidebarWidth + 40.f, 215.f);
                     window.draw(userStatsText);
                     
                     // === DOCUMENTS PANEL ===
-                    std::string docTotalStr = ExtractJsonField(statisticsData, "\"documents\":{\"total\":");
-                    if (docTotalStr.empty()) {
-                        size_t pos = statisticsData.find("\"documents\"");
-                        if (pos != std::string::npos) {
-                            size_t bracketPos = statisticsData.find("{", pos);
-                            if (bracketPos != std::string::npos) {
-                                size_t totalPos = statisticsData.find("\"total\":", bracketPos);
-                                if (totalPos != std::string::npos) {
-                                    size_t commaPos = statisticsData.find(",", totalPos);
-                                    docTotalStr = statisticsData.substr(totalPos + 8, commaPos - totalPos - 8);
-                                }
-                            }
-                        }
-                    }
-                    int docTotal = docTotalStr.empty() ? 0 : std::stoi(docTotalStr);
-                    
                     sf::RectangleShape docsPanel(sf::Vector2f(280.f, 120.f));
                     docsPanel.setPosition(sidebarWidth + 330.f, 180.f);
                     docsPanel.setFillColor(sf::Color(220, 235, 255));
@@ -1395,29 +2239,12 @@ void RunGui(Presentation::ViewModel::MainViewModel &vm)
                     docsLabel.setPosition(sidebarWidth + 340.f, 190.f);
                     window.draw(docsLabel);
                     
-                    std::string docStats = "Gesamt: " + std::to_string(docTotal) + " Dateien";
-                    sf::Text docStatsText(ToSFMLString(docStats), font, 11u);
+                    sf::Text docStatsText(ToSFMLString(statsDocsLine), font, 11u);
                     docStatsText.setFillColor(sf::Color(50, 80, 150));
                     docStatsText.setPosition(sidebarWidth + 340.f, 215.f);
                     window.draw(docStatsText);
                     
                     // === EXTRACTIONS PANEL ===
-                    std::string extrTotalStr = ExtractJsonField(statisticsData, "\"extractions\":{\"total\":");
-                    if (extrTotalStr.empty()) {
-                        size_t pos = statisticsData.find("\"extractions\"");
-                        if (pos != std::string::npos) {
-                            size_t bracketPos = statisticsData.find("{", pos);
-                            if (bracketPos != std::string::npos) {
-                                size_t totalPos = statisticsData.find("\"total\":", bracketPos);
-                                if (totalPos != std::string::npos) {
-                                    size_t commaPos = statisticsData.find(",", totalPos);
-                                    extrTotalStr = statisticsData.substr(totalPos + 8, commaPos - totalPos - 8);
-                                }
-                            }
-                        }
-                    }
-                    int extrTotal = extrTotalStr.empty() ? 0 : std::stoi(extrTotalStr);
-                    
                     sf::RectangleShape extrsPanel(sf::Vector2f(280.f, 120.f));
                     extrsPanel.setPosition(sidebarWidth + 630.f, 180.f);
                     extrsPanel.setFillColor(sf::Color(255, 240, 220));
@@ -1430,8 +2257,7 @@ void RunGui(Presentation::ViewModel::MainViewModel &vm)
                     extrsLabel.setPosition(sidebarWidth + 640.f, 190.f);
                     window.draw(extrsLabel);
                     
-                    std::string extrStats = "Gesamt: " + std::to_string(extrTotal);
-                    sf::Text extrStatsText(ToSFMLString(extrStats), font, 11u);
+                    sf::Text extrStatsText(ToSFMLString(statsExtrLine), font, 11u);
                     extrStatsText.setFillColor(sf::Color(150, 100, 50));
                     extrStatsText.setPosition(sidebarWidth + 640.f, 215.f);
                     window.draw(extrStatsText);
@@ -1449,49 +2275,17 @@ void RunGui(Presentation::ViewModel::MainViewModel &vm)
                     activityBox.setOutlineThickness(1.f);
                     window.draw(activityBox);
                     
-                    // Parse and display recent activity
-                    size_t activityPos = statisticsData.find("\"recentActivity\"");
-                    if (activityPos != std::string::npos) {
-                        size_t arrayStart = statisticsData.find("[", activityPos);
-                        if (arrayStart != std::string::npos) {
-                            float activityY = 360.f;
-                            int activityCount = 0;
-                            for (int i = 0; i < 3 && activityCount < 3; ++i) {
-                                size_t objStart = statisticsData.find("{", arrayStart);
-                                if (objStart == std::string::npos || objStart > activityPos + 500) break;
-                                
-                                size_t objEnd = statisticsData.find("}", objStart);
-                                if (objEnd == std::string::npos) break;
-                                
-                                std::string objStr = statisticsData.substr(objStart, objEnd - objStart + 1);
-                                
-                                std::string actType = ExtractJsonField(objStr, "type");
-                                std::string fileName = ExtractJsonField(objStr, "fileName");
-                                std::string uploadedBy = ExtractJsonField(objStr, "uploadedBy");
-                                std::string timestamp = ExtractJsonField(objStr, "timestamp");
-                                
-                                if (timestamp.length() > 19) {
-                                    timestamp = timestamp.substr(0, 19);
-                                }
-                                
-                                std::string activityLine = actType + ": " + fileName + " by " + uploadedBy + " at " + timestamp;
-                                if (activityLine.length() > 80) {
-                                    activityLine = activityLine.substr(0, 77) + "...";
-                                }
-                                
-                                sf::Text activityText(ToSFMLString(activityLine), font, 10u);
-                                activityText.setFillColor(sf::Color(80, 80, 80));
-                                activityText.setPosition(sidebarWidth + 30.f, activityY);
-                                window.draw(activityText);
-                                
-                                activityY += 20.f;
-                                arrayStart = objEnd + 1;
-                                activityCount++;
-                            }
-                        }
+                    float activityY = 360.f;
+                    for (const auto& activityLine : statsActivityLines) {
+                        sf::Text activityText(ToSFMLString(activityLine), font, 10u);
+                        activityText.setFillColor(sf::Color(80, 80, 80));
+                        activityText.setPosition(sidebarWidth + 30.f, activityY);
+                        window.draw(activityText);
+                        activityY += 20.f;
                     }
                 } else {
-                    sf::Text placeholderStats(ToSFMLString("Lade Statistiken..."), font, 14u);
+                    std::string placeholder = stats->error.empty() ? "Lade Statistiken..." : "Fehler beim Laden der Statistiken (" + stats->error + ")";
+                    sf::Text placeholderStats(ToSFMLString(placeholder), font, 14u);
                     placeholderStats.setFillColor(sf::Color(150, 150, 150));
                     placeholderStats.setPosition(sidebarWidth + 40.f, 250.f);
                     window.draw(placeholderStats);
@@ -1509,45 +2303,10 @@ void RunGui(Presentation::ViewModel::MainViewModel &vm)
                     loadingUsers = true;
                     Services::HttpResponse resp = Services::ApiService::Get("Admin/users");
                     if (resp.isSuccess && !resp.body.empty()) {
-                        // Parse users JSON array
-                        adminUsers.clear();
-                        std::string body = resp.body;
-                        std::cout << "DEBUG: Users Response: " << body.substr(0, 500) << std::endl;
-                        
-                        // JSON array parsing - extrahiere User-Objekte zwischen { und }
-                        size_t pos = 0;
-                        while ((pos = body.find("{", pos)) != std::string::npos) {
-                            size_t endPos = body.find("}", pos);
-                            if (endPos == std::string::npos) break;
-                            
-                            // Extrahiere das komplette User-Objekt
-                            std::string userObj = body.substr(pos, endPos - pos + 1);
-                            
-                            // Prüfe ob das ein User-Objekt ist (muss "username" enthalten)
-                            if (userObj.find("\"username\"") == std::string::npos) {
-                                pos = endPos + 1;
-                                continue;
-                            }
-                            
-                            UserInfo user;
-                            
-                            // Parse alle Felder aus dem User-Objekt
-                            user.userId = ExtractJsonField(userObj, "id");
-                            user.username = ExtractJsonField(userObj, "username");
-                            user.email = ExtractJsonField(userObj, "email");
-                            user.role = ExtractJsonField(userObj, "role");
-                            user.createdAt = ExtractJsonField(userObj, "createdAt");
-                            user.lastLogin = ExtractJsonField(userObj, "lastLogin");
-                            
-                            // Parse isActive aus JSON
-                            std::string isActiveStr = ExtractJsonField(userObj, "isActive");
-                            user.isActive = (isActiveStr == "true" || isActiveStr == "1");
-                            
-                            std::cout << "DEBUG: Parsed user - username: " << user.username << ", userId: [" << user.userId << "], isActive: " << user.isActive << std::endl;
-                            
-                            adminUsers.push_back(user);
-                            pos = endPos + 1;
-                        }
+                        adminUsers.Clear();
+                        std::cout << "DEBUG: Users Response: " << resp.body.substr(0, 500) << std::endl;
+                        size_t userCount = adminUsers.Ingest(resp.body);
+                        std::cout << "DEBUG: Parsed users: " << userCount << std::endl;
                         usersLoaded = true;
                     }
                     loadingUsers = false;
@@ -1682,88 +2441,61 @@ void RunGui(Presentation::ViewModel::MainViewModel &vm)
                     
                 } else {
                     // === USERS LIST VIEW ===
-                    sf::RectangleShape usersBox(sf::Vector2f(900.f, 500.f));
-                    usersBox.setPosition(sidebarWidth + 20.f, 170.f);
-                    usersBox.setFillColor(sf::Color(250, 250, 250));
-                    usersBox.setOutlineColor(sf::Color(180, 180, 180));
-                    usersBox.setOutlineThickness(1.f);
-                    window.draw(usersBox);
+                    // Liste als ein Batch: alle Flächen, dann die Texte je Schriftgröße
+                    batch.AddRect(sf::FloatRect(sidebarWidth + 20.f, 170.f, 900.f, 500.f), sf::Color(250, 250, 250),
+                                  sf::Color(180, 180, 180));
                     
                     // Create User Button
-                    sf::RectangleShape createUserBtn(sf::Vector2f(180.f, 35.f));
-                    createUserBtn.setPosition(sidebarWidth + 750.f, 135.f);
-                    createUserBtn.setFillColor(sf::Color(34, 139, 34));
-                    window.draw(createUserBtn);
-                    
-                    sf::Text createUserBtnText(ToSFMLString("+ Benutzer erstellen"), font, 12u);
-                    createUserBtnText.setFillColor(sf::Color::White);
-                    createUserBtnText.setPosition(sidebarWidth + 760.f, 143.f);
-                    window.draw(createUserBtnText);
+                    batch.AddRect(sf::FloatRect(sidebarWidth + 750.f, 135.f, 180.f, 35.f), sf::Color(34, 139, 34));
+                    batch.AddText(ToSFMLString("+ Benutzer erstellen"), font, 12u, sf::Vector2f(sidebarWidth + 760.f, 143.f),
+                                  sf::Color::White);
+                    router.AddRegion(sf::FloatRect(sidebarWidth + 750.f, 135.f, 180.f, 35.f), createUserHandler);
                     
                     // Users list
                     float userY = 190.f;
-                    for (size_t i = 0; i < adminUsers.size(); ++i) {
+                    for (size_t i = 0; i < adminUsers.Size(); ++i) {
                         float itemY = 190.f + (i * 75.f);
                         if (itemY > 650.f) break; // Stop rendering if beyond view
                         
                         // User item background
-                        sf::RectangleShape userItem(sf::Vector2f(890.f, 70.f));
-                        userItem.setPosition(sidebarWidth + 25.f, itemY);
-                        userItem.setFillColor(i % 2 == 0 ? sf::Color(255, 255, 255) : sf::Color(245, 245, 245));
-                        userItem.setOutlineColor(sf::Color(200, 200, 200));
-                        userItem.setOutlineThickness(1.f);
-                        window.draw(userItem);
+                        batch.AddRect(sf::FloatRect(sidebarWidth + 25.f, itemY, 890.f, 70.f),
+                                      i % 2 == 0 ? sf::Color(255, 255, 255) : sf::Color(245, 245, 245), sf::Color(200, 200, 200));
                         
                         // Username
-                        sf::Text userNameText(ToSFMLString(adminUsers[i].username), font, 12u);
-                        userNameText.setFillColor(sf::Color::Black);
-                        userNameText.setPosition(sidebarWidth + 35.f, itemY + 10.f);
-                        window.draw(userNameText);
+                        batch.AddText(ToSFMLString(std::string(adminUsers.Username(i))), font, 12u, sf::Vector2f(sidebarWidth + 35.f, itemY + 10.f),
+                                      sf::Color::Black);
                         
                         // Email
-                        std::string displayEmail = adminUsers[i].email.length() > 30 ? 
-                            adminUsers[i].email.substr(0, 30) + "..." : adminUsers[i].email;
-                        sf::Text emailText(ToSFMLString(displayEmail), font, 11u);
-                        emailText.setFillColor(sf::Color(100, 100, 100));
-                        emailText.setPosition(sidebarWidth + 35.f, itemY + 28.f);
-                        window.draw(emailText);
+                        std::string_view email = adminUsers.Email(i);
+                        std::string displayEmail = email.length() > 30 ? 
+                            std::string(email.substr(0, 30)) + "..." : std::string(email);
+                        batch.AddText(ToSFMLString(displayEmail), font, 11u, sf::Vector2f(sidebarWidth + 35.f, itemY + 28.f),
+                                      sf::Color(100, 100, 100));
                         
                         // Role
-                        sf::Text roleText(ToSFMLString(adminUsers[i].role), font, 11u);
-                        roleText.setFillColor(adminUsers[i].role == "Administrator" ? sf::Color(200, 50, 50) : sf::Color(100, 100, 100));
-                        roleText.setPosition(sidebarWidth + 450.f, itemY + 10.f);
-                        window.draw(roleText);
+                        batch.AddText(ToSFMLString(adminUsers.Role(i)), font, 11u, sf::Vector2f(sidebarWidth + 450.f, itemY + 10.f),
+                                      adminUsers.Role(i) == "Administrator" ? sf::Color(200, 50, 50) : sf::Color(100, 100, 100));
                         
                         // Activate/Deactivate Button
-                        sf::RectangleShape toggleBtn(sf::Vector2f(90.f, 30.f));
-                        toggleBtn.setPosition(sidebarWidth + 580.f, itemY + 20.f);
-                        toggleBtn.setFillColor(adminUsers[i].isActive ? sf::Color(50, 150, 50) : sf::Color(220, 20, 20));
-                        window.draw(toggleBtn);
-                        
-                        sf::Text toggleBtnText(ToSFMLString(adminUsers[i].isActive ? "Aktiv" : "Inaktiv"), font, 11u);
-                        toggleBtnText.setFillColor(sf::Color::White);
-                        toggleBtnText.setPosition(sidebarWidth + 590.f, itemY + 25.f);
-                        window.draw(toggleBtnText);
+                        batch.AddRect(sf::FloatRect(sidebarWidth + 580.f, itemY + 20.f, 90.f, 30.f),
+                                      adminUsers.IsActive(i) ? sf::Color(50, 150, 50) : sf::Color(220, 20, 20));
+                        batch.AddText(ToSFMLString(adminUsers.IsActive(i) ? "Aktiv" : "Inaktiv"), font, 11u,
+                                      sf::Vector2f(sidebarWidth + 590.f, itemY + 25.f), sf::Color::White);
+                        router.AddRegion(sf::FloatRect(sidebarWidth + 580.f, itemY + 20.f, 90.f, 30.f), toggleUserHandler, i);
                         
                         // Edit Button
-                        sf::RectangleShape editBtn(sf::Vector2f(140.f, 30.f));
-                        editBtn.setPosition(sidebarWidth + 690.f, itemY + 20.f);
-                        editBtn.setFillColor(sf::Color(70, 130, 180));
-                        window.draw(editBtn);
-                        
-                        sf::Text editBtnText(ToSFMLString("Bearbeiten"), font, 11u);
-                        editBtnText.setFillColor(sf::Color::White);
-                        editBtnText.setPosition(sidebarWidth + 700.f, itemY + 25.f);
-                        window.draw(editBtnText);
+                        batch.AddRect(sf::FloatRect(sidebarWidth + 690.f, itemY + 20.f, 140.f, 30.f), sf::Color(70, 130, 180));
+                        batch.AddText(ToSFMLString("Bearbeiten"), font, 11u, sf::Vector2f(sidebarWidth + 700.f, itemY + 25.f),
+                                      sf::Color::White);
+                        router.AddRegion(sf::FloatRect(sidebarWidth + 690.f, itemY + 20.f, 140.f, 30.f), editUserHandler, i);
                     }
                     
                     // "Keine Benutzer" Nachricht
-                    if (adminUsers.empty() && usersLoaded) {
-                        sf::Text noUsersText(ToSFMLString("Keine Benutzer vorhanden"), font, 14u);
-                        noUsersText.setFillColor(sf::Color(150, 150, 150));
-                        noUsersText.setPosition(sidebarWidth + 350.f, 350.f);
-                        window.draw(noUsersText);
+                    if (adminUsers.Empty() && usersLoaded) {
+                        batch.AddText(ToSFMLString("Keine Benutzer vorhanden"), font, 14u, sf::Vector2f(sidebarWidth + 350.f, 350.f),
+                                      sf::Color(150, 150, 150));
                     }
+                    batch.Flush(window);
                 }
                 
             } else if (adminSubTab == 2) {
@@ -1778,93 +2510,66 @@ void RunGui(Presentation::ViewModel::MainViewModel &vm)
                     adminDocsLoading = true;
                     Services::HttpResponse resp = Services::ApiService::Get("Admin/documents");
                     if (resp.isSuccess && !resp.body.empty()) {
-                        adminDocuments.clear();
-                        std::string body = resp.body;
-                        
-                        // Parse documents array
-                        size_t pos = 0;
-                        while ((pos = body.find("{", pos)) != std::string::npos) {
-                            size_t endPos = body.find("}", pos);
-                            if (endPos == std::string::npos) break;
-                            
-                            std::string docObj = body.substr(pos, endPos - pos + 1);
-                            
-                            if (docObj.find("\"fileName\"") == std::string::npos) {
-                                pos = endPos + 1;
-                                continue;
-                            }
-                            
-                            DocumentInfo doc;
-                            doc.fileId = ExtractJsonField(docObj, "id");
-                            doc.fileName = ExtractJsonField(docObj, "fileName");
-                            doc.uploadedBy = ExtractJsonField(docObj, "uploadedBy");
-                            doc.uploadedAt = ExtractJsonField(docObj, "uploadedAt");
-                            doc.fileSize = ExtractJsonField(docObj, "fileSize");
-                            
-                            adminDocuments.push_back(doc);
-                            pos = endPos + 1;
-                        }
+                        // Neue Tabelle statt Clear(): ein laufender Worker hält die alte noch fest
+                        auto table = std::make_shared<Services::DocumentTable>();
+                        table->Ingest(resp.body);
+                        adminDocuments = std::move(table);
+                        adminDocsList.dirty = true;
+                        adminDocsList.hasView = false;
                         adminDocsLoaded = true;
                     }
                     adminDocsLoading = false;
                 }
                 
-                sf::RectangleShape docsBox(sf::Vector2f(900.f, 500.f));
-                docsBox.setPosition(sidebarWidth + 20.f, 170.f);
-                docsBox.setFillColor(sf::Color(250, 250, 250));
-                docsBox.setOutlineColor(sf::Color(180, 180, 180));
-                docsBox.setOutlineThickness(1.f);
-                window.draw(docsBox);
+                refreshAdminList(adminDocsList, adminDocuments);
+                drawAdminListControls(0, sidebarWidth);
+                batch.AddRect(sf::FloatRect(sidebarWidth + 20.f, 170.f, 900.f, 500.f), sf::Color(250, 250, 250),
+                              sf::Color(180, 180, 180));
                 
-                if (adminDocuments.empty() && adminDocsLoaded) {
-                    sf::Text noDocs(ToSFMLString("Keine Dokumente vorhanden"), font, 14u);
-                    noDocs.setFillColor(sf::Color(150, 150, 150));
-                    noDocs.setPosition(sidebarWidth + 350.f, 350.f);
-                    window.draw(noDocs);
+                if (adminDocuments->Empty() && adminDocsLoaded) {
+                    batch.AddText(ToSFMLString("Keine Dokumente vorhanden"), font, 14u, sf::Vector2f(sidebarWidth + 350.f, 350.f),
+                                  sf::Color(150, 150, 150));
                 } else {
-                    // Documents list
-                    float docY = 190.f;
-                    for (size_t i = 0; i < adminDocuments.size(); ++i) {
-                        float itemY = docY + (i * 75.f);
-                        if (itemY > 650.f) break;
+                    // Documents list (sichtbarer Ausschnitt der Permutation aus adminDocsList)
+                    const Services::TableQueryResult& view = adminDocsList.view;
+                    for (size_t slot = 0; slot < adminListRows && adminDocsList.hasView; ++slot) {
+                        size_t displayRow = adminDocsList.firstRow + slot;
+                        if (displayRow >= view.DisplayRows()) break;
+                        float itemY = 190.f + (slot * 75.f);
+                        size_t index = 0;
+                        if (view.IsGroupHeader(displayRow, index)) {
+                            drawAdminGroupHeader(view.groups[index], "Dokumente", sidebarWidth, itemY);
+                            continue;
+                        }
+                        size_t i = view.rows[index];
                         
                         // Document item background
-                        sf::RectangleShape docItem(sf::Vector2f(890.f, 70.f));
-                        docItem.setPosition(sidebarWidth + 25.f, itemY);
-                        docItem.setFillColor(i % 2 == 0 ? sf::Color(255, 255, 255) : sf::Color(245, 245, 245));
-                        docItem.setOutlineColor(sf::Color(200, 200, 200));
-                        docItem.setOutlineThickness(1.f);
-                        window.draw(docItem);
+                        batch.AddRect(sf::FloatRect(sidebarWidth + 25.f, itemY, 890.f, 70.f),
+                                      displayRow % 2 == 0 ? sf::Color(255, 255, 255) : sf::Color(245, 245, 245), sf::Color(200, 200, 200));
                         
                         // Filename
-                        std::string displayName = adminDocuments[i].fileName.length() > 50 ? 
-                            adminDocuments[i].fileName.substr(0, 47) + "..." : adminDocuments[i].fileName;
-                        sf::Text fileNameText(ToSFMLString(displayName), font, 12u);
-                        fileNameText.setFillColor(sf::Color::Black);
-                        fileNameText.setPosition(sidebarWidth + 35.f, itemY + 10.f);
-                        window.draw(fileNameText);
+                        std::string_view fileName = adminDocuments->FileName(i);
+                        std::string displayName = fileName.length() > 50 ? 
+                            std::string(fileName.substr(0, 47)) + "..." : std::string(fileName);
+                        batch.AddText(ToSFMLString(displayName), font, 12u, sf::Vector2f(sidebarWidth + 35.f, itemY + 10.f),
+                                      sf::Color::Black);
                         
                         // Uploaded by
-                        sf::Text uploadedByText(ToSFMLString("Von: " + adminDocuments[i].uploadedBy), font, 11u);
-                        uploadedByText.setFillColor(sf::Color(100, 100, 100));
-                        uploadedByText.setPosition(sidebarWidth + 35.f, itemY + 28.f);
-                        window.draw(uploadedByText);
+                        batch.AddText(ToSFMLString("Von: " + adminDocuments->UploadedBy(i)), font, 11u,
+                                      sf::Vector2f(sidebarWidth + 35.f, itemY + 28.f), sf::Color(100, 100, 100));
                         
-                        // Upload date (truncated to 19 chars)
-                        std::string displayDate = adminDocuments[i].uploadedAt.length() > 19 ? 
-                            adminDocuments[i].uploadedAt.substr(0, 19) : adminDocuments[i].uploadedAt;
-                        sf::Text dateText(ToSFMLString(displayDate), font, 11u);
-                        dateText.setFillColor(sf::Color(100, 100, 100));
-                        dateText.setPosition(sidebarWidth + 450.f, itemY + 10.f);
-                        window.draw(dateText);
+                        // Upload date (beim Laden geparst, nur sichtbare Zeilen werden formatiert)
+                        std::string displayDate = Services::FormatTimestamp(adminDocuments->UploadedAt(i));
+                        batch.AddText(ToSFMLString(displayDate), font, 11u, sf::Vector2f(sidebarWidth + 450.f, itemY + 10.f),
+                                      sf::Color(100, 100, 100));
                         
                         // File size
-                        sf::Text sizeText(ToSFMLString("Größe: " + adminDocuments[i].fileSize + " B"), font, 11u);
-                        sizeText.setFillColor(sf::Color(100, 100, 100));
-                        sizeText.setPosition(sidebarWidth + 450.f, itemY + 28.f);
-                        window.draw(sizeText);
+                        int64_t fileSize = adminDocuments->FileSize(i);
+                        batch.AddText(ToSFMLString("Größe: " + (fileSize >= 0 ? std::to_string(fileSize) : std::string()) + " B"), font, 11u,
+                                      sf::Vector2f(sidebarWidth + 450.f, itemY + 28.f), sf::Color(100, 100, 100));
                     }
                 }
+                batch.Flush(window);
                 
             } else if (adminSubTab == 3) {
                 // === EXTRAKTIONEN ===
@@ -1878,94 +2583,60 @@ void RunGui(Presentation::ViewModel::MainViewModel &vm)
                     adminExtrsLoading = true;
                     Services::HttpResponse resp = Services::ApiService::Get("Admin/extractions");
                     if (resp.isSuccess && !resp.body.empty()) {
-                        adminExtractions.clear();
-                        std::string body = resp.body;
-                        
-                        // Parse extractions array
-                        size_t pos = 0;
-                        while ((pos = body.find("{", pos)) != std::string::npos) {
-                            size_t endPos = body.find("}", pos);
-                            if (endPos == std::string::npos) break;
-                            
-                            std::string extrObj = body.substr(pos, endPos - pos + 1);
-                            
-                            if (extrObj.find("\"status\"") == std::string::npos) {
-                                pos = endPos + 1;
-                                continue;
-                            }
-                            
-                            ExtractionInfo extr;
-                            extr.extractionId = ExtractJsonField(extrObj, "id");
-                            extr.fileName = ExtractJsonField(extrObj, "fileName");
-                            extr.extractionMethod = ExtractJsonField(extrObj, "extractionMethod");
-                            extr.completedAt = ExtractJsonField(extrObj, "completedAt");
-                            extr.status = ExtractJsonField(extrObj, "status");
-                            extr.uploadedBy = ExtractJsonField(extrObj, "uploadedBy");
-                            
-                            adminExtractions.push_back(extr);
-                            pos = endPos + 1;
-                        }
+                        auto table = std::make_shared<Services::ExtractionTable>();
+                        table->Ingest(resp.body);
+                        adminExtractions = std::move(table);
+                        adminExtrsList.dirty = true;
+                        adminExtrsList.hasView = false;
                         adminExtrsLoaded = true;
                     }
                     adminExtrsLoading = false;
                 }
                 
-                sf::RectangleShape extrsBox(sf::Vector2f(900.f, 500.f));
-                extrsBox.setPosition(sidebarWidth + 20.f, 170.f);
-                extrsBox.setFillColor(sf::Color(250, 250, 250));
-                extrsBox.setOutlineColor(sf::Color(180, 180, 180));
-                extrsBox.setOutlineThickness(1.f);
-                window.draw(extrsBox);
+                refreshAdminList(adminExtrsList, adminExtractions);
+                drawAdminListControls(1, sidebarWidth);
+                batch.AddRect(sf::FloatRect(sidebarWidth + 20.f, 170.f, 900.f, 500.f), sf::Color(250, 250, 250),
+                              sf::Color(180, 180, 180));
                 
-                if (adminExtractions.empty() && adminExtrsLoaded) {
-                    sf::Text noExtrs(ToSFMLString("Keine Extraktionen vorhanden"), font, 14u);
-                    noExtrs.setFillColor(sf::Color(150, 150, 150));
-                    noExtrs.setPosition(sidebarWidth + 350.f, 350.f);
-                    window.draw(noExtrs);
+                if (adminExtractions->Empty() && adminExtrsLoaded) {
+                    batch.AddText(ToSFMLString("Keine Extraktionen vorhanden"), font, 14u, sf::Vector2f(sidebarWidth + 350.f, 350.f),
+                                  sf::Color(150, 150, 150));
                 } else {
-                    // Extractions list
-                    float extrY = 190.f;
-                    for (size_t i = 0; i < adminExtractions.size(); ++i) {
-                        float itemY = extrY + (i * 75.f);
-                        if (itemY > 650.f) break;
+                    // Extractions list (sichtbarer Ausschnitt der Permutation aus adminExtrsList)
+                    const Services::TableQueryResult& view = adminExtrsList.view;
+                    for (size_t slot = 0; slot < adminListRows && adminExtrsList.hasView; ++slot) {
+                        size_t displayRow = adminExtrsList.firstRow + slot;
+                        if (displayRow >= view.DisplayRows()) break;
+                        float itemY = 190.f + (slot * 75.f);
+                        size_t index = 0;
+                        if (view.IsGroupHeader(displayRow, index)) {
+                            drawAdminGroupHeader(view.groups[index], "Extraktionen", sidebarWidth, itemY);
+                            continue;
+                        }
+                        size_t i = view.rows[index];
                         
                         // Extraction item background
-                        sf::RectangleShape extrItem(sf::Vector2f(890.f, 70.f));
-                        extrItem.setPosition(sidebarWidth + 25.f, itemY);
-                        extrItem.setFillColor(i % 2 == 0 ? sf::Color(255, 255, 255) : sf::Color(245, 245, 245));
-                        extrItem.setOutlineColor(sf::Color(200, 200, 200));
-                        extrItem.setOutlineThickness(1.f);
-                        window.draw(extrItem);
+                        batch.AddRect(sf::FloatRect(sidebarWidth + 25.f, itemY, 890.f, 70.f),
+                                      displayRow % 2 == 0 ? sf::Color(255, 255, 255) : sf::Color(245, 245, 245), sf::Color(200, 200, 200));
                         
                         // Filename
-                        std::string displayName = adminExtractions[i].fileName.length() > 50 ? 
-                            adminExtractions[i].fileName.substr(0, 47) + "..." : adminExtractions[i].fileName;
-                        sf::Text fileNameText(ToSFMLString(displayName), font, 12u);
-                        fileNameText.setFillColor(sf::Color::Black);
-                        fileNameText.setPosition(sidebarWidth + 35.f, itemY + 10.f);
-                        window.draw(fileNameText);
+                        std::string_view fileName = adminExtractions->FileName(i);
+                        std::string displayName = fileName.length() > 50 ? 
+                            std::string(fileName.substr(0, 47)) + "..." : std::string(fileName);
+                        batch.AddText(ToSFMLString(displayName), font, 12u, sf::Vector2f(sidebarWidth + 35.f, itemY + 10.f),
+                                      sf::Color::Black);
                         
                         // Extraction method
-                        sf::Text methodText(ToSFMLString("Methode: " + adminExtractions[i].extractionMethod), font, 11u);
-                        methodText.setFillColor(sf::Color(100, 100, 100));
-                        methodText.setPosition(sidebarWidth + 35.f, itemY + 28.f);
-                        window.draw(methodText);
+                        batch.AddText(ToSFMLString("Methode: " + adminExtractions->Method(i)), font, 11u,
+                                      sf::Vector2f(sidebarWidth + 35.f, itemY + 28.f), sf::Color(100, 100, 100));
                         
-                        // Completed date (truncated to 19 chars)
-                        std::string displayDate = adminExtractions[i].completedAt.length() > 19 ? 
-                            adminExtractions[i].completedAt.substr(0, 19) : adminExtractions[i].completedAt;
-                        sf::Text dateText(ToSFMLString(displayDate), font, 11u);
-                        dateText.setFillColor(sf::Color(100, 100, 100));
-                        dateText.setPosition(sidebarWidth + 450.f, itemY + 10.f);
-                        window.draw(dateText);
+                        // Completed date (beim Laden geparst)
+                        std::string displayDate = Services::FormatTimestamp(adminExtractions->CompletedAt(i));
+                        batch.AddText(ToSFMLString(displayDate), font, 11u, sf::Vector2f(sidebarWidth + 450.f, itemY + 10.f),
+                                      sf::Color(100, 100, 100));
                         
                         // Status (color-coded)
-                        int statusCode = 0;
-                        try {
-                            statusCode = std::stoi(adminExtractions[i].status);
-                        } catch (...) {
-                            statusCode = 0;
-                        }
+                        int statusCode = adminExtractions->Status(i);
                         
                         std::string statusText;
                         sf::Color statusColor;
@@ -1984,13 +2655,119 @@ void RunGui(Presentation::ViewModel::MainViewModel &vm)
                             statusColor = sf::Color(100, 100, 100);
                         }
                         
-                        sf::Text statusDisplay(ToSFMLString(statusText), font, 11u);
-                        statusDisplay.setFillColor(statusColor);
-                        statusDisplay.setPosition(sidebarWidth + 450.f, itemY + 28.f);
-                        window.draw(statusDisplay);
+                        batch.AddText(ToSFMLString(statusText), font, 11u, sf::Vector2f(sidebarWidth + 450.f, itemY + 28.f),
+                                      statusColor);
                     }
                 }
+                batch.Flush(window);
 
+            } else if (adminSubTab == 4) {
+                // === LOGS ===
+                if (!logTail.IsRunning()) {
+                    logTail.Start(1000);
+                }
+                
+                const float logListY = 170.f;
+                const float logRowHeight = 16.f;
+                const size_t logVisibleRows = 31;
+                
+                std::string levelLabel = "Level: " + (logLevelFilter == 0 ? std::string("Alle") : logTail.Name(logLevelFilter));
+                std::string categoryLabel = "Kategorie: " + (logCategoryFilter == 0 ? std::string("Alle") : logTail.Name(logCategoryFilter));
+                if (categoryLabel.length() > 30) categoryLabel = categoryLabel.substr(0, 27) + "...";
+                
+                struct LogButton { float x; float width; std::string label; bool highlighted; };
+                std::vector<LogButton> logButtons = {
+                    {sidebarWidth + 20.f, 170.f, levelLabel, logLevelFilter != 0},
+                    {sidebarWidth + 200.f, 230.f, categoryLabel, logCategoryFilter != 0},
+                    {sidebarWidth + 440.f, 100.f, "Folgen", logFollow},
+                    {sidebarWidth + 550.f, 90.f, "Leeren", false}
+                };
+                for (size_t b = 0; b < logButtons.size(); ++b) {
+                    sf::RectangleShape btn(sf::Vector2f(logButtons[b].width, 26.f));
+                    btn.setPosition(logButtons[b].x, 130.f);
+                    btn.setFillColor(logButtons[b].highlighted ? sf::Color(70, 130, 180) : sf::Color(200, 200, 200));
+                    window.draw(btn);
+                    
+                    sf::Text btnText(ToSFMLString(logButtons[b].label), font, 12u);
+                    btnText.setFillColor(logButtons[b].highlighted ? sf::Color::White : sf::Color::Black);
+                    btnText.setPosition(logButtons[b].x + 8.f, 135.f);
+                    window.draw(btnText);
+                    
+                    router.AddRegion(sf::FloatRect(logButtons[b].x, 130.f, logButtons[b].width, 26.f), logButtonHandler, b);
+                }
+                
+                // Scrollen hält das Mitlaufen an, ganz unten läuft es wieder mit
+                if (event.type == sf::Event::MouseWheelScrolled &&
+                    event.mouseWheelScroll.x >= sidebarWidth + 20.f && event.mouseWheelScroll.x <= sidebarWidth + 920.f &&
+                    event.mouseWheelScroll.y >= logListY && event.mouseWheelScroll.y <= logListY + 500.f) {
+                    long target = static_cast<long>(logFirstRow) - static_cast<long>(event.mouseWheelScroll.delta * 3.f);
+                    long maxFirst = static_cast<long>(logMatches > logVisibleRows ? logMatches - logVisibleRows : 0);
+                    target = std::max(0L, std::min(target, maxFirst));
+                    logFirstRow = static_cast<size_t>(target);
+                    logFollow = target >= maxFirst;
+                    logViewDirty = true;
+                }
+                
+                // Sichtbare Zeilen nur bei neuen Einträgen, Filter- oder Scrolländerung neu holen
+                if (logViewDirty || logTail.Version() != logViewVersion) {
+                    logViewVersion = logTail.Version();
+                    logViewDirty = false;
+                    if (logFollow) {
+                        logMatches = logTail.Collect(logLevelFilter, logCategoryFilter, 0, 0, logRows);
+                        logFirstRow = logMatches > logVisibleRows ? logMatches - logVisibleRows : 0;
+                    }
+                    logMatches = logTail.Collect(logLevelFilter, logCategoryFilter, logFirstRow, logVisibleRows, logRows);
+                }
+                
+                std::string logStatus = std::to_string(logMatches) + " Einträge | Puffer " + std::to_string(logTail.Size()) + "/" + std::to_string(logTail.Capacity());
+                std::string logError = logTail.LastError();
+                if (!logError.empty()) logStatus += " | Fehler: " + logError;
+                sf::Text logStatusText(ToSFMLString(logStatus), font, 11u);
+                logStatusText.setFillColor(logError.empty() ? sf::Color(100, 100, 100) : sf::Color(180, 60, 60));
+                logStatusText.setPosition(sidebarWidth + 650.f, 136.f);
+                window.draw(logStatusText);
+                
+                sf::RectangleShape logBox(sf::Vector2f(900.f, 500.f));
+                logBox.setPosition(sidebarWidth + 20.f, logListY);
+                logBox.setFillColor(sf::Color(250, 250, 250));
+                logBox.setOutlineColor(sf::Color(180, 180, 180));
+                logBox.setOutlineThickness(1.f);
+                window.draw(logBox);
+                
+                float rowY = logListY + 4.f;
+                for (const auto& record : logRows) {
+                    std::string level = logTail.Name(record.level);
+                    std::string time = record.timestamp.length() >= 19 && record.timestamp[10] == 'T'
+                        ? record.timestamp.substr(11, 12) : record.timestamp;
+                    std::string line = time + "  " + level + "  [" + logTail.Name(record.category) + "]  " + record.message;
+                    if (line.length() > 150) {
+                        size_t cut = 147;
+                        while (cut > 0 && (static_cast<unsigned char>(line[cut]) & 0xC0) == 0x80) --cut;
+                        line = line.substr(0, cut) + "...";
+                    }
+                    
+                    sf::Color lineColor(60, 60, 60);
+                    if (level.find("Error") != std::string::npos || level.find("Critical") != std::string::npos) {
+                        lineColor = sf::Color(190, 40, 40);
+                    } else if (level.find("Warn") != std::string::npos) {
+                        lineColor = sf::Color(190, 120, 20);
+                    } else if (level.find("Debug") != std::string::npos || level.find("Trace") != std::string::npos) {
+                        lineColor = sf::Color(140, 140, 140);
+                    }
+                    
+                    sf::Text lineText(ToSFMLString(line), font, 10u);
+                    lineText.setFillColor(lineColor);
+                    lineText.setPosition(sidebarWidth + 28.f, rowY);
+                    window.draw(lineText);
+                    rowY += logRowHeight;
+                }
+                
+                if (logRows.empty()) {
+                    sf::Text emptyText(ToSFMLString(logTail.Size() == 0 ? "Warte auf Logeinträge..." : "Keine Einträge für diesen Filter"), font, 14u);
+                    emptyText.setFillColor(sf::Color(150, 150, 150));
+                    emptyText.setPosition(sidebarWidth + 40.f, logListY + 80.f);
+                    window.draw(emptyText);
+                }
             }
             
         } else if (activeTab == 4) { // Einstellungen - API URL Settings
@@ -2063,12 +2840,127 @@ void RunGui(Presentation::ViewModel::MainViewModel &vm)
                 }
             }
             
+            // Mehrere Backends: Zustand je Knoten neben dem Test-Button
+            if (Services::ApiService::Nodes().Size() > 1) {
+                auto nodes = Services::ApiService::Nodes().Status();
+                for (size_t n = 0; n < nodes.size() && n < 5; ++n) {
+                    std::ostringstream line;
+                    line << (nodes[n].reachable ? "OK     " : "AUS    ") << nodes[n].url << "  |  " << nodes[n].outstanding << " offen, "
+                         << static_cast<int>(nodes[n].latencyMs + 0.5) << " ms, " << nodes[n].requests << " Requests, "
+                         << nodes[n].failures << " Fehler";
+                    sf::Text nodeText(ToSFMLString(line.str()), font, 11u);
+                    nodeText.setFillColor(nodes[n].reachable ? sf::Color(50, 150, 50) : sf::Color(200, 50, 50));
+                    nodeText.setPosition(sidebarWidth + 240.f, 245.f + n * 16.f);
+                    window.draw(nodeText);
+                }
+            }
+            
             if (!apiResponse.empty()) {
                 sf::Text connStatus(apiResponse, font, 12u);
                 connStatus.setFillColor(apiResponse.find("") != std::string::npos ? sf::Color(50, 150, 50) : sf::Color(200, 50, 50));
                 connStatus.setPosition(sidebarWidth + 20.f, 300.f);
                 window.draw(connStatus);
             }
+            
+            // === DIAGNOSE ===
+            sf::Text diagTitle(ToSFMLString("Diagnose (Antwortzeiten)"), font, 16u);
+            diagTitle.setFillColor(sf::Color::Black);
+            diagTitle.setPosition(sidebarWidth + 20.f, 330.f);
+            window.draw(diagTitle);
+            
+            const float sparkX = sidebarWidth + 440.f;
+            const float sparkWidth = 470.f;
+            const float sparkHeight = 70.f;
+            auto diagnostics = diagnosticsMonitor.Snapshot();
+            
+            // Texte und Sparklines nur nach einer neuen Messrunde neu aufbauen
+            if (diagnostics->version != diagnosticsVersion) {
+                diagnosticsVersion = diagnostics->version;
+                diagnosticsSparklines.clear();
+                diagnosticsLines.clear();
+                
+                for (size_t p = 0; p < diagnostics->probes.size(); ++p) {
+                    const auto& probe = diagnostics->probes[p];
+                    float rowY = 385.f + p * 100.f;
+                    
+                    std::ostringstream line;
+                    line << std::fixed << std::setprecision(1)
+                         << "p50 " << probe.p50Ms << " | p95 " << probe.p95Ms << " | p99 " << probe.p99Ms
+                         << " | Jitter " << probe.jitterMs << " ms | Ausfälle " << probe.failures << "/" << probe.samples;
+                    diagnosticsLines.push_back(line.str());
+                    
+                    float maxRtt = 1.f;
+                    for (float rtt : probe.history) maxRtt = std::max(maxRtt, rtt);
+                    float step = sparkWidth / static_cast<float>(Services::DiagnosticsMonitor::kWindow - 1);
+                    float baseY = rowY + 10.f + sparkHeight;
+                    
+                    // Linie über alle erfolgreichen Messungen, Ausfälle als rote Striche
+                    sf::VertexArray spark(sf::LineStrip);
+                    sf::VertexArray failures(sf::Lines);
+                    sf::Color lineColor = probe.degraded ? sf::Color(200, 80, 40) : sf::Color(70, 130, 180);
+                    for (size_t i = 0; i < probe.history.size(); ++i) {
+                        float x = sparkX + i * step;
+                        if (probe.history[i] < 0.f) {
+                            failures.append(sf::Vertex(sf::Vector2f(x, baseY - sparkHeight), sf::Color(200, 50, 50)));
+                            failures.append(sf::Vertex(sf::Vector2f(x, baseY), sf::Color(200, 50, 50)));
+                            continue;
+                        }
+                        spark.append(sf::Vertex(sf::Vector2f(x, baseY - probe.history[i] / maxRtt * sparkHeight), lineColor));
+                    }
+                    diagnosticsSparklines.push_back(spark);
+                    diagnosticsSparklines.push_back(failures);
+                }
+            }
+            
+            if (!diagnostics->warning.empty()) {
+                sf::Text diagWarning(ToSFMLString("Warnung: " + diagnostics->warning), font, 12u);
+                diagWarning.setFillColor(sf::Color(200, 80, 40));
+                diagWarning.setPosition(sidebarWidth + 20.f, 358.f);
+                window.draw(diagWarning);
+            }
+            
+            for (size_t p = 0; p < diagnostics->probes.size(); ++p) {
+                const auto& probe = diagnostics->probes[p];
+                float rowY = 385.f + p * 100.f;
+                
+                sf::RectangleShape probeBox(sf::Vector2f(900.f, 92.f));
+                probeBox.setPosition(sidebarWidth + 20.f, rowY);
+                probeBox.setFillColor(probe.degraded ? sf::Color(255, 240, 230) : sf::Color(248, 248, 248));
+                probeBox.setOutlineColor(sf::Color(180, 180, 180));
+                probeBox.setOutlineThickness(1.f);
+                window.draw(probeBox);
+                
+                sf::Text probeName(ToSFMLString("/api/" + probe.endpoint + "  (" + probe.layer + ")"), font, 13u);
+                probeName.setFillColor(sf::Color::Black);
+                probeName.setPosition(sidebarWidth + 30.f, rowY + 10.f);
+                window.draw(probeName);
+                
+                std::string lastText = probe.samples == 0 ? "Noch keine Messung"
+                    : probe.lastMs < 0.f ? "Zuletzt: nicht erreichbar" : "Zuletzt: " + std::to_string(static_cast<int>(probe.lastMs + 0.5)) + " ms";
+                sf::Text probeLast(ToSFMLString(lastText), font, 12u);
+                probeLast.setFillColor(probe.lastMs < 0.f ? sf::Color(200, 50, 50) : sf::Color(60, 60, 60));
+                probeLast.setPosition(sidebarWidth + 30.f, rowY + 35.f);
+                window.draw(probeLast);
+                
+                if (p < diagnosticsLines.size()) {
+                    sf::Text probeStats(ToSFMLString(diagnosticsLines[p]), font, 10u);
+                    probeStats.setFillColor(sf::Color(100, 100, 100));
+                    probeStats.setPosition(sidebarWidth + 30.f, rowY + 60.f);
+                    window.draw(probeStats);
+                }
+                
+                sf::RectangleShape sparkBox(sf::Vector2f(sparkWidth, sparkHeight));
+                sparkBox.setPosition(sparkX, rowY + 10.f);
+                sparkBox.setFillColor(sf::Color::White);
+                sparkBox.setOutlineColor(sf::Color(210, 210, 210));
+                sparkBox.setOutlineThickness(1.f);
+                window.draw(sparkBox);
+                
+                if (p * 2 + 1 < diagnosticsSparklines.size()) {
+                    window.draw(diagnosticsSparklines[p * 2]);
+                    window.draw(diagnosticsSparklines[p * 2 + 1]);
+                }
+            }
         } else if (activeTab == 5) { // Profil - Login/User Info
             if (isLoginInputMode) {
                 // LOGIN FORM
@@ -2189,9 +3081,74 @@ void RunGui(Presentation::ViewModel::MainViewModel &vm)
             status.setPosition(sidebarWidth + 20.f, 70.f);
             window.draw(status);
         }
+        tabScope.reset();
         
-        window.display();
+        std::optional<Services::FrameProfiler::Scope> overlayScope(std::in_place, profOverlays);
+        // Konfliktliste des Offline-Journals (über allen Tabs)
+        if (showConflicts && !syncConflicts.empty()) {
+            sf::RectangleShape panel(sf::Vector2f(620.f, 60.f + syncConflicts.size() * 44.f));
+            panel.setPosition(1200.f - 635.f, 55.f);
+            panel.setFillColor(sf::Color(255, 250, 245));
+            panel.setOutlineColor(sf::Color(200, 150, 120));
+            panel.setOutlineThickness(1.f);
+            window.draw(panel);
+
+            float conflictY = 65.f;
+            for (const auto& conflict : syncConflicts) {
+                sf::Text what(ToSFMLString(conflict.entry.description + " (" + conflict.entry.method + " " + conflict.entry.endpoint + ")"), font, 12u);
+                what.setFillColor(sf::Color::Black);
+                what.setPosition(1200.f - 625.f, conflictY);
+                window.draw(what);
+
+                std::string reason = std::string(Services::SyncService::IsConflictStatus(conflict.statusCode) ? "Konflikt" : "Abgelehnt") +
+                                     " (Status " + std::to_string(conflict.statusCode) + "): " + conflict.message;
+                if (reason.length() > 90) reason = reason.substr(0, 87) + "...";
+                sf::Text why(ToSFMLString(reason), font, 10u);
+                why.setFillColor(sf::Color(160, 60, 40));
+                why.setPosition(1200.f - 625.f, conflictY + 18.f);
+                window.draw(why);
+                conflictY += 44.f;
+                if (conflictY > 600.f) break;
+            }
+
+            sf::RectangleShape dismissBtn(sf::Vector2f(120.f, 26.f));
+            dismissBtn.setPosition(1200.f - 140.f, conflictY + 4.f);
+            dismissBtn.setFillColor(sf::Color(200, 100, 80));
+            window.draw(dismissBtn);
+
+            sf::Text dismissText(ToSFMLString("Verwerfen"), font, 12u);
+            dismissText.setFillColor(sf::Color::White);
+            dismissText.setPosition(1200.f - 115.f, conflictY + 8.f);
+            window.draw(dismissText);
+
+            router.AddRegion(sf::FloatRect(1200.f - 140.f, conflictY + 4.f, 120.f, 26.f), conflictDismissHandler);
+        }
+
+        frameOverlay.Draw(window, frameProfiler);
+        overlayScope.reset();
+
+        {
+            Services::FrameProfiler::Scope scope(profDisplay);
+            window.display();
+        }
+        frameProfiler.EndFrame();
     }
+
+    Services::FrameProfiler::SetCurrent(nullptr);
+    if (Services::Tracer::IsEnabled()) {
+        Services::Tracer::Stop();
+        writeTrace(tracePath.empty() ? Services::Tracer::DefaultPath() : tracePath);
+    }
+    statisticsPoller.Stop();
+    resultPrefetcher.Stop();
+    diagnosticsMonitor.Stop();
+    logTail.Stop();
+    syncService.Stop();
+    offlineJournal.Close();
+
+    // Ausstehende Index-Änderungen sichern
+    if (searchIndex.PendingChanges() > 0) searchIndex.Save();
+    localStore.Close();
 #else
     std::cout << "-- Console fallback GUI --\n";
     std::cout << "Press enter to start extraction (skeleton)" << std::endl;
@@ -1,23 +1,37 @@
 #pragma once
 
+#include "../../Core/Entity.h"
+#include <cstdint>
+#include <map>
 #include <memory>
 #include <string>
 
-namespace UseCases { class ExtractTextUseCase; }
+namespace UseCases { class ExtractTextUseCase; class ExtractionRouter; }
 
 namespace Presentation::ViewModel {
 
 class MainViewModel {
 public:
-    explicit MainViewModel(std::shared_ptr<UseCases::ExtractTextUseCase> usecase);
+    explicit MainViewModel(std::shared_ptr<UseCases::ExtractTextUseCase> usecase,
+                           std::shared_ptr<UseCases::ExtractionRouter> router = nullptr);
     void StartExtraction(const std::string &path);
     std::string GetStatus() const;
     std::string GetLastResult() const;
 
+    // Merkt sich den lokalen Pfad eines hochgeladenen Dokuments für lokale Extraktion
+    void RememberUpload(const std::string &fileId, const std::string &localPath);
+    std::string GetLocalPath(const std::string &fileId) const;
+
+    // Extraktion über den Router (lokal oder Server); route enthält danach den gewählten Weg
+    Core::ExtractionResult ExtractDocument(const std::string &fileId, const Core::ExtractionOptions &options,
+                                           std::string *route = nullptr);
+
 private:
     std::shared_ptr<UseCases::ExtractTextUseCase> usecase_;
+    std::shared_ptr<UseCases::ExtractionRouter> router_;
     std::string status_ = "Idle";
     std::string lastResult_;
+    std::map<std::string, std::string> localPaths_; // fileId -> lokaler Pfad
 };
 
 } // namespace Presentation::ViewModel
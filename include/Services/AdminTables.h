@@ -0,0 +1,188 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+namespace Services {
+
+/// <summary>
+/// Zeitstempel als Sekunden seit 1970 (UTC); kNoTimestamp wenn das Feld fehlt, null oder nicht lesbar ist
+/// </summary>
+constexpr int64_t kNoTimestamp = std::numeric_limits<int64_t>::min();
+
+/// <summary>
+/// Liest "YYYY-MM-DDTHH:MM:SS" am Anfang von text; Millisekunden und Zone dahinter werden ignoriert
+/// </summary>
+int64_t ParseTimestamp(std::string_view text);
+
+/// <summary>
+/// Gegenstück zu ParseTimestamp: "YYYY-MM-DDTHH:MM:SS" bzw. "" für kNoTimestamp
+/// </summary>
+std::string FormatTimestamp(int64_t seconds);
+
+/// <summary>
+/// Position eines Textes in einer StringArena
+/// </summary>
+struct StringRef {
+    uint32_t offset = 0;
+    uint32_t length = 0;
+};
+
+/// <summary>
+/// Freie Texte einer Tabelle (IDs, Namen, E-Mails) hintereinander in einem Puffer
+/// Eine Zelle ist nur eine 8-Byte-Referenz statt eines eigenen std::string mit Heap-Block.
+/// </summary>
+class StringArena {
+public:
+    StringRef Add(std::string_view text);
+    std::string_view Get(StringRef ref) const { return std::string_view(data_.data() + ref.offset, ref.length); }
+    void Clear() { data_.clear(); }
+    size_t MemoryBytes() const { return data_.capacity(); }
+
+private:
+    std::string data_;
+};
+
+/// <summary>
+/// Interning für Spalten mit wenigen verschiedenen Werten (Rolle, Methode, Benutzer)
+/// Jeder Wert wird einmal gespeichert, Zeilen halten nur die ID; ID 0 ist der leere String.
+/// </summary>
+class StringDictionary {
+public:
+    StringDictionary();
+    StringDictionary(const StringDictionary&) = delete;
+    StringDictionary& operator=(const StringDictionary&) = delete;
+
+    uint32_t Intern(std::string_view text);
+    const std::string& Get(uint32_t id) const { return *values_[id]; }
+    size_t Size() const { return values_.size(); }
+    void Clear();
+    size_t MemoryBytes() const;
+
+private:
+    std::unordered_map<std::string, uint32_t> ids_;
+    std::vector<const std::string*> values_;  // Zeigt auf die Schlüssel in ids_ (Knoten bleiben stabil)
+};
+
+/// <summary>
+/// Benutzerliste (GET Admin/users) spaltenweise
+/// </summary>
+class UserTable {
+public:
+    /// <summary>
+    /// Hängt die Benutzer eines JSON-Arrays an; Objekte ohne "username" werden übersprungen
+    /// Gibt die Anzahl neuer Zeilen zurück
+    /// </summary>
+    size_t Ingest(const std::string& json);
+    void Clear();
+
+    size_t Size() const { return active_.size(); }
+    bool Empty() const { return active_.empty(); }
+
+    std::string_view UserId(size_t row) const { return arena_.Get(userId_[row]); }
+    std::string_view Username(size_t row) const { return arena_.Get(username_[row]); }
+    std::string_view Email(size_t row) const { return arena_.Get(email_[row]); }
+    const std::string& Role(size_t row) const { return roles_.Get(role_[row]); }
+    int64_t CreatedAt(size_t row) const { return createdAt_[row]; }
+    int64_t LastLogin(size_t row) const { return lastLogin_[row]; }
+    bool IsActive(size_t row) const { return active_[row] != 0; }
+    void SetActive(size_t row, bool active) { active_[row] = active ? 1 : 0; }
+
+    size_t MemoryBytes() const;
+
+private:
+    StringArena arena_;
+    StringDictionary roles_;
+    std::vector<StringRef> userId_;
+    std::vector<StringRef> username_;
+    std::vector<StringRef> email_;
+    std::vector<uint32_t> role_;
+    std::vector<int64_t> createdAt_;
+    std::vector<int64_t> lastLogin_;
+    std::vector<uint8_t> active_;
+};
+
+/// <summary>
+/// Dokumentenliste (GET Admin/documents) spaltenweise; Größe -1 wenn unbekannt
+/// </summary>
+class DocumentTable {
+public:
+    /// <summary>
+    /// Hängt die Dokumente eines JSON-Arrays an; Objekte ohne "fileName" werden übersprungen
+    /// </summary>
+    size_t Ingest(const std::string& json);
+    void Clear();
+
+    size_t Size() const { return fileSize_.size(); }
+    bool Empty() const { return fileSize_.empty(); }
+
+    std::string_view FileId(size_t row) const { return arena_.Get(fileId_[row]); }
+    std::string_view FileName(size_t row) const { return arena_.Get(fileName_[row]); }
+    const std::string& UploadedBy(size_t row) const { return users_.Get(uploadedBy_[row]); }
+    int64_t UploadedAt(size_t row) const { return uploadedAt_[row]; }
+    int64_t FileSize(size_t row) const { return fileSize_[row]; }
+
+    // IDs der internierten Spalten (zum Sortieren und Gruppieren)
+    uint32_t UploadedById(size_t row) const { return uploadedBy_[row]; }
+    const StringDictionary& Users() const { return users_; }
+
+    size_t MemoryBytes() const;
+
+private:
+    StringArena arena_;
+    StringDictionary users_;
+    std::vector<StringRef> fileId_;
+    std::vector<StringRef> fileName_;
+    std::vector<uint32_t> uploadedBy_;
+    std::vector<int64_t> uploadedAt_;
+    std::vector<int64_t> fileSize_;
+};
+
+/// <summary>
+/// Extraktionsliste (GET Admin/extractions) spaltenweise
+/// Status ist der numerische Code des Backends (0 wenn nicht numerisch, wie bisher mit std::stoi)
+/// </summary>
+class ExtractionTable {
+public:
+    /// <summary>
+    /// Hängt die Extraktionen eines JSON-Arrays an; Objekte ohne "status" werden übersprungen
+    /// </summary>
+    size_t Ingest(const std::string& json);
+    void Clear();
+
+    size_t Size() const { return status_.size(); }
+    bool Empty() const { return status_.empty(); }
+
+    std::string_view ExtractionId(size_t row) const { return arena_.Get(extractionId_[row]); }
+    std::string_view FileName(size_t row) const { return arena_.Get(fileName_[row]); }
+    const std::string& Method(size_t row) const { return methods_.Get(method_[row]); }
+    const std::string& UploadedBy(size_t row) const { return users_.Get(uploadedBy_[row]); }
+    int64_t CompletedAt(size_t row) const { return completedAt_[row]; }
+    int32_t Status(size_t row) const { return status_[row]; }
+
+    // IDs der internierten Spalten (zum Sortieren und Gruppieren)
+    uint32_t MethodId(size_t row) const { return method_[row]; }
+    uint32_t UploadedById(size_t row) const { return uploadedBy_[row]; }
+    const StringDictionary& Methods() const { return methods_; }
+    const StringDictionary& Users() const { return users_; }
+
+    size_t MemoryBytes() const;
+
+private:
+    StringArena arena_;
+    StringDictionary methods_;
+    StringDictionary users_;
+    std::vector<StringRef> extractionId_;
+    std::vector<StringRef> fileName_;
+    std::vector<uint32_t> method_;
+    std::vector<uint32_t> uploadedBy_;
+    std::vector<int64_t> completedAt_;
+    std::vector<int32_t> status_;
+};
+
+} // namespace Services
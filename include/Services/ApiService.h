@@ -1,5 +1,6 @@
 #pragma once
 
+#include "NodeSet.h"
 #include <string>
 #include <memory>
 #include <map>
@@ -15,6 +16,7 @@ struct HttpResponse {
     std::string body;
     std::map<std::string, std::string> headers;
     bool isSuccess = false;
+    bool queued = false;  // Offline im Journal abgelegt, wird später übertragen
     
     // Login-Daten aus JSON-Response
     std::string user_email;
@@ -35,6 +37,7 @@ public:
     
     /// <summary>
     /// Setzt die API-URL manuell
+    /// Mehrere gleichwertige Backends durch Komma getrennt: Requests werden verteilt, bei Ausfall eines Knotens umgeleitet
     /// </summary>
     static void SetApiUrl(const std::string& url);
     
@@ -44,9 +47,14 @@ public:
     static void SetApiUrl(const std::string& ip, int port);
     
     /// <summary>
-    /// Gibt die aktuelle API-URL zurück
+    /// Gibt die aktuelle API-URL zurück (mehrere Knoten durch ", " getrennt)
     /// </summary>
     static std::string GetApiUrl();
+
+    /// <summary>
+    /// Die Backend-Knoten, auf die alle Requests verteilt werden (Status für die Einstellungen)
+    /// </summary>
+    static NodeSet& Nodes();
     
     /// <summary>
     /// Prüft die Verbindung zum Backend
@@ -55,6 +63,18 @@ public:
     
     // HTTP Methods
     static HttpResponse Get(const std::string& endpoint);
+    
+    /// <summary>
+    /// GET mit zusätzlichen Request-Headern (z.B. If-None-Match für bedingte Requests)
+    /// Response-Header stehen kleingeschrieben in response.headers
+    /// </summary>
+    static HttpResponse Get(const std::string& endpoint, const std::map<std::string, std::string>& requestHeaders);
+    
+    /// <summary>
+    /// GET ohne den Body zu puffern: erfolgreiche Antworten gehen stückweise an onData
+    /// Gibt onData false zurück, wird der Transfer abgebrochen. Bei Fehlerstatus steht der Body in response.body
+    /// </summary>
+    static HttpResponse GetStream(const std::string& endpoint, std::function<bool(const char* data, size_t size)> onData);
     static HttpResponse Post(const std::string& endpoint, const std::string& jsonBody);
     static HttpResponse Put(const std::string& endpoint, const std::string& jsonBody);
     static HttpResponse Delete(const std::string& endpoint);
@@ -80,18 +100,18 @@ public:
     /// </summary>
     static void ClearAuthCredentials();
     
+    /// <summary>
+    /// Schaltet die Debug-Ausgaben pro Request ab (z.B. für die Kommandozeile)
+    /// </summary>
+    static void SetVerbose(bool verbose);
+    
     /// <summary>
     /// SHA256-Hash für Passwort
     /// </summary>
     static std::string HashPassword(const std::string& password);
     
-private:
-    static std::string _baseUrl;
-    static std::string _authUsername;
-    static std::string _authPassword;
-    
     /// <summary>
-    /// Erstellt einen Authorization Header (Basic Auth)
+    /// Erstellt einen Authorization Header (Basic Auth) aus den gespeicherten Credentials
     /// </summary>
     static std::string GetAuthHeader();
     
@@ -100,6 +120,11 @@ private:
     /// </summary>
     static std::string BytesToHex(const unsigned char* bytes, size_t length);
     
+private:
+    static std::string _authUsername;
+    static std::string _authPassword;
+    static bool _verbose;
+    
     /// <summary>
     /// Parst JSON Response für Login-Daten
     /// </summary>
@@ -0,0 +1,26 @@
+#pragma once
+
+#include <cstdlib>
+#include <string>
+
+namespace Services {
+
+/// <summary>
+/// Pfad einer Anwendungsdatei im Home-Verzeichnis (USERPROFILE unter Windows, sonst HOME)
+/// Ohne Home-Verzeichnis liegt die Datei relativ zum Arbeitsverzeichnis.
+/// </summary>
+inline std::string AppDataPath(const std::string& name)
+{
+    #ifdef _WIN32
+        const char* home = std::getenv("USERPROFILE");
+    #else
+        const char* home = std::getenv("HOME");
+    #endif
+
+    if (!home) {
+        return name;
+    }
+    return std::string(home) + "/" + name;
+}
+
+} // namespace Services
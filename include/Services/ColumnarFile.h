@@ -0,0 +1,104 @@
+#pragma once
+
+#include "MappedFile.h"
+#include <cstdint>
+#include <cstdio>
+#include <functional>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace Services {
+
+/// <summary>
+/// Schreibt Zeilen spaltenweise in Zeilengruppen, jede Spalte einer Gruppe zlib-komprimiert
+/// Aufbau: Magic "TEFCOL1\n", Gruppen, Footer (Spaltennamen, Offset und Zeilenzahl je Gruppe),
+/// Footer-Offset (u64), Footer-CRC (u32), Magic. Eine Gruppe ist rowCount (u32) gefolgt von
+/// je Spalte rawSize, compressedSize, CRC der Rohdaten (je u32) und den komprimierten Daten;
+/// roh ist jede Spalte eine Folge von Länge (u32) + Bytes. Werte in Host-Byte-Reihenfolge wie
+/// im LocalStore. Große Spalten (Text) liegen so getrennt von den Metadaten und ein Leser kann
+/// sie überspringen. Im Speicher liegt immer nur die aktuelle Gruppe.
+/// </summary>
+class ColumnarWriter {
+public:
+    ColumnarWriter() = default;
+    ~ColumnarWriter();
+    ColumnarWriter(const ColumnarWriter&) = delete;
+    ColumnarWriter& operator=(const ColumnarWriter&) = delete;
+
+    /// <summary>
+    /// Legt die Datei an; eine Gruppe wird geschrieben sobald groupRows Zeilen oder groupBytes Rohdaten erreicht sind
+    /// </summary>
+    bool Open(const std::string& path, const std::vector<std::string>& columns,
+              size_t groupRows = 4096, size_t groupBytes = 8u << 20);
+
+    /// <summary>
+    /// Hängt eine Zeile an; values muss so viele Einträge haben wie Spalten
+    /// Ein Wert über 1 GB passt nicht in eine Gruppe: die Zeile wird abgelehnt (false), nichts wird abgeschnitten
+    /// </summary>
+    bool Append(const std::vector<std::string_view>& values);
+
+    /// <summary>
+    /// Schreibt die letzte Gruppe und den Footer; ohne Close ist die Datei unvollständig
+    /// </summary>
+    bool Close();
+
+    uint64_t Rows() const { return rows_; }
+    const std::string& LastError() const { return error_; }
+
+private:
+    struct GroupInfo {
+        uint64_t offset;
+        uint32_t rows;
+    };
+
+    std::FILE* file_ = nullptr;
+    std::vector<std::string> columns_;
+    std::vector<std::string> buffers_;   // Rohdaten der aktuellen Gruppe je Spalte
+    std::vector<GroupInfo> groups_;
+    std::string compressed_;
+    size_t groupRows_ = 0;
+    size_t groupBytes_ = 0;
+    uint32_t pendingRows_ = 0;
+    size_t pendingBytes_ = 0;
+    uint64_t offset_ = 0;
+    uint64_t rows_ = 0;
+    std::string error_;
+
+    bool Write(const void* data, size_t size);
+    bool FlushGroup();
+};
+
+/// <summary>
+/// Liest Dateien von ColumnarWriter über ein Memory-Mapping
+/// </summary>
+class ColumnarReader {
+public:
+    bool Open(const std::string& path);
+
+    const std::vector<std::string>& Columns() const { return columns_; }
+    uint64_t Rows() const { return rows_; }
+    const std::string& LastError() const { return error_; }
+
+    /// <summary>
+    /// Ruft onRow für jede Zeile auf; nur die Spalten aus columns werden entpackt (leer = alle)
+    /// Die string_views gelten nur während des Aufrufs. Gibt onRow false zurück, endet das Lesen.
+    /// </summary>
+    bool ForEach(const std::vector<size_t>& columns,
+                 const std::function<bool(const std::vector<std::string_view>&)>& onRow);
+
+private:
+    struct GroupInfo {
+        uint64_t offset;
+        uint32_t rows;
+    };
+
+    MappedFile file_;
+    std::vector<std::string> columns_;
+    std::vector<GroupInfo> groups_;
+    uint64_t footerOffset_ = 0;
+    uint64_t rows_ = 0;
+    std::string error_;
+};
+
+} // namespace Services
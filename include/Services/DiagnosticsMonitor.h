@@ -0,0 +1,114 @@
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace Services {
+
+/// <summary>
+/// Auswertung eines Endpunkts über das rollende Fenster
+/// </summary>
+struct ProbeSummary {
+    std::string endpoint;
+    std::string layer;          // Was der Endpunkt zusätzlich misst (Netzwerk, Datenbank, Worker)
+    size_t samples = 0;
+    size_t failures = 0;
+    double lastMs = 0.0;
+    double p50Ms = 0.0;
+    double p95Ms = 0.0;
+    double p99Ms = 0.0;
+    double jitterMs = 0.0;      // Mittlere Abweichung aufeinanderfolgender Messungen
+    bool degraded = false;
+    std::vector<float> history; // RTT in ms, älteste zuerst; < 0 = fehlgeschlagen
+};
+
+/// <summary>
+/// Unveränderlicher Stand aller Messungen; version steigt mit jeder Messrunde
+/// </summary>
+struct DiagnosticsSnapshot {
+    uint64_t version = 0;
+    std::vector<ProbeSummary> probes;
+    std::string warning;        // Leer wenn alles im Normalbereich liegt
+};
+
+/// <summary>
+/// Misst fortlaufend die Antwortzeit von ping, Diagnostics/connection und Diagnostics/stats
+/// Jeder Endpunkt fügt eine Schicht hinzu (Netzwerk, + Datenbank, + Worker-Statistik), so lässt
+/// sich eine Verlangsamung eingrenzen. Pro Endpunkt werden die letzten kWindow Messungen gehalten,
+/// Perzentile und Jitter werden auf dem Worker berechnet und per atomarem Tausch veröffentlicht.
+/// Messfenster und Snapshot verändert nur der Worker, Reset() setzt lediglich eine Anforderung.
+/// </summary>
+class DiagnosticsMonitor {
+public:
+    static constexpr size_t kWindow = 120;
+
+    DiagnosticsMonitor();
+    ~DiagnosticsMonitor();
+    DiagnosticsMonitor(const DiagnosticsMonitor&) = delete;
+    DiagnosticsMonitor& operator=(const DiagnosticsMonitor&) = delete;
+
+    void Start(int intervalMs = 5000);
+    void Stop();
+    bool IsRunning() const { return worker_.joinable(); }
+
+    /// <summary>
+    /// Ändert den Abstand der Messrunden (z.B. schneller solange die Anzeige sichtbar ist)
+    /// </summary>
+    void SetInterval(int intervalMs);
+
+    /// <summary>
+    /// Pausiert die Messrunden (z.B. wenn die Anzeige nicht sichtbar ist)
+    /// </summary>
+    void SetActive(bool active);
+
+    /// <summary>
+    /// Verwirft alle Messungen (z.B. nach Änderung der API-URL); der Worker leert die Fenster
+    /// vor seiner nächsten Veröffentlichung, eine gerade laufende Runde wird mit verworfen
+    /// </summary>
+    void Reset();
+
+    /// <summary>
+    /// Aktueller Stand, nie nullptr
+    /// </summary>
+    std::shared_ptr<const DiagnosticsSnapshot> Snapshot() const;
+
+
+private:
+    struct Probe {
+        std::string endpoint;
+        std::string layer;
+        std::array<float, kWindow> window{};
+        size_t head = 0;
+        size_t count = 0;
+    };
+
+    std::vector<Probe> probes_;
+    std::mutex probesMutex_;
+    std::shared_ptr<const DiagnosticsSnapshot> snapshot_;
+    uint64_t version_ = 0;   // unter probesMutex_
+    bool warned_ = false;
+    std::atomic<bool> resetRequested_{false};
+    std::atomic<bool> active_{true};
+
+    std::thread worker_;
+    std::mutex mutex_;
+    std::condition_variable wake_;
+    bool wakeRequested_ = false;
+    std::atomic<bool> stop_{false};
+    std::atomic<int> intervalMs_{5000};
+
+    void Wake();
+    void Run();
+    void Record(const std::vector<double>& rttMs);
+    void Publish();
+    static ProbeSummary Summarize(const Probe& probe);
+};
+
+} // namespace Services
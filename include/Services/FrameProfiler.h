@@ -0,0 +1,123 @@
+#pragma once
+
+#include <array>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace Services {
+
+/// <summary>
+/// Messwerte eines Frames; Abschnittszeiten sind inklusiv (verschachtelte Abschnitte zählen mit)
+/// </summary>
+struct FrameSample {
+    static constexpr size_t kMaxSections = 24;
+
+    double startMs = 0.0;                         // Seit Start des Profilers
+    float frameMs = 0.f;
+    std::array<float, kMaxSections> sectionMs{};  // Index = Abschnitts-ID
+    uint32_t allocations = 0;                     // Nur wenn der Allokationszähler eingebunden ist
+    uint64_t allocatedBytes = 0;
+};
+
+/// <summary>
+/// Auswertung eines Abschnitts über die betrachteten Frames
+/// </summary>
+struct FrameSectionSummary {
+    std::string name;
+    size_t activeFrames = 0;    // Frames, in denen der Abschnitt lief
+    double avgMs = 0.0;         // Mittel über alle Frames
+    double p99Ms = 0.0;
+    double maxMs = 0.0;
+    double share = 0.0;         // Anteil an der gesamten Frame-Zeit (0..1)
+};
+
+struct FrameSummary {
+    size_t frames = 0;
+    double p50Ms = 0.0;
+    double p99Ms = 0.0;
+    double maxMs = 0.0;
+    double fps = 0.0;
+    double allocationsPerFrame = 0.0;
+    double bytesPerFrame = 0.0;
+    std::vector<FrameSectionSummary> sections;   // Nach Anteil absteigend, nur aktive Abschnitte
+};
+
+/// <summary>
+/// Frame-Zeitmessung für die GUI: benannte Abschnitte werden mit Scope gemessen und pro Frame
+/// in einen Ringpuffer der letzten kFrames Frames geschrieben. Der Profiler gehört dem GUI-Thread;
+/// Scopes auf anderen Threads (z.B. ApiService in Workern) sind no-ops, weil dort kein Profiler
+/// aktiv ist. Allokationen zählt ein ersetzter operator new über CountAllocation (nur in der GUI).
+/// </summary>
+class FrameProfiler {
+public:
+    static constexpr size_t kFrames = 600;
+
+    FrameProfiler();
+
+    /// <summary>
+    /// Liefert die ID zu einem Abschnittsnamen (legt ihn beim ersten Aufruf an, threadsicher)
+    /// -1 wenn bereits kMaxSections Abschnitte existieren
+    /// </summary>
+    static int RegisterSection(const std::string& name);
+    static std::string SectionName(int section);
+
+    /// <summary>
+    /// Profiler des aufrufenden Threads, an den Scopes berichten (nullptr = keine Messung)
+    /// </summary>
+    static void SetCurrent(FrameProfiler* profiler);
+    static FrameProfiler* Current();
+
+    void BeginFrame();
+    void EndFrame();
+    void AddSectionTime(int section, double ms);
+
+    /// <summary>
+    /// Misst die Lebensdauer des Objekts als Zeit des Abschnitts im aktuellen Frame
+    /// </summary>
+    class Scope {
+    public:
+        explicit Scope(int section);
+        ~Scope();
+        Scope(const Scope&) = delete;
+        Scope& operator=(const Scope&) = delete;
+
+    private:
+        FrameProfiler* profiler_;
+        int section_;
+        std::chrono::steady_clock::time_point start_;
+    };
+
+    size_t FrameCount() const { return count_; }
+    /// <summary>
+    /// Die letzten Frames, älteste zuerst
+    /// </summary>
+    std::vector<FrameSample> Frames(size_t lastFrames = kFrames) const;
+    FrameSummary Summarize(size_t lastFrames = kFrames) const;
+
+    /// <summary>
+    /// Schreibt Zusammenfassung und alle Frames des Puffers als JSON
+    /// </summary>
+    bool Dump(const std::string& path, std::string& error) const;
+    static std::string DefaultDumpPath();
+
+    /// <summary>
+    /// Wird vom Allokationszähler bei jeder Allokation aufgerufen (zählt pro Thread)
+    /// </summary>
+    static void CountAllocation(size_t bytes) noexcept;
+
+private:
+    std::chrono::steady_clock::time_point origin_;
+    std::chrono::steady_clock::time_point frameStart_;
+    bool inFrame_ = false;
+    FrameSample current_;
+    uint64_t allocationsAtStart_ = 0;
+    uint64_t bytesAtStart_ = 0;
+    std::vector<FrameSample> ring_;
+    size_t next_ = 0;
+    size_t count_ = 0;
+};
+
+} // namespace Services
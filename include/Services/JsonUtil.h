@@ -0,0 +1,216 @@
+#pragma once
+
+#include <cstdint>
+#include <string>
+
+namespace Services {
+
+// Extrahiere "message" Feld aus JSON Response
+inline std::string ExtractMessageFromJSON(const std::string& json)
+{
+    size_t pos = json.find("\"message\":");
+    if (pos == std::string::npos) {
+        return json; // Fallback: ganze Response wenn kein message Feld
+    }
+    
+    pos = json.find("\"", pos + 10);
+    if (pos == std::string::npos) return json;
+    
+    size_t end = json.find("\"", pos + 1);
+    if (end == std::string::npos) return json;
+    
+    return json.substr(pos + 1, end - pos - 1);
+}
+
+// Extrahiere Wert aus JSON String für ein bestimmtes Feld (String oder Zahl)
+inline std::string ExtractJsonField(const std::string& jsonStr, const std::string& field)
+{
+    size_t pos = jsonStr.find("\"" + field + "\":");
+    if (pos == std::string::npos) return "";
+    
+    pos += field.length() + 3; // Springe über ":
+    
+    // Überspringe Whitespace
+    while (pos < jsonStr.length() && (jsonStr[pos] == ' ' || jsonStr[pos] == '\t')) {
+        pos++;
+    }
+    
+    // Check ob String (mit Anführungszeichen) oder Zahl
+    if (jsonStr[pos] == '"') {
+        // String-Wert
+        pos++;
+        size_t end = jsonStr.find("\"", pos);
+        if (end == std::string::npos) return "";
+        return jsonStr.substr(pos, end - pos);
+    } else {
+        // Numerischer Wert - lese bis zur nächsten Komma oder Klammer
+        size_t end = pos;
+        while (end < jsonStr.length() && jsonStr[end] != ',' && jsonStr[end] != '}' && jsonStr[end] != ']') {
+            end++;
+        }
+        std::string numStr = jsonStr.substr(pos, end - pos);
+        // Entferne Whitespace
+        size_t lastNonSpace = numStr.find_last_not_of(" \t");
+        if (lastNonSpace != std::string::npos) {
+            return numStr.substr(0, lastNonSpace + 1);
+        }
+        return numStr;
+    }
+}
+
+// Wert eines Feldes mit aufgelösten Escapes (\n, \", \uXXXX inkl. Surrogatpaaren)
+// Anders als ExtractJsonField endet ein String nicht an maskierten Anführungszeichen.
+// Zahlen/true/false werden roh zurückgegeben, null als leerer String.
+inline std::string ReadJsonValue(const std::string& json, const std::string& field)
+{
+    std::string search = "\"" + field + "\":";
+    size_t pos = json.find(search);
+    if (pos == std::string::npos) return "";
+    pos += search.size();
+    while (pos < json.size() && (json[pos] == ' ' || json[pos] == '\t')) ++pos;
+    if (pos >= json.size()) return "";
+
+    std::string value;
+    if (json[pos] != '"') {
+        size_t end = json.find_first_of(",}]", pos);
+        value = json.substr(pos, end == std::string::npos ? std::string::npos : end - pos);
+        while (!value.empty() && (value.back() == ' ' || value.back() == '\t' || value.back() == '\n' || value.back() == '\r')) value.pop_back();
+        return value == "null" ? "" : value;
+    }
+
+    auto appendUtf8 = [&value](uint32_t cp) {
+        if (cp < 0x80) {
+            value += static_cast<char>(cp);
+        } else if (cp < 0x800) {
+            value += static_cast<char>(0xC0 | (cp >> 6));
+            value += static_cast<char>(0x80 | (cp & 0x3F));
+        } else if (cp < 0x10000) {
+            value += static_cast<char>(0xE0 | (cp >> 12));
+            value += static_cast<char>(0x80 | ((cp >> 6) & 0x3F));
+            value += static_cast<char>(0x80 | (cp & 0x3F));
+        } else {
+            value += static_cast<char>(0xF0 | (cp >> 18));
+            value += static_cast<char>(0x80 | ((cp >> 12) & 0x3F));
+            value += static_cast<char>(0x80 | ((cp >> 6) & 0x3F));
+            value += static_cast<char>(0x80 | (cp & 0x3F));
+        }
+    };
+    auto hex4 = [&json](size_t at, uint32_t& cp) {
+        if (at + 4 > json.size()) return false;
+        cp = 0;
+        for (size_t k = at; k < at + 4; ++k) {
+            char h = json[k];
+            cp <<= 4;
+            if (h >= '0' && h <= '9') cp |= static_cast<uint32_t>(h - '0');
+            else if (h >= 'a' && h <= 'f') cp |= static_cast<uint32_t>(h - 'a' + 10);
+            else if (h >= 'A' && h <= 'F') cp |= static_cast<uint32_t>(h - 'A' + 10);
+            else return false;
+        }
+        return true;
+    };
+
+    size_t i = pos + 1;
+    while (i < json.size()) {
+        // Unmaskierte Abschnitte am Stück kopieren
+        size_t run = json.find_first_of("\"\\", i);
+        if (run == std::string::npos) run = json.size();
+        value.append(json, i, run - i);
+        i = run;
+        if (i >= json.size() || json[i] == '"') break;
+        if (i + 1 >= json.size()) break;
+
+        char e = json[i + 1];
+        i += 2;
+        switch (e) {
+            case 'n': value += '\n'; break;
+            case 'r': value += '\r'; break;
+            case 't': value += '\t'; break;
+            case 'b': value += '\b'; break;
+            case 'f': value += '\f'; break;
+            case 'u': {
+                uint32_t cp = 0;
+                if (!hex4(i, cp)) break;
+                i += 4;
+                if (cp >= 0xD800 && cp <= 0xDBFF) {
+                    uint32_t low = 0;
+                    if (i + 6 <= json.size() && json[i] == '\\' && json[i + 1] == 'u' && hex4(i + 2, low) &&
+                        low >= 0xDC00 && low <= 0xDFFF) {
+                        cp = 0x10000 + ((cp - 0xD800) << 10) + (low - 0xDC00);
+                        i += 6;
+                    } else {
+                        cp = 0xFFFD;
+                    }
+                } else if (cp >= 0xDC00 && cp <= 0xDFFF) {
+                    cp = 0xFFFD;
+                }
+                appendUtf8(cp);
+                break;
+            }
+            default: value += e; break;
+        }
+    }
+    return value;
+}
+
+// Maskiert einen String für die Ausgabe als JSON-Stringwert (ohne Anführungszeichen)
+inline std::string EscapeJson(const std::string& text)
+{
+    std::string out;
+    out.reserve(text.size() + 8);
+    for (unsigned char c : text) {
+        switch (c) {
+            case '"': out += "\\\""; break;
+            case '\\': out += "\\\\"; break;
+            case '\n': out += "\\n"; break;
+            case '\r': out += "\\r"; break;
+            case '\t': out += "\\t"; break;
+            default:
+                if (c < 0x20) {
+                    static const char hex[] = "0123456789abcdef";
+                    out += "\\u00";
+                    out += hex[c >> 4];
+                    out += hex[c & 0x0F];
+                } else {
+                    out += static_cast<char>(c);
+                }
+        }
+    }
+    return out;
+}
+
+// Ruft onObject für jedes Objekt {...} eines Arrays flacher Objekte auf (z.B. Upload/my-documents)
+// Verschachtelte Objekte werden am ersten '}' abgeschnitten
+template <typename Fn>
+void ForEachFlatObject(const std::string& json, Fn&& onObject)
+{
+    size_t pos = 0;
+    while ((pos = json.find('{', pos)) != std::string::npos) {
+        size_t endPos = json.find('}', pos);
+        if (endPos == std::string::npos) break;
+        onObject(json.substr(pos, endPos - pos + 1));
+        pos = endPos + 1;
+    }
+}
+
+// Position der schließenden Klammer zu '{' oder '[' an start (Strings werden übersprungen), npos wenn unvollständig
+inline size_t FindMatchingBracket(const std::string& json, size_t start)
+{
+    int depth = 0;
+    bool inString = false;
+    for (size_t i = start; i < json.size(); ++i) {
+        char c = json[i];
+        if (inString) {
+            if (c == '\\') ++i;
+            else if (c == '"') inString = false;
+        } else if (c == '"') {
+            inString = true;
+        } else if (c == '{' || c == '[') {
+            ++depth;
+        } else if (c == '}' || c == ']') {
+            if (--depth == 0) return i;
+        }
+    }
+    return std::string::npos;
+}
+
+} // namespace Services
@@ -0,0 +1,159 @@
+#pragma once
+
+#include "MappedFile.h"
+#include <atomic>
+#include <cstdint>
+#include <cstdio>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+namespace Services {
+
+/// <summary>
+/// Art eines Eintrags im lokalen Speicher; Schlüssel sind pro Art eindeutig
+/// </summary>
+enum class StoreKind : uint8_t {
+    Document = 1,    // Metadaten eines Dokuments (JSON-Objekt vom Server), Schlüssel = fileId
+    Extraction = 2,  // Extrahierter Text, Schlüssel = fileId
+    Meta = 3,        // Sonstige Metadaten (z.B. Methode/Zeitpunkt einer Extraktion)
+    Journal = 4      // Ausstehende Schreiboperation im Offline-Modus, Schlüssel = Sequenznummer
+};
+
+/// <summary>
+/// Wert direkt aus dem Mapping des lokalen Speichers; hält das Mapping fest, solange er lebt
+/// </summary>
+class StoreValue {
+public:
+    StoreValue(std::shared_ptr<const MappedFile> mapping, std::string_view value)
+        : mapping_(std::move(mapping)), value_(value) {}
+
+    std::string_view View() const { return value_; }
+    operator std::string_view() const { return value_; }
+
+private:
+    std::shared_ptr<const MappedFile> mapping_;
+    std::string_view value_;
+};
+
+/// <summary>
+/// Lokaler Append-only-Speicher für Dokumente, Extraktionsergebnisse und Metadaten
+/// Jeder Datensatz trägt eine CRC32, ein abgerissener Datensatz am Dateiende (Absturz
+/// beim Schreiben) wird beim Öffnen abgeschnitten. Eine Indexdatei (path + ".idx")
+/// erspart das Einlesen des ganzen Logs, nur danach angehängte Datensätze werden nachgelesen.
+/// Alle Dateien werden nur für den Besitzer lesbar angelegt (0600).
+/// Werte werden ohne Kopie aus dem Mapping gelesen; ein abgelöstes Mapping (nach Anhängen
+/// oder Kompaktierung) wird freigegeben, sobald kein StoreValue und kein ForEach es mehr hält.
+/// </summary>
+class LocalStore {
+public:
+    LocalStore() = default;
+    ~LocalStore();
+    LocalStore(const LocalStore&) = delete;
+    LocalStore& operator=(const LocalStore&) = delete;
+
+    /// <summary>
+    /// Öffnet oder erstellt den Speicher, stellt den Index wieder her
+    /// </summary>
+    bool Open(const std::string& path);
+
+    /// <summary>
+    /// Wartet auf eine laufende Kompaktierung, schreibt den Index und gibt alle Mappings frei
+    /// </summary>
+    void Close();
+
+    bool IsOpen() const { return log_ != nullptr; }
+
+    /// <summary>
+    /// Hängt einen Datensatz an; unveränderte Werte werden nicht erneut geschrieben
+    /// </summary>
+    bool Put(StoreKind kind, std::string_view key, std::string_view value);
+
+    /// <summary>
+    /// Markiert einen Schlüssel als gelöscht
+    /// </summary>
+    bool Remove(StoreKind kind, std::string_view key);
+
+    /// <summary>
+    /// Wert ohne Kopie aus dem Mapping, gültig solange der StoreValue lebt
+    /// </summary>
+    std::optional<StoreValue> Get(StoreKind kind, std::string_view key) const;
+
+    /// <summary>
+    /// Alle Einträge einer Art in Schreibreihenfolge; Views nur während des Aufrufs gültig
+    /// </summary>
+    void ForEach(StoreKind kind, const std::function<void(std::string_view key, std::string_view value)>& fn) const;
+
+    /// <summary>
+    /// Schreibt das Log auf die Platte (fsync) und aktualisiert die Indexdatei
+    /// </summary>
+    bool Flush();
+
+    /// <summary>
+    /// Schreibt nur noch lebende Datensätze in eine neue Datei und ersetzt das Log per Rename
+    /// </summary>
+    bool Compact();
+
+    /// <summary>
+    /// Startet Compact() auf einem Hintergrund-Thread; false wenn bereits eine läuft
+    /// </summary>
+    bool CompactAsync();
+
+    /// <summary>
+    /// Mehr als die Hälfte des Logs (und mindestens 1 MB) sind überschriebene/gelöschte Datensätze
+    /// </summary>
+    bool NeedsCompaction() const;
+
+    size_t EntryCount() const;
+    uint64_t FileBytes() const;
+
+    /// <summary>
+    /// Standardpfad im Home-Verzeichnis, ein Speicher pro Backend und Benutzer
+    /// (~/.text-extraction-store-<Hash aus API-URL und Benutzername>)
+    /// </summary>
+    static std::string DefaultPath(const std::string& apiUrl, const std::string& username);
+
+private:
+    struct Entry {
+        uint64_t recordOffset = 0;
+        uint32_t keyLength = 0;
+        uint32_t valueLength = 0;
+    };
+
+    std::string path_;
+    std::FILE* log_ = nullptr;
+    uint64_t generation_ = 0;  // Kennung des Logs, ändert sich mit jeder Kompaktierung
+    uint64_t end_ = 0;         // Logende inkl. noch nicht gemappter Datensätze
+    uint64_t liveBytes_ = 0;   // Größe aller lebenden Datensätze
+
+    // Schlüssel = Art (1 Byte) + fileId
+    std::unordered_map<std::string, Entry> entries_;
+
+    mutable std::mutex mutex_;
+    mutable std::shared_ptr<MappedFile> map_;
+    mutable std::vector<std::shared_ptr<MappedFile>> retired_;
+
+    std::thread compactThread_;
+    std::atomic<bool> compacting_{false};
+
+    static std::string MakeKey(StoreKind kind, std::string_view key);
+    static uint64_t RecordSize(const Entry& entry);
+
+    bool EnsureMapped(uint64_t size) const;
+    void RetireMapping() const;
+    std::string_view ValueOf(const Entry& entry) const;
+    bool Append(StoreKind kind, uint8_t flags, std::string_view key, std::string_view value, uint64_t& recordOffset);
+    void Apply(const std::string& fullKey, bool removed, const Entry& entry);
+    uint64_t Replay(uint64_t from);
+    uint64_t LoadIndex();
+    bool WriteIndex();
+    bool SyncLog();
+};
+
+} // namespace Services
@@ -0,0 +1,122 @@
+#pragma once
+
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+namespace Services {
+
+/// <summary>
+/// Vorab geparster Logeintrag; Level und Kategorie sind IDs in die Namenstabelle des LogTail
+/// </summary>
+struct LogRecord {
+    uint64_t sequence = 0;   // Laufende Nummer seit Start, lückenlos
+    std::string timestamp;
+    uint16_t level = 0;
+    uint16_t category = 0;
+    std::string message;
+};
+
+/// <summary>
+/// Verfolgt die Backend-Logs (/api/Logging) und hält die letzten Einträge in einem Ringpuffer
+/// Der erste Abruf holt Logging/recent, danach nur noch Logging/daterange ab dem zuletzt
+/// gesehenen Zeitstempel. Der Puffer hat feste Kapazität, alte Einträge werden überschrieben
+/// und ihre Strings wiederverwendet; Level und Kategorien werden nur einmal gespeichert.
+/// </summary>
+class LogTail {
+public:
+    explicit LogTail(size_t capacity = 20000);
+    ~LogTail();
+    LogTail(const LogTail&) = delete;
+    LogTail& operator=(const LogTail&) = delete;
+
+    void Start(int intervalMs = 1000);
+    void Stop();
+    bool IsRunning() const { return worker_.joinable(); }
+
+    /// <summary>
+    /// Pausiert das Abfragen (z.B. wenn der Log-Tab nicht sichtbar ist)
+    /// </summary>
+    void SetActive(bool active);
+
+    /// <summary>
+    /// Leert den Puffer; der nächste Abruf setzt am letzten Zeitstempel fort, bereits gesehene Einträge kommen nicht wieder
+    /// </summary>
+    void Clear();
+
+    /// <summary>
+    /// Übernimmt eine Antwort (JSON-Array) in den Puffer; am Zeitstempel-Übergang werden so viele gleiche
+    /// Einträge verworfen, wie der vorige Abruf zu diesem Zeitpunkt geliefert hat. Einträge ohne Zeitstempel bleiben erhalten
+    /// Gibt die Anzahl neuer Einträge zurück
+    /// </summary>
+    size_t Ingest(const std::string& json);
+
+    /// <summary>
+    /// Steigt bei jeder Änderung des Puffers
+    /// </summary>
+    uint64_t Version() const { return version_.load(); }
+    size_t Capacity() const { return capacity_; }
+    size_t Size() const;
+    uint64_t TotalReceived() const;
+    std::string LastError() const;
+
+    /// <summary>
+    /// Kopiert count passende Einträge ab Position first (0 = ältester passender) nach out
+    /// level/category 0 = alle; Rückgabe ist die Gesamtzahl passender Einträge
+    /// </summary>
+    size_t Collect(uint16_t level, uint16_t category, size_t first, size_t count, std::vector<LogRecord>& out) const;
+
+    /// <summary>
+    /// Bisher gesehene Level bzw. Kategorien als IDs
+    /// </summary>
+    std::vector<uint16_t> Levels() const;
+    std::vector<uint16_t> Categories() const;
+
+    /// <summary>
+    /// Name zu einer ID ("" für 0)
+    /// </summary>
+    std::string Name(uint16_t id) const;
+
+private:
+    const size_t capacity_;
+    std::vector<LogRecord> ring_;
+    size_t head_ = 0;        // Nächster Schreibplatz
+    size_t size_ = 0;
+    uint64_t nextSequence_ = 1;
+
+    // Namenstabelle für Level und Kategorien (ID 0 = leer)
+    std::vector<std::string> names_;
+    std::unordered_map<std::string, uint16_t> nameIds_;
+    std::vector<uint16_t> levels_;
+    std::vector<uint16_t> categories_;
+
+    // Übergang für den inkrementellen Abruf: spätester Zeitpunkt und wie oft jeder Eintrag dort vorkam
+    std::string lastTimestamp_;
+    int64_t lastTime_ = INT64_MIN;
+    std::unordered_map<size_t, uint32_t> boundaryCounts_;
+    std::string lastError_;
+
+    mutable std::mutex mutex_;
+    std::atomic<uint64_t> version_{0};
+
+    std::thread worker_;
+    std::mutex wakeMutex_;
+    std::condition_variable wake_;
+    bool wakeRequested_ = false;
+    std::atomic<bool> stop_{false};
+    std::atomic<bool> active_{true};
+    int intervalMs_ = 1000;
+
+    uint16_t Intern(const std::string& name, std::vector<uint16_t>& seen);
+    void Push(const std::string& timestamp, uint16_t level, uint16_t category, const std::string& message);
+    void Wake();
+    void Run();
+    void Poll();
+};
+
+} // namespace Services
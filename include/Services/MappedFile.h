@@ -0,0 +1,47 @@
+#pragma once
+
+#include <string>
+#include <string_view>
+#include <vector>
+#include <cstddef>
+
+namespace Services {
+
+/// <summary>
+/// Read-only Memory-Mapping einer Datei (RAII)
+/// Unter Windows wird die Datei stattdessen komplett in den Speicher gelesen
+/// </summary>
+class MappedFile {
+public:
+    MappedFile() = default;
+    explicit MappedFile(const std::string& path);
+    ~MappedFile();
+
+    MappedFile(const MappedFile&) = delete;
+    MappedFile& operator=(const MappedFile&) = delete;
+    MappedFile(MappedFile&& other) noexcept;
+    MappedFile& operator=(MappedFile&& other) noexcept;
+
+    /// <summary>
+    /// Öffnet und mappt die Datei, gibt false bei Fehler zurück
+    /// </summary>
+    bool Open(const std::string& path);
+
+    /// <summary>
+    /// Gibt das Mapping frei
+    /// </summary>
+    void Close();
+
+    bool IsOpen() const { return data_ != nullptr; }
+    const char* Data() const { return data_; }
+    size_t Size() const { return size_; }
+    std::string_view View() const { return std::string_view(data_, size_); }
+
+private:
+    const char* data_ = nullptr;
+    size_t size_ = 0;
+    bool mapped_ = false;
+    std::vector<char> buffer_; // Fallback ohne mmap
+};
+
+} // namespace Services
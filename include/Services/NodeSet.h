@@ -0,0 +1,115 @@
+#pragma once
+
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <utility>
+#include <vector>
+
+namespace Services {
+
+/// <summary>
+/// Mehrere gleichwertige Backend-Knoten (Replikate ohne Load Balancer davor)
+/// Ohne Schlüssel wird per "power of two choices" gewählt: zwei zufällige erreichbare Knoten, der mit
+/// weniger offenen Requests (bei Gleichstand und deutlich kürzerer Antwortzeit der schnellere) gewinnt. Dokumentbezogene Requests tragen
+/// die fileId als Schlüssel und landen über konsistentes Hashing immer auf demselben Knoten, solange
+/// er erreichbar ist; fällt ein Knoten aus, wandern nur seine Dokumente weiter. Nicht erreichbare Knoten
+/// werden mit wachsender Pause übersprungen und per GET {url}/ping zurückgeholt.
+/// </summary>
+class NodeSet {
+public:
+    /// <summary>
+    /// Vergabe eines Knotens für einen Request; mit Release zurückgeben
+    /// </summary>
+    struct Lease {
+        size_t node = 0;
+        uint64_t generation = 0;    // Passt nicht mehr nach SetUrls, Release wird dann ignoriert
+        std::string url;
+    };
+
+    struct NodeStatus {
+        std::string url;
+        bool reachable = true;
+        int outstanding = 0;
+        double latencyMs = 0.0;     // Gleitender Mittelwert erfolgreicher Requests
+        uint64_t requests = 0;
+        uint64_t failures = 0;
+    };
+
+    explicit NodeSet(int healthIntervalSeconds = 10);
+    ~NodeSet();
+    NodeSet(const NodeSet&) = delete;
+    NodeSet& operator=(const NodeSet&) = delete;
+
+    /// <summary>
+    /// Ersetzt die Knoten; ab zwei Knoten läuft die Zustandsprüfung im Hintergrund
+    /// </summary>
+    void SetUrls(const std::vector<std::string>& urls);
+    std::vector<std::string> Urls() const;
+    size_t Size() const;
+
+    /// <summary>
+    /// Wählt einen Knoten; tried = in diesem Request schon fehlgeschlagene Knoten
+    /// Sind alle Knoten als nicht erreichbar markiert, wird trotzdem einer geliefert (der Request scheitert dann wie bisher)
+    /// </summary>
+    Lease Acquire(std::string_view affinityKey, const std::vector<size_t>& tried);
+
+    /// <summary>
+    /// reachable = false bei Verbindungsfehlern: Knoten wird vorerst übersprungen
+    /// </summary>
+    void Release(const Lease& lease, bool reachable, double elapsedMs);
+
+    /// <summary>
+    /// Pingt alle Knoten sofort (synchron)
+    /// </summary>
+    void CheckHealth();
+
+    std::vector<NodeStatus> Status() const;
+
+    /// <summary>
+    /// Zerlegt "http://a:5000/api, http://b:5000/api" (Komma, Semikolon oder Leerraum); "/" am Ende wird entfernt
+    /// </summary>
+    static std::vector<std::string> ParseList(const std::string& text);
+
+    /// <summary>
+    /// fileId aus dokumentbezogenen Endpunkten (Extraction/{id}, Extraction/result/{id}, Upload/{id}/...), sonst leer
+    /// </summary>
+    static std::string_view AffinityKey(std::string_view endpoint);
+
+private:
+    using Clock = std::chrono::steady_clock;
+
+    struct Node {
+        std::string url;
+        bool reachable = true;
+        Clock::time_point retryAt{};    // Nicht erreichbar: erst danach wieder einen Versuch wagen
+        int backoffSeconds = 0;
+        int outstanding = 0;
+        double latencyMs = 0.0;
+        uint64_t requests = 0;
+        uint64_t failures = 0;
+    };
+
+    const int healthIntervalSeconds_;
+    mutable std::mutex mutex_;
+    std::vector<Node> nodes_;
+    std::vector<std::pair<uint64_t, size_t>> ring_;  // Hash -> Knoten, sortiert
+    uint64_t generation_ = 0;
+
+    std::thread health_;
+    std::condition_variable wake_;
+    bool stop_ = false;
+
+    bool UsableLocked(size_t node, const std::vector<size_t>& tried, Clock::time_point now) const;
+    size_t PickLocked(std::string_view affinityKey, const std::vector<size_t>& tried, Clock::time_point now);
+    void MarkLocked(Node& node, bool reachable);
+    void StartHealthChecks();
+    void StopHealthChecks();
+    void RunHealthChecks();
+};
+
+} // namespace Services
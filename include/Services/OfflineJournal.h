@@ -0,0 +1,99 @@
+#pragma once
+
+#include "LocalStore.h"
+#include <atomic>
+#include <cstdint>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace Services {
+
+/// <summary>
+/// Eine im Offline-Modus zurückgestellte Schreiboperation
+/// </summary>
+struct JournalEntry {
+    uint64_t sequence = 0;
+    std::string method;       // POST, PUT, DELETE oder UPLOAD
+    std::string endpoint;
+    std::string body;         // JSON-Body, bei UPLOAD der lokale Dateipfad
+    std::string description;  // Anzeigetext für Status und Konflikte
+    std::string user;         // Angemeldeter Benutzer beim Erfassen
+    int64_t createdAt = 0;    // Unix-Zeit
+};
+
+/// <summary>
+/// Beim Nachspielen vom Server abgelehnte Operation
+/// </summary>
+struct SyncConflict {
+    JournalEntry entry;
+    int statusCode = 0;
+    std::string message;
+};
+
+/// <summary>
+/// Dauerhaftes Journal für Schreiboperationen ohne Serververbindung
+/// Einträge liegen in einem eigenen LocalStore (CRC, fsync pro Eintrag) und
+/// werden in Erfassungsreihenfolge nachgespielt; Konflikte bleiben bis zur Bestätigung erhalten.
+/// </summary>
+class OfflineJournal {
+public:
+    /// <summary>
+    /// Öffnet das Journal, die Datei ist nur für den Besitzer lesbar (enthält Request-Bodies, aber keine Passwörter)
+    /// </summary>
+    bool Open(const std::string& path);
+    void Close();
+
+    /// <summary>
+    /// Legt eine Operation dauerhaft ab und vergibt die Sequenznummer
+    /// </summary>
+    uint64_t Append(JournalEntry entry);
+
+    /// <summary>
+    /// Ausstehende Operationen in Erfassungsreihenfolge
+    /// </summary>
+    std::vector<JournalEntry> Pending() const;
+
+    /// <summary>
+    /// Anzahl ausstehender Operationen eines Benutzers
+    /// </summary>
+    size_t PendingCount(const std::string& user) const;
+
+    /// <summary>
+    /// Entfernt eine erfolgreich übertragene Operation
+    /// </summary>
+    bool Complete(uint64_t sequence);
+
+    /// <summary>
+    /// Verschiebt eine abgelehnte Operation in die Konfliktliste
+    /// </summary>
+    bool MarkConflict(const JournalEntry& entry, int statusCode, const std::string& message);
+
+    std::vector<SyncConflict> Conflicts() const;
+    void ClearConflicts();
+
+    /// <summary>
+    /// Zählt bei jeder Änderung an ausstehenden Operationen oder Konflikten hoch (Anzeige nur dann neu aufbauen)
+    /// </summary>
+    uint64_t Version() const { return version_.load(); }
+
+    /// <summary>
+    /// Standardpfad im Home-Verzeichnis (~/.text-extraction-journal)
+    /// </summary>
+    static std::string DefaultPath();
+
+private:
+    LocalStore store_;
+    mutable std::mutex mutex_;
+    uint64_t nextSequence_ = 1;
+    std::unordered_map<std::string, size_t> pendingByUser_;
+    std::atomic<uint64_t> version_{0};
+
+    void ForgetPendingLocked(std::string_view value);
+    static std::string SequenceKey(uint64_t sequence);
+    static std::string Serialize(const JournalEntry& entry);
+    static bool Deserialize(std::string_view data, JournalEntry& entry);
+};
+
+} // namespace Services
@@ -0,0 +1,51 @@
+#pragma once
+
+#include "../Core/ITextExtractor.h"
+#include <memory>
+#include <mutex>
+#include <string>
+
+namespace Services {
+
+/// <summary>
+/// Lokaler Text-Extraktor für PDFs mit Textebene (born-digital)
+/// Liest die xref-Tabelle, dekodiert Flate-Content-Streams und wertet
+/// Tj/TJ-Operatoren mit ToUnicode-CMaps aus. Gescannte Dokumente ohne
+/// Textebene werden erkannt und müssen weiterhin an den Server (OCR).
+/// </summary>
+class PdfTextExtractor : public Core::ITextExtractor {
+public:
+    /// <summary>
+    /// workerCount = 0 verwendet alle verfügbaren CPU-Kerne
+    /// </summary>
+    explicit PdfTextExtractor(unsigned int workerCount = 0);
+
+    /// <summary>
+    /// Prüft anhand der Dateiendung ob es sich um ein PDF handelt
+    /// </summary>
+    bool CanHandle(const std::string& path) const override;
+
+    /// <summary>
+    /// Extrahiert den Text seitenweise parallel, bricht nach options.maxPages ab
+    /// </summary>
+    Core::ExtractionResult Extract(const std::string& path, const Core::ExtractionOptions& options) override;
+
+    /// <summary>
+    /// Schnelltest auf Textebene, liest nur die ersten probePages Seiten
+    /// Das geparste Dokument wird für ein folgendes Extract derselben Datei aufgehoben
+    /// </summary>
+    bool HasTextLayer(const std::string& path, int probePages = 2) override;
+
+private:
+    struct ParsedDocument;
+
+    unsigned int workerCount_;
+    std::mutex probeMutex_;
+    std::string probedPath_;
+    std::shared_ptr<ParsedDocument> probed_;
+
+    std::shared_ptr<ParsedDocument> Parse(const std::string& path, std::string& error);
+    void ExtractPages(const ParsedDocument& parsed, const Core::ExtractionOptions& options, Core::ExtractionResult& result);
+};
+
+} // namespace Services
@@ -0,0 +1,30 @@
+#pragma once
+
+#include "../Core/IRemoteExtractor.h"
+#include <string>
+
+namespace Services {
+
+/// <summary>
+/// Serverseitige Extraktion über POST /api/Extraction/{fileId}
+/// Queue-Tiefe wird aus GET /api/Extraction/stats gelesen
+/// </summary>
+class RemoteExtractor : public Core::IRemoteExtractor {
+public:
+    /// <summary>
+    /// Startet die Extraktion auf dem Server und wartet auf das Ergebnis
+    /// </summary>
+    Core::ExtractionResult Extract(const std::string& fileId, const Core::ExtractionOptions& options) override;
+
+    /// <summary>
+    /// Summe aus wartenden und laufenden Jobs, -1 wenn unbekannt
+    /// </summary>
+    int QueueDepth() override;
+
+    /// <summary>
+    /// Serialisiert die Optionen als ExtractionOptions-DTO
+    /// </summary>
+    static std::string BuildOptionsJson(const Core::ExtractionOptions& options);
+};
+
+} // namespace Services
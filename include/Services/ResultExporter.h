@@ -0,0 +1,86 @@
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <functional>
+#include <string>
+
+namespace Services {
+
+/// <summary>
+/// Eine exportierte Extraktion; error ist gesetzt wenn der Text nicht geladen werden konnte
+/// </summary>
+struct ExportRecord {
+    std::string extractionId;
+    std::string documentId;
+    std::string fileName;
+    std::string method;
+    std::string status;
+    std::string completedAt;
+    std::string uploadedBy;
+    std::string error;
+    std::string text;
+};
+
+enum class ExportSource {
+    AdminListing,   // Admin/extractions seitenweise, Text je Extraktion nachladen
+    Results         // Extraction/results als Stream
+};
+
+struct ExportOptions {
+    ExportSource source = ExportSource::AdminListing;
+    std::string jsonlPath;          // Leer = kein JSONL
+    std::string columnarPath;       // Leer = kein Spaltenformat (ColumnarFile)
+    int pageSize = 100;
+    int jobs = 4;                   // Parallele Requests für fehlende Texte
+    size_t queueCapacity = 64;      // Datensätze je Warteschlange
+};
+
+struct ExportProgress {
+    size_t listed = 0;
+    size_t written = 0;
+    size_t failed = 0;
+    uint64_t textBytes = 0;
+};
+
+/// <summary>
+/// Exportiert Extraktionsergebnisse direkt auf die Platte
+/// Ein Thread listet (Seiten von Admin/extractions oder der Stream von Extraction/results),
+/// jobs Threads laden fehlende Texte parallel nach, der aufrufende Thread schreibt. Zwischen
+/// den Stufen liegen begrenzte Warteschlangen, im Speicher sind also nie mehr als etwa
+/// 2 * queueCapacity + jobs Datensätze plus eine Zeilengruppe des Spaltenformats; beim Blättern
+/// durch Admin/extractions zusätzlich die Metadaten (ohne Texte) aller gelisteten Extraktionen.
+/// Die Dateien entstehen als .part und werden erst nach vollständigem Export umbenannt.
+/// </summary>
+class ResultExporter {
+public:
+    explicit ResultExporter(ExportOptions options);
+
+    /// <summary>
+    /// Führt den Export aus; onProgress wird vom schreibenden Thread aufgerufen
+    /// Gibt false bei Abbruch oder wenn nicht gelistet werden konnte (error enthält den Grund)
+    /// Fehlende Texte einzelner Extraktionen zählen als failed, der Export läuft weiter.
+    /// </summary>
+    bool Run(const std::function<void(const ExportProgress&)>& onProgress, std::string& error);
+
+    /// <summary>
+    /// Bricht einen laufenden Export ab (threadsicher)
+    /// </summary>
+    void Cancel() { cancelled_ = true; }
+
+    /// <summary>
+    /// Liest die bekannten Felder aus einem JSON-Objekt der API
+    /// </summary>
+    static ExportRecord ParseRecord(const std::string& obj);
+
+    /// <summary>
+    /// Eine Zeile JSONL ohne Zeilenumbruch
+    /// </summary>
+    static std::string ToJsonLine(const ExportRecord& record);
+
+private:
+    ExportOptions options_;
+    std::atomic<bool> cancelled_{false};
+};
+
+} // namespace Services
@@ -0,0 +1,127 @@
+#pragma once
+
+#include "ApiService.h"
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <list>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+namespace Services {
+
+/// <summary>
+/// Lädt Extraction/result/{id} spekulativ vor, bevor der Benutzer "Öffnen" klickt
+/// Die GUI meldet per SetWanted die Dokumente nach Wahrscheinlichkeit (unter der Maus, dann sichtbare
+/// Zeilen); erst wenn die Liste dwellMs stabil ist, holt ein einzelner Hintergrund-Thread das erste noch
+/// fehlende Ergebnis. Fällt das Dokument aus der Liste, wird der Transfer abgebrochen; Antworten über
+/// maxResultBytes werden nicht vorgeladen. Fertige Antworten liegen in einem LRU-Cache mit Byte-Budget.
+/// Öffnet der Benutzer ein Dokument ohne Vorabruf, lädt derselbe Thread es per Request vorrangig; die GUI
+/// blockiert nie und fragt TakeRequested pro Frame ab.
+/// </summary>
+class ResultPrefetcher {
+public:
+    struct Stats {
+        uint64_t fetched = 0;      // Vollständig vorgeladen
+        uint64_t cancelled = 0;    // Abgebrochen (nicht mehr gewünscht, zu groß)
+        uint64_t hits = 0;         // Take() aus dem Cache
+        uint64_t misses = 0;
+        size_t cachedBytes = 0;
+    };
+
+    explicit ResultPrefetcher(size_t budgetBytes = 32u << 20, size_t maxResultBytes = 4u << 20, int dwellMs = 150);
+    ~ResultPrefetcher();
+    ResultPrefetcher(const ResultPrefetcher&) = delete;
+    ResultPrefetcher& operator=(const ResultPrefetcher&) = delete;
+
+    void Start();
+    void Stop();
+    bool IsRunning() const { return worker_.joinable(); }
+
+    /// <summary>
+    /// Inaktiv (anderer Tab, offline): nichts Neues laden, laufender Abruf wird abgebrochen
+    /// </summary>
+    void SetActive(bool active);
+
+    /// <summary>
+    /// Gewünschte Dokument-IDs, wahrscheinlichste zuerst; nur bei Änderung aufrufen
+    /// </summary>
+    void SetWanted(const std::vector<std::string>& fileIds);
+
+    /// <summary>
+    /// Entnimmt ein vorgeladenes Ergebnis, ohne zu warten
+    /// false = nicht vorhanden, der Aufrufer lädt per Request nach
+    /// </summary>
+    bool Take(const std::string& fileId, HttpResponse& out);
+
+    /// <summary>
+    /// Lädt fileId vor allen gewünschten Dokumenten, ohne Verweildauer und Größenlimit, auch wenn inaktiv
+    /// Ein laufender Vorabruf desselben Dokuments wird übernommen statt neu gestartet
+    /// </summary>
+    void Request(const std::string& fileId);
+
+    /// <summary>
+    /// true, sobald der Request für fileId beantwortet ist (auch mit Fehlerstatus)
+    /// </summary>
+    bool TakeRequested(const std::string& fileId, HttpResponse& out);
+
+    /// <summary>
+    /// Verwirft ein vorgeladenes Ergebnis (z.B. nach einer neuen Extraktion)
+    /// </summary>
+    void Invalidate(const std::string& fileId);
+
+    /// <summary>
+    /// Verwirft alles (z.B. nach Serverwechsel oder Logout)
+    /// </summary>
+    void Clear();
+
+    Stats GetStats() const;
+
+private:
+    struct Entry {
+        HttpResponse response;
+        std::list<std::string>::iterator lru;
+    };
+
+    const size_t budgetBytes_;
+    const size_t maxResultBytes_;
+    const std::chrono::milliseconds dwell_;
+
+    mutable std::mutex mutex_;
+    std::condition_variable wake_;
+    std::vector<std::string> wanted_;
+    std::chrono::steady_clock::time_point wantedSince_;
+    std::unordered_map<std::string, Entry> cache_;
+    std::list<std::string> lru_;                 // Vorne = zuletzt geladen
+    struct Failure {
+        int attempts = 0;
+        std::chrono::steady_clock::time_point retryAt;   // time_point::max() = nicht erneut versuchen
+    };
+    std::unordered_map<std::string, Failure> failed_;
+    std::string inFlight_;
+    std::string requested_;                      // Vom Benutzer geöffnet, wird vorrangig geladen
+    bool requestDone_ = false;
+    HttpResponse requestedResponse_;
+    size_t cachedBytes_ = 0;
+    Stats stats_;
+    bool active_ = true;
+    bool stop_ = false;
+    std::atomic<bool> abort_{false};             // Laufenden Transfer abbrechen
+    std::atomic<bool> inFlightRequested_{false}; // Laufender Transfer gehört zum Request: kein Limit, kein Abbruch bei Inaktivität
+
+    std::thread worker_;
+
+    void Run();
+    // Erstes gewünschtes Dokument ohne Ergebnis und ohne laufende Wartezeit; leer wenn keins,
+    // retryAt = früheste Wartezeit, die vorher abläuft (Lock gehalten)
+    std::string NextWanted(std::chrono::steady_clock::time_point& retryAt) const;
+    void RecordFailure(const std::string& fileId, const HttpResponse& response);
+    void Store(const std::string& fileId, HttpResponse&& response);
+    void EraseLocked(std::unordered_map<std::string, Entry>::iterator it);
+};
+
+} // namespace Services
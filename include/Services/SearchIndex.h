@@ -0,0 +1,147 @@
+#pragma once
+
+#include "MappedFile.h"
+#include <cstdint>
+#include <map>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+namespace Services {
+
+/// <summary>
+/// Treffer einer Volltextsuche
+/// </summary>
+struct SearchHit {
+    std::string docId;
+    std::string name;
+    uint32_t score = 0; // Anzahl Vorkommen aller Suchbegriffe
+};
+
+/// <summary>
+/// Lokaler invertierter Index über extrahierte Texte
+/// Posting-Listen sind varint-delta-komprimiert (Dokument + Positionen).
+/// Der gespeicherte Stand wird per mmap geöffnet (kein Parsen beim Start),
+/// neue Dokumente landen in einem Delta-Segment im Speicher bis zum nächsten Save().
+/// Suche: Begriffe (UND), "Phrasen" in Anführungszeichen und Präfixe mit *.
+/// </summary>
+class SearchIndex {
+public:
+    SearchIndex() = default;
+    SearchIndex(const SearchIndex&) = delete;
+    SearchIndex& operator=(const SearchIndex&) = delete;
+
+    /// <summary>
+    /// Öffnet den Index, eine fehlende Datei ergibt einen leeren Index
+    /// </summary>
+    bool Open(const std::string& path);
+
+    /// <summary>
+    /// Schreibt Basis + Delta kompaktiert in eine neue Datei und mappt sie neu
+    /// </summary>
+    bool Save();
+
+    /// <summary>
+    /// Indiziert ein Dokument; ein vorhandenes Dokument mit gleicher ID wird ersetzt.
+    /// Gibt false zurück wenn der Text unverändert ist.
+    /// </summary>
+    bool AddDocument(const std::string& docId, const std::string& name, std::string_view text);
+
+    /// <summary>
+    /// Entfernt ein Dokument aus den Suchergebnissen
+    /// </summary>
+    void RemoveDocument(const std::string& docId);
+
+    /// <summary>
+    /// Sucht nach allen Begriffen/Phrasen der Anfrage, sortiert nach Trefferzahl
+    /// </summary>
+    std::vector<SearchHit> Search(const std::string& query, size_t maxResults = 50) const;
+
+    size_t DocumentCount() const { return liveDocs_; }
+    size_t PendingChanges() const { return pendingChanges_; }
+
+    /// <summary>
+    /// Standardpfad im Home-Verzeichnis (~/.text-extraction-index)
+    /// </summary>
+    static std::string DefaultPath();
+
+    /// <summary>
+    /// Zerlegt Text in kleingeschriebene Begriffe (UTF-8); CJK-Zeichen sind Einzelbegriffe
+    /// </summary>
+    static std::vector<std::string> Tokenize(std::string_view text);
+
+private:
+    // Eintrag im sortierten Wörterbuch der Datei
+    struct DictEntry {
+        uint32_t termOffset;
+        uint32_t termLength;
+        uint64_t postingsOffset;
+        uint32_t postingsLength;
+        uint32_t docFreq;
+    };
+
+    struct DeltaPostings {
+        std::string bytes;
+        uint32_t lastDoc = 0;
+        uint32_t docFreq = 0;
+    };
+
+    struct DeltaDoc {
+        std::string id;
+        std::string name;
+        uint64_t hash;
+    };
+
+    struct Clause {
+        std::vector<std::string> terms;
+        bool prefix = false;
+    };
+
+    // Dokument -> Trefferzahl, nach Dokument sortiert
+    using DocList = std::vector<std::pair<uint32_t, uint32_t>>;
+
+    // Positionen eines Begriffs für eine Kandidatenliste, flach gespeichert:
+    // Kandidat i belegt positions[offsets[i] .. offsets[i + 1])
+    struct PositionLists {
+        std::vector<uint32_t> offsets;
+        std::vector<uint32_t> positions;
+    };
+
+    std::string path_;
+    MappedFile file_;
+
+    // Basis-Segment (gemappt)
+    uint32_t baseDocCount_ = 0;
+    uint32_t baseTermCount_ = 0;
+    const uint64_t* docOffsets_ = nullptr;
+    const char* docData_ = nullptr;
+    const DictEntry* dict_ = nullptr;
+    const char* termPool_ = nullptr;
+    const unsigned char* postings_ = nullptr;
+
+    // Delta-Segment (im Speicher)
+    std::map<std::string, DeltaPostings, std::less<>> delta_;
+    std::vector<DeltaDoc> deltaDocs_;
+
+    std::vector<uint8_t> deleted_;                  // pro Dokumentnummer
+    mutable std::unordered_map<std::string, uint32_t> idToDoc_; // lazy aufgebaut
+    mutable bool idMapBuilt_ = false;
+    size_t liveDocs_ = 0;
+    size_t pendingChanges_ = 0;
+
+    void ResetBase();
+    void BuildIdMap() const;
+    std::string_view DocId(uint32_t doc) const;
+    std::string_view DocName(uint32_t doc) const;
+    uint64_t DocHash(uint32_t doc) const;
+    std::string_view BaseTerm(uint32_t index) const;
+    const DictEntry* FindBaseTerm(std::string_view term) const;
+
+    DocList TermDocs(std::string_view term) const;
+    DocList PrefixDocs(std::string_view prefix) const;
+    DocList PhraseDocs(const std::vector<std::string>& terms) const;
+    void CollectPositions(std::string_view term, const std::vector<uint32_t>& candidates, PositionLists& out) const;
+};
+
+} // namespace Services
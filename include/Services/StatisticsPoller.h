@@ -0,0 +1,109 @@
+#pragma once
+
+#include "ApiService.h"
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace Services {
+
+/// <summary>
+/// Eintrag aus recentActivity der Admin-Statistik
+/// </summary>
+struct ActivityEntry {
+    std::string type;
+    std::string fileName;
+    std::string uploadedBy;
+    std::string timestamp;
+
+    bool operator==(const ActivityEntry& other) const;
+};
+
+/// <summary>
+/// Unveränderlicher Stand der Admin-Statistik; version steigt nur wenn sich Werte ändern
+/// </summary>
+struct StatisticsSnapshot {
+    uint64_t version = 0;
+    bool loaded = false;       // Mindestens einmal erfolgreich geladen
+    int usersTotal = 0;
+    int usersActive = 0;
+    int usersInactive = 0;
+    int documentsTotal = 0;
+    int extractionsTotal = 0;
+    std::vector<ActivityEntry> recentActivity;
+    int64_t fetchedAt = 0;     // Unix-Zeit der letzten geänderten Antwort
+    std::string error;         // Letzter Fehler, leer wenn die letzte Abfrage erfolgreich war
+
+    bool SameValues(const StatisticsSnapshot& other) const;
+};
+
+/// <summary>
+/// Fragt Admin/statistics periodisch auf einem Hintergrund-Thread ab
+/// Bedingte Requests (ETag/Last-Modified) vermeiden unnötige Übertragungen, geparst wird
+/// auf dem Worker. Neue Stände werden per atomarem shared_ptr-Tausch veröffentlicht,
+/// der Render-Thread liest ohne Lock und baut seine Texte nur bei neuer version neu auf.
+/// </summary>
+class StatisticsPoller {
+public:
+    explicit StatisticsPoller(std::string endpoint = "Admin/statistics");
+    ~StatisticsPoller();
+    StatisticsPoller(const StatisticsPoller&) = delete;
+    StatisticsPoller& operator=(const StatisticsPoller&) = delete;
+
+    /// <summary>
+    /// Startet den Worker, die erste Abfrage erfolgt sofort
+    /// </summary>
+    void Start(int intervalSeconds = 10);
+    void Stop();
+    bool IsRunning() const { return worker_.joinable(); }
+
+    void SetInterval(int intervalSeconds);
+    int Interval() const { return intervalSeconds_.load(); }
+
+    /// <summary>
+    /// Pausiert die Abfragen (z.B. wenn der Statistik-Tab nicht sichtbar ist)
+    /// </summary>
+    void SetActive(bool active);
+
+    /// <summary>
+    /// Fragt sofort ab statt auf das Intervall zu warten
+    /// </summary>
+    void RefreshNow();
+
+    /// <summary>
+    /// Aktueller Stand, nie nullptr
+    /// </summary>
+    std::shared_ptr<const StatisticsSnapshot> Snapshot() const;
+
+    /// <summary>
+    /// Parst eine Antwort von Admin/statistics (ohne version/fetchedAt)
+    /// </summary>
+    static bool Parse(const std::string& json, StatisticsSnapshot& snapshot);
+
+private:
+    std::string endpoint_;
+    std::shared_ptr<const StatisticsSnapshot> snapshot_;
+    std::thread worker_;
+    std::mutex mutex_;
+    std::condition_variable wake_;
+    bool wakeRequested_ = false;
+    std::atomic<bool> stop_{false};
+    std::atomic<bool> active_{true};
+    std::atomic<int> intervalSeconds_{10};
+
+    // Nur vom Worker benutzt
+    std::string etag_;
+    std::string lastModified_;
+
+    void Wake();
+    void Run();
+    void Poll();
+    void Publish(StatisticsSnapshot next);
+};
+
+} // namespace Services
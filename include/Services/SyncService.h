@@ -0,0 +1,99 @@
+#pragma once
+
+#include "ApiService.h"
+#include "OfflineJournal.h"
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+namespace Services {
+
+/// <summary>
+/// Offline-Modus: verfolgt die Erreichbarkeit des Backends und spielt das Journal nach
+/// Solange der Server nicht erreichbar ist (oder noch Einträge warten, damit die
+/// Reihenfolge erhalten bleibt), landen Schreiboperationen sofort im Journal statt
+/// auf einen Timeout zu warten. Ein Hintergrund-Thread prüft die Verbindung und
+/// überträgt das Journal in Reihenfolge. Vorübergehende Fehler (5xx, 401, 429) halten die
+/// Übertragung mit wachsender Wartezeit an; andere Ablehnungen landen in der Konfliktliste.
+/// </summary>
+class SyncService {
+public:
+    explicit SyncService(OfflineJournal& journal);
+    ~SyncService();
+    SyncService(const SyncService&) = delete;
+    SyncService& operator=(const SyncService&) = delete;
+
+    /// <summary>
+    /// Startet den Hintergrund-Thread; probeIntervalSeconds gilt während der Offline-Phase
+    /// </summary>
+    void Start(int probeIntervalSeconds = 5);
+    void Stop();
+
+    bool IsOnline() const { return online_.load(); }
+    bool IsSyncing() const { return syncing_.load(); }
+    /// <summary>
+    /// Ausstehende Operationen des angemeldeten Benutzers
+    /// </summary>
+    size_t PendingCount() const;
+
+    /// <summary>
+    /// true wenn Schreiboperationen ins Journal müssen (offline oder noch ausstehende Einträge)
+    /// </summary>
+    bool ShouldQueue() const;
+
+    /// <summary>
+    /// Führt eine Schreiboperation aus oder legt sie im Journal ab (Antwort mit queued = true)
+    /// method: POST, PUT, DELETE oder UPLOAD (body = lokaler Dateipfad)
+    /// </summary>
+    HttpResponse Submit(const std::string& method, const std::string& endpoint,
+                        const std::string& body, const std::string& description);
+
+    /// <summary>
+    /// Legt eine Operation ohne Sendeversuch im Journal ab
+    /// Passwortfelder stehen dort nur als Platzhalter, ihr Wert bleibt bis zum Beenden im Speicher
+    /// </summary>
+    HttpResponse Enqueue(const std::string& method, const std::string& endpoint,
+                         const std::string& body, const std::string& description);
+
+    /// <summary>
+    /// Meldet einen Verbindungsfehler (statusCode 0) aus einem direkten Request
+    /// </summary>
+    void ReportOffline();
+
+    /// <summary>
+    /// true wenn seit dem letzten Aufruf Operationen übertragen wurden (Listen neu laden)
+    /// </summary>
+    bool TakeCompleted() { return completed_.exchange(false); }
+
+    /// <summary>
+    /// true für echte Konflikte (409 Conflict, 412 Precondition Failed), sonst wurde die Operation abgelehnt
+    /// </summary>
+    static bool IsConflictStatus(int statusCode) { return statusCode == 409 || statusCode == 412; }
+
+private:
+    OfflineJournal& journal_;
+    std::thread worker_;
+    std::mutex mutex_;
+    std::condition_variable wake_;
+    bool wakeRequested_ = false;
+    std::atomic<bool> stop_{false};
+    std::atomic<bool> online_{true};
+    std::atomic<bool> syncing_{false};
+    std::atomic<bool> completed_{false};
+    int probeIntervalSeconds_ = 5;
+    std::unordered_map<uint64_t, std::vector<std::string>> secrets_;  // Sequenz -> Passwortwerte, unter mutex_
+    int retryDelaySeconds_ = 0;                        // Nur im Worker-Thread
+    std::chrono::steady_clock::time_point retryAt_{};  // Nur im Worker-Thread
+
+    void Wake();
+    void Run();
+    void Replay();
+    static HttpResponse Execute(const std::string& method, const std::string& endpoint, const std::string& body);
+};
+
+} // namespace Services
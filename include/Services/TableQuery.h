@@ -0,0 +1,123 @@
+#pragma once
+
+#include "AdminTables.h"
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace Services {
+
+/// <summary>
+/// Sortierbare Spalten der Admin-Tabellen (Dokumente: Name, User, Date, Size; Extraktionen: Name, Method, Date, Status)
+/// </summary>
+enum class TableColumn { Name, User, Date, Size, Method, Status };
+
+/// <summary>
+/// Sicht auf eine Tabelle: Filter auf den Dateinamen, Sortierung und Gruppierung nach Benutzer
+/// </summary>
+struct TableQuerySpec {
+    bool sorted = false;            // false = Reihenfolge des Servers
+    TableColumn column = TableColumn::Date;
+    bool descending = false;
+    std::string filter;             // Teilstring im Dateinamen ohne Groß-/Kleinschreibung, "abc*" = Präfix
+    bool groupByUser = false;       // Gruppen alphabetisch nach Benutzer, innerhalb nach column
+};
+
+/// <summary>
+/// Zusammenhängender Abschnitt von rows mit demselben Benutzer
+/// </summary>
+struct TableGroup {
+    uint32_t first = 0;             // Position in rows
+    uint32_t count = 0;
+    std::string user;
+};
+
+/// <summary>
+/// Ergebnis einer Abfrage: Zeilenindizes in Anzeigereihenfolge, die Tabelle selbst bleibt unverändert
+/// Mit Gruppierung steht vor jeder Gruppe eine Kopfzeile; Anzeigezeilen = rows + groups.
+/// </summary>
+struct TableQueryResult {
+    std::vector<uint32_t> rows;
+    std::vector<TableGroup> groups;
+    size_t totalRows = 0;           // Zeilen der Tabelle vor dem Filter
+    double elapsedMs = 0.0;
+
+    size_t DisplayRows() const { return rows.size() + groups.size(); }
+
+    /// <summary>
+    /// Löst eine Anzeigezeile auf: true = Kopfzeile der Gruppe index, sonst ist index die Position in rows
+    /// </summary>
+    bool IsGroupHeader(size_t displayRow, size_t& index) const;
+};
+
+/// <summary>
+/// Filtert, sortiert und gruppiert Admin-Tabellen auf einem Worker-Thread
+/// Sortiert wird über vorab berechnete 64-Bit-Schlüssel (Zahlen direkt, internierte Spalten über den
+/// Rang ihres Wertes, Namen über die ersten 8 gefalteten Bytes) und bei großen Tabellen in Blöcken
+/// parallel mit anschließendem Mischen. Die Tabelle wird nur gelesen und per shared_ptr festgehalten,
+/// das Ergebnis ist eine Permutation der Zeilenindizes. Ablauf wie beim TextFinder: Start(), TakeResult().
+/// Jede TableQuery hat einen eigenen Worker-Thread, der immer nur die neueste Abfrage bearbeitet. Der
+/// GUI-Thread wartet bei Start/Cancel nie auf ihn: eine laufende Abfrage wird über das Abbruch-Flag
+/// beendet und ihr Ergebnis anhand der Generationsnummer verworfen. Erst der Destruktor wartet auf den Worker.
+/// </summary>
+class TableQuery {
+public:
+    TableQuery() = default;
+    ~TableQuery();
+    TableQuery(const TableQuery&) = delete;
+    TableQuery& operator=(const TableQuery&) = delete;
+
+    /// <summary>
+    /// Startet eine neue Abfrage; eine laufende wird abgebrochen
+    /// </summary>
+    void Start(std::shared_ptr<const DocumentTable> table, const TableQuerySpec& spec);
+    void Start(std::shared_ptr<const ExtractionTable> table, const TableQuerySpec& spec);
+
+    /// <summary>
+    /// Bricht die laufende Abfrage ab und verwirft ihr Ergebnis, ohne auf den Worker zu warten
+    /// </summary>
+    void Cancel();
+
+    /// <summary>
+    /// Holt ein fertiges Ergebnis ab (GUI-Thread); false wenn keins vorliegt
+    /// </summary>
+    bool TakeResult(TableQueryResult& out);
+
+    bool IsRunning() const;
+
+    /// <summary>
+    /// Synchron (Worker, Benchmarks); threads = 0 wählt nach Tabellengröße und Kernen
+    /// </summary>
+    static TableQueryResult Run(const DocumentTable& table, const TableQuerySpec& spec, size_t threads = 0,
+                                const std::atomic<bool>* cancel = nullptr);
+    static TableQueryResult Run(const ExtractionTable& table, const TableQuerySpec& spec, size_t threads = 0,
+                                const std::atomic<bool>* cancel = nullptr);
+
+private:
+    using Job = std::function<TableQueryResult(const std::atomic<bool>& cancel)>;
+
+    std::thread worker_;            // Startet mit der ersten Abfrage
+    mutable std::mutex mutex_;
+    std::condition_variable wake_;
+    Job job_;                       // Noch nicht begonnene Abfrage (nur die neueste)
+    uint64_t generation_ = 0;       // Zählt mit jedem Start/Cancel hoch
+    bool running_ = false;          // Abfrage der aktuellen Generation offen
+    bool hasResult_ = false;
+    bool stop_ = false;
+    TableQueryResult result_;
+    std::atomic<bool> cancel_{false};  // Bricht die gerade laufende Abfrage ab
+
+    template <typename Table>
+    void StartWorker(std::shared_ptr<const Table> table, const TableQuerySpec& spec);
+    void CancelLocked();
+    void WorkerLoop();
+};
+
+} // namespace Services
@@ -0,0 +1,83 @@
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <vector>
+
+namespace Services {
+
+/// <summary>
+/// Ergebnis einer Suche im Dokumenttext
+/// </summary>
+struct TextFinderResult {
+    std::vector<size_t> hits;   // Byte-Offsets, aufsteigend, nicht überlappend
+    size_t needleLength = 0;    // Länge eines Treffers in Bytes
+    bool truncated = false;     // maxHits erreicht
+    double elapsedMs = 0.0;
+};
+
+/// <summary>
+/// Teilstringsuche in großen Texten, ohne Beachtung von Groß-/Kleinschreibung (inkl. Umlaute).
+/// Kandidaten werden über erstes und letztes Byte des Suchbegriffs vektorisiert gefiltert
+/// (AVX2 mit Laufzeitprüfung, sonst SSE2 bzw. skalar) und danach vollständig verglichen.
+/// Start() sucht auf einem Worker-Thread, das Ergebnis wird mit TakeResult() abgeholt.
+/// </summary>
+class TextFinder {
+public:
+    static constexpr size_t kMaxHits = 1000000;
+
+    TextFinder() = default;
+    ~TextFinder();
+    TextFinder(const TextFinder&) = delete;
+    TextFinder& operator=(const TextFinder&) = delete;
+
+    /// <summary>
+    /// Startet eine neue Suche; eine laufende Suche wird abgebrochen
+    /// </summary>
+    void Start(std::shared_ptr<const std::string> text, const std::string& needle);
+
+    /// <summary>
+    /// Bricht die laufende Suche ab und verwirft ihr Ergebnis
+    /// </summary>
+    void Cancel();
+
+    /// <summary>
+    /// Holt ein fertiges Ergebnis ab (GUI-Thread); false wenn keins vorliegt
+    /// </summary>
+    bool TakeResult(TextFinderResult& out);
+
+    bool IsRunning() const { return running_.load(); }
+
+    /// <summary>
+    /// Findet alle Vorkommen von needle in text (synchron)
+    /// </summary>
+    static std::vector<size_t> FindAll(std::string_view text, std::string_view needle,
+                                       size_t maxHits = kMaxHits,
+                                       const std::atomic<bool>* cancel = nullptr,
+                                       bool* truncated = nullptr);
+
+    /// <summary>
+    /// Faltet A-Z und Latin-1-Großbuchstaben (Ä, Ö, Ü, ...) auf Kleinbuchstaben; die Bytelänge bleibt gleich
+    /// </summary>
+    static std::string Fold(std::string_view text);
+
+    /// <summary>
+    /// Wie Fold, hängt das Ergebnis an out an (ohne eigene Allokation bei wiederverwendetem Puffer)
+    /// </summary>
+    static void FoldInto(std::string_view text, std::string& out);
+
+private:
+    std::thread worker_;
+    std::atomic<bool> cancel_{false};
+    std::atomic<bool> running_{false};
+    std::mutex mutex_;
+    bool hasResult_ = false;
+    TextFinderResult result_;
+};
+
+} // namespace Services
@@ -0,0 +1,79 @@
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <string_view>
+
+namespace Services {
+
+/// <summary>
+/// Aufzeichnung von Zeitspannen (Requests, JSON-Dekodierung, Extraktion, Frames) für Perfetto bzw.
+/// chrome://tracing. Jeder Thread schreibt ohne Sperre in einen eigenen Ringpuffer; nur das Anlegen
+/// eines Puffers (einmal pro Thread) und der Export nehmen eine Sperre. Ist die Aufzeichnung aus,
+/// kostet eine Spanne nur das Lesen eines atomaren Flags.
+/// </summary>
+class Tracer {
+public:
+    static constexpr size_t kEventsPerThread = 8192;
+
+    /// <summary>
+    /// Startet eine neue Aufzeichnung; Ereignisse früherer Aufzeichnungen werden beim Export ignoriert
+    /// </summary>
+    static void Start();
+    static void Stop();
+    static bool IsEnabled() { return enabled_.load(std::memory_order_relaxed); }
+
+    /// <summary>
+    /// Startet die Aufzeichnung, wenn TEF_TRACE gesetzt ist; path erhält den Zielpfad (leer = DefaultPath)
+    /// </summary>
+    static bool StartFromEnvironment(std::string& path);
+
+    /// <summary>
+    /// Name des aufrufenden Threads in der Darstellung (z.B. "GUI", "StatisticsPoller")
+    /// </summary>
+    static void SetThreadName(const std::string& name);
+
+    // Nanosekunden seit Programmstart (gemeinsame Zeitbasis aller Threads)
+    static int64_t NowNs();
+
+    static void Complete(const char* category, std::string_view name, int64_t startNs, int64_t endNs,
+                         std::string_view detail = {});
+    static void Instant(const char* category, std::string_view name, std::string_view detail = {});
+    static void Counter(const char* category, std::string_view name, double value);
+
+    /// <summary>
+    /// Schreibt alle Ereignisse der laufenden bzw. letzten Aufzeichnung als Chrome-Trace-JSON
+    /// Darf während der Aufzeichnung aufgerufen werden; dabei überschriebene Einträge werden verworfen
+    /// </summary>
+    static bool Write(const std::string& path, std::string& error);
+    static size_t EventCount();
+    static std::string DefaultPath();
+
+private:
+    static std::atomic<bool> enabled_;
+};
+
+/// <summary>
+/// Misst die Lebensdauer des Objekts als Spanne; name und suffix werden nur bei aktiver Aufzeichnung kopiert
+/// </summary>
+class TraceSpan {
+public:
+    TraceSpan(const char* category, std::string_view name, std::string_view suffix = {});
+    ~TraceSpan();
+    TraceSpan(const TraceSpan&) = delete;
+    TraceSpan& operator=(const TraceSpan&) = delete;
+
+    // Zusatzinfo (z.B. Status oder Größe), erscheint unter args.detail
+    void SetDetail(std::string_view detail);
+
+private:
+    const char* category_;
+    bool active_;
+    int64_t startNs_ = 0;
+    std::string name_;
+    std::string detail_;
+};
+
+} // namespace Services
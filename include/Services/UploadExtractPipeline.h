@@ -0,0 +1,129 @@
+#pragma once
+
+#include "../Core/Entity.h"
+#include "BoundedQueue.h"
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace Services {
+
+enum class PipelineStage { Waiting, Uploading, Uploaded, Extracting, Fetching, Done, Failed, Cancelled };
+
+/// <summary>
+/// Anzeigetext einer Stufe
+/// </summary>
+const char* PipelineStageName(PipelineStage stage);
+
+/// <summary>
+/// Eine Datei auf dem Weg Upload -> POST Extraction/{fileId} -> Ergebnis
+/// </summary>
+struct PipelineItem {
+    std::string path;
+    std::string fileName;
+    std::string fileId;             // Aus der UploadResponse
+    PipelineStage stage = PipelineStage::Waiting;
+    double uploadProgress = 0.0;    // 0.0 bis 1.0
+    int statusCode = 0;             // Letzter HTTP-Status, 0 = Server nicht erreichbar
+    std::string error;
+    std::string method;
+    std::string completedAt;
+    std::string text;               // Nur in TakeCompleted gefüllt, Snapshot() lässt ihn leer
+    double uploadMs = 0.0;
+    double extractMs = 0.0;         // POST und ggf. Nachladen des Ergebnisses
+};
+
+struct PipelineOptions {
+    Core::ExtractionOptions extraction;
+    int extractJobs = 2;            // Parallele Extraktionen auf dem Server
+    size_t aheadCapacity = 2;       // So viele hochgeladene Dateien dürfen auf eine Extraktion warten
+};
+
+/// <summary>
+/// Hochladen, Extrahieren und Ergebnis abholen als eine Operation pro Datei
+/// Ein Upload-Thread lädt die Dateien nacheinander hoch (die Bandbreite teilt sich ohnehin),
+/// extractJobs Worker stoßen mit der fileId aus der UploadResponse die Extraktion an. Während
+/// Datei N auf dem Server extrahiert wird, läuft schon der Upload von Datei N+1; eine begrenzte
+/// Warteschlange zwischen den Stufen verhindert, dass die Uploads beliebig weit vorauslaufen.
+/// Enthält die Antwort des POST keinen Text, wird Extraction/result/{fileId} gestreamt nachgeladen.
+/// </summary>
+class UploadExtractPipeline {
+public:
+    explicit UploadExtractPipeline(PipelineOptions options = PipelineOptions());
+    ~UploadExtractPipeline();
+    UploadExtractPipeline(const UploadExtractPipeline&) = delete;
+    UploadExtractPipeline& operator=(const UploadExtractPipeline&) = delete;
+
+    /// <summary>
+    /// Reiht Dateien ein (auch während schon andere laufen); startet die Threads beim ersten Aufruf
+    /// </summary>
+    void Add(const std::vector<std::string>& paths);
+
+    /// <summary>
+    /// Noch nicht begonnene Dateien werden verworfen; laufende Requests werden zu Ende geführt
+    /// </summary>
+    void Cancel();
+
+    /// <summary>
+    /// Wartet bis alle eingereihten Dateien abgeschlossen sind und beendet die Threads (Benchmarks)
+    /// Danach nimmt die Pipeline keine Dateien mehr an.
+    /// </summary>
+    void Finish();
+
+    /// <summary>
+    /// Dateien, die noch nicht Done/Failed/Cancelled sind
+    /// </summary>
+    size_t Pending() const;
+
+    /// <summary>
+    /// Zählt bei jeder Statusänderung hoch; Snapshot() nur neu holen wenn sie sich geändert hat
+    /// </summary>
+    uint64_t Version() const { return version_.load(); }
+
+    /// <summary>
+    /// Alle Dateien in Reihenfolge des Einreihens, ohne Text
+    /// </summary>
+    std::vector<PipelineItem> Snapshot() const;
+
+    /// <summary>
+    /// Seit dem letzten Aufruf abgeschlossene Dateien (Done mit Text, Failed mit Fehler); false wenn keine
+    /// </summary>
+    bool TakeCompleted(std::vector<PipelineItem>& out);
+
+    /// <summary>
+    /// Entfernt abgeschlossene Dateien vom Anfang der Liste
+    /// </summary>
+    void ClearFinished();
+
+private:
+    const PipelineOptions options_;
+
+    mutable std::mutex mutex_;
+    std::condition_variable uploadReady_;
+    std::condition_variable idle_;
+    std::deque<PipelineItem> items_;
+    size_t firstItem_ = 0;              // Laufende Nummer von items_.front() (ClearFinished entfernt vorne)
+    size_t nextUpload_ = 0;             // Laufende Nummer der nächsten hochzuladenden Datei
+    std::vector<PipelineItem> completed_;
+    bool stop_ = false;
+    std::atomic<uint64_t> version_{0};
+
+    BoundedQueue<size_t> uploaded_;     // Laufende Nummern, bereit zur Extraktion
+    std::thread uploader_;
+    std::vector<std::thread> extractors_;
+
+    void UploadLoop();
+    void ExtractLoop();
+    void Extract(size_t number);
+    // Eintrag zur laufenden Nummer oder nullptr wenn er inzwischen entfernt wurde (Lock gehalten)
+    PipelineItem* ItemLocked(size_t number);
+    void CompleteLocked(PipelineItem& item, PipelineStage stage, std::string error, std::string text = std::string());
+    void Stop();
+};
+
+} // namespace Services
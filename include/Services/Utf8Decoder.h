@@ -0,0 +1,36 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace Services {
+
+/// <summary>
+/// Validierender UTF-8 zu UTF-32 Decoder mit ASCII-Fast-Path (SSE2)
+/// Ungültige Sequenzen werden einzeln durch U+FFFD ersetzt statt den ganzen String zu verwerfen.
+/// Dekodiert wird immer der ganze String in einem Aufruf auf dem aufrufenden Thread.
+/// </summary>
+class Utf8Decoder {
+public:
+    static constexpr uint32_t kReplacementChar = 0xFFFD;
+
+    /// <summary>
+    /// Dekodiert size Bytes nach out, out muss Platz für mindestens size Codepoints haben.
+    /// Gibt die Anzahl geschriebener Codepoints zurück.
+    /// </summary>
+    static size_t Decode(const char* data, size_t size, uint32_t* out, size_t* replacements = nullptr);
+
+    /// <summary>
+    /// Dekodiert in einen wiederverwendbaren Puffer (Kapazität bleibt zwischen Aufrufen erhalten)
+    /// </summary>
+    static void Decode(const char* data, size_t size, std::vector<uint32_t>& out);
+
+    /// <summary>
+    /// Wie Decode, schreibt zusätzlich den Byte-Offset (relativ zu data) jedes Codepoints nach offsets.
+    /// offsets muss wie out Platz für mindestens size Einträge haben.
+    /// </summary>
+    static size_t DecodeWithOffsets(const char* data, size_t size, uint32_t* out, uint32_t* offsets);
+};
+
+} // namespace Services
@@ -0,0 +1,48 @@
+#pragma once
+
+#include <SFML/Graphics.hpp>
+#include <cstddef>
+#include <vector>
+
+namespace UI {
+
+// Sammelt Rechtecke und Texte eines Bildschirmbereichs und zeichnet sie mit wenigen Draw-Calls:
+// alle Flächen in einem Vertex-Array, Glyphen in einem Array pro Font-Textur (Font + Schriftgröße).
+// Flächen liegen immer unter den Texten desselben Batches; was darüber liegen soll (Popups,
+// Overlays), kommt nach Flush() bzw. in einen eigenen Batch.
+// Die Puffer bleiben über Frames erhalten, nach dem ersten Frame wird nicht mehr alloziert.
+class BatchRenderer {
+public:
+    BatchRenderer();
+
+    void AddRect(const sf::FloatRect& rect, const sf::Color& fill);
+    // Rand wie sf::RectangleShape mit positiver Outline-Dicke: außerhalb von rect
+    void AddRect(const sf::FloatRect& rect, const sf::Color& fill, const sf::Color& outline, float thickness = 1.f);
+    void AddOutline(const sf::FloatRect& rect, const sf::Color& outline, float thickness = 1.f);
+
+    // Gleiche Glyphenpositionen wie sf::Text (Regular, ohne Transformation außer position)
+    void AddText(const sf::String& text, const sf::Font& font, unsigned int characterSize, sf::Vector2f position,
+                 const sf::Color& color);
+
+    // Zeichnet und leert den Batch; gibt die Zahl der Draw-Calls zurück
+    size_t Flush(sf::RenderTarget& target);
+    void Clear();
+
+private:
+    struct GlyphLayer {
+        const sf::Texture* texture = nullptr;
+        sf::VertexArray vertices;
+    };
+
+    sf::VertexArray solid_;
+    std::vector<GlyphLayer> glyphLayers_;
+
+    sf::VertexArray& LayerFor(const sf::Texture& texture);
+};
+
+// Hängt die Glyphen-Quads von chars wie sf::Text (Regular) als Dreiecke an; Textur: font.getTexture(characterSize).
+// charX erhält optional die x-Position jedes Zeichens (wie sf::Text::findCharacterPos) und dahinter die Endposition.
+void AppendGlyphQuads(sf::VertexArray& vertices, const sf::Font& font, unsigned int characterSize, const sf::Uint32* chars,
+                      size_t count, sf::Vector2f position, const sf::Color& color, std::vector<float>* charX = nullptr);
+
+} // namespace UI
@@ -0,0 +1,53 @@
+#pragma once
+
+#include <SFML/Graphics.hpp>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <vector>
+
+namespace UI {
+
+// Verteilt Mausklicks an klickbare Bereiche. Bereiche werden beim Zeichnen registriert (pro Frame neu)
+// und in einem groben Raster abgelegt; ein Klick prüft nur die Bereiche seiner Rasterzelle, unabhängig
+// davon wie viele Zeilen und Buttons es gibt. Handler werden einmal angelegt und bekommen beim Klick
+// den beim Registrieren übergebenen Index (z.B. Zeilennummer), damit pro Frame nichts alloziert wird.
+class EventRouter {
+public:
+    using Handler = std::function<void(size_t index)>;
+
+    EventRouter(float width, float height, float cellSize = 50.f);
+
+    // Einmalig beim Aufbau der Ansicht; Rückgabe ist die Id für AddRegion
+    size_t AddHandler(Handler handler);
+
+    // Verwirft die Bereiche des letzten Frames (vor dem Zeichnen aufrufen)
+    void BeginFrame();
+    // Später registrierte Bereiche liegen oben (Popups nach dem Inhalt registrieren)
+    void AddRegion(const sf::FloatRect& rect, size_t handler, size_t index = 0);
+
+    // Mausklick an den obersten getroffenen Bereich; true wenn ein Handler lief
+    bool Dispatch(const sf::Event& event);
+    bool HitTest(float x, float y, size_t& handler, size_t& index) const;
+
+    size_t RegionCount() const { return regions_.size(); }
+
+private:
+    struct Region {
+        sf::FloatRect rect;
+        uint32_t handler;
+        size_t index;
+    };
+
+    float cellSize_;
+    int columns_;
+    int rows_;
+    std::vector<Handler> handlers_;
+    std::vector<Region> regions_;
+    std::vector<std::vector<uint32_t>> cells_;  // Indizes in regions_, aufsteigend
+
+    int Column(float x) const;
+    int Row(float y) const;
+};
+
+} // namespace UI
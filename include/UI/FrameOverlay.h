@@ -0,0 +1,41 @@
+#pragma once
+
+#include "../Services/FrameProfiler.h"
+#include <SFML/Graphics.hpp>
+#include <chrono>
+#include <string>
+#include <vector>
+
+namespace UI {
+
+// Einblendbare Anzeige des FrameProfilers: Frame-Zeiten (p50/p99), Verlauf, Abschnitte und Allokationen.
+// Texte werden höchstens alle 250 ms neu aufgebaut, damit die Anzeige selbst kaum Frame-Zeit kostet.
+class FrameOverlay {
+public:
+    explicit FrameOverlay(const sf::Font& font);
+
+    void Toggle() { visible_ = !visible_; }
+    bool IsVisible() const { return visible_; }
+    // Statuszeile, z.B. Pfad des letzten Dumps
+    void SetMessage(const std::string& message);
+
+    void Draw(sf::RenderTarget& target, const Services::FrameProfiler& profiler);
+
+private:
+    static constexpr size_t kGraphFrames = 240;
+    static constexpr size_t kMaxSectionRows = 10;
+
+    const sf::Font& font_;
+    bool visible_ = false;
+    std::string message_;
+    std::chrono::steady_clock::time_point lastBuild_;
+    bool built_ = false;
+    std::vector<sf::Text> lines_;
+    std::vector<sf::RectangleShape> bars_;
+    sf::VertexArray graph_;
+    sf::VertexArray budget_;
+
+    void Rebuild(const Services::FrameProfiler& profiler);
+};
+
+} // namespace UI
@@ -15,7 +15,8 @@ class Sidebar {
 public:
     Sidebar(const sf::Font &font, float width = 250.f, float height = 700.f);
     
-    void draw(sf::RenderWindow &window);
+    // Erzeugt die Geometrie der Sidebar; gezeichnet wird beim Flush des Batches
+    void draw(BatchRenderer &batch);
     void handleEvent(const sf::Event &event);
     
     void toggle();
@@ -30,10 +31,7 @@ public:
     /// </summary>
     void setRibbonVisible(int index, bool visible);
     
-    void setHeight(float height) { 
-        height_ = height;
-        background_.setSize(sf::Vector2f(getWidth(), height_));
-    }
+    void setHeight(float height) { height_ = height; }
     
     float getWidth() const { return isExpanded_ ? width_ : collapsedWidth_; }
     float getHeight() const { return height_; }
@@ -61,7 +59,6 @@ private:
     std::vector<Ribbon> ribbons_;
     
     // UI elements
-    sf::RectangleShape background_;
     Button toggleButton_;
     std::vector<Button> ribbonButtons_;
     std::vector<Button> itemButtons_;
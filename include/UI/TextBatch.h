@@ -0,0 +1,56 @@
+#pragma once
+
+#include "BatchRenderer.h"
+#include "TextLayout.h"
+#include <SFML/Graphics.hpp>
+#include <cstddef>
+#include <unordered_map>
+#include <vector>
+
+namespace UI {
+
+// Zeichnet die sichtbaren Zeilen eines umbrochenen Textes als ein Vertex-Array aus der Glyphen-Textur des Fonts.
+// Die Geometrie jeder Zeile wird nach Zeilennummer gecacht; beim Scrollen ändert sich nur die Verschiebung
+// beim Zeichnen, das Array wird erst neu zusammengesetzt wenn andere Zeilen sichtbar werden.
+class TextBatch {
+public:
+    TextBatch(const sf::Font& font, unsigned int characterSize, float lineHeight, const sf::Color& color = sf::Color::Black);
+
+    // Text oder Umbruch hat sich geändert: gecachte Zeilen verwerfen
+    void Invalidate();
+
+    // Sichtbare Zeilen [first, last) aus layout; no-op wenn Bereich und Text unverändert sind
+    void SetVisibleLines(const TextLayout& layout, size_t first, size_t last);
+
+    // x-Position vor Zeichen index der Zeile (relativ zum Zeilenanfang), wie sf::Text::findCharacterPos
+    float CharX(const TextLayout& layout, size_t line, size_t index);
+
+    // origin = linke obere Ecke von Zeile 0 (z.B. Textbox minus Scroll-Offset)
+    void Draw(sf::RenderTarget& target, sf::Vector2f origin) const;
+
+    size_t CachedLines() const { return lines_.size(); }
+
+private:
+    static constexpr size_t kMaxCachedLines = 1024;
+
+    struct LineGeometry {
+        uint32_t byteOffset = 0;
+        uint32_t byteLength = 0;
+        sf::VertexArray vertices{sf::Triangles};  // Zeilenanfang bei (0, 0)
+        std::vector<float> charX;
+    };
+
+    const sf::Font& font_;
+    unsigned int characterSize_;
+    float lineHeight_;
+    sf::Color color_;
+    std::unordered_map<size_t, LineGeometry> lines_;
+    sf::VertexArray visible_{sf::Triangles};  // Zeile first bei y = 0
+    size_t first_ = 0;
+    size_t last_ = 0;
+    bool dirty_ = true;
+
+    const LineGeometry& Line(const TextLayout& layout, size_t index);
+};
+
+} // namespace UI
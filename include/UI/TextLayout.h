@@ -0,0 +1,91 @@
+#pragma once
+
+#include <cstdint>
+#include <functional>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#ifdef USE_SFML
+#include <SFML/Graphics.hpp>
+#endif
+
+namespace UI {
+
+// Eine umbrochene Zeile als Bereich im Quelltext (UTF-8 Bytes und Codepoints)
+struct LineSpan {
+    uint32_t byteOffset = 0;
+    uint32_t byteLength = 0;
+    uint32_t firstChar = 0;  // Index in Chars()
+    uint32_t charCount = 0;  // ohne hängende Leerzeichen und Zeilenumbruch
+    float width = 0.f;
+};
+
+// Zeilenumbruch nach Glyphenbreiten mit vereinfachten UAX#14-Umbruchregeln.
+// Breiten werden einmal pro Text gemessen und gecacht, ein neuer Umbruch
+// (andere Breite) kommt ohne Font-Zugriffe und ohne Allokationen aus.
+// Der Text wird nicht kopiert: er gehört dem Aufrufer und muss bis zum nächsten SetText/Clear gültig bleiben.
+class TextLayout {
+public:
+    // Vorschub von cp in Pixeln inklusive Kerning zum Vorgänger prev (0 am Zeilenanfang)
+    using AdvanceFn = std::function<float(uint32_t prev, uint32_t cp)>;
+
+    void SetAdvanceFunction(AdvanceFn advance, uint32_t fontKey = 0);
+
+    // Setzt den Text neu; gibt false zurück wenn version, Puffer und Font unverändert sind.
+    // Der Aufrufer zählt version bei jeder Textänderung hoch, damit pro Frame kein Textvergleich nötig ist
+    bool SetText(std::string_view utf8, uint64_t version);
+    void Clear();
+
+    // Bricht für maxWidth um; no-op wenn sich weder Breite noch Text geändert haben
+    void Wrap(float maxWidth);
+
+    size_t LineCount() const { return lines_.size(); }
+    const LineSpan& Line(size_t index) const { return lines_[index]; }
+    std::string_view LineText(size_t index) const;
+    // Zeile bzw. Codepoint-Index (in Chars()) zu einem Byte-Offset im Text
+    size_t LineForByte(size_t byteOffset) const;
+    size_t CharForByte(size_t byteOffset) const;
+    const uint32_t* Chars() const { return chars_.data(); }
+    std::string_view Text() const { return text_; }
+    float MaxWidth() const { return maxWidth_; }
+
+private:
+    enum BreakClass : uint8_t {
+        kBreakNone,       // kein Umbruch nach diesem Zeichen
+        kBreakAfter,      // Umbruch nach diesem Zeichen erlaubt (Bindestrich, ZWSP, Soft-Hyphen)
+        kBreakSpace,      // Leerzeichen: Umbruch danach, hängt am Zeilenende
+        kBreakMandatory,  // Zeilenumbruch
+        kBreakIdeograph   // CJK: Umbruch vor und nach erlaubt
+    };
+
+    AdvanceFn advanceFn_;
+    uint32_t fontKey_ = 0;
+    std::string_view text_;
+    uint64_t version_ = 0;
+    std::vector<uint32_t> chars_;
+    std::vector<uint32_t> byteOffsets_; // Byte-Offset jedes Codepoints (+ Endmarke)
+    std::vector<float> advances_;
+    std::vector<uint8_t> classes_;
+    std::vector<LineSpan> lines_;
+    float maxWidth_ = -1.f;
+    bool dirty_ = true;
+
+    static BreakClass Classify(uint32_t cp);
+    static bool NoBreakBefore(uint32_t cp);
+    void Measure();
+    void WrapFrom(size_t firstChar);
+};
+
+// Anzahl der durch Whitespace getrennten Wörter (Statistik der Detailansicht)
+size_t CountWords(std::string_view utf8);
+
+#ifdef USE_SFML
+// Glyphen-Vorschub und Kerning aus einem SFML-Font
+TextLayout::AdvanceFn MakeFontAdvance(const sf::Font& font, unsigned int characterSize);
+
+// Baut den sf::String einer umbrochenen Zeile direkt aus den dekodierten Codepoints
+sf::String LineString(const TextLayout& layout, size_t index);
+#endif
+
+} // namespace UI
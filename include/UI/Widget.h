@@ -1,5 +1,6 @@
 #pragma once
 
+#include "BatchRenderer.h"
 #include <SFML/Graphics.hpp>
 #include <string>
 #include <functional>
@@ -11,7 +12,10 @@ class Widget {
 public:
     virtual ~Widget() = default;
     
-    virtual void draw(sf::RenderWindow &window) = 0;
+    // Widgets erzeugen nur Geometrie; gezeichnet wird beim Flush des Batches
+    virtual void draw(BatchRenderer &batch) = 0;
+    // Einzelnes Widget sofort zeichnen (eigener Batch)
+    void draw(sf::RenderTarget &target);
     virtual void handleEvent(const sf::Event &event) = 0;
     
     void setPosition(float x, float y) { 
@@ -35,7 +39,8 @@ class Button : public Widget {
 public:
     Button(const std::string &label, const sf::Font &font);
     
-    void draw(sf::RenderWindow &window) override;
+    using Widget::draw;
+    void draw(BatchRenderer &batch) override;
     void handleEvent(const sf::Event &event) override;
     
     void setCallback(std::function<void()> callback) { callback_ = callback; }
@@ -60,13 +65,14 @@ class RectShape : public Widget {
 public:
     RectShape(float width, float height, const sf::Color &color = sf::Color::White);
     
-    void draw(sf::RenderWindow &window) override;
+    using Widget::draw;
+    void draw(BatchRenderer &batch) override;
     void handleEvent(const sf::Event &event) override {}
     
-    void setFillColor(const sf::Color &color) { shape_.setFillColor(color); }
+    void setFillColor(const sf::Color &color) { color_ = color; }
     
 private:
-    sf::RectangleShape shape_;
+    sf::Color color_;
 };
 
 } // namespace UI
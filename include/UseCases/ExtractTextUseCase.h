@@ -2,6 +2,7 @@
 
 #include "../Core/Entity.h"
 #include "../Core/IRepository.h"
+#include "../Core/ITextExtractor.h"
 #include <memory>
 #include <string>
 
@@ -9,11 +10,19 @@ namespace UseCases {
 
 class ExtractTextUseCase {
 public:
-    explicit ExtractTextUseCase(std::shared_ptr<Core::IRepository> repo);
+    // extractor ist optional: ohne lokalen Extraktor wird immer das Repository gefragt
+    explicit ExtractTextUseCase(std::shared_ptr<Core::IRepository> repo,
+                                std::shared_ptr<Core::ITextExtractor> extractor = nullptr);
     std::string Execute(const std::string &path);
 
+    // Lokale Extraktion; success == false wenn kein Extraktor passt oder keine Textebene vorhanden ist
+    Core::ExtractionResult Extract(const std::string &path, const Core::ExtractionOptions &options);
+    bool CanExtractLocally(const std::string &path) const;
+    bool HasTextLayer(const std::string &path, int probePages = 2);
+
 private:
     std::shared_ptr<Core::IRepository> repo_;
+    std::shared_ptr<Core::ITextExtractor> extractor_;
 };
 
 } // namespace UseCases
@@ -0,0 +1,95 @@
+#pragma once
+
+#include "../Core/Entity.h"
+#include "../Core/IRemoteExtractor.h"
+#include <chrono>
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+
+namespace UseCases {
+
+class ExtractTextUseCase;
+
+// Ein Dokument kann lokal (Pfad), remote (fileId) oder auf beiden Wegen verfügbar sein
+struct DocumentRef {
+    std::string localPath;
+    std::string fileId;
+    uint64_t sizeBytes = 0; // 0 = unbekannt, wird bei Bedarf aus localPath gelesen
+};
+
+struct RouteDecision {
+    enum class Target { Local, Remote, None };
+    Target target = Target::None;
+    double estimatedLocalMs = -1.0;  // -1 = nicht möglich
+    double estimatedRemoteMs = -1.0;
+    int queueDepth = -1;
+    double sizeMB = 0.0;
+    std::string reason;
+};
+
+// Lineares Kostenmodell: ms = overheadMs + msPerMB * MB, online per normalisiertem LMS gelernt
+struct CostModel {
+    double overheadMs;
+    double msPerMB;
+    int samples = 0;
+
+    double Estimate(double sizeMB) const { return overheadMs + msPerMB * sizeMB; }
+    void Observe(double sizeMB, double elapsedMs);
+};
+
+// Entscheidet pro Dokument zwischen lokaler Extraktion und Server-Extraktion
+// anhand von Dateityp, Größe, Textebene, Server-Queue und gemessenen Laufzeiten.
+// Ist der Server nicht erreichbar, wird automatisch lokal extrahiert (und umgekehrt).
+// Gelernte Kostenmodelle werden unter modelPath gespeichert (leer = nur für diese Sitzung),
+// höchstens alle paar Sekunden und beim Zerstören des Routers.
+class ExtractionRouter {
+public:
+    ExtractionRouter(std::shared_ptr<ExtractTextUseCase> local,
+                     std::shared_ptr<Core::IRemoteExtractor> remote,
+                     std::string modelPath = std::string());
+    ~ExtractionRouter();
+
+    RouteDecision Decide(const DocumentRef &doc, const Core::ExtractionOptions &options);
+
+    // Führt die Extraktion auf dem gewählten Weg aus, mit Fallback auf den anderen
+    Core::ExtractionResult Run(const DocumentRef &doc, const Core::ExtractionOptions &options,
+                               RouteDecision *decisionOut = nullptr);
+
+    CostModel GetLocalModel() const;
+    CostModel GetRemoteModel() const;
+
+    // ~/.text-extraction-router
+    static std::string DefaultModelPath();
+
+private:
+    std::shared_ptr<ExtractTextUseCase> local_;
+    std::shared_ptr<Core::IRemoteExtractor> remote_;
+    const std::string modelPath_;
+
+    mutable std::mutex mutex_;
+    std::mutex saveMutex_;
+    CostModel localModel_{40.0, 25.0};
+    CostModel remoteModel_{600.0, 80.0};
+    std::map<std::string, bool> textLayerCache_; // Pfad -> Textebene vorhanden
+    bool modelsDirty_ = false;
+    std::chrono::steady_clock::time_point savedAt_{};
+
+    int cachedQueueDepth_ = -1;
+    std::chrono::steady_clock::time_point queueCheckedAt_{};
+    std::chrono::steady_clock::time_point backendDownUntil_{};
+
+    int QueueDepth();
+    bool BackendAvailable() const;
+    void MarkBackendDown();
+    bool ProbeTextLayer(const std::string &path);
+    void LoadModels();
+    void SaveModels();
+    void SaveModelsIfDue();
+    Core::ExtractionResult RunLocal(const DocumentRef &doc, const Core::ExtractionOptions &options, double sizeMB);
+    Core::ExtractionResult RunRemote(const DocumentRef &doc, const Core::ExtractionOptions &options, double sizeMB);
+};
+
+} // namespace UseCases
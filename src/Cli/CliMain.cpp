@@ -0,0 +1,726 @@
+// Kommandozeile: Massen-Upload und Extraktion ohne Display (z.B. per cron auf Servern)
+#include "../../include/Services/ApiService.h"
+#include "../../include/Services/ColumnarFile.h"
+#include "../../include/Services/JsonUtil.h"
+#include "../../include/Services/LoginService.h"
+#include "../../include/Services/PdfTextExtractor.h"
+#include "../../include/Services/RemoteExtractor.h"
+#include "../../include/Services/ResultExporter.h"
+#include "../../include/Services/Tracer.h"
+#include "../../include/UseCases/ExtractTextUseCase.h"
+#include "../../include/UseCases/ExtractionRouter.h"
+#include <algorithm>
+#include <atomic>
+#include <cctype>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+#include <memory>
+#include <mutex>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <unordered_set>
+#include <vector>
+
+namespace fs = std::filesystem;
+
+namespace {
+
+enum class Command { Ingest, Upload, Extract, Export, Dump };
+enum class Route { Remote, Local, Auto };
+
+struct CliOptions {
+    Command command = Command::Ingest;
+    std::vector<std::string> inputs;   // Pfade (ingest/upload), fileIds (extract) oder Spaltendatei (dump)
+    std::string apiUrl;
+    std::string user;
+    std::string password;
+    std::string outDir = ".";
+    std::vector<std::string> extensions;
+    int jobs = 4;
+    int retries = 2;
+    Route route = Route::Remote;
+    bool json = false;
+    bool skipExisting = false;
+    bool verbose = false;
+    Core::ExtractionOptions extraction;
+    Services::ExportOptions exporting;
+    std::vector<std::string> columns;  // dump: nur diese Spalten
+    std::string tracePath;             // Chrome-Trace der Requests und Extraktionen
+};
+
+struct Job {
+    std::string path;      // Lokale Datei (leer bei extract)
+    std::string relative;  // Name relativ zum Eingabeordner, bestimmt die Ausgabedatei
+    std::string fileId;
+    uint64_t bytes = 0;
+};
+
+// Verschluckt die Debug-Ausgaben der Services, stdout bleibt für den Fortschritt frei
+class NullBuffer : public std::streambuf {
+protected:
+    int overflow(int c) override { return c; }
+};
+
+void PrintUsage()
+{
+    std::fprintf(stderr,
+        "Verwendung: tef_cli <ingest|upload|extract> [Optionen] <Pfade oder fileIds>...\n"
+        "            tef_cli export [--jsonl DATEI] [--columnar DATEI] [Optionen]\n"
+        "            tef_cli dump [--columns a,b] DATEI\n"
+        "\n"
+        "  ingest   Dateien/Ordner hochladen, extrahieren und Text nach --out schreiben\n"
+        "  upload   Dateien/Ordner nur hochladen, gibt die fileIds aus\n"
+        "  extract  Bereits hochgeladene Dateien (fileIds) extrahieren\n"
+        "  export   Alle Extraktionsergebnisse als JSONL und/oder Spaltenformat speichern\n"
+        "  dump     Spaltenformat-Datei als JSONL auf stdout ausgeben\n"
+        "\n"
+        "Optionen:\n"
+        "  --api URL          Backend, z.B. http://10.0.0.5:5000/api, mehrere durch Komma (Standard: $TEF_API_URL)\n"
+        "  --user NAME        Benutzer (Standard: $TEF_USER oder gespeicherter GUI-Login)\n"
+        "  --password PW      Passwort (besser: $TEF_PASSWORD)\n"
+        "  --out DIR          Zielordner für die Texte (Standard: .)\n"
+        "  --jobs N           Parallele Dateien (Standard: 4)\n"
+        "  --retries N        Wiederholungen bei Netzwerk-/5xx-Fehlern (Standard: 2; Uploads nur bei 502/503/504)\n"
+        "  --ext pdf,png      Nur diese Endungen aus Ordnern übernehmen\n"
+        "  --route R          remote (Standard), local oder auto (ExtractionRouter)\n"
+        "                     local/auto: lokal extrahierte Texte landen nur unter --out, nicht auf dem Server\n"
+        "  --ocr              OCR auf dem Server aktivieren\n"
+        "  --lang CODE        Sprache für die Extraktion (Standard: de)\n"
+        "  --max-pages N      Höchstens N Seiten (0 = alle)\n"
+        "  --skip-existing    Dateien mit vorhandener Ausgabedatei überspringen\n"
+        "  --json             Fortschritt als JSON-Zeilen auf stdout\n"
+        "  --verbose          Debug-Ausgaben der Services auf stderr\n"
+        "  --trace DATEI      Zeitspannen (Requests, Extraktion) als Chrome-Trace speichern (ui.perfetto.dev)\n"
+        "\n"
+        "Export:\n"
+        "  --jsonl DATEI      Eine Extraktion pro Zeile als JSON\n"
+        "  --columnar DATEI   Spaltenformat (TEFCOL1): Metadaten und Text getrennt zlib-komprimiert\n"
+        "  --source S         admin (Standard, Admin/extractions seitenweise) oder results (Extraction/results)\n"
+        "  --page-size N      Einträge pro Seite bei --source admin (Standard: 100)\n"
+        "  --jobs N           Parallele Requests für die Texte\n"
+        "\n"
+        "Exit-Code: 0 = alles erfolgreich, 1 = mindestens eine Datei fehlgeschlagen, 2 = Aufruffehler\n");
+}
+
+std::string EnvOr(const char* name, const std::string& fallback)
+{
+    const char* value = std::getenv(name);
+    return value && *value ? value : fallback;
+}
+
+bool ParseArgs(int argc, char** argv, CliOptions& opts, std::string& error)
+{
+    if (argc < 2) {
+        error = "Kein Befehl angegeben";
+        return false;
+    }
+    std::string command = argv[1];
+    if (command == "--help" || command == "-h") return false;
+    if (command == "ingest") opts.command = Command::Ingest;
+    else if (command == "upload") opts.command = Command::Upload;
+    else if (command == "extract") opts.command = Command::Extract;
+    else if (command == "export") opts.command = Command::Export;
+    else if (command == "dump") opts.command = Command::Dump;
+    else {
+        error = "Unbekannter Befehl: " + command;
+        return false;
+    }
+
+    opts.apiUrl = EnvOr("TEF_API_URL", "");
+    opts.user = EnvOr("TEF_USER", "");
+    opts.password = EnvOr("TEF_PASSWORD", "");
+
+    for (int i = 2; i < argc; ++i) {
+        std::string arg = argv[i];
+        auto value = [&](std::string& target) {
+            if (i + 1 >= argc) {
+                error = arg + " erwartet einen Wert";
+                return false;
+            }
+            target = argv[++i];
+            return true;
+        };
+        auto number = [&](int& target, int minimum) {
+            std::string text;
+            if (!value(text)) return false;
+            char* end = nullptr;
+            long parsed = std::strtol(text.c_str(), &end, 10);
+            if (text.empty() || *end != '\0' || parsed < minimum) {
+                error = arg + ": ungültige Zahl " + text;
+                return false;
+            }
+            target = static_cast<int>(parsed);
+            return true;
+        };
+
+        if (arg == "--api") { if (!value(opts.apiUrl)) return false; }
+        else if (arg == "--user") { if (!value(opts.user)) return false; }
+        else if (arg == "--password") { if (!value(opts.password)) return false; }
+        else if (arg == "--out") { if (!value(opts.outDir)) return false; }
+        else if (arg == "--trace") { if (!value(opts.tracePath)) return false; }
+        else if (arg == "--jobs") { if (!number(opts.jobs, 1)) return false; }
+        else if (arg == "--retries") { if (!number(opts.retries, 0)) return false; }
+        else if (arg == "--max-pages") { if (!number(opts.extraction.maxPages, 0)) return false; }
+        else if (arg == "--lang") { if (!value(opts.extraction.language)) return false; }
+        else if (arg == "--ocr") opts.extraction.enableOCR = true;
+        else if (arg == "--skip-existing") opts.skipExisting = true;
+        else if (arg == "--json") opts.json = true;
+        else if (arg == "--verbose") opts.verbose = true;
+        else if (arg == "--ext") {
+            std::string list;
+            if (!value(list)) return false;
+            std::stringstream stream(list);
+            std::string ext;
+            while (std::getline(stream, ext, ',')) {
+                if (ext.empty()) continue;
+                if (ext[0] != '.') ext = "." + ext;
+                std::transform(ext.begin(), ext.end(), ext.begin(), [](unsigned char c) { return static_cast<char>(std::tolower(c)); });
+                opts.extensions.push_back(ext);
+            }
+        }
+        else if (arg == "--jsonl") { if (!value(opts.exporting.jsonlPath)) return false; }
+        else if (arg == "--columnar") { if (!value(opts.exporting.columnarPath)) return false; }
+        else if (arg == "--page-size") { if (!number(opts.exporting.pageSize, 1)) return false; }
+        else if (arg == "--source") {
+            std::string source;
+            if (!value(source)) return false;
+            if (source == "admin") opts.exporting.source = Services::ExportSource::AdminListing;
+            else if (source == "results") opts.exporting.source = Services::ExportSource::Results;
+            else {
+                error = "Unbekannte Quelle: " + source;
+                return false;
+            }
+        }
+        else if (arg == "--columns") {
+            std::string list;
+            if (!value(list)) return false;
+            std::stringstream stream(list);
+            std::string column;
+            while (std::getline(stream, column, ',')) {
+                if (!column.empty()) opts.columns.push_back(column);
+            }
+        }
+        else if (arg == "--route") {
+            std::string route;
+            if (!value(route)) return false;
+            if (route == "remote") opts.route = Route::Remote;
+            else if (route == "local") opts.route = Route::Local;
+            else if (route == "auto") opts.route = Route::Auto;
+            else {
+                error = "Unbekannte Route: " + route;
+                return false;
+            }
+        }
+        else if (arg == "--help" || arg == "-h") {
+            error.clear();
+            return false;
+        }
+        else if (arg.rfind("--", 0) == 0) {
+            error = "Unbekannte Option: " + arg;
+            return false;
+        }
+        else opts.inputs.push_back(arg);
+    }
+
+    if (opts.command == Command::Export) {
+        if (opts.exporting.jsonlPath.empty() && opts.exporting.columnarPath.empty()) {
+            error = "export braucht --jsonl und/oder --columnar";
+            return false;
+        }
+        opts.exporting.jobs = opts.jobs;
+        return true;
+    }
+    if (opts.inputs.empty()) {
+        error = "Keine Eingaben angegeben";
+        return false;
+    }
+    if (opts.command == Command::Dump && opts.inputs.size() != 1) {
+        error = "dump erwartet genau eine Datei";
+        return false;
+    }
+    if (opts.command == Command::Extract && opts.route == Route::Local) {
+        error = "extract arbeitet mit fileIds, --route local ist dort nicht möglich";
+        return false;
+    }
+    return true;
+}
+
+bool MatchesExtension(const fs::path& path, const std::vector<std::string>& extensions)
+{
+    if (extensions.empty()) return true;
+    std::string ext = path.extension().string();
+    std::transform(ext.begin(), ext.end(), ext.begin(), [](unsigned char c) { return static_cast<char>(std::tolower(c)); });
+    return std::find(extensions.begin(), extensions.end(), ext) != extensions.end();
+}
+
+// Gleichnamige Dateien aus verschiedenen Eingaben (a/x.pdf, b/x.pdf) bekämen dieselbe Ausgabedatei:
+// spätere Vorkommen erhalten einen Zähler vor der Endung (x-2.pdf). Groß-/Kleinschreibung zählt nicht,
+// weil Windows und macOS sie im Dateinamen nicht unterscheiden.
+void DisambiguateOutputs(std::vector<Job>& jobs)
+{
+    auto key = [](std::string name) {
+        std::transform(name.begin(), name.end(), name.begin(), [](unsigned char c) { return static_cast<char>(std::tolower(c)); });
+        return name;
+    };
+    std::unordered_set<std::string> used;
+    for (auto& job : jobs) {
+        if (used.insert(key(job.relative)).second) continue;
+        fs::path relative(job.relative);
+        std::string stem = (relative.parent_path() / relative.stem()).generic_string();
+        std::string extension = relative.extension().string();
+        for (int n = 2; ; ++n) {
+            std::string candidate = stem + "-" + std::to_string(n) + extension;
+            if (used.insert(key(candidate)).second) {
+                job.relative = candidate;
+                break;
+            }
+        }
+    }
+}
+
+// Ordner rekursiv, versteckte Dateien/Ordner werden übersprungen
+bool CollectFiles(const CliOptions& opts, std::vector<Job>& jobs, std::string& error)
+{
+    for (const auto& input : opts.inputs) {
+        std::error_code ec;
+        fs::path root(input);
+        if (fs::is_regular_file(root, ec)) {
+            Job job;
+            job.path = root.string();
+            job.relative = root.filename().string();
+            job.bytes = fs::file_size(root, ec);
+            jobs.push_back(job);
+            continue;
+        }
+        if (!fs::is_directory(root, ec)) {
+            error = "Nicht gefunden: " + input;
+            return false;
+        }
+
+        std::vector<Job> found;
+        for (auto it = fs::recursive_directory_iterator(root, fs::directory_options::skip_permission_denied, ec);
+             it != fs::recursive_directory_iterator(); it.increment(ec)) {
+            if (ec) break;
+            std::string name = it->path().filename().string();
+            if (!name.empty() && name[0] == '.') {
+                if (it->is_directory(ec)) it.disable_recursion_pending();
+                continue;
+            }
+            if (!it->is_regular_file(ec) || !MatchesExtension(it->path(), opts.extensions)) continue;
+
+            Job job;
+            job.path = it->path().string();
+            job.relative = fs::relative(it->path(), root, ec).generic_string();
+            if (ec || job.relative.empty()) job.relative = name;
+            job.bytes = it->file_size(ec);
+            found.push_back(job);
+        }
+        // Feste Reihenfolge, damit Läufe vergleichbar sind
+        std::sort(found.begin(), found.end(), [](const Job& a, const Job& b) { return a.relative < b.relative; });
+        jobs.insert(jobs.end(), found.begin(), found.end());
+    }
+    DisambiguateOutputs(jobs);
+    return true;
+}
+
+// Schreibt erst in eine temporäre Datei, damit Konsumenten nie halbe Texte sehen
+bool WriteOutput(const fs::path& target, const std::string& text, std::string& error)
+{
+    std::error_code ec;
+    fs::create_directories(target.parent_path(), ec);
+    fs::path temp = target;
+    temp += ".part";
+    {
+        std::ofstream out(temp, std::ios::binary | std::ios::trunc);
+        if (!out) {
+            error = "Kann " + temp.string() + " nicht schreiben";
+            return false;
+        }
+        out.write(text.data(), static_cast<std::streamsize>(text.size()));
+        if (!out) {
+            error = "Schreibfehler in " + temp.string();
+            return false;
+        }
+    }
+    #ifdef _WIN32
+        fs::remove(target, ec);
+    #endif
+    fs::rename(temp, target, ec);
+    if (ec) {
+        error = "Umbenennen fehlgeschlagen: " + ec.message();
+        return false;
+    }
+    return true;
+}
+
+// Fortschritt: eine Zeile pro Ereignis, als JSON oder lesbarer Text
+class Progress {
+public:
+    Progress(bool json, size_t total) : json_(json), total_(total) {}
+
+    void Json(const std::string& line)
+    {
+        if (!json_) return;
+        Write(line);
+    }
+
+    void Text(const std::string& line)
+    {
+        if (json_) return;
+        Write(line);
+    }
+
+    size_t Finished() { return ++finished_; }
+    size_t Total() const { return total_; }
+
+private:
+    std::mutex mutex_;
+    bool json_;
+    size_t total_;
+    std::atomic<size_t> finished_{0};
+
+    void Write(const std::string& line)
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        std::fwrite(line.data(), 1, line.size(), stdout);
+        std::fputc('\n', stdout);
+        std::fflush(stdout);
+    }
+};
+
+std::string Quote(const std::string& text)
+{
+    return "\"" + Services::EscapeJson(text) + "\"";
+}
+
+long long ElapsedMs(std::chrono::steady_clock::time_point start)
+{
+    return std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - start).count();
+}
+
+// Der Upload ist nicht idempotent: ohne Antwort (statusCode 0) kann die Datei schon angelegt sein,
+// ein zweiter Versuch erzeugte ein Duplikat. Nur Gateway-/Überlastantworten erreichen das Backend sicher nicht.
+bool UploadRetryable(int statusCode)
+{
+    return statusCode == 502 || statusCode == 503 || statusCode == 504;
+}
+
+class Runner {
+public:
+    Runner(const CliOptions& opts, std::vector<Job>& jobs, Progress& progress)
+        : opts_(opts), jobs_(jobs), progress_(progress)
+    {
+        auto usecase = std::make_shared<UseCases::ExtractTextUseCase>(nullptr, std::make_shared<Services::PdfTextExtractor>());
+        local_ = usecase;
+        remote_ = std::make_shared<Services::RemoteExtractor>();
+        router_ = std::make_shared<UseCases::ExtractionRouter>(usecase, remote_, UseCases::ExtractionRouter::DefaultModelPath());
+    }
+
+    void Run()
+    {
+        size_t workers = std::min(jobs_.size(), static_cast<size_t>(opts_.jobs));
+        std::vector<std::thread> threads;
+        for (size_t i = 0; i < workers; ++i) {
+            threads.emplace_back([this, i] {
+                if (Services::Tracer::IsEnabled()) Services::Tracer::SetThreadName("Job " + std::to_string(i + 1));
+                for (size_t index = next_++; index < jobs_.size(); index = next_++) {
+                    Process(jobs_[index]);
+                }
+            });
+        }
+        for (auto& thread : threads) thread.join();
+    }
+
+    size_t Ok() const { return ok_; }
+    size_t Failed() const { return failed_; }
+    size_t Skipped() const { return skipped_; }
+    uint64_t UploadedBytes() const { return uploadedBytes_; }
+
+private:
+    const CliOptions& opts_;
+    std::vector<Job>& jobs_;
+    Progress& progress_;
+    std::shared_ptr<UseCases::ExtractTextUseCase> local_;
+    std::shared_ptr<Services::RemoteExtractor> remote_;
+    std::shared_ptr<UseCases::ExtractionRouter> router_;
+    std::atomic<size_t> next_{0};
+    std::atomic<size_t> ok_{0};
+    std::atomic<size_t> failed_{0};
+    std::atomic<size_t> skipped_{0};
+    std::atomic<uint64_t> uploadedBytes_{0};
+
+    std::string Label(const Job& job) const
+    {
+        return job.path.empty() ? job.fileId : job.relative;
+    }
+
+    std::string Counter()
+    {
+        return "[" + std::to_string(progress_.Finished()) + "/" + std::to_string(progress_.Total()) + "] ";
+    }
+
+    void Fail(const Job& job, const std::string& stage, int statusCode, const std::string& message)
+    {
+        ++failed_;
+        progress_.Json("{\"event\":\"error\",\"file\":" + Quote(Label(job)) + ",\"fileId\":" + Quote(job.fileId) +
+                       ",\"stage\":" + Quote(stage) + ",\"status\":" + std::to_string(statusCode) +
+                       ",\"message\":" + Quote(message) + "}");
+        progress_.Text(Counter() + "FEHLER " + Label(job) + " (" + stage + "): " + message);
+    }
+
+    fs::path OutputPath(const Job& job) const
+    {
+        return fs::path(opts_.outDir) / (job.path.empty() ? job.fileId : job.relative);
+    }
+
+    void Process(Job& job)
+    {
+        Services::TraceSpan span("job", Label(job));
+        fs::path output = OutputPath(job);
+        output += ".txt";
+        std::error_code ec;
+        if (opts_.skipExisting && opts_.command != Command::Upload && fs::file_size(output, ec) > 0 && !ec) {
+            ++skipped_;
+            progress_.Json("{\"event\":\"skipped\",\"file\":" + Quote(Label(job)) + ",\"output\":" + Quote(output.string()) + "}");
+            progress_.Text(Counter() + "übersprungen " + Label(job) + " (Ausgabe vorhanden)");
+            return;
+        }
+
+        if (opts_.command != Command::Extract && !Upload(job)) return;
+        if (opts_.command == Command::Upload) {
+            ++ok_;
+            progress_.Text(Counter() + "hochgeladen " + Label(job) + " -> " + job.fileId);
+            return;
+        }
+        Extract(job, output);
+    }
+
+    bool Upload(Job& job)
+    {
+        auto start = std::chrono::steady_clock::now();
+        Services::HttpResponse resp;
+        for (int attempt = 0; ; ++attempt) {
+            resp = Services::ApiService::UploadFile(job.path);
+            if (resp.isSuccess || !UploadRetryable(resp.statusCode) || attempt >= opts_.retries) break;
+            std::this_thread::sleep_for(std::chrono::seconds(1 << attempt));
+        }
+        if (!resp.isSuccess) {
+            Fail(job, "upload", resp.statusCode, Services::ExtractMessageFromJSON(resp.body));
+            return false;
+        }
+
+        job.fileId = Services::ExtractJsonField(resp.body, "fileId");
+        if (job.fileId.empty()) {
+            Fail(job, "upload", resp.statusCode, "Antwort ohne fileId");
+            return false;
+        }
+        uploadedBytes_ += job.bytes;
+        progress_.Json("{\"event\":\"uploaded\",\"file\":" + Quote(Label(job)) + ",\"fileId\":" + Quote(job.fileId) +
+                       ",\"bytes\":" + std::to_string(job.bytes) + ",\"ms\":" + std::to_string(ElapsedMs(start)) + "}");
+        return true;
+    }
+
+    void Extract(const Job& job, const fs::path& output)
+    {
+        auto start = std::chrono::steady_clock::now();
+        Core::ExtractionResult result;
+        for (int attempt = 0; ; ++attempt) {
+            if (opts_.route == Route::Local) {
+                result = local_->Extract(job.path, opts_.extraction);
+            } else if (opts_.route == Route::Auto) {
+                UseCases::DocumentRef doc{job.path, job.fileId, job.bytes};
+                result = router_->Run(doc, opts_.extraction);
+            } else {
+                result = remote_->Extract(job.fileId, opts_.extraction);
+            }
+            // Netzwerkfehler und 5xx wie beim Upload wiederholen, lokale Fehler nicht
+            bool retryable = result.backendUnreachable || result.statusCode >= 500;
+            if (result.success || !retryable || attempt >= opts_.retries) break;
+            std::this_thread::sleep_for(std::chrono::seconds(1 << attempt));
+        }
+        if (!result.success) {
+            Fail(job, "extract", result.statusCode, result.error);
+            return;
+        }
+
+        std::string error;
+        if (!WriteOutput(output, result.text, error)) {
+            Fail(job, "write", 0, error);
+            return;
+        }
+        ++ok_;
+        long long ms = ElapsedMs(start);
+        progress_.Json("{\"event\":\"extracted\",\"file\":" + Quote(Label(job)) + ",\"fileId\":" + Quote(job.fileId) +
+                       ",\"method\":" + Quote(result.method) + ",\"pages\":" + std::to_string(result.pageCount) +
+                       ",\"chars\":" + std::to_string(result.text.size()) + ",\"ms\":" + std::to_string(ms) +
+                       ",\"output\":" + Quote(output.string()) + "}");
+        progress_.Text(Counter() + "ok " + Label(job) + " -> " + output.string() + " (" + result.method + ", " +
+                       std::to_string(result.text.size()) + " Zeichen, " + std::to_string(ms) + " ms)");
+    }
+};
+
+} // namespace
+
+int RunExport(const CliOptions& opts)
+{
+    Progress progress(opts.json, 0);
+    progress.Json("{\"event\":\"start\",\"api\":" + Quote(Services::ApiService::GetApiUrl()) +
+                  ",\"source\":" + Quote(opts.exporting.source == Services::ExportSource::Results ? "results" : "admin") +
+                  ",\"jobs\":" + std::to_string(opts.exporting.jobs) + "}");
+    progress.Text("Export von " + Services::ApiService::GetApiUrl() + ", " + std::to_string(opts.exporting.jobs) + " parallel");
+
+    auto start = std::chrono::steady_clock::now();
+    Services::ResultExporter exporter(opts.exporting);
+    std::string error;
+    Services::ExportProgress last;
+    bool ok = exporter.Run([&](const Services::ExportProgress& p) {
+        last = p;
+        progress.Json("{\"event\":\"progress\",\"listed\":" + std::to_string(p.listed) + ",\"written\":" +
+                      std::to_string(p.written) + ",\"failed\":" + std::to_string(p.failed) + ",\"textBytes\":" +
+                      std::to_string(p.textBytes) + "}");
+    }, error);
+    long long ms = ElapsedMs(start);
+
+    if (!ok) {
+        progress.Json("{\"event\":\"error\",\"message\":" + Quote(error) + "}");
+        std::fprintf(stderr, "Fehler: %s\n", error.c_str());
+    }
+    progress.Json("{\"event\":\"done\",\"written\":" + std::to_string(last.written) + ",\"failed\":" +
+                  std::to_string(last.failed) + ",\"textBytes\":" + std::to_string(last.textBytes) +
+                  ",\"ms\":" + std::to_string(ms) + "}");
+    progress.Text("Fertig: " + std::to_string(last.written) + " Extraktionen (" + std::to_string(last.failed) +
+                  " ohne Text) in " + std::to_string(ms) + " ms");
+    return !ok ? 1 : (last.failed > 0 ? 1 : 0);
+}
+
+int RunDump(const CliOptions& opts)
+{
+    Services::ColumnarReader reader;
+    if (!reader.Open(opts.inputs.front())) {
+        std::fprintf(stderr, "Fehler: %s\n", reader.LastError().c_str());
+        return 2;
+    }
+    const auto& names = reader.Columns();
+    std::vector<size_t> selected;
+    for (const auto& column : opts.columns) {
+        auto it = std::find(names.begin(), names.end(), column);
+        if (it == names.end()) {
+            std::fprintf(stderr, "Fehler: Unbekannte Spalte %s\n", column.c_str());
+            return 2;
+        }
+        selected.push_back(static_cast<size_t>(it - names.begin()));
+    }
+    if (selected.empty()) {
+        for (size_t c = 0; c < names.size(); ++c) selected.push_back(c);
+    }
+
+    std::string line;
+    bool ok = reader.ForEach(selected, [&](const std::vector<std::string_view>& row) {
+        line = "{";
+        for (size_t i = 0; i < selected.size(); ++i) {
+            if (i > 0) line += ',';
+            line += Quote(names[selected[i]]) + ":" + Quote(std::string(row[selected[i]]));
+        }
+        line += "}\n";
+        return std::fwrite(line.data(), 1, line.size(), stdout) == line.size();
+    });
+    if (!ok) {
+        std::fprintf(stderr, "Fehler: %s\n", reader.LastError().c_str());
+        return 1;
+    }
+    return 0;
+}
+
+void WriteTrace(const CliOptions& opts)
+{
+    if (opts.tracePath.empty()) return;
+    Services::Tracer::Stop();
+    std::string error;
+    if (Services::Tracer::Write(opts.tracePath, error)) {
+        std::fprintf(stderr, "Trace gespeichert: %s (%zu Ereignisse)\n", opts.tracePath.c_str(), Services::Tracer::EventCount());
+    } else {
+        std::fprintf(stderr, "Fehler: %s\n", error.c_str());
+    }
+}
+
+int main(int argc, char** argv)
+{
+    CliOptions opts;
+    std::string error;
+    if (!ParseArgs(argc, argv, opts, error)) {
+        if (!error.empty()) std::fprintf(stderr, "Fehler: %s\n\n", error.c_str());
+        PrintUsage();
+        return error.empty() ? 0 : 2;
+    }
+
+    if (opts.command == Command::Dump) return RunDump(opts);
+
+    // Service-Ausgaben nach stderr (--verbose) oder verwerfen, stdout gehört dem Fortschritt
+    NullBuffer nullBuffer;
+    std::streambuf* originalCout = std::cout.rdbuf(opts.verbose ? std::cerr.rdbuf() : &nullBuffer);
+    Services::ApiService::SetVerbose(opts.verbose);
+    if (!opts.tracePath.empty()) {
+        Services::Tracer::SetThreadName("tef_cli");
+        Services::Tracer::Start();
+    }
+
+    Services::LoginService::Initialize();
+    Services::ApiService::Initialize();
+    if (!opts.apiUrl.empty()) Services::ApiService::SetApiUrl(opts.apiUrl);
+    if (!opts.user.empty() && !opts.password.empty()) {
+        Services::ApiService::SetAuthCredentials(opts.user, Services::ApiService::HashPassword(opts.password));
+    }
+
+    if (opts.command == Command::Export) {
+        int code = RunExport(opts);
+        std::cout.rdbuf(originalCout);
+        WriteTrace(opts);
+        return code;
+    }
+
+    std::vector<Job> jobs;
+    if (opts.command == Command::Extract) {
+        for (const auto& fileId : opts.inputs) {
+            Job job;
+            job.fileId = fileId;
+            jobs.push_back(job);
+        }
+    } else if (!CollectFiles(opts, jobs, error)) {
+        std::cout.rdbuf(originalCout);
+        std::fprintf(stderr, "Fehler: %s\n", error.c_str());
+        return 2;
+    }
+
+    uint64_t totalBytes = 0;
+    for (const auto& job : jobs) totalBytes += job.bytes;
+
+    Progress progress(opts.json, jobs.size());
+    progress.Json("{\"event\":\"start\",\"api\":" + Quote(Services::ApiService::GetApiUrl()) +
+                  ",\"files\":" + std::to_string(jobs.size()) + ",\"bytes\":" + std::to_string(totalBytes) +
+                  ",\"jobs\":" + std::to_string(opts.jobs) + "}");
+    progress.Text(std::to_string(jobs.size()) + " Dateien, " + std::to_string(opts.jobs) + " parallel, Backend " +
+                  Services::ApiService::GetApiUrl());
+
+    auto start = std::chrono::steady_clock::now();
+    Runner runner(opts, jobs, progress);
+    runner.Run();
+    long long ms = ElapsedMs(start);
+
+    double seconds = ms > 0 ? ms / 1000.0 : 0.001;
+    char rate[32];
+    std::snprintf(rate, sizeof(rate), "%.2f", runner.UploadedBytes() / (1024.0 * 1024.0) / seconds);
+    progress.Json("{\"event\":\"done\",\"ok\":" + std::to_string(runner.Ok()) + ",\"failed\":" + std::to_string(runner.Failed()) +
+                  ",\"skipped\":" + std::to_string(runner.Skipped()) + ",\"uploadedBytes\":" + std::to_string(runner.UploadedBytes()) +
+                  ",\"ms\":" + std::to_string(ms) + ",\"uploadMBps\":" + rate + "}");
+    progress.Text("Fertig: " + std::to_string(runner.Ok()) + " ok, " + std::to_string(runner.Failed()) + " fehlgeschlagen, " +
+                  std::to_string(runner.Skipped()) + " übersprungen in " + std::to_string(ms) + " ms (" + rate + " MB/s Upload)");
+
+    std::cout.rdbuf(originalCout);
+    WriteTrace(opts);
+    return runner.Failed() > 0 ? 1 : 0;
+}
@@ -0,0 +1,400 @@
+#include "../../include/Mock/HttpServer.h"
+#include <algorithm>
+#include <arpa/inet.h>
+#include <cctype>
+#include <chrono>
+#include <cstdio>
+#include <cstring>
+#include <iostream>
+#include <memory>
+#include <netinet/in.h>
+#include <netinet/tcp.h>
+#include <poll.h>
+#include <sys/socket.h>
+#include <thread>
+#include <unistd.h>
+#include <utility>
+#include <vector>
+
+namespace Mock {
+
+namespace {
+
+constexpr size_t kMaxHeaderBytes = 64 * 1024;
+constexpr size_t kMaxBodyBytes = 512u << 20;
+constexpr int kMaxConnections = 1024;
+constexpr int kIdleTimeoutSeconds = 30;
+
+std::string Lower(std::string text)
+{
+    std::transform(text.begin(), text.end(), text.begin(),
+                   [](unsigned char c) { return static_cast<char>(std::tolower(c)); });
+    return text;
+}
+
+std::string Trim(const std::string& text)
+{
+    size_t start = text.find_first_not_of(" \t\r\n");
+    if (start == std::string::npos) return "";
+    size_t end = text.find_last_not_of(" \t\r\n");
+    return text.substr(start, end - start + 1);
+}
+
+std::string UrlDecode(const std::string& text, bool plusAsSpace)
+{
+    std::string out;
+    out.reserve(text.size());
+    for (size_t i = 0; i < text.size(); ++i) {
+        char c = text[i];
+        if (c == '%' && i + 2 < text.size() && std::isxdigit(static_cast<unsigned char>(text[i + 1])) &&
+            std::isxdigit(static_cast<unsigned char>(text[i + 2]))) {
+            out += static_cast<char>(std::stoi(text.substr(i + 1, 2), nullptr, 16));
+            i += 2;
+        } else if (c == '+' && plusAsSpace) {
+            out += ' ';
+        } else {
+            out += c;
+        }
+    }
+    return out;
+}
+
+const char* Reason(int status)
+{
+    switch (status) {
+        case 200: return "OK";
+        case 201: return "Created";
+        case 204: return "No Content";
+        case 304: return "Not Modified";
+        case 400: return "Bad Request";
+        case 401: return "Unauthorized";
+        case 403: return "Forbidden";
+        case 404: return "Not Found";
+        case 405: return "Method Not Allowed";
+        case 409: return "Conflict";
+        case 413: return "Payload Too Large";
+        case 431: return "Request Header Fields Too Large";
+        case 500: return "Internal Server Error";
+        case 501: return "Not Implemented";
+        case 503: return "Service Unavailable";
+        default: return "Status";
+    }
+}
+
+// Begrenzt die Senderate einer Antwort auf bytesPerSecond
+struct Throttle {
+    int64_t bytesPerSecond = 0;
+    int64_t sent = 0;
+    std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+
+    size_t Slice(size_t remaining) const
+    {
+        if (bytesPerSecond <= 0) return remaining;
+        // Etwa 50 Pakete pro Sekunde, damit die Rate auch bei kleinen Antworten stimmt
+        size_t slice = static_cast<size_t>(std::max<int64_t>(1024, bytesPerSecond / 50));
+        return std::min(slice, remaining);
+    }
+
+    void Account(size_t bytes)
+    {
+        if (bytesPerSecond <= 0) return;
+        sent += static_cast<int64_t>(bytes);
+        auto due = start + std::chrono::microseconds(sent * 1000000 / bytesPerSecond);
+        std::this_thread::sleep_until(due);
+    }
+};
+
+} // namespace
+
+std::string HttpRequest::Query(const std::string& key, const std::string& fallback) const
+{
+    auto it = query.find(key);
+    return it != query.end() ? it->second : fallback;
+}
+
+std::string HttpRequest::Header(const std::string& name) const
+{
+    auto it = headers.find(name);
+    return it != headers.end() ? it->second : "";
+}
+
+HttpServer::HttpServer(Handler handler, NetworkProfile profile)
+    : handler_(std::move(handler)), profile_(profile)
+{
+}
+
+HttpServer::~HttpServer()
+{
+    if (listenFd_ >= 0) ::close(listenFd_);
+}
+
+double HttpServer::Random(uint64_t seed, uint64_t sequence, uint64_t salt)
+{
+    // SplitMix64 über (seed, sequence, salt)
+    uint64_t z = seed + sequence * 0x9E3779B97F4A7C15ULL + salt * 0xD1B54A32D192ED03ULL;
+    z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ULL;
+    z = (z ^ (z >> 27)) * 0x94D049BB133111EBULL;
+    z ^= z >> 31;
+    return static_cast<double>(z >> 11) / static_cast<double>(1ULL << 53);
+}
+
+bool HttpServer::Listen(const std::string& address, int port, std::string& error)
+{
+    listenFd_ = ::socket(AF_INET, SOCK_STREAM, 0);
+    if (listenFd_ < 0) {
+        error = std::string("socket: ") + std::strerror(errno);
+        return false;
+    }
+    int one = 1;
+    ::setsockopt(listenFd_, SOL_SOCKET, SO_REUSEADDR, &one, sizeof(one));
+
+    sockaddr_in addr{};
+    addr.sin_family = AF_INET;
+    addr.sin_port = htons(static_cast<uint16_t>(port));
+    if (::inet_pton(AF_INET, address.c_str(), &addr.sin_addr) != 1) {
+        error = "Ungültige Adresse: " + address;
+        return false;
+    }
+    if (::bind(listenFd_, reinterpret_cast<sockaddr*>(&addr), sizeof(addr)) != 0 || ::listen(listenFd_, 512) != 0) {
+        error = address + ":" + std::to_string(port) + ": " + std::strerror(errno);
+        return false;
+    }
+
+    socklen_t length = sizeof(addr);
+    ::getsockname(listenFd_, reinterpret_cast<sockaddr*>(&addr), &length);
+    port_ = ntohs(addr.sin_port);
+    return true;
+}
+
+void HttpServer::Run()
+{
+    // Verbindungs-Threads werden gejoint, keiner darf Run() (und damit this) überleben
+    std::vector<std::pair<std::thread, std::shared_ptr<std::atomic<bool>>>> workers;
+    auto reap = [&workers](bool all) {
+        for (auto it = workers.begin(); it != workers.end();) {
+            if (!all && !it->second->load()) {
+                ++it;
+                continue;
+            }
+            it->first.join();
+            it = workers.erase(it);
+        }
+    };
+
+    while (!stop_) {
+        reap(false);
+        pollfd pfd{listenFd_, POLLIN, 0};
+        if (::poll(&pfd, 1, 200) <= 0) continue;
+        int fd = ::accept(listenFd_, nullptr, nullptr);
+        if (fd < 0) continue;
+
+        if (connections_.load() >= kMaxConnections) {
+            static const char busy[] = "HTTP/1.1 503 Service Unavailable\r\nContent-Length: 0\r\nConnection: close\r\n\r\n";
+            ::send(fd, busy, sizeof(busy) - 1, MSG_NOSIGNAL);
+            ::close(fd);
+            continue;
+        }
+        ++connections_;
+        auto done = std::make_shared<std::atomic<bool>>(false);
+        std::thread worker([this, fd, done] {
+            Serve(fd);
+            ::close(fd);
+            --connections_;
+            *done = true;
+        });
+        workers.emplace_back(std::move(worker), std::move(done));
+    }
+
+    ::close(listenFd_);
+    listenFd_ = -1;
+    // Wartende Verbindungen sehen stop_ nach dem nächsten recv-Timeout (1 s), laufende Antworten
+    // werden zu Ende gesendet; gewartet wird ohne Zeitlimit
+    reap(true);
+}
+
+void HttpServer::Serve(int fd)
+{
+    int one = 1;
+    ::setsockopt(fd, IPPROTO_TCP, TCP_NODELAY, &one, sizeof(one));
+    timeval timeout{1, 0};
+    ::setsockopt(fd, SOL_SOCKET, SO_RCVTIMEO, &timeout, sizeof(timeout));
+
+    std::string buffer;
+    char chunk[16384];
+    int idleSeconds = 0;
+    auto receive = [&]() {
+        while (!stop_) {
+            ssize_t n = ::recv(fd, chunk, sizeof(chunk), 0);
+            if (n > 0) {
+                buffer.append(chunk, static_cast<size_t>(n));
+                idleSeconds = 0;
+                return true;
+            }
+            if (n == 0) return false;
+            if (errno != EAGAIN && errno != EWOULDBLOCK && errno != EINTR) return false;
+            if (++idleSeconds >= kIdleTimeoutSeconds) return false;
+        }
+        return false;
+    };
+
+    while (!stop_) {
+        size_t headerEnd;
+        while ((headerEnd = buffer.find("\r\n\r\n")) == std::string::npos) {
+            if (buffer.size() > kMaxHeaderBytes) {
+                HttpRequest dummy;
+                HttpReply reply{431, "text/plain", {}, "", nullptr};
+                SendReply(fd, dummy, reply, false);
+                return;
+            }
+            if (!receive()) return;
+        }
+
+        HttpRequest request;
+        std::string head = buffer.substr(0, headerEnd);
+        size_t lineEnd = head.find("\r\n");
+        std::string requestLine = head.substr(0, lineEnd);
+        size_t sp1 = requestLine.find(' ');
+        size_t sp2 = requestLine.rfind(' ');
+        if (sp1 == std::string::npos || sp2 == sp1) return;
+        request.method = requestLine.substr(0, sp1);
+        std::string target = requestLine.substr(sp1 + 1, sp2 - sp1 - 1);
+        std::string version = requestLine.substr(sp2 + 1);
+
+        size_t pos = lineEnd == std::string::npos ? head.size() : lineEnd + 2;
+        while (pos < head.size()) {
+            size_t next = head.find("\r\n", pos);
+            if (next == std::string::npos) next = head.size();
+            std::string line = head.substr(pos, next - pos);
+            size_t colon = line.find(':');
+            if (colon != std::string::npos) request.headers[Lower(Trim(line.substr(0, colon)))] = Trim(line.substr(colon + 1));
+            pos = next + 2;
+        }
+
+        size_t question = target.find('?');
+        request.path = UrlDecode(target.substr(0, question), false);
+        if (question != std::string::npos) {
+            std::string queryString = target.substr(question + 1);
+            size_t start = 0;
+            while (start <= queryString.size()) {
+                size_t amp = queryString.find('&', start);
+                if (amp == std::string::npos) amp = queryString.size();
+                std::string pair = queryString.substr(start, amp - start);
+                size_t eq = pair.find('=');
+                if (!pair.empty()) {
+                    request.query[UrlDecode(pair.substr(0, eq), true)] =
+                        eq == std::string::npos ? "" : UrlDecode(pair.substr(eq + 1), true);
+                }
+                start = amp + 1;
+            }
+        }
+
+        if (!request.Header("transfer-encoding").empty()) {
+            HttpReply reply{501, "text/plain", {}, "Chunked request bodies werden nicht unterstützt", nullptr};
+            SendReply(fd, request, reply, false);
+            return;
+        }
+        size_t contentLength = 0;
+        std::string lengthHeader = request.Header("content-length");
+        if (!lengthHeader.empty()) contentLength = static_cast<size_t>(std::strtoull(lengthHeader.c_str(), nullptr, 10));
+        if (contentLength > kMaxBodyBytes) {
+            HttpReply reply{413, "text/plain", {}, "", nullptr};
+            SendReply(fd, request, reply, false);
+            return;
+        }
+        // curl wartet bei größeren Uploads auf die Freigabe
+        if (Lower(request.Header("expect")) == "100-continue" && buffer.size() < headerEnd + 4 + contentLength) {
+            static const char proceed[] = "HTTP/1.1 100 Continue\r\n\r\n";
+            if (!SendAll(fd, proceed, sizeof(proceed) - 1, false)) return;
+        }
+        while (buffer.size() < headerEnd + 4 + contentLength) {
+            if (!receive()) return;
+        }
+        request.body = buffer.substr(headerEnd + 4, contentLength);
+        buffer.erase(0, headerEnd + 4 + contentLength);
+
+        std::string connection = Lower(request.Header("connection"));
+        bool keepAlive = version == "HTTP/1.1" ? connection != "close" : connection == "keep-alive";
+        request.sequence = ++sequence_;
+
+        // Netzwerkbedingungen anwenden
+        if (profile_.dropRate > 0.0 && Random(profile_.seed, request.sequence, 1) < profile_.dropRate) {
+            if (accessLog_) std::cout << request.method << " " << target << " -> (verworfen)" << std::endl;
+            return;
+        }
+        int delayMs = profile_.latencyMs;
+        if (profile_.jitterMs > 0) delayMs += static_cast<int>(Random(profile_.seed, request.sequence, 2) * (profile_.jitterMs + 1));
+        if (delayMs > 0) std::this_thread::sleep_for(std::chrono::milliseconds(delayMs));
+
+        auto start = std::chrono::steady_clock::now();
+        HttpReply reply;
+        if (profile_.errorRate > 0.0 && Random(profile_.seed, request.sequence, 3) < profile_.errorRate) {
+            reply.status = 500;
+            reply.body = "{\"success\":false,\"message\":\"Simulierter Serverfehler\"}";
+        } else {
+            reply = handler_(request);
+        }
+        bool sent = SendReply(fd, request, reply, keepAlive);
+
+        if (accessLog_) {
+            long long ms = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - start).count();
+            std::cout << request.method << " " << target << " -> " << reply.status << " (" << ms + delayMs << " ms)" << std::endl;
+        }
+        if (!sent || !keepAlive) return;
+    }
+}
+
+bool HttpServer::SendAll(int fd, const char* data, size_t size, bool throttle)
+{
+    Throttle pace;
+    pace.bytesPerSecond = throttle ? profile_.bandwidthBytes : 0;
+    while (size > 0) {
+        size_t slice = pace.Slice(size);
+        ssize_t n = ::send(fd, data, slice, MSG_NOSIGNAL);
+        if (n < 0 && errno == EINTR) continue;
+        if (n <= 0) return false;
+        data += n;
+        size -= static_cast<size_t>(n);
+        pace.Account(static_cast<size_t>(n));
+    }
+    return true;
+}
+
+bool HttpServer::SendReply(int fd, const HttpRequest& request, HttpReply& reply, bool keepAlive)
+{
+    bool noBody = request.method == "HEAD" || reply.status == 204 || reply.status == 304;
+    bool chunked = reply.stream != nullptr && !noBody;
+
+    std::string head = "HTTP/1.1 " + std::to_string(reply.status) + " " + Reason(reply.status) + "\r\n";
+    head += "Content-Type: " + reply.contentType + "\r\n";
+    if (chunked) head += "Transfer-Encoding: chunked\r\n";
+    else if (reply.status != 304 && reply.status != 204) head += "Content-Length: " + std::to_string(reply.body.size()) + "\r\n";
+    for (const auto& header : reply.headers) head += header.first + ": " + header.second + "\r\n";
+    head += keepAlive ? "Connection: keep-alive\r\n\r\n" : "Connection: close\r\n\r\n";
+
+    if (noBody) return SendAll(fd, head.data(), head.size(), false);
+    if (!chunked) {
+        // Header und kleine Bodies in einem Paket
+        if (reply.body.size() < 16384) {
+            head += reply.body;
+            return SendAll(fd, head.data(), head.size(), true);
+        }
+        return SendAll(fd, head.data(), head.size(), false) && SendAll(fd, reply.body.data(), reply.body.size(), true);
+    }
+
+    if (!SendAll(fd, head.data(), head.size(), false)) return false;
+    std::string piece;
+    bool more = true;
+    while (more) {
+        piece.clear();
+        more = reply.stream(piece);
+        if (piece.empty()) continue;
+        char size[24];
+        int length = std::snprintf(size, sizeof(size), "%zx\r\n", piece.size());
+        piece.insert(0, size, static_cast<size_t>(length));
+        piece += "\r\n";
+        if (!SendAll(fd, piece.data(), piece.size(), true)) return false;
+    }
+    return SendAll(fd, "0\r\n\r\n", 5, false);
+}
+
+} // namespace Mock
@@ -0,0 +1,900 @@
+#include "../../include/Mock/MockBackend.h"
+#include "../../include/Services/JsonUtil.h"
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <functional>
+#include <iomanip>
+#include <memory>
+#include <openssl/sha.h>
+#include <sstream>
+#include <thread>
+
+namespace Mock {
+
+namespace {
+
+using Services::EscapeJson;
+using Services::ReadJsonValue;
+
+// Fester Bezugszeitpunkt 2026-01-01T00:00:00Z, damit der Datenbestand reproduzierbar ist
+constexpr std::time_t kBaseTime = 1767225600;
+constexpr size_t kMaxLogs = 50000;
+constexpr int kMaxPageSize = 1000;
+
+std::atomic<int> extractionsRunning{0};
+
+const char* const kWords[] = {
+    "Rechnung", "Vertrag", "Kunde", "Lieferung", "Betrag", "Zahlung", "gemäß", "Vereinbarung", "über",
+    "Prüfung", "Änderung", "Datum", "Seite", "Anlage", "wird", "wurde", "die", "der", "das", "und",
+    "mit", "für", "nach", "Bestellung", "Grundlage", "Frist", "Übersicht", "Zustellung", "Höhe", "Straße",
+    "Gebühren", "Mahnung", "Auftrag", "Angebot", "Position", "Menge", "Einheit", "Steuer", "Summe", "Bericht"};
+const char* const kNames[] = {"Rechnung", "Vertrag", "Scan", "Bericht", "Angebot", "Lieferschein", "Protokoll", "Brief"};
+const char* const kLevels[] = {"Information", "Information", "Information", "Debug", "Warning", "Error"};
+const char* const kCategories[] = {"Api.Upload", "Api.Extraction", "Api.Admin", "Worker.Extraction", "Database"};
+
+uint64_t Mix(uint64_t seed, uint64_t value, uint64_t salt = 0)
+{
+    uint64_t z = seed + value * 0x9E3779B97F4A7C15ULL + salt * 0xD1B54A32D192ED03ULL;
+    z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ULL;
+    z = (z ^ (z >> 27)) * 0x94D049BB133111EBULL;
+    return z ^ (z >> 31);
+}
+
+std::string FormatTime(std::time_t time)
+{
+    std::tm tm{};
+    gmtime_r(&time, &tm);
+    char buf[32];
+    std::strftime(buf, sizeof(buf), "%Y-%m-%dT%H:%M:%SZ", &tm);
+    return buf;
+}
+
+std::string NowWithMillis()
+{
+    auto now = std::chrono::system_clock::now();
+    std::time_t seconds = std::chrono::system_clock::to_time_t(now);
+    long millis = static_cast<long>(std::chrono::duration_cast<std::chrono::milliseconds>(now.time_since_epoch()).count() % 1000);
+    std::tm tm{};
+    gmtime_r(&seconds, &tm);
+    char buf[40];
+    size_t length = std::strftime(buf, sizeof(buf), "%Y-%m-%dT%H:%M:%S", &tm);
+    std::snprintf(buf + length, sizeof(buf) - length, ".%03ldZ", millis);
+    return buf;
+}
+
+std::string Quote(const std::string& text)
+{
+    return "\"" + EscapeJson(text) + "\"";
+}
+
+HttpReply Json(int status, std::string body)
+{
+    HttpReply reply;
+    reply.status = status;
+    reply.body = std::move(body);
+    return reply;
+}
+
+HttpReply Message(int status, const std::string& message)
+{
+    return Json(status, "{\"success\":" + std::string(status < 400 ? "true" : "false") + ",\"message\":" + Quote(message) + "}");
+}
+
+std::string Base64Decode(const std::string& text)
+{
+    static const std::string chars = "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/";
+    std::string out;
+    int value = 0, bits = -8;
+    for (char c : text) {
+        size_t index = chars.find(c);
+        if (index == std::string::npos) break;
+        value = (value << 6) + static_cast<int>(index);
+        bits += 6;
+        if (bits >= 0) {
+            out += static_cast<char>((value >> bits) & 0xFF);
+            bits -= 8;
+        }
+    }
+    return out;
+}
+
+int ToInt(const std::string& text, int fallback)
+{
+    if (text.empty()) return fallback;
+    char* end = nullptr;
+    long value = std::strtol(text.c_str(), &end, 10);
+    return *end == '\0' ? static_cast<int>(value) : fallback;
+}
+
+} // namespace
+
+MockBackend::MockBackend(DatasetOptions options)
+    : options_(std::move(options)), baseTime_(kBaseTime)
+{
+    if (options_.users == 0) options_.users = 1;
+    SeedUsers();
+    SeedLogs();
+}
+
+std::string MockBackend::HashPassword(const std::string& password)
+{
+    unsigned char hash[SHA256_DIGEST_LENGTH];
+    SHA256(reinterpret_cast<const unsigned char*>(password.c_str()), password.length(), hash);
+    std::ostringstream out;
+    for (unsigned char byte : hash) out << std::hex << std::setw(2) << std::setfill('0') << static_cast<int>(byte);
+    return out.str();
+}
+
+void MockBackend::SeedUsers()
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    users_.clear();
+    std::string hash = HashPassword(options_.password);
+    for (size_t i = 0; i < options_.users; ++i) {
+        User user;
+        user.id = static_cast<int>(i + 1);
+        user.username = i == 0 ? "admin" : "user" + std::to_string(i);
+        user.email = user.username + "@example.com";
+        user.role = i == 0 ? "Admin" : "User";
+        user.passwordHash = hash;
+        user.createdAt = baseTime_ - static_cast<std::time_t>((options_.users - i) * 86400);
+        // Jeder zehnte Benutzer ist deaktiviert, der Admin nie
+        user.active = i == 0 || i % 10 != 9;
+        users_.push_back(user);
+    }
+}
+
+void MockBackend::SeedLogs()
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    logs_.clear();
+    // Vorlauf der letzten Stunde, damit Logging/recent sofort etwas liefert
+    std::time_t now = std::time(nullptr);
+    for (int i = 0; i < 500; ++i) {
+        uint64_t h = Mix(options_.seed, static_cast<uint64_t>(i), 7);
+        LogEntry entry;
+        entry.id = nextLogId_++;
+        entry.timestamp = FormatTime(now - 3600 + i * 7).substr(0, 19) + ".000Z";
+        entry.level = kLevels[h % (sizeof(kLevels) / sizeof(kLevels[0]))];
+        entry.category = kCategories[(h >> 8) % (sizeof(kCategories) / sizeof(kCategories[0]))];
+        entry.message = "Vorgang " + std::to_string(i) + " verarbeitet";
+        logs_.push_back(entry);
+    }
+}
+
+void MockBackend::Log(const std::string& level, const std::string& category, const std::string& message)
+{
+    LogEntry entry;
+    entry.timestamp = NowWithMillis();
+    entry.level = level;
+    entry.category = category;
+    entry.message = message;
+    std::lock_guard<std::mutex> lock(mutex_);
+    entry.id = nextLogId_++;
+    logs_.push_back(std::move(entry));
+    if (logs_.size() > kMaxLogs) logs_.pop_front();
+}
+
+// ---------------------------------------------------------------------------
+// Datenbestand
+
+size_t MockBackend::DocumentCount() const
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    return options_.documents + uploaded_.size();
+}
+
+bool MockBackend::ParseDocumentId(const std::string& id, size_t& index) const
+{
+    // Dokumente heißen doc-<n>, Extraktionen ext-<n> mit demselben n
+    if (id.size() < 5 || (id.compare(0, 4, "doc-") != 0 && id.compare(0, 4, "ext-") != 0)) return false;
+    char* end = nullptr;
+    unsigned long long value = std::strtoull(id.c_str() + 4, &end, 10);
+    if (*end != '\0') return false;
+    index = static_cast<size_t>(value);
+    return true;
+}
+
+bool MockBackend::FindDocument(size_t index, Document& document) const
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (deleted_.count(index)) return false;
+
+    if (index >= options_.documents) {
+        size_t offset = index - options_.documents;
+        if (offset >= uploaded_.size()) return false;
+        document = uploaded_[offset];
+    } else {
+        uint64_t h = Mix(options_.seed, index);
+        const char* name = kNames[h % (sizeof(kNames) / sizeof(kNames[0]))];
+        bool scan = (h >> 16) % 5 == 0;
+        document.index = index;
+        document.fileName = std::string(name) + "_" + std::to_string(index) + (scan ? ".png" : ".pdf");
+        document.fileSize = 20000 + (h >> 20) % 5000000;
+        size_t owner = index % options_.users;
+        document.uploadedBy = owner == 0 ? "admin" : "user" + std::to_string(owner);
+        document.uploadedAt = baseTime_ - static_cast<std::time_t>((options_.documents - index) * 47);
+        document.extracted = static_cast<int>(Mix(options_.seed, index, 1) % 100) < options_.extractedPercent;
+        document.method = scan ? "OCR" : "PdfText";
+        document.completedAt = document.uploadedAt + 5 + static_cast<std::time_t>((h >> 40) % 90);
+    }
+
+    auto extraction = extractions_.find(index);
+    if (extraction != extractions_.end()) {
+        document.extracted = true;
+        document.method = extraction->second.method;
+        document.completedAt = extraction->second.completedAt;
+    }
+    return true;
+}
+
+std::vector<size_t> MockBackend::SelectDocuments(bool extractedOnly, const std::string& owner) const
+{
+    // Besitzer der generierten Dokumente ergibt sich aus dem Index (admin, user1, user2, ...)
+    size_t ownerSlot = options_.users;
+    if (owner == "admin") ownerSlot = 0;
+    else if (owner.compare(0, 4, "user") == 0 && owner.size() > 4) ownerSlot = static_cast<size_t>(ToInt(owner.substr(4), -1));
+
+    std::vector<size_t> indices;
+    std::lock_guard<std::mutex> lock(mutex_);
+    size_t count = options_.documents + uploaded_.size();
+    for (size_t i = 0; i < count; ++i) {
+        if (deleted_.count(i)) continue;
+        bool generated = i < options_.documents;
+        if (!owner.empty()) {
+            if (generated ? i % options_.users != ownerSlot : uploaded_[i - options_.documents].uploadedBy != owner) continue;
+        }
+        if (extractedOnly) {
+            bool extracted = generated && static_cast<int>(Mix(options_.seed, i, 1) % 100) < options_.extractedPercent;
+            if (!extracted && !extractions_.count(i)) continue;
+        }
+        indices.push_back(i);
+    }
+    return indices;
+}
+
+std::string MockBackend::DocumentText(size_t index) const
+{
+    uint64_t state = Mix(options_.seed, index, 2);
+    auto next = [&state]() {
+        state = Mix(state, 0x5851F42D4C957F2DULL);
+        return state;
+    };
+
+    // Länge zwischen 50 % und 150 % des Mittelwerts
+    size_t target = options_.textBytes / 2 + (options_.textBytes > 0 ? next() % (options_.textBytes + 1) : 0);
+    std::string text;
+    text.reserve(target + 64);
+    text += "Dokument doc-" + std::to_string(index) + "\n\n";
+    size_t wordsInSentence = 0, sentences = 0;
+    const size_t wordCount = sizeof(kWords) / sizeof(kWords[0]);
+    while (text.size() < target) {
+        std::string word = kWords[next() % wordCount];
+        if (wordsInSentence == 0 && !word.empty() && word[0] >= 'a' && word[0] <= 'z') word[0] = static_cast<char>(word[0] - 32);
+        text += word;
+        if (++wordsInSentence >= 6 + next() % 9) {
+            wordsInSentence = 0;
+            text += (++sentences % 5 == 0) ? ".\n\n" : ". ";
+        } else {
+            text += next() % 11 == 0 ? ", " : " ";
+        }
+    }
+    return text;
+}
+
+bool MockBackend::Authenticate(const HttpRequest& request, User& caller) const
+{
+    std::string header = request.Header("authorization");
+    if (header.compare(0, 6, "Basic ") != 0) return false;
+    std::string credentials = Base64Decode(header.substr(6));
+    size_t colon = credentials.find(':');
+    if (colon == std::string::npos) return false;
+    std::string username = credentials.substr(0, colon);
+    std::string hash = credentials.substr(colon + 1);
+
+    std::lock_guard<std::mutex> lock(mutex_);
+    for (const auto& user : users_) {
+        if (user.username == username && user.active && user.passwordHash == hash) {
+            caller = user;
+            return true;
+        }
+    }
+    return false;
+}
+
+// ---------------------------------------------------------------------------
+// JSON
+
+std::string MockBackend::UserJson(const User& user) const
+{
+    return "{\"id\":" + std::to_string(user.id) + ",\"username\":" + Quote(user.username) + ",\"email\":" + Quote(user.email) +
+           ",\"role\":" + Quote(user.role) + ",\"isActive\":" + (user.active ? "true" : "false") +
+           ",\"createdAt\":" + Quote(FormatTime(user.createdAt)) +
+           ",\"lastLogin\":" + (user.lastLogin ? Quote(FormatTime(user.lastLogin)) : "null") + "}";
+}
+
+std::string MockBackend::DocumentJson(const Document& document) const
+{
+    std::string id = "doc-" + std::to_string(document.index);
+    bool image = document.fileName.size() > 4 && document.fileName.compare(document.fileName.size() - 4, 4, ".png") == 0;
+    return "{\"id\":" + Quote(id) + ",\"fileId\":" + Quote(id) + ",\"fileName\":" + Quote(document.fileName) +
+           ",\"fileSize\":" + std::to_string(document.fileSize) + ",\"contentType\":" +
+           Quote(image ? "image/png" : "application/pdf") + ",\"uploadedBy\":" + Quote(document.uploadedBy) +
+           ",\"uploadedAt\":" + Quote(FormatTime(document.uploadedAt)) +
+           ",\"hasExtraction\":" + (document.extracted ? "true" : "false") + "}";
+}
+
+std::string MockBackend::ExtractionJson(const Document& document, bool withText) const
+{
+    std::string json = "{\"id\":" + Quote("ext-" + std::to_string(document.index)) +
+                       ",\"extractionId\":" + Quote("ext-" + std::to_string(document.index)) +
+                       ",\"documentId\":" + Quote("doc-" + std::to_string(document.index)) +
+                       ",\"fileName\":" + Quote(document.fileName) + ",\"uploadedBy\":" + Quote(document.uploadedBy) +
+                       ",\"extractionMethod\":" + Quote(document.method) + ",\"status\":\"Completed\"" +
+                       ",\"completedAt\":" + Quote(FormatTime(document.completedAt));
+    if (withText) {
+        std::string text = DocumentText(document.index);
+        json += ",\"pageCount\":" + std::to_string(std::max<size_t>(1, text.size() / 1800));
+        json += ",\"extractedText\":" + Quote(text);
+    }
+    return json + "}";
+}
+
+std::string MockBackend::LogJson(const LogEntry& entry) const
+{
+    return "{\"id\":" + std::to_string(entry.id) + ",\"timestamp\":" + Quote(entry.timestamp) + ",\"level\":" +
+           Quote(entry.level) + ",\"category\":" + Quote(entry.category) + ",\"message\":" + Quote(entry.message) + "}";
+}
+
+std::string MockBackend::StatisticsJson() const
+{
+    size_t active = 0, total = 0;
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        total = users_.size();
+        for (const auto& user : users_) active += user.active ? 1 : 0;
+    }
+    std::vector<size_t> all = SelectDocuments(false, "");
+    size_t documents = all.size();
+    size_t extracted = SelectDocuments(true, "").size();
+    std::vector<Document> recent;
+    for (size_t i = all.size(); i-- > 0 && recent.size() < 10;) {
+        Document document;
+        if (FindDocument(all[i], document)) recent.push_back(document);
+    }
+
+    std::string json = "{\"users\":{\"total\":" + std::to_string(total) + ",\"active\":" + std::to_string(active) +
+                       ",\"inactive\":" + std::to_string(total - active) + "},\"documents\":{\"total\":" +
+                       std::to_string(documents) + "},\"extractions\":{\"total\":" + std::to_string(extracted) + ",\"pending\":" +
+                       std::to_string(documents - extracted) + "},\"recentActivity\":[";
+    for (size_t i = 0; i < recent.size(); ++i) {
+        if (i > 0) json += ",";
+        json += "{\"type\":\"upload\",\"fileName\":" + Quote(recent[i].fileName) + ",\"uploadedBy\":" +
+                Quote(recent[i].uploadedBy) + ",\"timestamp\":" + Quote(FormatTime(recent[i].uploadedAt)) + "}";
+    }
+    return json + "]}";
+}
+
+// ---------------------------------------------------------------------------
+// Routing
+
+HttpReply MockBackend::Handle(const HttpRequest& request)
+{
+    std::vector<std::string> parts;
+    std::stringstream stream(request.path);
+    std::string part;
+    while (std::getline(stream, part, '/')) {
+        if (!part.empty()) parts.push_back(part);
+    }
+    if (parts.empty() || parts[0] != "api") return Message(404, "Unbekannter Pfad");
+    parts.erase(parts.begin());
+
+    // ping/info messen nur Netzwerk und Webserver, alles andere geht "über die Datenbank"
+    bool lightweight = parts.empty() || parts[0] == "ping" || parts[0] == "info";
+    if (!lightweight && options_.dbLatencyMs > 0) std::this_thread::sleep_for(std::chrono::milliseconds(options_.dbLatencyMs));
+
+    std::string caller;
+    HttpReply reply = Route(request, parts, caller);
+
+    if (!lightweight && (parts.empty() || parts[0] != "Logging")) {
+        std::string level = reply.status >= 500 ? "Error" : reply.status >= 400 ? "Warning" : "Information";
+        Log(level, "Api." + parts[0], request.method + " " + request.path + " -> " + std::to_string(reply.status) +
+                                          (caller.empty() ? "" : " (" + caller + ")"));
+    }
+    return reply;
+}
+
+HttpReply MockBackend::Route(const HttpRequest& request, const std::vector<std::string>& parts, std::string& callerName)
+{
+    if (parts.empty()) return Json(200, "{\"name\":\"tef_mock_server\",\"status\":\"ok\"}");
+    const std::string& controller = parts[0];
+    if (controller == "ping") return Json(200, "{\"status\":\"ok\",\"timestamp\":" + Quote(NowWithMillis()) + "}");
+    if (controller == "info") {
+        return Json(200, "{\"name\":\"tef_mock_server\",\"version\":\"1.0\",\"documents\":" +
+                             std::to_string(DocumentCount()) + ",\"users\":" + std::to_string(options_.users) + "}");
+    }
+    if (controller == "User") return HandleUser(request, parts);
+
+    User caller;
+    if (!Authenticate(request, caller)) {
+        if (options_.requireAuth) return Message(401, "Nicht angemeldet");
+        // Ohne Anmeldung läuft alles als admin
+        caller.username = "admin";
+        caller.role = "Admin";
+    }
+    callerName = caller.username;
+
+    bool adminOnly = controller == "Admin" || controller == "Seed" ||
+                     (controller == "Plugin" && request.method != "GET") ||
+                     (controller == "Logging" && request.method != "GET");
+    if (adminOnly && caller.role != "Admin") return Message(403, "Keine Berechtigung");
+
+    if (controller == "Upload") return HandleUpload(request, parts, caller);
+    if (controller == "Extraction") return HandleExtraction(request, parts);
+    if (controller == "Admin") return HandleAdmin(request, parts);
+    if (controller == "Logging") return HandleLogging(request, parts);
+    if (controller == "Diagnostics") return HandleDiagnostics(request, parts);
+    if (controller == "Plugin") return HandlePlugin(request, parts);
+    if (controller == "Seed") return HandleSeed(request, parts);
+    return Message(404, "Unbekannter Endpunkt: " + controller);
+}
+
+HttpReply MockBackend::HandleUser(const HttpRequest& request, const std::vector<std::string>& parts)
+{
+    if (request.method != "GET") return Message(405, "Nur GET");
+
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (parts.size() == 2 && parts[1] == "all") {
+        std::string json = "[";
+        for (size_t i = 0; i < users_.size(); ++i) {
+            if (i > 0) json += ",";
+            json += UserJson(users_[i]);
+        }
+        return Json(200, json + "]");
+    }
+    if (parts.size() != 1) return Message(404, "Unbekannter Endpunkt");
+
+    // Login: Passwort kommt als SHA256-Hex wie in ApiService::Login
+    std::string username = request.Query("username");
+    std::string password = request.Query("password");
+    for (auto& user : users_) {
+        if (user.username != username) continue;
+        if (!user.active) return Message(401, "Benutzer ist deaktiviert");
+        if (user.passwordHash != password) break;
+        user.lastLogin = std::time(nullptr);
+        return Json(200, "{\"success\":true,\"message\":\"Login erfolgreich\",\"user\":" + UserJson(user) +
+                             ",\"token\":" + Quote("mock-" + user.passwordHash.substr(0, 16)) + "}");
+    }
+    return Message(401, "Ungültiger Benutzername oder Passwort");
+}
+
+HttpReply MockBackend::HandleUpload(const HttpRequest& request, const std::vector<std::string>& parts, const User& caller)
+{
+    if (parts.size() == 1 && request.method == "POST") {
+        // multipart/form-data mit Feld "file"
+        std::string contentType = request.Header("content-type");
+        size_t boundaryPos = contentType.find("boundary=");
+        if (boundaryPos == std::string::npos) return Message(400, "multipart/form-data erwartet");
+        std::string boundary = "--" + contentType.substr(boundaryPos + 9);
+        if (boundary.size() > 2 && boundary[2] == '"') boundary = "--" + boundary.substr(3, boundary.find('"', 3) - 3);
+
+        size_t namePos = request.body.find("filename=\"");
+        size_t dataStart = request.body.find("\r\n\r\n", namePos);
+        if (namePos == std::string::npos || dataStart == std::string::npos) return Message(400, "Keine Datei übermittelt");
+        namePos += 10;
+        std::string fileName = request.body.substr(namePos, request.body.find('"', namePos) - namePos);
+        dataStart += 4;
+        size_t dataEnd = request.body.find("\r\n" + boundary, dataStart);
+        if (dataEnd == std::string::npos) dataEnd = request.body.size();
+        if (fileName.empty() || dataEnd == dataStart) return Message(400, "Leere Datei");
+
+        Document document;
+        document.fileName = fileName;
+        document.fileSize = dataEnd - dataStart;
+        document.uploadedBy = caller.username;
+        document.uploadedAt = std::time(nullptr);
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            document.index = options_.documents + uploaded_.size();
+            uploaded_.push_back(document);
+        }
+        std::string id = "doc-" + std::to_string(document.index);
+        return Json(200, "{\"success\":true,\"message\":\"Datei hochgeladen\",\"fileName\":" + Quote(fileName) +
+                             ",\"fileSize\":" + std::to_string(document.fileSize) + ",\"fileId\":" + Quote(id) +
+                             ",\"uploadedAt\":" + Quote(FormatTime(document.uploadedAt)) + "}");
+    }
+
+    if (parts.size() == 2 && request.method == "GET" && (parts[1] == "my-documents" || parts[1] == "statistics")) {
+        size_t mine = 0;
+        uint64_t mySize = 0;
+        std::string json = "[";
+        for (size_t index : SelectDocuments(false, caller.username)) {
+            Document document;
+            if (!FindDocument(index, document)) continue;
+            ++mine;
+            mySize += document.fileSize;
+            if (parts[1] == "my-documents") {
+                if (mine > 1) json += ",";
+                json += DocumentJson(document);
+            }
+        }
+        if (parts[1] == "my-documents") return Json(200, json + "]");
+        return Json(200, "{\"totalDocuments\":" + std::to_string(mine) + ",\"totalSize\":" + std::to_string(mySize) + "}");
+    }
+
+    size_t index = 0;
+    Document document;
+    if (parts.size() < 2 || !ParseDocumentId(parts[1], index) || !FindDocument(index, document)) {
+        return Message(404, "Datei nicht gefunden");
+    }
+
+    if (parts.size() == 2 && request.method == "GET") {
+        return Json(200, "{\"success\":true,\"message\":\"\",\"fileName\":" + Quote(document.fileName) +
+                             ",\"fileSize\":" + std::to_string(document.fileSize) + ",\"fileId\":" + Quote(parts[1]) +
+                             ",\"uploadedAt\":" + Quote(FormatTime(document.uploadedAt)) + "}");
+    }
+    if (parts.size() == 2 && request.method == "DELETE") {
+        if (document.uploadedBy != caller.username && caller.role != "Admin") return Message(403, "Keine Berechtigung");
+        std::lock_guard<std::mutex> lock(mutex_);
+        deleted_.insert(index);
+        extractions_.erase(index);
+        return Message(200, "Datei gelöscht");
+    }
+    if (parts.size() == 3 && parts[2] == "download" && request.method == "GET") {
+        // Inhalt wird nicht gespeichert: Füllbytes in Originalgröße, gestreamt
+        HttpReply reply;
+        reply.contentType = "application/octet-stream";
+        reply.headers["Content-Disposition"] = "attachment; filename=\"" + document.fileName + "\"";
+        auto remaining = std::make_shared<uint64_t>(document.fileSize);
+        reply.stream = [remaining](std::string& chunk) {
+            size_t size = static_cast<size_t>(std::min<uint64_t>(*remaining, 65536));
+            chunk.assign(size, 'x');
+            *remaining -= size;
+            return *remaining > 0;
+        };
+        return reply;
+    }
+    return Message(404, "Unbekannter Endpunkt");
+}
+
+HttpReply MockBackend::HandleExtraction(const HttpRequest& request, const std::vector<std::string>& parts)
+{
+    if (parts.size() == 2 && parts[1] == "stats" && request.method == "GET") {
+        size_t total = SelectDocuments(false, "").size();
+        size_t completed = SelectDocuments(true, "").size();
+        return Json(200, "{\"total\":" + std::to_string(total) + ",\"completed\":" + std::to_string(completed) +
+                             ",\"failed\":0,\"pending\":" + std::to_string(total - completed) +
+                             ",\"queueLength\":" + std::to_string(extractionsRunning.load()) +
+                             ",\"averageDurationMs\":" + std::to_string(options_.extractionMs) + "}");
+    }
+
+    if (parts.size() == 2 && parts[1] == "results" && request.method == "GET") {
+        // Alle Ergebnisse mit Text: gestreamt, damit 100k Dokumente nicht im Speicher landen
+        struct Cursor {
+            std::vector<size_t> indices;
+            size_t next = 0;
+            bool first = true;
+            bool opened = false;
+        };
+        auto cursor = std::make_shared<Cursor>();
+        cursor->indices = SelectDocuments(true, "");
+        HttpReply reply;
+        reply.stream = [this, cursor](std::string& chunk) {
+            if (!cursor->opened) {
+                chunk += "[";
+                cursor->opened = true;
+            }
+            while (cursor->next < cursor->indices.size() && chunk.size() < 65536) {
+                Document document;
+                if (!FindDocument(cursor->indices[cursor->next++], document) || !document.extracted) continue;
+                if (!cursor->first) chunk += ",";
+                cursor->first = false;
+                chunk += ExtractionJson(document, true);
+            }
+            if (cursor->next < cursor->indices.size()) return true;
+            chunk += "]";
+            return false;
+        };
+        return reply;
+    }
+
+    size_t index = 0;
+    Document document;
+    bool result = parts.size() == 3 && parts[1] == "result" && request.method == "GET";
+    bool start = parts.size() == 2 && request.method == "POST";
+    if (!result && !start) return Message(404, "Unbekannter Endpunkt");
+    const std::string& id = result ? parts[2] : parts[1];
+    if (!ParseDocumentId(id, index) || !FindDocument(index, document)) return Message(404, "Dokument nicht gefunden");
+
+    if (result) {
+        if (!document.extracted) return Message(404, "Keine Extraktion vorhanden");
+        return Json(200, ExtractionJson(document, true));
+    }
+
+    // Extraktion "ausführen"
+    ++extractionsRunning;
+    if (options_.extractionMs > 0) std::this_thread::sleep_for(std::chrono::milliseconds(options_.extractionMs));
+    --extractionsRunning;
+
+    bool ocr = ReadJsonValue(request.body, "enableOCR") == "true";
+    bool image = document.fileName.size() > 4 && document.fileName.compare(document.fileName.size() - 4, 4, ".png") == 0;
+    Extraction extraction{ocr || image ? "OCR" : "PdfText", std::time(nullptr)};
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        extractions_[index] = extraction;
+    }
+    document.extracted = true;
+    document.method = extraction.method;
+    document.completedAt = extraction.completedAt;
+    std::string json = ExtractionJson(document, true);
+    json.insert(1, "\"success\":true,");
+    return Json(200, json);
+}
+
+HttpReply MockBackend::HandleAdmin(const HttpRequest& request, const std::vector<std::string>& parts)
+{
+    if (parts.size() < 2) return Message(404, "Unbekannter Endpunkt");
+    const std::string& area = parts[1];
+
+    if (area == "statistics" && request.method == "GET") {
+        // Bedingte Requests wie beim StatisticsPoller: unveränderte Daten -> 304
+        HttpReply reply = Json(200, StatisticsJson());
+        std::string etag = "\"" + std::to_string(std::hash<std::string>()(reply.body)) + "\"";
+        reply.headers["ETag"] = etag;
+        if (request.Header("if-none-match") == etag) {
+            reply.status = 304;
+            reply.body.clear();
+        }
+        return reply;
+    }
+
+    if (area == "users") {
+        std::lock_guard<std::mutex> lock(mutex_);
+        if (parts.size() == 2 && request.method == "GET") {
+            bool includeInactive = request.Query("includeInactive", "true") != "false";
+            std::string json = "[";
+            bool first = true;
+            for (const auto& user : users_) {
+                if (!user.active && !includeInactive) continue;
+                if (!first) json += ",";
+                first = false;
+                json += UserJson(user);
+            }
+            return Json(200, json + "]");
+        }
+        if (parts.size() == 2 && request.method == "POST") {
+            User user;
+            user.username = ReadJsonValue(request.body, "username");
+            std::string password = ReadJsonValue(request.body, "password");
+            if (user.username.empty() || password.empty()) return Message(400, "Benutzername und Passwort erforderlich");
+            for (const auto& existing : users_) {
+                if (existing.username == user.username) return Message(409, "Benutzer existiert bereits");
+            }
+            user.id = users_.empty() ? 1 : users_.back().id + 1;
+            user.email = ReadJsonValue(request.body, "email");
+            user.role = ReadJsonValue(request.body, "role");
+            if (user.role.empty()) user.role = "User";
+            user.passwordHash = HashPassword(password);
+            user.createdAt = std::time(nullptr);
+            users_.push_back(user);
+            return Json(200, "{\"success\":true,\"message\":\"Benutzer angelegt\",\"user\":" + UserJson(user) + "}");
+        }
+
+        int userId = parts.size() >= 3 ? ToInt(parts[2], -1) : -1;
+        auto it = std::find_if(users_.begin(), users_.end(), [userId](const User& user) { return user.id == userId; });
+        if (it == users_.end()) return Message(404, "Benutzer nicht gefunden");
+        if (parts.size() == 3 && request.method == "PUT") {
+            std::string email = ReadJsonValue(request.body, "email");
+            std::string role = ReadJsonValue(request.body, "role");
+            std::string newPassword = ReadJsonValue(request.body, "newPassword");
+            if (!email.empty()) it->email = email;
+            if (!role.empty()) it->role = role;
+            if (!newPassword.empty()) it->passwordHash = HashPassword(newPassword);
+            return Json(200, "{\"success\":true,\"message\":\"Benutzer aktualisiert\",\"user\":" + UserJson(*it) + "}");
+        }
+        if (parts.size() == 4 && request.method == "POST" && (parts[3] == "activate" || parts[3] == "deactivate")) {
+            it->active = parts[3] == "activate";
+            return Message(200, it->active ? "Benutzer aktiviert" : "Benutzer deaktiviert");
+        }
+        return Message(404, "Unbekannter Endpunkt");
+    }
+
+    if ((area == "documents" || area == "extractions") && request.method == "GET") {
+        bool extractions = area == "extractions";
+
+        // Einzelne Extraktion mit Text
+        if (extractions && parts.size() == 3) {
+            size_t index = 0;
+            Document document;
+            if (!ParseDocumentId(parts[2], index) || !FindDocument(index, document) || !document.extracted) {
+                return Message(404, "Extraktion nicht gefunden");
+            }
+            return Json(200, ExtractionJson(document, true));
+        }
+
+        // Dokumente eines Benutzers
+        std::string owner;
+        if (!extractions && parts.size() == 4 && parts[2] == "user") owner = parts[3];
+        else if (parts.size() != 2) return Message(404, "Unbekannter Endpunkt");
+
+        int pageSize = std::min(std::max(ToInt(request.Query("pageSize"), 50), 1), kMaxPageSize);
+        int page = std::max(ToInt(request.Query("page"), 1), 1);
+        std::vector<size_t> indices = SelectDocuments(extractions, owner);
+        // Die Dokumentliste eines Benutzers ist nicht seitenweise
+        size_t first = owner.empty() ? std::min(indices.size(), static_cast<size_t>(page - 1) * static_cast<size_t>(pageSize)) : 0;
+        size_t last = owner.empty() ? std::min(indices.size(), first + static_cast<size_t>(pageSize)) : indices.size();
+        std::string items;
+        for (size_t i = first; i < last; ++i) {
+            Document document;
+            if (!FindDocument(indices[i], document)) continue;
+            if (!items.empty()) items += ",";
+            items += extractions ? ExtractionJson(document, false) : DocumentJson(document);
+        }
+        size_t matches = indices.size();
+        if (!owner.empty()) return Json(200, "[" + items + "]");
+        return Json(200, "{\"items\":[" + items + "],\"page\":" + std::to_string(page) + ",\"pageSize\":" +
+                             std::to_string(pageSize) + ",\"totalCount\":" + std::to_string(matches) + "}");
+    }
+    return Message(404, "Unbekannter Endpunkt");
+}
+
+HttpReply MockBackend::HandleLogging(const HttpRequest& request, const std::vector<std::string>& parts)
+{
+    if (parts.size() < 2) return Message(404, "Unbekannter Endpunkt");
+    const std::string& area = parts[1];
+    int count = std::max(ToInt(request.Query("count"), 100), 0);
+
+    if (area == "test" && request.method == "POST") {
+        std::string level = ReadJsonValue(request.body, "level");
+        Log(level.empty() ? "Information" : level, "Test", ReadJsonValue(request.body, "message"));
+        return Message(200, "Testeintrag geschrieben");
+    }
+
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (area == "config" && parts.size() == 3) {
+        if (request.method == "POST") logLevels_[parts[2]] = ReadJsonValue(request.body, "logLevel");
+        auto it = logLevels_.find(parts[2]);
+        return Json(200, "{\"category\":" + Quote(parts[2]) + ",\"logLevel\":" +
+                             Quote(it != logLevels_.end() ? it->second : "Information") + "}");
+    }
+    if (area == "cleanup" && request.method == "DELETE") {
+        int days = std::max(ToInt(request.Query("daysToKeep"), 30), 0);
+        std::string cutoff = FormatTime(std::time(nullptr) - static_cast<std::time_t>(days) * 86400);
+        size_t before = logs_.size();
+        logs_.erase(std::remove_if(logs_.begin(), logs_.end(), [&cutoff](const LogEntry& entry) { return entry.timestamp < cutoff; }),
+                    logs_.end());
+        return Json(200, "{\"success\":true,\"deleted\":" + std::to_string(before - logs_.size()) + "}");
+    }
+    if (area == "statistics" && request.method == "GET") {
+        std::map<std::string, size_t> byLevel;
+        for (const auto& entry : logs_) ++byLevel[entry.level];
+        std::string json = "{\"total\":" + std::to_string(logs_.size()) + ",\"byLevel\":{";
+        bool first = true;
+        for (const auto& level : byLevel) {
+            if (!first) json += ",";
+            first = false;
+            json += Quote(level.first) + ":" + std::to_string(level.second);
+        }
+        return Json(200, json + "}}");
+    }
+    if (request.method != "GET") return Message(404, "Unbekannter Endpunkt");
+
+    // Abfragen: recent/level/category liefern die neuesten zuerst, daterange aufsteigend
+    std::string json = "[";
+    auto append = [&json](const std::string& item) {
+        if (json.size() > 1) json += ",";
+        json += item;
+    };
+    if (area == "daterange") {
+        std::string from = request.Query("from");
+        std::string to = request.Query("to");
+        for (const auto& entry : logs_) {
+            if (entry.timestamp < from || (!to.empty() && entry.timestamp > to)) continue;
+            append(LogJson(entry));
+        }
+        return Json(200, json + "]");
+    }
+
+    std::string filter = parts.size() == 3 ? parts[2] : "";
+    if (area != "recent" && !((area == "level" || area == "category") && !filter.empty())) {
+        return Message(404, "Unbekannter Endpunkt");
+    }
+    int found = 0;
+    for (auto it = logs_.rbegin(); it != logs_.rend() && found < count; ++it) {
+        if (area == "level" && it->level != filter) continue;
+        if (area == "category" && it->category != filter) continue;
+        append(LogJson(*it));
+        ++found;
+    }
+    return Json(200, json + "]");
+}
+
+HttpReply MockBackend::HandleDiagnostics(const HttpRequest& request, const std::vector<std::string>& parts)
+{
+    std::string area = parts.size() >= 2 ? parts[1] : "";
+    if (area == "connection") return Json(200, "{\"success\":true,\"message\":\"Verbindung erfolgreich\",\"database\":\"mock\"}");
+    if (area == "database" && parts.size() == 3 && parts[2] == "exists") return Json(200, "{\"exists\":true}");
+    if (area == "database" && parts.size() == 3 && parts[2] == "create" && request.method == "POST") {
+        return Json(200, "{\"success\":true,\"created\":false,\"message\":\"Datenbank existiert bereits\"}");
+    }
+    if (area == "tables") return Json(200, "{\"tables\":[\"Users\",\"Documents\",\"Extractions\",\"Logs\"]}");
+
+    size_t users = 0, logs = 0;
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        users = users_.size();
+        logs = logs_.size();
+    }
+    std::string stats = "{\"users\":" + std::to_string(users) + ",\"documents\":" + std::to_string(DocumentCount()) +
+                        ",\"logs\":" + std::to_string(logs) + ",\"extractionsRunning\":" +
+                        std::to_string(extractionsRunning.load()) + "}";
+    if (area == "stats") return Json(200, stats);
+    if (area == "full-report") {
+        return Json(200, "{\"connection\":{\"success\":true},\"databaseExists\":true,\"stats\":" + stats +
+                             ",\"generatedAt\":" + Quote(NowWithMillis()) + "}");
+    }
+    return Message(404, "Unbekannter Endpunkt");
+}
+
+HttpReply MockBackend::HandlePlugin(const HttpRequest& request, const std::vector<std::string>& parts)
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (parts.size() == 1 && request.method == "GET") {
+        std::string json = "[";
+        for (size_t i = 0; i < plugins_.size(); ++i) {
+            if (i > 0) json += ",";
+            json += "{\"name\":" + Quote(plugins_[i]) + ",\"loaded\":true}";
+        }
+        return Json(200, json + "]");
+    }
+    if (parts.size() == 2 && parts[1] == "stats" && request.method == "GET") {
+        return Json(200, "{\"loaded\":" + std::to_string(plugins_.size()) + "}");
+    }
+    if (parts.size() == 2 && parts[1] == "load" && request.method == "POST") {
+        std::string path = ReadJsonValue(request.body, "pluginPath");
+        if (path.empty()) return Message(400, "pluginPath fehlt");
+        std::string name = path.substr(path.find_last_of("/\\") + 1);
+        if (std::find(plugins_.begin(), plugins_.end(), name) == plugins_.end()) plugins_.push_back(name);
+        return Message(200, "Plugin geladen: " + name);
+    }
+    if (parts.size() == 2 && request.method == "DELETE") {
+        auto it = std::find(plugins_.begin(), plugins_.end(), parts[1]);
+        if (it == plugins_.end()) return Message(404, "Plugin nicht geladen");
+        plugins_.erase(it);
+        return Message(200, "Plugin entladen");
+    }
+    return Message(404, "Unbekannter Endpunkt");
+}
+
+HttpReply MockBackend::HandleSeed(const HttpRequest& request, const std::vector<std::string>& parts)
+{
+    std::string area = parts.size() >= 2 ? parts[1] : "";
+    if (area == "status" && request.method == "GET") {
+        return Json(200, "{\"seeded\":true,\"documents\":" + std::to_string(DocumentCount()) + ",\"users\":" +
+                             std::to_string(options_.users) + "}");
+    }
+    if (request.method != "POST") return Message(404, "Unbekannter Endpunkt");
+    if (area == "seed" && parts.size() == 3 && parts[2] == "users") {
+        SeedUsers();
+        return Message(200, "Benutzer angelegt");
+    }
+    if (area == "seed") return Message(200, "Daten bereits vorhanden");
+    if (area == "reset") {
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            uploaded_.clear();
+            deleted_.clear();
+            extractions_.clear();
+            plugins_.clear();
+            logLevels_.clear();
+        }
+        SeedUsers();
+        return Message(200, "Datenbestand zurückgesetzt");
+    }
+    return Message(404, "Unbekannter Endpunkt");
+}
+
+} // namespace Mock
@@ -0,0 +1,157 @@
+// Mock-Backend für reproduzierbare Last- und Latenztests ohne das .NET-Backend
+#include "../../include/Mock/HttpServer.h"
+#include "../../include/Mock/MockBackend.h"
+#include <csignal>
+#include <cstdio>
+#include <cstdlib>
+#include <iostream>
+#include <string>
+
+namespace {
+
+Mock::HttpServer* runningServer = nullptr;
+
+void OnSignal(int)
+{
+    if (runningServer) runningServer->Stop();
+}
+
+void PrintUsage()
+{
+    std::fprintf(stderr,
+        "Verwendung: tef_mock_server [Optionen]\n"
+        "\n"
+        "Stellt die REST-API aus Swagger-Docs.json unter http://<bind>:<port>/api bereit.\n"
+        "Alle Benutzer (admin, user1, ...) haben das Passwort aus --password.\n"
+        "\n"
+        "Server:\n"
+        "  --port N             Port (Standard: 5000, 0 = frei wählen und ausgeben)\n"
+        "  --bind ADRESSE       Adresse (Standard: 127.0.0.1)\n"
+        "  --verbose            Jeden Request auf stdout protokollieren\n"
+        "\n"
+        "Datenbestand:\n"
+        "  --documents N        Anzahl Dokumente (Standard: 1000)\n"
+        "  --users N            Anzahl Benutzer (Standard: 20)\n"
+        "  --text-bytes N       Mittlere Textlänge einer Extraktion (Standard: 2000)\n"
+        "  --extracted P        Prozent der Dokumente mit Extraktion (Standard: 90)\n"
+        "  --password PW        Passwort aller Benutzer (Standard: test)\n"
+        "  --no-auth            Requests ohne Anmeldung erlauben (laufen als admin)\n"
+        "  --seed N             Startwert für Datenbestand und Zufallsentscheidungen (Standard: 1)\n"
+        "\n"
+        "Netzwerk und Last:\n"
+        "  --latency-ms N       Feste Verzögerung jeder Antwort\n"
+        "  --jitter-ms N        Zusätzliche zufällige Verzögerung 0..N\n"
+        "  --bandwidth-kbps N   Senderate je Verbindung in KiB/s (0 = unbegrenzt)\n"
+        "  --error-rate R       Anteil Antworten mit Status 500 (0..1)\n"
+        "  --drop-rate R        Anteil Verbindungen, die ohne Antwort geschlossen werden (0..1)\n"
+        "  --db-latency-ms N    Zusätzliche Verzögerung aller Endpunkte außer ping/info\n"
+        "  --extraction-ms N    Dauer von POST Extraction/{id}\n");
+}
+
+bool ParseArgs(int argc, char** argv, std::string& bind, int& port, bool& verbose,
+               Mock::DatasetOptions& dataset, Mock::NetworkProfile& network, std::string& error)
+{
+    for (int i = 1; i < argc; ++i) {
+        std::string arg = argv[i];
+        auto value = [&](std::string& target) {
+            if (i + 1 >= argc) {
+                error = arg + " erwartet einen Wert";
+                return false;
+            }
+            target = argv[++i];
+            return true;
+        };
+        auto integer = [&](long long& target, long long minimum) {
+            std::string text;
+            if (!value(text)) return false;
+            char* end = nullptr;
+            target = std::strtoll(text.c_str(), &end, 10);
+            if (text.empty() || *end != '\0' || target < minimum) {
+                error = arg + ": ungültige Zahl " + text;
+                return false;
+            }
+            return true;
+        };
+        auto rate = [&](double& target) {
+            std::string text;
+            if (!value(text)) return false;
+            char* end = nullptr;
+            target = std::strtod(text.c_str(), &end);
+            if (text.empty() || *end != '\0' || target < 0.0 || target > 1.0) {
+                error = arg + ": Wert zwischen 0 und 1 erwartet";
+                return false;
+            }
+            return true;
+        };
+
+        long long number = 0;
+        if (arg == "--port") { if (!integer(number, 0)) return false; port = static_cast<int>(number); }
+        else if (arg == "--bind") { if (!value(bind)) return false; }
+        else if (arg == "--verbose") verbose = true;
+        else if (arg == "--documents") { if (!integer(number, 0)) return false; dataset.documents = static_cast<size_t>(number); }
+        else if (arg == "--users") { if (!integer(number, 1)) return false; dataset.users = static_cast<size_t>(number); }
+        else if (arg == "--text-bytes") { if (!integer(number, 0)) return false; dataset.textBytes = static_cast<size_t>(number); }
+        else if (arg == "--extracted") { if (!integer(number, 0)) return false; dataset.extractedPercent = static_cast<int>(number); }
+        else if (arg == "--password") { if (!value(dataset.password)) return false; }
+        else if (arg == "--no-auth") dataset.requireAuth = false;
+        else if (arg == "--seed") {
+            if (!integer(number, 0)) return false;
+            dataset.seed = network.seed = static_cast<uint64_t>(number);
+        }
+        else if (arg == "--latency-ms") { if (!integer(number, 0)) return false; network.latencyMs = static_cast<int>(number); }
+        else if (arg == "--jitter-ms") { if (!integer(number, 0)) return false; network.jitterMs = static_cast<int>(number); }
+        else if (arg == "--bandwidth-kbps") { if (!integer(number, 0)) return false; network.bandwidthBytes = number * 1024; }
+        else if (arg == "--error-rate") { if (!rate(network.errorRate)) return false; }
+        else if (arg == "--drop-rate") { if (!rate(network.dropRate)) return false; }
+        else if (arg == "--db-latency-ms") { if (!integer(number, 0)) return false; dataset.dbLatencyMs = static_cast<int>(number); }
+        else if (arg == "--extraction-ms") { if (!integer(number, 0)) return false; dataset.extractionMs = static_cast<int>(number); }
+        else if (arg == "--help" || arg == "-h") {
+            error.clear();
+            return false;
+        }
+        else {
+            error = "Unbekannte Option: " + arg;
+            return false;
+        }
+    }
+    return true;
+}
+
+} // namespace
+
+int main(int argc, char** argv)
+{
+    std::string bind = "127.0.0.1";
+    int port = 5000;
+    bool verbose = false;
+    Mock::DatasetOptions dataset;
+    Mock::NetworkProfile network;
+    std::string error;
+    if (!ParseArgs(argc, argv, bind, port, verbose, dataset, network, error)) {
+        if (!error.empty()) std::fprintf(stderr, "Fehler: %s\n\n", error.c_str());
+        PrintUsage();
+        return error.empty() ? 0 : 2;
+    }
+
+    Mock::MockBackend backend(dataset);
+    Mock::HttpServer server([&backend](const Mock::HttpRequest& request) { return backend.Handle(request); }, network);
+    server.SetAccessLog(verbose);
+    if (!server.Listen(bind, port, error)) {
+        std::fprintf(stderr, "Fehler: %s\n", error.c_str());
+        return 1;
+    }
+
+    runningServer = &server;
+    std::signal(SIGINT, OnSignal);
+    std::signal(SIGTERM, OnSignal);
+
+    // Erste Zeile ist maschinenlesbar, damit Skripte mit --port 0 die URL finden
+    std::cout << "http://" << bind << ":" << server.Port() << "/api" << std::endl;
+    std::cout << "tef_mock_server: " << dataset.documents << " Dokumente, " << dataset.users << " Benutzer, Latenz "
+              << network.latencyMs << "+" << network.jitterMs << " ms, Fehlerrate " << network.errorRate << std::endl;
+
+    server.Run();
+    runningServer = nullptr;
+    std::cout << "tef_mock_server beendet nach " << server.Requests() << " Requests" << std::endl;
+    return 0;
+}
@@ -0,0 +1,241 @@
+#include "../../include/Services/AdminTables.h"
+#include "../../include/Services/JsonUtil.h"
+#include <cstdio>
+#include <cstdlib>
+
+namespace Services {
+
+namespace {
+
+// Tage seit 1970-01-01 für ein Datum im gregorianischen Kalender (H. Hinnant, days_from_civil)
+int64_t DaysFromCivil(int64_t y, unsigned m, unsigned d)
+{
+    y -= m <= 2;
+    const int64_t era = (y >= 0 ? y : y - 399) / 400;
+    const unsigned yoe = static_cast<unsigned>(y - era * 400);
+    const unsigned doy = (153 * (m + (m > 2 ? -3 : 9)) + 2) / 5 + d - 1;
+    const unsigned doe = yoe * 365 + yoe / 4 - yoe / 100 + doy;
+    return era * 146097 + static_cast<int64_t>(doe) - 719468;
+}
+
+void CivilFromDays(int64_t z, int64_t& y, unsigned& m, unsigned& d)
+{
+    z += 719468;
+    const int64_t era = (z >= 0 ? z : z - 146096) / 146097;
+    const unsigned doe = static_cast<unsigned>(z - era * 146097);
+    const unsigned yoe = (doe - doe / 1460 + doe / 36524 - doe / 146096) / 365;
+    const unsigned doy = doe - (365 * yoe + yoe / 4 - yoe / 100);
+    const unsigned mp = (5 * doy + 2) / 153;
+    d = doy - (153 * mp + 2) / 5 + 1;
+    m = mp < 10 ? mp + 3 : mp - 9;
+    y = static_cast<int64_t>(yoe) + era * 400 + (m <= 2);
+}
+
+bool ReadDigits(std::string_view text, size_t pos, size_t count, unsigned& value)
+{
+    value = 0;
+    for (size_t i = pos; i < pos + count; ++i) {
+        if (text[i] < '0' || text[i] > '9') return false;
+        value = value * 10 + static_cast<unsigned>(text[i] - '0');
+    }
+    return true;
+}
+
+// Wie std::stoi: führende Leerzeichen und Vorzeichen erlaubt, Rest ignoriert; fallback wenn keine Ziffer folgt
+int64_t ParseInteger(const std::string& text, int64_t fallback)
+{
+    const char* begin = text.c_str();
+    char* end = nullptr;
+    long long value = std::strtoll(begin, &end, 10);
+    return end == begin ? fallback : static_cast<int64_t>(value);
+}
+
+template <typename T>
+size_t ColumnBytes(const std::vector<T>& column)
+{
+    return column.capacity() * sizeof(T);
+}
+
+} // namespace
+
+int64_t ParseTimestamp(std::string_view text)
+{
+    // 2026-03-01T12:00:00 (Leerzeichen statt T wird ebenfalls akzeptiert)
+    if (text.size() < 19 || text[4] != '-' || text[7] != '-' || (text[10] != 'T' && text[10] != ' ') ||
+        text[13] != ':' || text[16] != ':') {
+        return kNoTimestamp;
+    }
+    unsigned year, month, day, hour, minute, second;
+    if (!ReadDigits(text, 0, 4, year) || !ReadDigits(text, 5, 2, month) || !ReadDigits(text, 8, 2, day) ||
+        !ReadDigits(text, 11, 2, hour) || !ReadDigits(text, 14, 2, minute) || !ReadDigits(text, 17, 2, second)) {
+        return kNoTimestamp;
+    }
+    if (month < 1 || month > 12 || day < 1 || day > 31 || hour > 23 || minute > 59 || second > 60) return kNoTimestamp;
+    return DaysFromCivil(year, month, day) * 86400 + hour * 3600 + minute * 60 + second;
+}
+
+std::string FormatTimestamp(int64_t seconds)
+{
+    if (seconds == kNoTimestamp) return "";
+    int64_t days = seconds >= 0 ? seconds / 86400 : (seconds - 86399) / 86400;
+    int64_t rest = seconds - days * 86400;
+    int64_t year;
+    unsigned month, day;
+    CivilFromDays(days, year, month, day);
+    char buf[64];
+    std::snprintf(buf, sizeof(buf), "%04lld-%02u-%02uT%02u:%02u:%02u", static_cast<long long>(year), month, day,
+                  static_cast<unsigned>(rest / 3600), static_cast<unsigned>(rest / 60 % 60), static_cast<unsigned>(rest % 60));
+    return buf;
+}
+
+// ---------------------------------------------------------------------------
+
+StringRef StringArena::Add(std::string_view text)
+{
+    StringRef ref;
+    ref.offset = static_cast<uint32_t>(data_.size());
+    ref.length = static_cast<uint32_t>(text.size());
+    data_.append(text.data(), text.size());
+    return ref;
+}
+
+StringDictionary::StringDictionary()
+{
+    Clear();
+}
+
+uint32_t StringDictionary::Intern(std::string_view text)
+{
+    if (text.empty()) return 0;
+    auto inserted = ids_.emplace(std::string(text), static_cast<uint32_t>(values_.size()));
+    if (inserted.second) values_.push_back(&inserted.first->first);
+    return inserted.first->second;
+}
+
+void StringDictionary::Clear()
+{
+    ids_.clear();
+    values_.clear();
+    auto empty = ids_.emplace(std::string(), 0u);
+    values_.push_back(&empty.first->first);
+}
+
+size_t StringDictionary::MemoryBytes() const
+{
+    // Grobe Schätzung: Knoten (Schlüssel, ID, Verkettung), Heap-Puffer langer Werte, Buckets, Zeigertabelle
+    size_t bytes = ids_.bucket_count() * sizeof(void*) + values_.capacity() * sizeof(const std::string*);
+    for (const auto& entry : ids_) {
+        bytes += sizeof(entry) + sizeof(void*);
+        if (entry.first.capacity() > 15) bytes += entry.first.capacity() + 1;
+    }
+    return bytes;
+}
+
+// ---------------------------------------------------------------------------
+
+size_t UserTable::Ingest(const std::string& json)
+{
+    size_t added = 0;
+    ForEachFlatObject(json, [&](const std::string& obj) {
+        if (obj.find("\"username\"") == std::string::npos) return;
+        userId_.push_back(arena_.Add(ExtractJsonField(obj, "id")));
+        username_.push_back(arena_.Add(ExtractJsonField(obj, "username")));
+        email_.push_back(arena_.Add(ExtractJsonField(obj, "email")));
+        role_.push_back(roles_.Intern(ExtractJsonField(obj, "role")));
+        createdAt_.push_back(ParseTimestamp(ExtractJsonField(obj, "createdAt")));
+        lastLogin_.push_back(ParseTimestamp(ExtractJsonField(obj, "lastLogin")));
+        std::string isActive = ExtractJsonField(obj, "isActive");
+        active_.push_back(isActive == "true" || isActive == "1" ? 1 : 0);
+        ++added;
+    });
+    return added;
+}
+
+void UserTable::Clear()
+{
+    arena_.Clear();
+    roles_.Clear();
+    userId_.clear();
+    username_.clear();
+    email_.clear();
+    role_.clear();
+    createdAt_.clear();
+    lastLogin_.clear();
+    active_.clear();
+}
+
+size_t UserTable::MemoryBytes() const
+{
+    return arena_.MemoryBytes() + roles_.MemoryBytes() + ColumnBytes(userId_) + ColumnBytes(username_) +
+           ColumnBytes(email_) + ColumnBytes(role_) + ColumnBytes(createdAt_) + ColumnBytes(lastLogin_) + ColumnBytes(active_);
+}
+
+size_t DocumentTable::Ingest(const std::string& json)
+{
+    size_t added = 0;
+    ForEachFlatObject(json, [&](const std::string& obj) {
+        if (obj.find("\"fileName\"") == std::string::npos) return;
+        fileId_.push_back(arena_.Add(ExtractJsonField(obj, "id")));
+        fileName_.push_back(arena_.Add(ExtractJsonField(obj, "fileName")));
+        uploadedBy_.push_back(users_.Intern(ExtractJsonField(obj, "uploadedBy")));
+        uploadedAt_.push_back(ParseTimestamp(ExtractJsonField(obj, "uploadedAt")));
+        fileSize_.push_back(ParseInteger(ExtractJsonField(obj, "fileSize"), -1));
+        ++added;
+    });
+    return added;
+}
+
+void DocumentTable::Clear()
+{
+    arena_.Clear();
+    users_.Clear();
+    fileId_.clear();
+    fileName_.clear();
+    uploadedBy_.clear();
+    uploadedAt_.clear();
+    fileSize_.clear();
+}
+
+size_t DocumentTable::MemoryBytes() const
+{
+    return arena_.MemoryBytes() + users_.MemoryBytes() + ColumnBytes(fileId_) + ColumnBytes(fileName_) +
+           ColumnBytes(uploadedBy_) + ColumnBytes(uploadedAt_) + ColumnBytes(fileSize_);
+}
+
+size_t ExtractionTable::Ingest(const std::string& json)
+{
+    size_t added = 0;
+    ForEachFlatObject(json, [&](const std::string& obj) {
+        if (obj.find("\"status\"") == std::string::npos) return;
+        extractionId_.push_back(arena_.Add(ExtractJsonField(obj, "id")));
+        fileName_.push_back(arena_.Add(ExtractJsonField(obj, "fileName")));
+        method_.push_back(methods_.Intern(ExtractJsonField(obj, "extractionMethod")));
+        uploadedBy_.push_back(users_.Intern(ExtractJsonField(obj, "uploadedBy")));
+        completedAt_.push_back(ParseTimestamp(ExtractJsonField(obj, "completedAt")));
+        status_.push_back(static_cast<int32_t>(ParseInteger(ExtractJsonField(obj, "status"), 0)));
+        ++added;
+    });
+    return added;
+}
+
+void ExtractionTable::Clear()
+{
+    arena_.Clear();
+    methods_.Clear();
+    users_.Clear();
+    extractionId_.clear();
+    fileName_.clear();
+    method_.clear();
+    uploadedBy_.clear();
+    completedAt_.clear();
+    status_.clear();
+}
+
+size_t ExtractionTable::MemoryBytes() const
+{
+    return arena_.MemoryBytes() + methods_.MemoryBytes() + users_.MemoryBytes() + ColumnBytes(extractionId_) +
+           ColumnBytes(fileName_) + ColumnBytes(method_) + ColumnBytes(uploadedBy_) + ColumnBytes(completedAt_) +
+           ColumnBytes(status_);
+}
+
+} // namespace Services
@@ -1,4 +1,6 @@
 #include "../../include/Services/ApiService.h"
+#include "../../include/Services/FrameProfiler.h"
+#include "../../include/Services/Tracer.h"
 #include "../../include/Services/LoginService.h"
 #include <curl/curl.h>
 #include <openssl/sha.h>
@@ -6,9 +8,14 @@
 #include <sstream>
 #include <iomanip>
 #include <cstring>
+#include <algorithm>
+#include <cctype>
 #include <memory>
 #include <optional>
 #include <functional>
+#include <mutex>
+#include <chrono>
+#include <vector>
 
 // Helper function declarations outside namespace
 static std::string extractJsonValue(const std::string& json, const std::string& key) {
@@ -26,9 +33,60 @@ static std::string extractJsonValue(const std::string& json, const std::string&
 namespace Services {
 
 // Static member initialization
-std::string ApiService::_baseUrl = "http://127.0.0.1:5000/api";
 std::string ApiService::_authUsername;
 std::string ApiService::_authPassword;
+bool ApiService::_verbose = true;
+
+// Blockierende Requests auf dem GUI-Thread erscheinen als eigener Abschnitt im Frame-Profiler
+static int ApiSection()
+{
+    static const int section = FrameProfiler::RegisterSection("ApiService (blockierend)");
+    return section;
+}
+
+// Verbindungsfehler, bei denen der Server den Request sicher nicht gesehen hat
+static bool NotSent(CURLcode res)
+{
+    return res == CURLE_COULDNT_CONNECT || res == CURLE_COULDNT_RESOLVE_HOST || res == CURLE_COULDNT_RESOLVE_PROXY;
+}
+
+// Führt den Request aus; misst ihn für Frame-Profiler und Trace (Methode, Endpunkt, Status)
+// Setzt die URL selbst: Knoten aus ApiService::Nodes(), bei Verbindungsfehlern der nächste Knoten.
+// GET/PUT/DELETE/HEAD werden bei jedem Fehler ohne Antwort wiederholt, POST nur wenn er den Server
+// nicht erreicht haben kann (sonst könnte ein Upload doppelt angelegt werden). Fehlerstatus werden nicht wiederholt.
+static CURLcode Perform(CURL* curl, const char* method, const std::string& endpoint)
+{
+    FrameProfiler::Scope scope(ApiSection());
+    NodeSet& nodes = ApiService::Nodes();
+    std::string_view key = NodeSet::AffinityKey(endpoint);
+    bool idempotent = std::strcmp(method, "POST ") != 0;
+    size_t attempts = std::max<size_t>(1, nodes.Size());
+    std::vector<size_t> tried;
+    CURLcode res = CURLE_FAILED_INIT;
+    for (size_t attempt = 0; attempt < attempts; ++attempt) {
+        NodeSet::Lease lease = nodes.Acquire(key, tried);
+        std::string url = endpoint.empty() ? lease.url : lease.url + "/" + endpoint;
+        curl_easy_setopt(curl, CURLOPT_URL, url.c_str());
+
+        TraceSpan span("net", method, endpoint);
+        auto start = std::chrono::steady_clock::now();
+        res = curl_easy_perform(curl);
+        double elapsedMs = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+        long status = 0;
+        curl_easy_getinfo(curl, CURLINFO_RESPONSE_CODE, &status);
+        if (Tracer::IsEnabled()) {
+            std::string detail = res == CURLE_OK ? "Status " + std::to_string(status) : std::string(curl_easy_strerror(res));
+            span.SetDetail(attempts > 1 ? detail + " @ " + lease.url : detail);
+        }
+
+        // Hat der Knoten geantwortet (auch mit Fehlerstatus oder abgebrochenem Stream), ist er erreichbar
+        bool reachable = res == CURLE_OK || status != 0;
+        nodes.Release(lease, reachable, elapsedMs);
+        if (reachable || !(idempotent || NotSent(res))) break;
+        tried.push_back(lease.node);
+    }
+    return res;
+}
 
 // Callback für CURL Response-Daten
 static size_t WriteCallback(void* contents, size_t size, size_t nmemb, std::string* userp)
@@ -37,12 +95,54 @@ static size_t WriteCallback(void* contents, size_t size, size_t nmemb, std::stri
     return size * nmemb;
 }
 
+// Zustand für GetStream: Erfolgsbody geht an den Aufrufer, Fehlerbody in den Puffer
+struct StreamTarget {
+    CURL* curl = nullptr;
+    std::function<bool(const char*, size_t)>* onData = nullptr;
+    std::string errorBody;
+    bool cancelled = false;
+};
+
+static size_t StreamCallback(void* contents, size_t size, size_t nmemb, StreamTarget* target)
+{
+    size_t length = size * nmemb;
+    long httpCode = 0;
+    curl_easy_getinfo(target->curl, CURLINFO_RESPONSE_CODE, &httpCode);
+    if (httpCode < 200 || httpCode >= 300) {
+        target->errorBody.append(static_cast<char*>(contents), length);
+        return length;
+    }
+    if (!(*target->onData)(static_cast<const char*>(contents), length)) {
+        target->cancelled = true;
+        return 0;
+    }
+    return length;
+}
+
+// Callback für Response-Header (Name kleingeschrieben, Wert ohne Whitespace)
+static size_t HeaderCallback(char* buffer, size_t size, size_t nitems, std::map<std::string, std::string>* headers)
+{
+    size_t length = size * nitems;
+    std::string line(buffer, length);
+    size_t colon = line.find(':');
+    if (colon != std::string::npos) {
+        std::string name = line.substr(0, colon);
+        std::transform(name.begin(), name.end(), name.begin(),
+                       [](unsigned char c) { return static_cast<char>(std::tolower(c)); });
+        size_t start = line.find_first_not_of(" \t", colon + 1);
+        size_t end = line.find_last_not_of(" \t\r\n");
+        (*headers)[name] = (start == std::string::npos || end < start) ? "" : line.substr(start, end - start + 1);
+    }
+    return length;
+}
+
 // Progress Callback für Upload
 static int ProgressCallback(void* clientp, curl_off_t dltotal, curl_off_t dlnow,
                            curl_off_t ultotal, curl_off_t ulnow)
 {
     if (ultotal > 0) {
         double progress = static_cast<double>(ulnow) / static_cast<double>(ultotal);
+        Tracer::Counter("upload", "Upload-Fortschritt %", progress * 100.0);
         auto callback = static_cast<std::function<void(double)>*>(clientp);
         if (callback) {
             (*callback)(progress);
@@ -53,8 +153,12 @@ static int ProgressCallback(void* clientp, curl_off_t dltotal, curl_off_t dlnow,
 
 void ApiService::Initialize(const std::string& backendIp, int port)
 {
-    _baseUrl = "http://" + backendIp + ":" + std::to_string(port) + "/api";
-    std::cout << "ApiService initialisiert: " << _baseUrl << std::endl;
+    // curl_global_init ist nicht threadsicher und muss vor parallelen Requests laufen
+    static std::once_flag curlInit;
+    std::call_once(curlInit, [] { curl_global_init(CURL_GLOBAL_DEFAULT); });
+
+    Nodes().SetUrls({"http://" + backendIp + ":" + std::to_string(port) + "/api"});
+    std::cout << "ApiService initialisiert: " << GetApiUrl() << std::endl;
     
     // Lade gespeicherte Credentials vom LoginService
     auto credentials = LoginService::GetStoredCredentials();
@@ -66,11 +170,10 @@ void ApiService::Initialize(const std::string& backendIp, int port)
 
 void ApiService::SetApiUrl(const std::string& url)
 {
-    _baseUrl = url;
-    if (_baseUrl.back() == '/') {
-        _baseUrl.pop_back();
-    }
-    std::cout << "API-URL gesetzt: " << _baseUrl << std::endl;
+    std::vector<std::string> urls = NodeSet::ParseList(url);
+    if (urls.empty()) return;
+    Nodes().SetUrls(urls);
+    std::cout << "API-URL gesetzt: " << GetApiUrl() << std::endl;
 }
 
 void ApiService::SetApiUrl(const std::string& ip, int port)
@@ -80,7 +183,20 @@ void ApiService::SetApiUrl(const std::string& ip, int port)
 
 std::string ApiService::GetApiUrl()
 {
-    return _baseUrl;
+    std::string joined;
+    for (const auto& url : Nodes().Urls()) {
+        if (!joined.empty()) joined += ", ";
+        joined += url;
+    }
+    return joined;
+}
+
+NodeSet& ApiService::Nodes()
+{
+    static NodeSet nodes;
+    static std::once_flag defaults;
+    std::call_once(defaults, [] { nodes.SetUrls({"http://127.0.0.1:5000/api"}); });
+    return nodes;
 }
 
 bool ApiService::CheckConnection(int timeoutSeconds)
@@ -89,15 +205,14 @@ bool ApiService::CheckConnection(int timeoutSeconds)
     if (!curl) return false;
 
     try {
-        curl_easy_setopt(curl, CURLOPT_URL, _baseUrl.c_str());
         curl_easy_setopt(curl, CURLOPT_TIMEOUT, timeoutSeconds);
         curl_easy_setopt(curl, CURLOPT_NOBODY, 1L);
 
-        CURLcode res = curl_easy_perform(curl);
+        CURLcode res = Perform(curl, "HEAD ", "");
         curl_easy_cleanup(curl);
 
         if (res == CURLE_OK) {
-            std::cout << "Verbindung zu " << _baseUrl << " erfolgreich" << std::endl;
+            std::cout << "Verbindung zu " << GetApiUrl() << " erfolgreich" << std::endl;
             return true;
         }
         
@@ -111,6 +226,11 @@ bool ApiService::CheckConnection(int timeoutSeconds)
 }
 
 HttpResponse ApiService::Get(const std::string& endpoint)
+{
+    return Get(endpoint, {});
+}
+
+HttpResponse ApiService::Get(const std::string& endpoint, const std::map<std::string, std::string>& requestHeaders)
 {
     CURL* curl = curl_easy_init();
     HttpResponse response;
@@ -122,7 +242,6 @@ HttpResponse ApiService::Get(const std::string& endpoint)
     }
 
     std::string readBuffer;
-    std::string url = _baseUrl + "/" + endpoint;
     std::string authHeader = GetAuthHeader();
 
     struct curl_slist* headers = nullptr;
@@ -130,14 +249,19 @@ HttpResponse ApiService::Get(const std::string& endpoint)
     if (!authHeader.empty()) {
         headers = curl_slist_append(headers, authHeader.c_str());
     }
+    for (const auto& header : requestHeaders) {
+        std::string line = header.first + ": " + header.second;
+        headers = curl_slist_append(headers, line.c_str());
+    }
 
-    curl_easy_setopt(curl, CURLOPT_URL, url.c_str());
     curl_easy_setopt(curl, CURLOPT_HTTPHEADER, headers);
     curl_easy_setopt(curl, CURLOPT_WRITEFUNCTION, WriteCallback);
     curl_easy_setopt(curl, CURLOPT_WRITEDATA, &readBuffer);
+    curl_easy_setopt(curl, CURLOPT_HEADERFUNCTION, HeaderCallback);
+    curl_easy_setopt(curl, CURLOPT_HEADERDATA, &response.headers);
     curl_easy_setopt(curl, CURLOPT_TIMEOUT, 10L);
 
-    CURLcode res = curl_easy_perform(curl);
+    CURLcode res = Perform(curl, "GET ", endpoint);
 
     if (res == CURLE_OK) {
         long httpCode = 0;
@@ -153,7 +277,63 @@ HttpResponse ApiService::Get(const std::string& endpoint)
     curl_slist_free_all(headers);
     curl_easy_cleanup(curl);
 
-    //std::cout << "GET " << url << " -> " << response.statusCode << std::endl;
+    //std::cout << "GET " << endpoint << " -> " << response.statusCode << std::endl;
+    return response;
+}
+
+HttpResponse ApiService::GetStream(const std::string& endpoint, std::function<bool(const char* data, size_t size)> onData)
+{
+    CURL* curl = curl_easy_init();
+    HttpResponse response;
+
+    if (!curl) {
+        response.statusCode = 0;
+        response.body = "Failed to initialize CURL";
+        return response;
+    }
+
+    std::string authHeader = GetAuthHeader();
+
+    struct curl_slist* headers = nullptr;
+    headers = curl_slist_append(headers, "Content-Type: application/json");
+    if (!authHeader.empty()) {
+        headers = curl_slist_append(headers, authHeader.c_str());
+    }
+
+    StreamTarget target;
+    target.curl = curl;
+    target.onData = &onData;
+
+    curl_easy_setopt(curl, CURLOPT_HTTPHEADER, headers);
+    curl_easy_setopt(curl, CURLOPT_WRITEFUNCTION, StreamCallback);
+    curl_easy_setopt(curl, CURLOPT_WRITEDATA, &target);
+    curl_easy_setopt(curl, CURLOPT_HEADERFUNCTION, HeaderCallback);
+    curl_easy_setopt(curl, CURLOPT_HEADERDATA, &response.headers);
+    curl_easy_setopt(curl, CURLOPT_CONNECTTIMEOUT, 10L);
+    // Große Antworten dürfen dauern, nur ein stehender Transfer bricht ab
+    curl_easy_setopt(curl, CURLOPT_LOW_SPEED_LIMIT, 1L);
+    curl_easy_setopt(curl, CURLOPT_LOW_SPEED_TIME, 30L);
+
+    CURLcode res = Perform(curl, "GET ", endpoint);
+
+    if (res == CURLE_OK) {
+        long httpCode = 0;
+        curl_easy_getinfo(curl, CURLINFO_RESPONSE_CODE, &httpCode);
+        response.statusCode = httpCode;
+        response.body = std::move(target.errorBody);
+        response.isSuccess = (httpCode >= 200 && httpCode < 300);
+    } else if (target.cancelled) {
+        long httpCode = 0;
+        curl_easy_getinfo(curl, CURLINFO_RESPONSE_CODE, &httpCode);
+        response.statusCode = httpCode;
+        response.body = "Abgebrochen";
+    } else {
+        response.statusCode = 0;
+        response.body = std::string("CURL Error: ") + curl_easy_strerror(res);
+    }
+
+    curl_slist_free_all(headers);
+    curl_easy_cleanup(curl);
     return response;
 }
 
@@ -169,7 +349,6 @@ HttpResponse ApiService::Post(const std::string& endpoint, const std::string& js
     }
 
     std::string readBuffer;
-    std::string url = _baseUrl + "/" + endpoint;
     std::string authHeader = GetAuthHeader();
 
     struct curl_slist* headers = nullptr;
@@ -178,14 +357,13 @@ HttpResponse ApiService::Post(const std::string& endpoint, const std::string& js
         headers = curl_slist_append(headers, authHeader.c_str());
     }
 
-    curl_easy_setopt(curl, CURLOPT_URL, url.c_str());
     curl_easy_setopt(curl, CURLOPT_HTTPHEADER, headers);
     curl_easy_setopt(curl, CURLOPT_POSTFIELDS, jsonBody.c_str());
     curl_easy_setopt(curl, CURLOPT_WRITEFUNCTION, WriteCallback);
     curl_easy_setopt(curl, CURLOPT_WRITEDATA, &readBuffer);
     curl_easy_setopt(curl, CURLOPT_TIMEOUT, 10L);
 
-    CURLcode res = curl_easy_perform(curl);
+    CURLcode res = Perform(curl, "POST ", endpoint);
 
     if (res == CURLE_OK) {
         long httpCode = 0;
@@ -201,7 +379,7 @@ HttpResponse ApiService::Post(const std::string& endpoint, const std::string& js
     curl_slist_free_all(headers);
     curl_easy_cleanup(curl);
 
-    //std::cout << "POST " << url << " -> " << response.statusCode << std::endl;
+    //std::cout << "POST " << endpoint << " -> " << response.statusCode << std::endl;
     return response;
 }
 
@@ -217,7 +395,6 @@ HttpResponse ApiService::Put(const std::string& endpoint, const std::string& jso
     }
 
     std::string readBuffer;
-    std::string url = _baseUrl + "/" + endpoint;
     std::string authHeader = GetAuthHeader();
 
     struct curl_slist* headers = nullptr;
@@ -226,7 +403,6 @@ HttpResponse ApiService::Put(const std::string& endpoint, const std::string& jso
         headers = curl_slist_append(headers, authHeader.c_str());
     }
 
-    curl_easy_setopt(curl, CURLOPT_URL, url.c_str());
     curl_easy_setopt(curl, CURLOPT_HTTPHEADER, headers);
     curl_easy_setopt(curl, CURLOPT_CUSTOMREQUEST, "PUT");
     curl_easy_setopt(curl, CURLOPT_POSTFIELDS, jsonBody.c_str());
@@ -234,7 +410,7 @@ HttpResponse ApiService::Put(const std::string& endpoint, const std::string& jso
     curl_easy_setopt(curl, CURLOPT_WRITEDATA, &readBuffer);
     curl_easy_setopt(curl, CURLOPT_TIMEOUT, 10L);
 
-    CURLcode res = curl_easy_perform(curl);
+    CURLcode res = Perform(curl, "PUT ", endpoint);
 
     if (res == CURLE_OK) {
         long httpCode = 0;
@@ -250,7 +426,7 @@ HttpResponse ApiService::Put(const std::string& endpoint, const std::string& jso
     curl_slist_free_all(headers);
     curl_easy_cleanup(curl);
 
-    //std::cout << "PUT " << url << " -> " << response.statusCode << std::endl;
+    //std::cout << "PUT " << endpoint << " -> " << response.statusCode << std::endl;
     return response;
 }
 
@@ -266,7 +442,6 @@ HttpResponse ApiService::Delete(const std::string& endpoint)
     }
 
     std::string readBuffer;
-    std::string url = _baseUrl + "/" + endpoint;
     std::string authHeader = GetAuthHeader();
 
     struct curl_slist* headers = nullptr;
@@ -275,14 +450,13 @@ HttpResponse ApiService::Delete(const std::string& endpoint)
         headers = curl_slist_append(headers, authHeader.c_str());
     }
 
-    curl_easy_setopt(curl, CURLOPT_URL, url.c_str());
     curl_easy_setopt(curl, CURLOPT_HTTPHEADER, headers);
     curl_easy_setopt(curl, CURLOPT_CUSTOMREQUEST, "DELETE");
     curl_easy_setopt(curl, CURLOPT_WRITEFUNCTION, WriteCallback);
     curl_easy_setopt(curl, CURLOPT_WRITEDATA, &readBuffer);
     curl_easy_setopt(curl, CURLOPT_TIMEOUT, 10L);
 
-    CURLcode res = curl_easy_perform(curl);
+    CURLcode res = Perform(curl, "DELETE ", endpoint);
 
     if (res == CURLE_OK) {
         long httpCode = 0;
@@ -298,7 +472,7 @@ HttpResponse ApiService::Delete(const std::string& endpoint)
     curl_slist_free_all(headers);
     curl_easy_cleanup(curl);
 
-    //std::cout << "DELETE " << url << " -> " << response.statusCode << std::endl;
+    //std::cout << "DELETE " << endpoint << " -> " << response.statusCode << std::endl;
     return response;
 }
 
@@ -320,7 +494,7 @@ HttpResponse ApiService::Login(const std::string& username, const std::string& p
 HttpResponse ApiService::UploadFile(const std::string& filePath, 
                                     std::function<void(double)> progressCallback)
 {
-    std::cout << "UploadFile called with path: [" << filePath << "]" << std::endl;
+    if (_verbose) std::cout << "UploadFile called with path: [" << filePath << "]" << std::endl;
     
     CURL* curl = curl_easy_init();
     HttpResponse response;
@@ -343,15 +517,14 @@ HttpResponse ApiService::UploadFile(const std::string& filePath,
     fclose(fp);
 
     std::string readBuffer;
-    std::string url = _baseUrl + "/Upload";
     std::string authHeader = GetAuthHeader();
 
     struct curl_slist* headers = nullptr;
     headers = curl_slist_append(headers, "Content-Type: multipart/form-data");
     if (!authHeader.empty()) {
-        std::cout << "DEBUG: Adding auth header to upload request" << std::endl;
+        if (_verbose) std::cout << "DEBUG: Adding auth header to upload request" << std::endl;
         headers = curl_slist_append(headers, authHeader.c_str());
-    } else {
+    } else if (_verbose) {
         std::cout << "WARNING: No auth header available for upload!" << std::endl;
     }
 
@@ -361,7 +534,6 @@ HttpResponse ApiService::UploadFile(const std::string& filePath,
     curl_mime_name(part, "file");
     curl_mime_filedata(part, filePath.c_str());
 
-    curl_easy_setopt(curl, CURLOPT_URL, url.c_str());
     curl_easy_setopt(curl, CURLOPT_HTTPHEADER, headers);
     curl_easy_setopt(curl, CURLOPT_MIMEPOST, mime);
     curl_easy_setopt(curl, CURLOPT_WRITEFUNCTION, WriteCallback);
@@ -374,7 +546,7 @@ HttpResponse ApiService::UploadFile(const std::string& filePath,
         curl_easy_setopt(curl, CURLOPT_XFERINFODATA, &progressCallback);
     }
 
-    CURLcode res = curl_easy_perform(curl);
+    CURLcode res = Perform(curl, "POST ", "Upload");
 
     if (res == CURLE_OK) {
         long httpCode = 0;
@@ -391,8 +563,8 @@ HttpResponse ApiService::UploadFile(const std::string& filePath,
     curl_slist_free_all(headers);
     curl_easy_cleanup(curl);
 
-    std::cout << "UPLOAD " << filePath << " -> " << response.statusCode << std::endl;
-    if (!response.body.empty()) {
+    if (_verbose) std::cout << "UPLOAD " << filePath << " -> " << response.statusCode << std::endl;
+    if (_verbose && !response.body.empty()) {
         std::cout << "SERVER RESPONSE: " << response.body << std::endl;
     }
     return response;
@@ -405,6 +577,11 @@ void ApiService::SetAuthCredentials(const std::string& username, const std::stri
     std::cout << "Auth-Credentials gesetzt für: " << username << std::endl;
 }
 
+void ApiService::SetVerbose(bool verbose)
+{
+    _verbose = verbose;
+}
+
 void ApiService::ClearAuthCredentials()
 {
     _authUsername.clear();
@@ -414,11 +591,11 @@ void ApiService::ClearAuthCredentials()
 std::string ApiService::GetAuthHeader()
 {
     if (_authUsername.empty() || _authPassword.empty()) {
-        std::cout << "DEBUG: GetAuthHeader() - keine Credentials gespeichert" << std::endl;
+        if (_verbose) std::cout << "DEBUG: GetAuthHeader() - keine Credentials gespeichert" << std::endl;
         return "";
     }
 
-    std::cout << "DEBUG: GetAuthHeader() - Username: " << _authUsername << ", Password (gehashed): " << _authPassword.substr(0, 8) << "..." << std::endl;
+    if (_verbose) std::cout << "DEBUG: GetAuthHeader() - Username: " << _authUsername << ", Password (gehashed): " << _authPassword.substr(0, 8) << "..." << std::endl;
 
     std::string credentials = _authUsername + ":" + _authPassword;
     // Base64 encoding (vereinfacht - für Production sollte man eine Library verwenden)
@@ -0,0 +1,280 @@
+#include "../../include/Services/ColumnarFile.h"
+#include <cstring>
+#include <zlib.h>
+
+namespace Services {
+
+namespace {
+
+constexpr char kMagic[8] = {'T', 'E', 'F', 'C', 'O', 'L', '1', '\n'};
+constexpr size_t kTrailerSize = sizeof(uint64_t) + sizeof(uint32_t) + sizeof(kMagic);
+
+template <typename T>
+void AppendPod(std::string& out, const T& value)
+{
+    out.append(reinterpret_cast<const char*>(&value), sizeof(T));
+}
+
+template <typename T>
+bool ReadPod(const char*& p, const char* end, T& value)
+{
+    if (static_cast<size_t>(end - p) < sizeof(T)) return false;
+    std::memcpy(&value, p, sizeof(T));
+    p += sizeof(T);
+    return true;
+}
+
+uint32_t Crc(const char* data, size_t size)
+{
+    uLong crc = crc32(0L, Z_NULL, 0);
+    if (size > 0) crc = crc32(crc, reinterpret_cast<const Bytef*>(data), static_cast<uInt>(size));
+    return static_cast<uint32_t>(crc);
+}
+
+} // namespace
+
+ColumnarWriter::~ColumnarWriter()
+{
+    if (file_) std::fclose(file_);
+}
+
+bool ColumnarWriter::Open(const std::string& path, const std::vector<std::string>& columns,
+                          size_t groupRows, size_t groupBytes)
+{
+    if (file_) std::fclose(file_);
+    columns_ = columns;
+    buffers_.assign(columns_.size(), std::string());
+    groups_.clear();
+    groupRows_ = groupRows > 0 ? groupRows : 1;
+    // Eine Spalte einer Gruppe muss in u32 passen
+    groupBytes_ = groupBytes > 0 && groupBytes < (1u << 30) ? groupBytes : (1u << 30);
+    pendingRows_ = 0;
+    pendingBytes_ = 0;
+    offset_ = 0;
+    rows_ = 0;
+    error_.clear();
+
+    file_ = std::fopen(path.c_str(), "wb");
+    if (!file_) {
+        error_ = "Datei kann nicht angelegt werden: " + path;
+        return false;
+    }
+    return Write(kMagic, sizeof(kMagic));
+}
+
+bool ColumnarWriter::Write(const void* data, size_t size)
+{
+    if (std::fwrite(data, 1, size, file_) != size) {
+        error_ = "Schreibfehler";
+        return false;
+    }
+    offset_ += size;
+    return true;
+}
+
+bool ColumnarWriter::Append(const std::vector<std::string_view>& values)
+{
+    if (!file_ || values.size() != columns_.size()) {
+        error_ = "Ungültige Zeile";
+        return false;
+    }
+    // Einzelwerte über 1 GB passen nicht in eine Gruppe; vor dem Anhängen prüfen, damit keine halbe Zeile bleibt
+    for (size_t c = 0; c < values.size(); ++c) {
+        if (values[c].size() > (1u << 30)) {
+            error_ = "Wert in Spalte " + columns_[c] + " größer als 1 GB";
+            return false;
+        }
+    }
+    for (size_t c = 0; c < values.size(); ++c) {
+        AppendPod(buffers_[c], static_cast<uint32_t>(values[c].size()));
+        buffers_[c].append(values[c].data(), values[c].size());
+        pendingBytes_ += sizeof(uint32_t) + values[c].size();
+    }
+    ++pendingRows_;
+    ++rows_;
+    if (pendingRows_ >= groupRows_ || pendingBytes_ >= groupBytes_) return FlushGroup();
+    return true;
+}
+
+bool ColumnarWriter::FlushGroup()
+{
+    if (pendingRows_ == 0) return true;
+    groups_.push_back(GroupInfo{offset_, pendingRows_});
+    if (!Write(&pendingRows_, sizeof(pendingRows_))) return false;
+
+    for (auto& raw : buffers_) {
+        uLongf compressedSize = compressBound(static_cast<uLong>(raw.size()));
+        compressed_.resize(compressedSize);
+        if (compress2(reinterpret_cast<Bytef*>(&compressed_[0]), &compressedSize,
+                      reinterpret_cast<const Bytef*>(raw.data()), static_cast<uLong>(raw.size()),
+                      Z_DEFAULT_COMPRESSION) != Z_OK) {
+            error_ = "Komprimierung fehlgeschlagen";
+            return false;
+        }
+        uint32_t header[3] = {static_cast<uint32_t>(raw.size()), static_cast<uint32_t>(compressedSize),
+                              Crc(raw.data(), raw.size())};
+        if (!Write(header, sizeof(header)) || !Write(compressed_.data(), compressedSize)) return false;
+        // Kapazität für die nächste Gruppe behalten
+        raw.clear();
+    }
+    pendingRows_ = 0;
+    pendingBytes_ = 0;
+    return true;
+}
+
+bool ColumnarWriter::Close()
+{
+    if (!file_) return false;
+    bool ok = FlushGroup();
+
+    std::string footer;
+    AppendPod(footer, static_cast<uint32_t>(columns_.size()));
+    for (const auto& name : columns_) {
+        AppendPod(footer, static_cast<uint16_t>(name.size()));
+        footer.append(name);
+    }
+    AppendPod(footer, static_cast<uint32_t>(groups_.size()));
+    for (const auto& group : groups_) {
+        AppendPod(footer, group.offset);
+        AppendPod(footer, group.rows);
+    }
+    uint64_t footerOffset = offset_;
+    uint32_t footerCrc = Crc(footer.data(), footer.size());
+    AppendPod(footer, footerOffset);
+    AppendPod(footer, footerCrc);
+    footer.append(kMagic, sizeof(kMagic));
+
+    ok = ok && Write(footer.data(), footer.size());
+    ok = (std::fclose(file_) == 0) && ok;
+    file_ = nullptr;
+    if (!ok && error_.empty()) error_ = "Schreibfehler";
+    return ok;
+}
+
+bool ColumnarReader::Open(const std::string& path)
+{
+    columns_.clear();
+    groups_.clear();
+    rows_ = 0;
+    error_.clear();
+
+    if (!file_.Open(path)) {
+        error_ = "Datei kann nicht geöffnet werden: " + path;
+        return false;
+    }
+    const char* data = file_.Data();
+    size_t size = file_.Size();
+    if (size < sizeof(kMagic) + kTrailerSize || std::memcmp(data, kMagic, sizeof(kMagic)) != 0 ||
+        std::memcmp(data + size - sizeof(kMagic), kMagic, sizeof(kMagic)) != 0) {
+        error_ = "Kein TEFCOL-Format oder unvollständig";
+        return false;
+    }
+
+    const char* trailer = data + size - kTrailerSize;
+    uint32_t footerCrc = 0;
+    ReadPod(trailer, data + size, footerOffset_);
+    ReadPod(trailer, data + size, footerCrc);
+    size_t footerEnd = size - kTrailerSize;
+    if (footerOffset_ < sizeof(kMagic) || footerOffset_ > footerEnd ||
+        Crc(data + footerOffset_, footerEnd - footerOffset_) != footerCrc) {
+        error_ = "Footer beschädigt";
+        return false;
+    }
+
+    const char* p = data + footerOffset_;
+    const char* end = data + footerEnd;
+    uint32_t columnCount = 0, groupCount = 0;
+    if (!ReadPod(p, end, columnCount)) {
+        error_ = "Footer beschädigt";
+        return false;
+    }
+    for (uint32_t c = 0; c < columnCount; ++c) {
+        uint16_t length = 0;
+        if (!ReadPod(p, end, length) || static_cast<size_t>(end - p) < length) {
+            error_ = "Footer beschädigt";
+            return false;
+        }
+        columns_.emplace_back(p, length);
+        p += length;
+    }
+    if (!ReadPod(p, end, groupCount)) {
+        error_ = "Footer beschädigt";
+        return false;
+    }
+    for (uint32_t g = 0; g < groupCount; ++g) {
+        GroupInfo group{};
+        if (!ReadPod(p, end, group.offset) || !ReadPod(p, end, group.rows) || group.offset >= footerOffset_) {
+            error_ = "Footer beschädigt";
+            return false;
+        }
+        groups_.push_back(group);
+        rows_ += group.rows;
+    }
+    return true;
+}
+
+bool ColumnarReader::ForEach(const std::vector<size_t>& columns,
+                             const std::function<bool(const std::vector<std::string_view>&)>& onRow)
+{
+    std::vector<bool> wanted(columns_.size(), columns.empty());
+    for (size_t c : columns) {
+        if (c < wanted.size()) wanted[c] = true;
+    }
+
+    const char* data = file_.Data();
+    const char* end = data + footerOffset_;
+    std::vector<std::string> raw(columns_.size());
+    std::vector<const char*> cursor(columns_.size());
+    std::vector<std::string_view> row(columns_.size());
+
+    for (const auto& group : groups_) {
+        const char* p = data + group.offset;
+        uint32_t rows = 0;
+        if (!ReadPod(p, end, rows) || rows != group.rows) {
+            error_ = "Gruppe beschädigt";
+            return false;
+        }
+
+        for (size_t c = 0; c < columns_.size(); ++c) {
+            uint32_t header[3];
+            if (!ReadPod(p, end, header) || static_cast<size_t>(end - p) < header[1]) {
+                error_ = "Gruppe beschädigt";
+                return false;
+            }
+            if (wanted[c]) {
+                uLongf rawSize = header[0];
+                raw[c].resize(rawSize);
+                if ((rawSize > 0 && uncompress(reinterpret_cast<Bytef*>(&raw[c][0]), &rawSize,
+                                               reinterpret_cast<const Bytef*>(p), header[1]) != Z_OK) ||
+                    rawSize != header[0] || Crc(raw[c].data(), raw[c].size()) != header[2]) {
+                    error_ = "Spalte " + columns_[c] + " beschädigt";
+                    return false;
+                }
+                cursor[c] = raw[c].data();
+            }
+            // Nicht angeforderte Spalten werden nur übersprungen
+            p += header[1];
+        }
+
+        for (uint32_t r = 0; r < rows; ++r) {
+            for (size_t c = 0; c < columns_.size(); ++c) {
+                if (!wanted[c]) {
+                    row[c] = std::string_view();
+                    continue;
+                }
+                const char* columnEnd = raw[c].data() + raw[c].size();
+                uint32_t length = 0;
+                if (!ReadPod(cursor[c], columnEnd, length) || static_cast<size_t>(columnEnd - cursor[c]) < length) {
+                    error_ = "Spalte " + columns_[c] + " beschädigt";
+                    return false;
+                }
+                row[c] = std::string_view(cursor[c], length);
+                cursor[c] += length;
+            }
+            if (!onRow(row)) return true;
+        }
+    }
+    return true;
+}
+
+} // namespace Services
@@ -0,0 +1,249 @@
+#include "../../include/Services/DiagnosticsMonitor.h"
+#include "../../include/Services/ApiService.h"
+#include "../../include/Services/Tracer.h"
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <iostream>
+#include <sstream>
+
+namespace Services {
+
+namespace {
+
+// Die letzten kRecent Messungen werden mit dem Median der älteren verglichen
+constexpr size_t kRecent = 10;
+constexpr size_t kMinBaseline = 20;
+constexpr double kMinIncreaseMs = 50.0;
+
+double Percentile(std::vector<float> values, double p)
+{
+    if (values.empty()) return 0.0;
+    size_t index = static_cast<size_t>(std::ceil(p * values.size()));
+    index = index > 0 ? index - 1 : 0;
+    std::nth_element(values.begin(), values.begin() + index, values.end());
+    return values[index];
+}
+
+std::string FormatMs(double ms)
+{
+    std::ostringstream out;
+    out.setf(std::ios::fixed);
+    out.precision(ms < 10.0 ? 1 : 0);
+    out << ms << " ms";
+    return out.str();
+}
+
+} // namespace
+
+DiagnosticsMonitor::DiagnosticsMonitor()
+    : snapshot_(std::make_shared<const DiagnosticsSnapshot>())
+{
+    probes_.resize(3);
+    probes_[0].endpoint = "ping";
+    probes_[0].layer = "Netzwerk";
+    probes_[1].endpoint = "Diagnostics/connection";
+    probes_[1].layer = "Datenbank";
+    probes_[2].endpoint = "Diagnostics/stats";
+    probes_[2].layer = "Worker";
+    Publish();
+}
+
+DiagnosticsMonitor::~DiagnosticsMonitor()
+{
+    Stop();
+}
+
+void DiagnosticsMonitor::Start(int intervalMs)
+{
+    if (worker_.joinable()) return;
+    intervalMs_ = intervalMs > 0 ? intervalMs : 5000;
+    stop_ = false;
+    worker_ = std::thread(&DiagnosticsMonitor::Run, this);
+}
+
+void DiagnosticsMonitor::Stop()
+{
+    stop_ = true;
+    Wake();
+    if (worker_.joinable()) worker_.join();
+}
+
+void DiagnosticsMonitor::SetInterval(int intervalMs)
+{
+    intervalMs = intervalMs > 0 ? intervalMs : 5000;
+    // Beim Verkürzen sofort messen statt das alte Intervall abzuwarten
+    if (intervalMs_.exchange(intervalMs) > intervalMs) Wake();
+}
+
+void DiagnosticsMonitor::SetActive(bool active)
+{
+    if (!active_.exchange(active) && active) Wake();
+}
+
+void DiagnosticsMonitor::Reset()
+{
+    resetRequested_ = true;
+    Wake();
+}
+
+void DiagnosticsMonitor::Wake()
+{
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        wakeRequested_ = true;
+    }
+    wake_.notify_one();
+}
+
+std::shared_ptr<const DiagnosticsSnapshot> DiagnosticsMonitor::Snapshot() const
+{
+    return std::atomic_load(&snapshot_);
+}
+
+void DiagnosticsMonitor::Record(const std::vector<double>& rttMs)
+{
+    std::lock_guard<std::mutex> lock(probesMutex_);
+    // Eine während der Runde angeforderte Zurücksetzung verwirft auch deren Messungen (evtl. alter Server)
+    if (resetRequested_.exchange(false)) {
+        for (auto& probe : probes_) {
+            probe.head = 0;
+            probe.count = 0;
+        }
+        warned_ = false;
+        return;
+    }
+    for (size_t i = 0; i < rttMs.size() && i < probes_.size(); ++i) {
+        Probe& target = probes_[i];
+        target.window[target.head] = static_cast<float>(rttMs[i]);
+        target.head = (target.head + 1) % kWindow;
+        if (target.count < kWindow) ++target.count;
+    }
+}
+
+ProbeSummary DiagnosticsMonitor::Summarize(const Probe& probe)
+{
+    ProbeSummary summary;
+    summary.endpoint = probe.endpoint;
+    summary.layer = probe.layer;
+    summary.samples = probe.count;
+
+    size_t oldest = (probe.head + kWindow - probe.count) % kWindow;
+    summary.history.reserve(probe.count);
+    for (size_t i = 0; i < probe.count; ++i) {
+        summary.history.push_back(probe.window[(oldest + i) % kWindow]);
+    }
+    if (summary.history.empty()) return summary;
+
+    std::vector<float> ok;
+    ok.reserve(summary.history.size());
+    double jitterSum = 0.0;
+    size_t jitterCount = 0;
+    float previous = -1.f;
+    for (float rtt : summary.history) {
+        if (rtt < 0.f) {
+            ++summary.failures;
+            previous = -1.f;
+            continue;
+        }
+        if (previous >= 0.f) {
+            jitterSum += std::fabs(rtt - previous);
+            ++jitterCount;
+        }
+        previous = rtt;
+        ok.push_back(rtt);
+    }
+    summary.lastMs = summary.history.back();
+    summary.jitterMs = jitterCount > 0 ? jitterSum / jitterCount : 0.0;
+    summary.p50Ms = Percentile(ok, 0.50);
+    summary.p95Ms = Percentile(ok, 0.95);
+    summary.p99Ms = Percentile(ok, 0.99);
+
+    // Verschlechterung: mehrere Ausfälle zuletzt oder deutlich langsamer als der bisherige Median
+    size_t recentStart = summary.history.size() > kRecent ? summary.history.size() - kRecent : 0;
+    std::vector<float> recent, baseline;
+    size_t recentFailures = 0;
+    for (size_t i = 0; i < summary.history.size(); ++i) {
+        float rtt = summary.history[i];
+        if (i >= recentStart) {
+            if (rtt < 0.f) ++recentFailures;
+            else recent.push_back(rtt);
+        } else if (rtt >= 0.f) {
+            baseline.push_back(rtt);
+        }
+    }
+    if (recentFailures >= 3) {
+        summary.degraded = true;
+    } else if (baseline.size() >= kMinBaseline && !recent.empty()) {
+        double before = Percentile(baseline, 0.50);
+        double now = Percentile(recent, 0.50);
+        summary.degraded = now > std::max(2.0 * before, before + kMinIncreaseMs);
+    }
+    return summary;
+}
+
+void DiagnosticsMonitor::Publish()
+{
+    auto next = std::make_shared<DiagnosticsSnapshot>();
+    bool warn = false;
+    std::string warning;
+    {
+        std::lock_guard<std::mutex> lock(probesMutex_);
+        for (const auto& probe : probes_) {
+            next->probes.push_back(Summarize(probe));
+        }
+
+        // Die erste langsame Schicht benennen: ping misst nur Netzwerk und Webserver,
+        // connection zusätzlich die Datenbank, stats zusätzlich die Extraktions-Statistik
+        const auto& probes = next->probes;
+        bool allFailing = !probes.empty() && std::all_of(probes.begin(), probes.end(), [](const ProbeSummary& p) {
+            return p.samples > 0 && p.history.back() < 0.f;
+        });
+        if (allFailing) {
+            next->warning = "Backend nicht erreichbar";
+        } else if (probes[0].degraded) {
+            next->warning = "Netzwerk/Server langsam: ping p50 " + FormatMs(probes[0].p50Ms) + ", zuletzt " + FormatMs(probes[0].lastMs);
+        } else if (probes[1].degraded) {
+            next->warning = "Datenbank langsam: Diagnostics/connection zuletzt " + FormatMs(probes[1].lastMs) +
+                            " bei normalem ping";
+        } else if (probes[2].degraded) {
+            next->warning = "Backend-Worker ausgelastet: Diagnostics/stats zuletzt " + FormatMs(probes[2].lastMs);
+        }
+
+        warn = !next->warning.empty() && !warned_;
+        warned_ = !next->warning.empty();
+        if (warn) warning = next->warning;
+        next->version = ++version_;
+        std::atomic_store(&snapshot_, std::shared_ptr<const DiagnosticsSnapshot>(std::move(next)));
+    }
+    if (warn) std::cout << "Diagnose: " << warning << std::endl;
+}
+
+void DiagnosticsMonitor::Run()
+{
+    Tracer::SetThreadName("DiagnosticsMonitor");
+    while (!stop_) {
+        if (active_) {
+            std::vector<double> rttMs;
+            for (size_t i = 0; i < probes_.size() && !stop_; ++i) {
+                auto start = std::chrono::steady_clock::now();
+                HttpResponse resp = ApiService::Get(probes_[i].endpoint);
+                double elapsed = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+                // Jede HTTP-Antwort (auch 401/500) zählt als Laufzeit, nur Verbindungsfehler als Ausfall
+                rttMs.push_back(resp.statusCode != 0 ? elapsed : -1.0);
+            }
+            Record(rttMs);
+            Publish();
+        } else if (resetRequested_) {
+            Record({});
+            Publish();
+        }
+
+        std::unique_lock<std::mutex> lock(mutex_);
+        wake_.wait_for(lock, std::chrono::milliseconds(intervalMs_.load()),
+                       [this] { return wakeRequested_ || stop_.load(); });
+        wakeRequested_ = false;
+    }
+}
+
+} // namespace Services
@@ -0,0 +1,249 @@
+#include "../../include/Services/FrameProfiler.h"
+#include "../../include/Services/AppPaths.h"
+#include "../../include/Services/JsonUtil.h"
+#include "../../include/Services/Tracer.h"
+#include <algorithm>
+#include <cstdio>
+#include <cstdlib>
+#include <ctime>
+#include <memory>
+#include <mutex>
+
+namespace Services {
+
+namespace {
+
+std::mutex sectionMutex;
+std::vector<std::string> sectionNames;
+
+thread_local FrameProfiler* currentProfiler = nullptr;
+thread_local uint64_t threadAllocations = 0;
+thread_local uint64_t threadAllocatedBytes = 0;
+
+double Percentile(std::vector<float> values, double p)
+{
+    if (values.empty()) return 0.0;
+    size_t index = static_cast<size_t>(p * static_cast<double>(values.size() - 1) + 0.5);
+    std::nth_element(values.begin(), values.begin() + index, values.end());
+    return values[index];
+}
+
+std::string Number(double value)
+{
+    char buffer[32];
+    std::snprintf(buffer, sizeof(buffer), "%.3f", value);
+    return buffer;
+}
+
+} // namespace
+
+FrameProfiler::FrameProfiler()
+    : origin_(std::chrono::steady_clock::now()), ring_(kFrames)
+{
+}
+
+int FrameProfiler::RegisterSection(const std::string& name)
+{
+    std::lock_guard<std::mutex> lock(sectionMutex);
+    auto it = std::find(sectionNames.begin(), sectionNames.end(), name);
+    if (it != sectionNames.end()) return static_cast<int>(it - sectionNames.begin());
+    if (sectionNames.size() >= FrameSample::kMaxSections) return -1;
+    sectionNames.push_back(name);
+    return static_cast<int>(sectionNames.size() - 1);
+}
+
+std::string FrameProfiler::SectionName(int section)
+{
+    std::lock_guard<std::mutex> lock(sectionMutex);
+    if (section < 0 || static_cast<size_t>(section) >= sectionNames.size()) return "";
+    return sectionNames[section];
+}
+
+void FrameProfiler::SetCurrent(FrameProfiler* profiler)
+{
+    currentProfiler = profiler;
+}
+
+FrameProfiler* FrameProfiler::Current()
+{
+    return currentProfiler;
+}
+
+void FrameProfiler::CountAllocation(size_t bytes) noexcept
+{
+    ++threadAllocations;
+    threadAllocatedBytes += bytes;
+}
+
+void FrameProfiler::BeginFrame()
+{
+    frameStart_ = std::chrono::steady_clock::now();
+    current_ = FrameSample();
+    current_.startMs = std::chrono::duration<double, std::milli>(frameStart_ - origin_).count();
+    allocationsAtStart_ = threadAllocations;
+    bytesAtStart_ = threadAllocatedBytes;
+    inFrame_ = true;
+}
+
+void FrameProfiler::EndFrame()
+{
+    if (!inFrame_) return;
+    inFrame_ = false;
+    current_.frameMs = std::chrono::duration<float, std::milli>(std::chrono::steady_clock::now() - frameStart_).count();
+    current_.allocations = static_cast<uint32_t>(threadAllocations - allocationsAtStart_);
+    current_.allocatedBytes = threadAllocatedBytes - bytesAtStart_;
+    if (Tracer::IsEnabled()) {
+        int64_t end = Tracer::NowNs();
+        Tracer::Complete("frame", "Frame", end - static_cast<int64_t>(current_.frameMs * 1e6), end,
+                         std::to_string(current_.allocations) + " Allokationen");
+    }
+    ring_[next_] = current_;
+    next_ = (next_ + 1) % kFrames;
+    count_ = std::min(count_ + 1, kFrames);
+}
+
+void FrameProfiler::AddSectionTime(int section, double ms)
+{
+    if (!inFrame_ || section < 0 || static_cast<size_t>(section) >= FrameSample::kMaxSections) return;
+    current_.sectionMs[section] += static_cast<float>(ms);
+}
+
+FrameProfiler::Scope::Scope(int section)
+    : profiler_(currentProfiler), section_(section)
+{
+    if (profiler_) start_ = std::chrono::steady_clock::now();
+}
+
+FrameProfiler::Scope::~Scope()
+{
+    if (!profiler_) return;
+    double ms = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start_).count();
+    profiler_->AddSectionTime(section_, ms);
+    if (Tracer::IsEnabled()) {
+        int64_t end = Tracer::NowNs();
+        Tracer::Complete("frame", SectionName(section_), end - static_cast<int64_t>(ms * 1e6), end);
+    }
+}
+
+std::vector<FrameSample> FrameProfiler::Frames(size_t lastFrames) const
+{
+    size_t n = std::min(lastFrames, count_);
+    std::vector<FrameSample> frames;
+    frames.reserve(n);
+    for (size_t i = 0; i < n; ++i) frames.push_back(ring_[(next_ + kFrames - n + i) % kFrames]);
+    return frames;
+}
+
+FrameSummary FrameProfiler::Summarize(size_t lastFrames) const
+{
+    FrameSummary summary;
+    std::vector<FrameSample> frames = Frames(lastFrames);
+    summary.frames = frames.size();
+    if (frames.empty()) return summary;
+
+    std::vector<float> times;
+    times.reserve(frames.size());
+    double total = 0.0;
+    double allocations = 0.0;
+    double bytes = 0.0;
+    for (const auto& frame : frames) {
+        times.push_back(frame.frameMs);
+        total += frame.frameMs;
+        summary.maxMs = std::max(summary.maxMs, static_cast<double>(frame.frameMs));
+        allocations += frame.allocations;
+        bytes += static_cast<double>(frame.allocatedBytes);
+    }
+    double n = static_cast<double>(frames.size());
+    summary.p50Ms = Percentile(times, 0.50);
+    summary.p99Ms = Percentile(times, 0.99);
+    double span = frames.back().startMs + frames.back().frameMs - frames.front().startMs;
+    summary.fps = span > 0.0 ? n * 1000.0 / span : 0.0;
+    summary.allocationsPerFrame = allocations / n;
+    summary.bytesPerFrame = bytes / n;
+
+    for (size_t s = 0; s < FrameSample::kMaxSections; ++s) {
+        FrameSectionSummary section;
+        std::vector<float> values;
+        values.reserve(frames.size());
+        double sum = 0.0;
+        for (const auto& frame : frames) {
+            float ms = frame.sectionMs[s];
+            values.push_back(ms);
+            sum += ms;
+            if (ms > 0.f) ++section.activeFrames;
+            section.maxMs = std::max(section.maxMs, static_cast<double>(ms));
+        }
+        if (section.activeFrames == 0) continue;
+        section.name = SectionName(static_cast<int>(s));
+        section.avgMs = sum / n;
+        section.p99Ms = Percentile(std::move(values), 0.99);
+        section.share = total > 0.0 ? sum / total : 0.0;
+        summary.sections.push_back(std::move(section));
+    }
+    std::sort(summary.sections.begin(), summary.sections.end(),
+              [](const FrameSectionSummary& a, const FrameSectionSummary& b) { return a.share > b.share; });
+    return summary;
+}
+
+bool FrameProfiler::Dump(const std::string& path, std::string& error) const
+{
+    FrameSummary summary = Summarize();
+    std::vector<FrameSample> frames = Frames();
+    size_t sectionCount;
+    {
+        std::lock_guard<std::mutex> lock(sectionMutex);
+        sectionCount = sectionNames.size();
+    }
+
+    std::time_t now = std::time(nullptr);
+    char created[32];
+    std::strftime(created, sizeof(created), "%Y-%m-%dT%H:%M:%SZ", std::gmtime(&now));
+
+    std::string json = "{\"schema\":\"tef_frames/1\",\"created\":\"" + std::string(created) + "\",\"frames\":" +
+                       std::to_string(summary.frames) + ",\"p50Ms\":" + Number(summary.p50Ms) + ",\"p99Ms\":" +
+                       Number(summary.p99Ms) + ",\"maxMs\":" + Number(summary.maxMs) + ",\"fps\":" + Number(summary.fps) +
+                       ",\"allocationsPerFrame\":" + Number(summary.allocationsPerFrame) +
+                       ",\"bytesPerFrame\":" + Number(summary.bytesPerFrame) + ",\"summary\":[";
+    for (size_t i = 0; i < summary.sections.size(); ++i) {
+        const auto& section = summary.sections[i];
+        if (i) json += ",";
+        json += "\n  {\"name\":\"" + EscapeJson(section.name) + "\",\"activeFrames\":" + std::to_string(section.activeFrames) +
+                ",\"avgMs\":" + Number(section.avgMs) + ",\"p99Ms\":" + Number(section.p99Ms) +
+                ",\"maxMs\":" + Number(section.maxMs) + ",\"share\":" + Number(section.share) + "}";
+    }
+
+    // Frames kompakt: [Start, Dauer, Allokationen, Bytes, Abschnitt 0, Abschnitt 1, ...] in der Reihenfolge von "sections"
+    json += "\n],\"sections\":[";
+    for (size_t s = 0; s < sectionCount; ++s) {
+        if (s) json += ",";
+        json += "\"" + EscapeJson(SectionName(static_cast<int>(s))) + "\"";
+    }
+    json += "],\"samples\":[";
+    for (size_t i = 0; i < frames.size(); ++i) {
+        const auto& frame = frames[i];
+        if (i) json += ",";
+        json += "\n  [" + Number(frame.startMs) + "," + Number(frame.frameMs) + "," + std::to_string(frame.allocations) + "," +
+                std::to_string(frame.allocatedBytes);
+        for (size_t s = 0; s < sectionCount; ++s) json += "," + Number(frame.sectionMs[s]);
+        json += "]";
+    }
+    json += "\n]}\n";
+
+    std::unique_ptr<std::FILE, int (*)(std::FILE*)> file(std::fopen(path.c_str(), "wb"), &std::fclose);
+    if (!file || std::fwrite(json.data(), 1, json.size(), file.get()) != json.size()) {
+        error = "Datei kann nicht geschrieben werden: " + path;
+        return false;
+    }
+    return true;
+}
+
+std::string FrameProfiler::DefaultDumpPath()
+{
+    std::time_t now = std::time(nullptr);
+    char stamp[32];
+    std::strftime(stamp, sizeof(stamp), "%Y%m%d-%H%M%S", std::localtime(&now));
+    std::string name = std::string("tef-frames-") + stamp + ".json";
+    return AppDataPath(name);
+}
+
+} // namespace Services
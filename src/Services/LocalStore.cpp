@@ -0,0 +1,584 @@
+#include "../../include/Services/LocalStore.h"
+#include "../../include/Services/AppPaths.h"
+#include <algorithm>
+#include <chrono>
+#include <cstddef>
+#include <cstdlib>
+#include <cstring>
+#include <filesystem>
+#include <iostream>
+#include <random>
+#include <zlib.h>
+
+#ifdef _WIN32
+    #include <io.h>
+#else
+    #include <fcntl.h>
+    #include <unistd.h>
+#endif
+
+namespace Services {
+
+namespace {
+
+constexpr char kLogMagic[8] = {'T', 'E', 'F', 'S', 'T', 'O', 'R', '1'};
+constexpr char kIndexMagic[8] = {'T', 'E', 'F', 'S', 'I', 'D', 'X', '1'};
+constexpr uint64_t kLogHeaderSize = 16;   // Magic + Generation
+constexpr uint32_t kRecordMagic = 0x31524654; // "TFR1"
+constexpr uint8_t kFlagRemoved = 1;
+
+struct RecordHeader {
+    uint32_t magic;
+    uint32_t crc;          // über kind..valueLength, Schlüssel und Wert
+    uint8_t kind;
+    uint8_t flags;
+    uint16_t reserved;
+    uint32_t keyLength;
+    uint32_t valueLength;
+};
+static_assert(sizeof(RecordHeader) == 20, "RecordHeader muss ungepolstert sein");
+
+constexpr size_t kCrcOffset = offsetof(RecordHeader, kind);
+
+uint32_t RecordCrc(const RecordHeader& header, const char* key, const char* value)
+{
+    uLong crc = crc32(0L, Z_NULL, 0);
+    crc = crc32(crc, reinterpret_cast<const Bytef*>(&header) + kCrcOffset, static_cast<uInt>(sizeof(RecordHeader) - kCrcOffset));
+    crc = crc32(crc, reinterpret_cast<const Bytef*>(key), header.keyLength);
+    // crc32() mit Z_NULL liefert den Startwert zurück, leere Werte (Löschmarken) daher überspringen
+    if (header.valueLength > 0) crc = crc32(crc, reinterpret_cast<const Bytef*>(value), header.valueLength);
+    return static_cast<uint32_t>(crc);
+}
+
+uint64_t NewGeneration()
+{
+    std::random_device rd;
+    uint64_t now = static_cast<uint64_t>(std::chrono::system_clock::now().time_since_epoch().count());
+    return now ^ (static_cast<uint64_t>(rd()) << 32) ^ rd();
+}
+
+bool WriteLogHeader(std::FILE* file, uint64_t generation)
+{
+    return std::fwrite(kLogMagic, 1, sizeof(kLogMagic), file) == sizeof(kLogMagic) &&
+           std::fwrite(&generation, 1, sizeof(generation), file) == sizeof(generation);
+}
+
+bool SyncFile(std::FILE* file)
+{
+    if (std::fflush(file) != 0) return false;
+#ifdef _WIN32
+    return _commit(_fileno(file)) == 0;
+#else
+    return fsync(fileno(file)) == 0;
+#endif
+}
+
+template <typename T>
+void AppendPod(std::string& out, const T& value)
+{
+    out.append(reinterpret_cast<const char*>(&value), sizeof(T));
+}
+
+template <typename T>
+bool ReadPod(const char*& p, const char* end, T& value)
+{
+    if (static_cast<size_t>(end - p) < sizeof(T)) return false;
+    std::memcpy(&value, p, sizeof(T));
+    p += sizeof(T);
+    return true;
+}
+
+// Ersetzt target atomar durch source
+bool ReplaceFile(const std::string& source, const std::string& target)
+{
+#ifdef _WIN32
+    std::remove(target.c_str());
+#endif
+    return std::rename(source.c_str(), target.c_str()) == 0;
+}
+
+// Legt neue Dateien gleich mit 0600 an, nicht erst nachträglich per chmod
+std::FILE* OpenPrivate(const std::string& path, const char* mode)
+{
+#ifdef _WIN32
+    return std::fopen(path.c_str(), mode);
+#else
+    int flags = O_WRONLY | O_CREAT | (mode[0] == 'a' ? O_APPEND : O_TRUNC);
+    int fd = ::open(path.c_str(), flags, 0600);
+    if (fd < 0) return nullptr;
+    std::FILE* file = ::fdopen(fd, mode);
+    if (!file) ::close(fd);
+    return file;
+#endif
+}
+
+} // namespace
+
+LocalStore::~LocalStore()
+{
+    Close();
+}
+
+std::string LocalStore::MakeKey(StoreKind kind, std::string_view key)
+{
+    std::string fullKey;
+    fullKey.reserve(key.size() + 1);
+    fullKey.push_back(static_cast<char>(kind));
+    fullKey.append(key);
+    return fullKey;
+}
+
+uint64_t LocalStore::RecordSize(const Entry& entry)
+{
+    return sizeof(RecordHeader) + entry.keyLength + entry.valueLength;
+}
+
+bool LocalStore::Open(const std::string& path)
+{
+    Close();
+    std::lock_guard<std::mutex> lock(mutex_);
+    path_ = path;
+
+    std::error_code ec;
+    if (!std::filesystem::exists(path_, ec) || std::filesystem::file_size(path_, ec) == 0) {
+        std::FILE* file = OpenPrivate(path_, "wb");
+        if (!file) {
+            std::cout << "LocalStore: Datei kann nicht angelegt werden: " << path_ << std::endl;
+            return false;
+        }
+        bool ok = WriteLogHeader(file, NewGeneration()) && SyncFile(file);
+        std::fclose(file);
+        if (!ok) return false;
+    }
+
+    map_ = std::make_shared<MappedFile>();
+    if (!map_->Open(path_) || map_->Size() < kLogHeaderSize ||
+        std::memcmp(map_->Data(), kLogMagic, sizeof(kLogMagic)) != 0) {
+        std::cout << "LocalStore: Ungültige Datei: " << path_ << std::endl;
+        map_.reset();
+        return false;
+    }
+    std::memcpy(&generation_, map_->Data() + sizeof(kLogMagic), sizeof(generation_));
+    end_ = map_->Size();
+
+    // Index laden, danach nur den nicht abgedeckten Rest des Logs nachlesen
+    uint64_t covered = LoadIndex();
+    if (covered == 0) {
+        entries_.clear();
+        liveBytes_ = 0;
+        covered = kLogHeaderSize;
+    }
+    uint64_t validEnd = Replay(covered);
+
+    if (validEnd < end_) {
+        // Abgerissener Datensatz am Ende (Absturz beim Schreiben)
+        std::cout << "LocalStore: " << (end_ - validEnd) << " Bytes unvollständiger Daten am Ende entfernt" << std::endl;
+        map_.reset();
+        std::filesystem::resize_file(path_, validEnd, ec);
+        if (ec) {
+            std::cout << "LocalStore: Abschneiden fehlgeschlagen: " << ec.message() << std::endl;
+            return false;
+        }
+        end_ = validEnd;
+        if (!EnsureMapped(end_)) return false;
+    }
+
+    log_ = OpenPrivate(path_, "ab");
+    if (!log_) {
+        std::cout << "LocalStore: Datei kann nicht zum Schreiben geöffnet werden: " << path_ << std::endl;
+        map_.reset();
+        return false;
+    }
+
+    std::cout << "LocalStore geöffnet: " << entries_.size() << " Einträge, " << end_ << " Bytes" << std::endl;
+    return true;
+}
+
+void LocalStore::Close()
+{
+    if (compactThread_.joinable()) compactThread_.join();
+
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (log_) {
+        if (SyncLog()) WriteIndex();
+        std::fclose(log_);
+        log_ = nullptr;
+    }
+    entries_.clear();
+    map_.reset();
+    retired_.clear();
+    end_ = 0;
+    liveBytes_ = 0;
+}
+
+bool LocalStore::EnsureMapped(uint64_t size) const
+{
+    if (map_ && map_->Size() >= size) return true;
+
+    // Neu mappen; das alte Mapping bleibt für ausgegebene Werte erhalten
+    auto mapping = std::make_shared<MappedFile>();
+    if (!mapping->Open(path_)) return false;
+    RetireMapping();
+    map_ = std::move(mapping);
+    return map_->Size() >= size;
+}
+
+void LocalStore::RetireMapping() const
+{
+    // Abgelöste Mappings, die nur noch hier referenziert werden, freigeben
+    retired_.erase(std::remove_if(retired_.begin(), retired_.end(),
+                                  [](const std::shared_ptr<MappedFile>& mapping) { return mapping.use_count() == 1; }),
+                   retired_.end());
+    if (map_) {
+        if (map_.use_count() > 1) retired_.push_back(std::move(map_));
+        map_.reset();
+    }
+}
+
+std::string_view LocalStore::ValueOf(const Entry& entry) const
+{
+    if (!EnsureMapped(entry.recordOffset + RecordSize(entry))) return {};
+    return std::string_view(map_->Data() + entry.recordOffset + sizeof(RecordHeader) + entry.keyLength, entry.valueLength);
+}
+
+void LocalStore::Apply(const std::string& fullKey, bool removed, const Entry& entry)
+{
+    auto it = entries_.find(fullKey);
+    if (it != entries_.end()) {
+        liveBytes_ -= RecordSize(it->second);
+        if (removed) {
+            entries_.erase(it);
+        } else {
+            it->second = entry;
+        }
+    } else if (!removed) {
+        entries_.emplace(fullKey, entry);
+    }
+    if (!removed) liveBytes_ += RecordSize(entry);
+}
+
+uint64_t LocalStore::Replay(uint64_t from)
+{
+    const char* data = map_->Data();
+    const uint64_t size = map_->Size();
+    uint64_t pos = from;
+
+    while (pos + sizeof(RecordHeader) <= size) {
+        RecordHeader header;
+        std::memcpy(&header, data + pos, sizeof(header));
+        uint64_t recordSize = sizeof(RecordHeader) + static_cast<uint64_t>(header.keyLength) + header.valueLength;
+        if (header.magic != kRecordMagic || header.keyLength == 0 || pos + recordSize > size) break;
+
+        const char* key = data + pos + sizeof(RecordHeader);
+        if (RecordCrc(header, key, key + header.keyLength) != header.crc) break;
+
+        Entry entry{pos, header.keyLength, header.valueLength};
+        std::string fullKey = MakeKey(static_cast<StoreKind>(header.kind), std::string_view(key, header.keyLength));
+        Apply(fullKey, (header.flags & kFlagRemoved) != 0, entry);
+        pos += recordSize;
+    }
+    return pos;
+}
+
+bool LocalStore::Append(StoreKind kind, uint8_t flags, std::string_view key, std::string_view value, uint64_t& recordOffset)
+{
+    if (!log_ || key.empty() || key.size() > UINT32_MAX || value.size() > UINT32_MAX) return false;
+
+    RecordHeader header{};
+    header.magic = kRecordMagic;
+    header.kind = static_cast<uint8_t>(kind);
+    header.flags = flags;
+    header.keyLength = static_cast<uint32_t>(key.size());
+    header.valueLength = static_cast<uint32_t>(value.size());
+    header.crc = RecordCrc(header, key.data(), value.data());
+
+    // Ein Datensatz ist entweder vollständig oder wird beim nächsten Öffnen verworfen
+    bool ok = std::fwrite(&header, 1, sizeof(header), log_) == sizeof(header) &&
+              std::fwrite(key.data(), 1, key.size(), log_) == key.size() &&
+              (value.empty() || std::fwrite(value.data(), 1, value.size(), log_) == value.size()) &&
+              std::fflush(log_) == 0;
+    if (!ok) {
+        std::cout << "LocalStore: Schreibfehler in " << path_ << std::endl;
+        // Den abgerissenen Datensatz sofort abschneiden: dahinter angehängte Datensätze
+        // wären sonst beim nächsten Replay nicht mehr erreichbar
+        std::fclose(log_);
+        std::error_code ec;
+        std::filesystem::resize_file(path_, end_, ec);
+        log_ = OpenPrivate(path_, "ab");
+        if (ec) {
+            std::cout << "LocalStore: Abschneiden fehlgeschlagen: " << ec.message() << std::endl;
+            end_ = std::filesystem::file_size(path_, ec);
+        }
+        return false;
+    }
+
+    recordOffset = end_;
+    end_ += sizeof(header) + key.size() + value.size();
+    return true;
+}
+
+bool LocalStore::Put(StoreKind kind, std::string_view key, std::string_view value)
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    std::string fullKey = MakeKey(kind, key);
+
+    auto it = entries_.find(fullKey);
+    if (it != entries_.end() && it->second.valueLength == value.size() && ValueOf(it->second) == value) {
+        return true;
+    }
+
+    uint64_t offset = 0;
+    if (!Append(kind, 0, key, value, offset)) return false;
+    Apply(fullKey, false, Entry{offset, static_cast<uint32_t>(key.size()), static_cast<uint32_t>(value.size())});
+    return true;
+}
+
+bool LocalStore::Remove(StoreKind kind, std::string_view key)
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    std::string fullKey = MakeKey(kind, key);
+    if (entries_.find(fullKey) == entries_.end()) return true;
+
+    uint64_t offset = 0;
+    if (!Append(kind, kFlagRemoved, key, std::string_view(), offset)) return false;
+    Apply(fullKey, true, Entry{});
+    return true;
+}
+
+std::optional<StoreValue> LocalStore::Get(StoreKind kind, std::string_view key) const
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto it = entries_.find(MakeKey(kind, key));
+    if (it == entries_.end()) return std::nullopt;
+    if (!EnsureMapped(it->second.recordOffset + RecordSize(it->second))) return std::nullopt;
+    return StoreValue(map_, ValueOf(it->second));
+}
+
+void LocalStore::ForEach(StoreKind kind, const std::function<void(std::string_view key, std::string_view value)>& fn) const
+{
+    std::vector<std::pair<std::string_view, std::string_view>> items;
+    std::shared_ptr<const MappedFile> mapping;  // Hält das Mapping, falls fn anhängt oder kompaktiert wird
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        if (!EnsureMapped(end_)) return;
+        mapping = map_;
+
+        std::vector<const Entry*> selected;
+        for (const auto& item : entries_) {
+            if (static_cast<StoreKind>(item.first[0]) == kind) selected.push_back(&item.second);
+        }
+        std::sort(selected.begin(), selected.end(),
+                  [](const Entry* a, const Entry* b) { return a->recordOffset < b->recordOffset; });
+
+        items.reserve(selected.size());
+        for (const Entry* entry : selected) {
+            const char* key = mapping->Data() + entry->recordOffset + sizeof(RecordHeader);
+            items.emplace_back(std::string_view(key, entry->keyLength), std::string_view(key + entry->keyLength, entry->valueLength));
+        }
+    }
+
+    // Ohne Lock aufrufen, damit fn selbst Put()/Get() verwenden darf
+    for (const auto& item : items) fn(item.first, item.second);
+}
+
+bool LocalStore::SyncLog()
+{
+    return log_ && SyncFile(log_);
+}
+
+bool LocalStore::Flush()
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    return SyncLog() && WriteIndex();
+}
+
+uint64_t LocalStore::LoadIndex()
+{
+    MappedFile index;
+    if (!index.Open(path_ + ".idx") || index.Size() < sizeof(kIndexMagic) + 20 + sizeof(uint32_t)) return 0;
+
+    const char* p = index.Data();
+    const char* end = index.Data() + index.Size() - sizeof(uint32_t);
+    uint32_t storedCrc;
+    std::memcpy(&storedCrc, end, sizeof(storedCrc));
+    uLong crc = crc32(crc32(0L, Z_NULL, 0), reinterpret_cast<const Bytef*>(p), static_cast<uInt>(end - p));
+    if (static_cast<uint32_t>(crc) != storedCrc || std::memcmp(p, kIndexMagic, sizeof(kIndexMagic)) != 0) return 0;
+    p += sizeof(kIndexMagic);
+
+    uint64_t generation = 0, covered = 0;
+    uint32_t count = 0;
+    if (!ReadPod(p, end, generation) || !ReadPod(p, end, covered) || !ReadPod(p, end, count)) return 0;
+    // Index gehört zu einem anderen (kompaktierten) Log oder deckt mehr ab als vorhanden ist
+    if (generation != generation_ || covered < kLogHeaderSize || covered > end_) return 0;
+
+    entries_.clear();
+    liveBytes_ = 0;
+    for (uint32_t i = 0; i < count; ++i) {
+        uint32_t keyLength = 0;
+        Entry entry;
+        if (!ReadPod(p, end, keyLength) || static_cast<size_t>(end - p) < keyLength) return 0;
+        std::string fullKey(p, keyLength);
+        p += keyLength;
+        if (!ReadPod(p, end, entry.recordOffset) || !ReadPod(p, end, entry.keyLength) || !ReadPod(p, end, entry.valueLength)) return 0;
+        if (entry.recordOffset + RecordSize(entry) > covered) return 0;
+        liveBytes_ += RecordSize(entry);
+        entries_.emplace(std::move(fullKey), entry);
+    }
+    return covered;
+}
+
+bool LocalStore::WriteIndex()
+{
+    std::string out;
+    out.reserve(64 + entries_.size() * 64);
+    out.append(kIndexMagic, sizeof(kIndexMagic));
+    AppendPod(out, generation_);
+    AppendPod(out, end_);
+    AppendPod(out, static_cast<uint32_t>(entries_.size()));
+    for (const auto& item : entries_) {
+        AppendPod(out, static_cast<uint32_t>(item.first.size()));
+        out.append(item.first);
+        AppendPod(out, item.second.recordOffset);
+        AppendPod(out, item.second.keyLength);
+        AppendPod(out, item.second.valueLength);
+    }
+    uLong crc = crc32(crc32(0L, Z_NULL, 0), reinterpret_cast<const Bytef*>(out.data()), static_cast<uInt>(out.size()));
+    AppendPod(out, static_cast<uint32_t>(crc));
+
+    std::string tmpPath = path_ + ".idx.tmp";
+    std::FILE* file = OpenPrivate(tmpPath, "wb");
+    if (!file) return false;
+    bool ok = std::fwrite(out.data(), 1, out.size(), file) == out.size() && SyncFile(file);
+    std::fclose(file);
+    if (!ok || !ReplaceFile(tmpPath, path_ + ".idx")) {
+        std::remove(tmpPath.c_str());
+        return false;
+    }
+    return true;
+}
+
+bool LocalStore::Compact()
+{
+    std::unique_lock<std::mutex> lock(mutex_);
+    if (!log_ || !EnsureMapped(end_)) return false;
+
+    // Schnappschuss der lebenden Datensätze, kopiert wird ohne Lock
+    std::shared_ptr<MappedFile> source = map_;
+    const uint64_t snapshotEnd = end_;
+    std::vector<Entry> live;
+    live.reserve(entries_.size());
+    for (const auto& item : entries_) live.push_back(item.second);
+    lock.unlock();
+
+    std::sort(live.begin(), live.end(), [](const Entry& a, const Entry& b) { return a.recordOffset < b.recordOffset; });
+
+    const std::string compactPath = path_ + ".compact";
+    std::FILE* out = OpenPrivate(compactPath, "wb");
+    if (!out) return false;
+
+    const uint64_t generation = NewGeneration();
+    bool ok = WriteLogHeader(out, generation);
+    std::unordered_map<uint64_t, uint64_t> moved; // alter -> neuer Offset
+    moved.reserve(live.size());
+    uint64_t pos = kLogHeaderSize;
+    for (const Entry& entry : live) {
+        if (!ok) break;
+        uint64_t size = RecordSize(entry);
+        ok = std::fwrite(source->Data() + entry.recordOffset, 1, size, out) == size;
+        moved[entry.recordOffset] = pos;
+        pos += size;
+    }
+
+    lock.lock();
+    // Während des Kopierens angehängte Datensätze unverändert übernehmen
+    const uint64_t tailStart = pos;
+    if (ok && end_ > snapshotEnd) {
+        ok = EnsureMapped(end_) &&
+             std::fwrite(map_->Data() + snapshotEnd, 1, end_ - snapshotEnd, out) == end_ - snapshotEnd;
+        pos += end_ - snapshotEnd;
+    }
+    ok = ok && SyncFile(out);
+    std::fclose(out);
+
+    if (ok) {
+        // Rechte der alten Datei übernehmen (z.B. nur für den Besitzer lesbar)
+        std::error_code ec;
+        std::filesystem::permissions(compactPath, std::filesystem::status(path_, ec).permissions(),
+                                     std::filesystem::perm_options::replace, ec);
+        std::fclose(log_);
+        log_ = nullptr;
+        ok = ReplaceFile(compactPath, path_);
+        log_ = OpenPrivate(path_, "ab");
+    }
+    if (!ok || !log_) {
+        std::cout << "LocalStore: Kompaktierung fehlgeschlagen" << std::endl;
+        std::remove(compactPath.c_str());
+        if (!log_) log_ = OpenPrivate(path_, "ab");
+        return false;
+    }
+
+    const uint64_t before = end_;
+    liveBytes_ = 0;
+    for (auto& item : entries_) {
+        Entry& entry = item.second;
+        entry.recordOffset = entry.recordOffset >= snapshotEnd ? tailStart + (entry.recordOffset - snapshotEnd)
+                                                               : moved[entry.recordOffset];
+        liveBytes_ += RecordSize(entry);
+    }
+    generation_ = generation;
+    end_ = pos;
+
+    // Altes Mapping zurückstellen, ausgegebene Werte darauf bleiben gültig
+    RetireMapping();
+    EnsureMapped(end_);
+    WriteIndex();
+
+    std::cout << "LocalStore kompaktiert: " << before << " -> " << end_ << " Bytes" << std::endl;
+    return true;
+}
+
+bool LocalStore::CompactAsync()
+{
+    if (compacting_.exchange(true)) return false;
+    if (compactThread_.joinable()) compactThread_.join();
+    compactThread_ = std::thread([this]() {
+        Compact();
+        compacting_ = false;
+    });
+    return true;
+}
+
+bool LocalStore::NeedsCompaction() const
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    uint64_t garbage = end_ - kLogHeaderSize - std::min(liveBytes_, end_ - kLogHeaderSize);
+    return garbage >= (1u << 20) && garbage * 2 > end_;
+}
+
+size_t LocalStore::EntryCount() const
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    return entries_.size();
+}
+
+uint64_t LocalStore::FileBytes() const
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    return end_;
+}
+
+std::string LocalStore::DefaultPath(const std::string& apiUrl, const std::string& username)
+{
+    // FNV-1a über URL und Benutzer: Konten und Server teilen sich keinen Speicher
+    uint64_t hash = 14695981039346656037ull;
+    for (unsigned char c : apiUrl + '\n' + username) {
+        hash ^= c;
+        hash *= 1099511628211ull;
+    }
+    char suffix[17];
+    std::snprintf(suffix, sizeof(suffix), "%016llx", static_cast<unsigned long long>(hash));
+
+    return AppDataPath(std::string(".text-extraction-store-") + suffix);
+}
+
+} // namespace Services
@@ -0,0 +1,378 @@
+#include "../../include/Services/LogTail.h"
+#include "../../include/Services/ApiService.h"
+#include "../../include/Services/JsonUtil.h"
+#include "../../include/Services/Tracer.h"
+#include <algorithm>
+#include <cctype>
+#include <chrono>
+#include <cstdio>
+#include <functional>
+#include <iostream>
+
+namespace Services {
+
+namespace {
+
+// Längere Meldungen werden gekürzt, damit der Puffer auch bei Stacktraces begrenzt bleibt
+constexpr size_t kMaxMessageBytes = 1024;
+constexpr int kInitialCount = 500;
+
+// Kennzeichnet Einträge ohne (lesbaren) Zeitstempel
+constexpr int64_t kNoTime = INT64_MIN;
+
+struct ParsedEntry {
+    std::string timestamp;
+    int64_t time = kNoTime;  // Mikrosekunden seit 1970 (UTC)
+    std::string level;
+    std::string category;
+    std::string message;
+};
+
+std::string FirstOf(const std::string& obj, std::initializer_list<const char*> keys)
+{
+    for (const char* key : keys) {
+        std::string value = ReadJsonValue(obj, key);
+        if (!value.empty()) return value;
+    }
+    return "";
+}
+
+// Kürzt auf maxBytes ohne ein UTF-8-Zeichen zu zerschneiden
+void TruncateUtf8(std::string& text, size_t maxBytes)
+{
+    if (text.size() <= maxBytes) return;
+    size_t cut = maxBytes;
+    while (cut > 0 && (static_cast<unsigned char>(text[cut]) & 0xC0) == 0x80) --cut;
+    text.resize(cut);
+    text += "...";
+}
+
+std::string UrlEncode(const std::string& text)
+{
+    std::string out;
+    for (unsigned char c : text) {
+        if (std::isalnum(c) || c == '-' || c == '_' || c == '.' || c == '~') {
+            out += static_cast<char>(c);
+        } else {
+            char buf[4];
+            std::snprintf(buf, sizeof(buf), "%%%02X", c);
+            out += buf;
+        }
+    }
+    return out;
+}
+
+// Tage seit 1970-01-01 für ein Datum im gregorianischen Kalender (Howard Hinnant, days_from_civil)
+int64_t DaysFromCivil(int64_t y, unsigned m, unsigned d)
+{
+    y -= m <= 2;
+    const int64_t era = (y >= 0 ? y : y - 399) / 400;
+    const unsigned yoe = static_cast<unsigned>(y - era * 400);
+    const unsigned doy = (153 * (m > 2 ? m - 3 : m + 9) + 2) / 5 + d - 1;
+    const unsigned doe = yoe * 365 + yoe / 4 - yoe / 100 + doy;
+    return era * 146097 + static_cast<int64_t>(doe) - 719468;
+}
+
+// ISO-8601 "YYYY-MM-DD[T ]hh:mm:ss[.ffffff][Z|±hh:mm]" in Mikrosekunden (UTC); ohne Zone gilt UTC.
+// Verglichen wird der Zeitpunkt, nicht der String: Zonen und unterschiedlich viele Nachkommastellen
+// sortieren als Text falsch.
+int64_t ParseTimestamp(const std::string& text)
+{
+    const char* p = text.c_str();
+    auto digits = [&p](int count, int& value) {
+        value = 0;
+        for (int i = 0; i < count; ++i, ++p) {
+            if (!std::isdigit(static_cast<unsigned char>(*p))) return false;
+            value = value * 10 + (*p - '0');
+        }
+        return true;
+    };
+    int year, month, day, hour, minute, second;
+    if (!digits(4, year) || *p++ != '-' || !digits(2, month) || *p++ != '-' || !digits(2, day)) return kNoTime;
+    if (*p != 'T' && *p != ' ') return kNoTime;
+    ++p;
+    if (!digits(2, hour) || *p++ != ':' || !digits(2, minute) || *p++ != ':' || !digits(2, second)) return kNoTime;
+    if (month < 1 || month > 12 || day < 1 || day > 31 || hour > 23 || minute > 59 || second > 60) return kNoTime;
+
+    int64_t micros = 0;
+    if (*p == '.' || *p == ',') {
+        ++p;
+        int scale = 100000;
+        while (std::isdigit(static_cast<unsigned char>(*p))) {
+            micros += (*p++ - '0') * scale;
+            scale /= 10;
+        }
+    }
+    int64_t offsetMinutes = 0;
+    if (*p == '+' || *p == '-') {
+        int sign = *p++ == '-' ? -1 : 1;
+        int offsetHours, offsetMins = 0;
+        if (!digits(2, offsetHours)) return kNoTime;
+        if (*p == ':') ++p;
+        if (std::isdigit(static_cast<unsigned char>(*p)) && !digits(2, offsetMins)) return kNoTime;
+        offsetMinutes = sign * (offsetHours * 60 + offsetMins);
+    }
+
+    int64_t seconds = DaysFromCivil(year, static_cast<unsigned>(month), static_cast<unsigned>(day)) * 86400 +
+                      hour * 3600 + minute * 60 + second - offsetMinutes * 60;
+    return seconds * 1000000 + micros;
+}
+
+size_t EntryHash(const std::string& level, const std::string& category, const std::string& message)
+{
+    return std::hash<std::string>()(level + '\x1f' + category + '\x1f' + message);
+}
+
+} // namespace
+
+LogTail::LogTail(size_t capacity)
+    : capacity_(capacity > 0 ? capacity : 1),
+      ring_(capacity_),
+      names_(1)
+{
+}
+
+LogTail::~LogTail()
+{
+    Stop();
+}
+
+void LogTail::Start(int intervalMs)
+{
+    if (worker_.joinable()) return;
+    intervalMs_ = intervalMs > 0 ? intervalMs : 1000;
+    stop_ = false;
+    worker_ = std::thread(&LogTail::Run, this);
+}
+
+void LogTail::Stop()
+{
+    stop_ = true;
+    Wake();
+    if (worker_.joinable()) worker_.join();
+}
+
+void LogTail::SetActive(bool active)
+{
+    if (!active_.exchange(active) && active) Wake();
+}
+
+void LogTail::Clear()
+{
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        // Nur den Ring leeren: die Hochwassermarke bleibt, sonst käme der Server-Puffer erneut
+        head_ = 0;
+        size_ = 0;
+    }
+    ++version_;
+    Wake();
+}
+
+void LogTail::Wake()
+{
+    {
+        std::lock_guard<std::mutex> lock(wakeMutex_);
+        wakeRequested_ = true;
+    }
+    wake_.notify_one();
+}
+
+uint16_t LogTail::Intern(const std::string& name, std::vector<uint16_t>& seen)
+{
+    if (name.empty()) return 0;
+    auto it = nameIds_.find(name);
+    if (it != nameIds_.end()) {
+        if (std::find(seen.begin(), seen.end(), it->second) == seen.end()) seen.push_back(it->second);
+        return it->second;
+    }
+    // Mehr unterschiedliche Namen sind kein sinnvolles Log mehr, Rest läuft unter "" (ID 0)
+    if (names_.size() >= 0xFFFF) return 0;
+    uint16_t id = static_cast<uint16_t>(names_.size());
+    names_.push_back(name);
+    nameIds_.emplace(name, id);
+    seen.push_back(id);
+    return id;
+}
+
+void LogTail::Push(const std::string& timestamp, uint16_t level, uint16_t category, const std::string& message)
+{
+    // Überschreibt den ältesten Eintrag, assign() nutzt dessen Speicher weiter
+    LogRecord& record = ring_[head_];
+    record.sequence = nextSequence_++;
+    record.timestamp.assign(timestamp);
+    record.level = level;
+    record.category = category;
+    record.message.assign(message);
+    head_ = (head_ + 1) % capacity_;
+    if (size_ < capacity_) ++size_;
+}
+
+size_t LogTail::Ingest(const std::string& json)
+{
+    TraceSpan span("json", "Logs dekodieren");
+    // Parsen ohne Lock, der Render-Thread liest währenddessen weiter
+    std::vector<ParsedEntry> parsed;
+    size_t pos = json.find('[');
+    if (pos == std::string::npos) return 0;
+    while ((pos = json.find('{', pos)) != std::string::npos) {
+        size_t end = FindMatchingBracket(json, pos);
+        if (end == std::string::npos) break;
+        std::string obj = json.substr(pos, end - pos + 1);
+
+        ParsedEntry entry;
+        entry.timestamp = FirstOf(obj, {"timestamp", "createdAt", "time"});
+        entry.time = ParseTimestamp(entry.timestamp);
+        entry.level = FirstOf(obj, {"level", "logLevel"});
+        entry.category = FirstOf(obj, {"category", "source", "logger"});
+        entry.message = FirstOf(obj, {"message", "text"});
+        // Mehrzeilige Meldungen (Stacktraces) einzeilig darstellen
+        std::replace_if(entry.message.begin(), entry.message.end(),
+                        [](char c) { return c == '\n' || c == '\r' || c == '\t'; }, ' ');
+        TruncateUtf8(entry.message, kMaxMessageBytes);
+        parsed.push_back(std::move(entry));
+        pos = end + 1;
+    }
+    if (parsed.empty()) return 0;
+
+    // Logging/recent liefert die neuesten zuerst; Einträge ohne Zeitstempel bleiben vorn in Empfangsreihenfolge
+    std::stable_sort(parsed.begin(), parsed.end(),
+                     [](const ParsedEntry& a, const ParsedEntry& b) { return a.time < b.time; });
+
+    size_t added = 0;
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        // daterange schließt den Startzeitpunkt ein: Einträge mit genau diesem Zeitpunkt kamen schon
+        // im letzten Abruf. Gezählt statt als Menge, damit gleichlautende neue Einträge nicht verloren gehen
+        std::unordered_map<size_t, uint32_t> overlap;
+        overlap.swap(boundaryCounts_);
+        const int64_t previousTime = lastTime_;
+        for (const auto& entry : parsed) {
+            if (entry.time != kNoTime) {
+                if (entry.time < previousTime) continue;
+                size_t hash = EntryHash(entry.level, entry.category, entry.message);
+                if (entry.time > lastTime_) {
+                    lastTime_ = entry.time;
+                    lastTimestamp_ = entry.timestamp;
+                    boundaryCounts_.clear();
+                }
+                ++boundaryCounts_[hash];
+                if (entry.time == previousTime) {
+                    auto seen = overlap.find(hash);
+                    if (seen != overlap.end() && seen->second > 0) {
+                        --seen->second;
+                        continue;
+                    }
+                }
+            }
+
+            Push(entry.timestamp, Intern(entry.level, levels_), Intern(entry.category, categories_), entry.message);
+            ++added;
+        }
+        // Ohne Einträge am bisherigen Rand bleibt das alte Überlappungsfenster gültig
+        if (lastTime_ == previousTime && boundaryCounts_.empty()) boundaryCounts_.swap(overlap);
+    }
+    if (added > 0) ++version_;
+    return added;
+}
+
+size_t LogTail::Size() const
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    return size_;
+}
+
+uint64_t LogTail::TotalReceived() const
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    return nextSequence_ - 1;
+}
+
+std::string LogTail::LastError() const
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    return lastError_;
+}
+
+size_t LogTail::Collect(uint16_t level, uint16_t category, size_t first, size_t count, std::vector<LogRecord>& out) const
+{
+    out.clear();
+    std::lock_guard<std::mutex> lock(mutex_);
+    size_t oldest = (head_ + capacity_ - size_) % capacity_;
+
+    // Ohne Filter direkt adressieren
+    if (level == 0 && category == 0) {
+        for (size_t i = first; i < size_ && out.size() < count; ++i) {
+            out.push_back(ring_[(oldest + i) % capacity_]);
+        }
+        return size_;
+    }
+
+    size_t matches = 0;
+    for (size_t i = 0; i < size_; ++i) {
+        const LogRecord& record = ring_[(oldest + i) % capacity_];
+        if ((level != 0 && record.level != level) || (category != 0 && record.category != category)) continue;
+        if (matches >= first && out.size() < count) out.push_back(record);
+        ++matches;
+    }
+    return matches;
+}
+
+std::vector<uint16_t> LogTail::Levels() const
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    return levels_;
+}
+
+std::vector<uint16_t> LogTail::Categories() const
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    return categories_;
+}
+
+std::string LogTail::Name(uint16_t id) const
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    return id < names_.size() ? names_[id] : "";
+}
+
+void LogTail::Poll()
+{
+    std::string from;
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        from = lastTimestamp_;
+    }
+    std::string endpoint = from.empty() ? "Logging/recent?count=" + std::to_string(kInitialCount)
+                                        : "Logging/daterange?from=" + UrlEncode(from);
+
+    HttpResponse resp = ApiService::Get(endpoint);
+    std::string error;
+    if (resp.isSuccess) {
+        Ingest(resp.body);
+    } else {
+        error = resp.statusCode == 0 ? "Server nicht erreichbar" : "Status " + std::to_string(resp.statusCode);
+    }
+
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (error != lastError_) {
+        if (!error.empty()) std::cout << "Fehler beim Laden der Logs: " << error << std::endl;
+        lastError_ = error;
+        ++version_;
+    }
+}
+
+void LogTail::Run()
+{
+    Tracer::SetThreadName("LogTail");
+    while (!stop_) {
+        if (active_) Poll();
+
+        std::unique_lock<std::mutex> lock(wakeMutex_);
+        wake_.wait_for(lock, std::chrono::milliseconds(intervalMs_),
+                       [this] { return wakeRequested_ || stop_.load(); });
+        wakeRequested_ = false;
+    }
+}
+
+} // namespace Services
@@ -1,4 +1,5 @@
 #include "../../include/Services/LoginService.h"
+#include "../../include/Services/AppPaths.h"
 #include <iostream>
 #include <fstream>
 #include <filesystem>
@@ -115,19 +116,7 @@ void LoginService::OnLoginStatusChanged(LoginStatusChangedEvent handler)
 std::string LoginService::GetStoragePath()
 {
     // Speichert im Home-Verzeichnis für bessere Persistenz
-    #ifdef _WIN32
-        const char* home = std::getenv("USERPROFILE");
-    #else
-        const char* home = std::getenv("HOME");
-    #endif
-    
-    if (!home) {
-        return ".text-extraction-login";
-    }
-    
-    std::string path = home;
-    path += "/.text-extraction-login";
-    return path;
+    return AppDataPath(".text-extraction-login");
 }
 
 // XOR-basierte einfache Verschlüsselung mit Schlüssel
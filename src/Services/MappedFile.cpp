@@ -0,0 +1,112 @@
+#include "../../include/Services/MappedFile.h"
+#include <fstream>
+#include <utility>
+
+#ifndef _WIN32
+    #include <sys/mman.h>
+    #include <sys/stat.h>
+    #include <fcntl.h>
+    #include <unistd.h>
+#endif
+
+namespace Services {
+
+MappedFile::MappedFile(const std::string& path)
+{
+    Open(path);
+}
+
+MappedFile::~MappedFile()
+{
+    Close();
+}
+
+MappedFile::MappedFile(MappedFile&& other) noexcept
+{
+    *this = std::move(other);
+}
+
+MappedFile& MappedFile::operator=(MappedFile&& other) noexcept
+{
+    if (this != &other) {
+        Close();
+        mapped_ = other.mapped_;
+        size_ = other.size_;
+        if (!mapped_ && !other.buffer_.empty()) {
+            buffer_ = std::move(other.buffer_);
+            data_ = buffer_.data();
+        } else {
+            data_ = other.data_;
+        }
+        other.data_ = nullptr;
+        other.size_ = 0;
+        other.mapped_ = false;
+        other.buffer_.clear();
+    }
+    return *this;
+}
+
+bool MappedFile::Open(const std::string& path)
+{
+    Close();
+
+#ifndef _WIN32
+    int fd = ::open(path.c_str(), O_RDONLY);
+    if (fd < 0) {
+        return false;
+    }
+
+    struct stat st;
+    if (fstat(fd, &st) != 0) {
+        ::close(fd);
+        return false;
+    }
+
+    size_ = static_cast<size_t>(st.st_size);
+    if (size_ == 0) {
+        // Leere Dateien können nicht gemappt werden
+        ::close(fd);
+        static const char empty = '\0';
+        data_ = &empty;
+        return true;
+    }
+
+    void* addr = mmap(nullptr, size_, PROT_READ, MAP_PRIVATE, fd, 0);
+    ::close(fd);
+    if (addr == MAP_FAILED) {
+        size_ = 0;
+        return false;
+    }
+
+    madvise(addr, size_, MADV_WILLNEED);
+    data_ = static_cast<const char*>(addr);
+    mapped_ = true;
+    return true;
+#else
+    std::ifstream file(path, std::ios::binary | std::ios::ate);
+    if (!file.is_open()) {
+        return false;
+    }
+    size_ = static_cast<size_t>(file.tellg());
+    buffer_.resize(size_ + 1);
+    file.seekg(0);
+    file.read(buffer_.data(), static_cast<std::streamsize>(size_));
+    data_ = buffer_.data();
+    return true;
+#endif
+}
+
+void MappedFile::Close()
+{
+#ifndef _WIN32
+    if (mapped_ && data_) {
+        munmap(const_cast<char*>(data_), size_);
+    }
+#endif
+    data_ = nullptr;
+    size_ = 0;
+    mapped_ = false;
+    buffer_.clear();
+}
+
+} // namespace Services
@@ -0,0 +1,324 @@
+#include "../../include/Services/NodeSet.h"
+#include "../../include/Services/Tracer.h"
+#include <curl/curl.h>
+#include <algorithm>
+#include <functional>
+#include <iostream>
+#include <random>
+
+namespace Services {
+
+namespace {
+
+constexpr int kVirtualNodes = 64;       // Punkte je Knoten auf dem Ring, glättet die Verteilung
+constexpr int kMaxBackoffSeconds = 30;
+constexpr double kLatencyWeight = 0.2;
+constexpr double kLatencySlackMs = 10.0;   // Darunter ist der Unterschied Messrauschen
+
+// FNV-1a mit splitmix64-Nachmischung: kurze, ähnliche IDs streuen sonst schlecht über den Ring
+uint64_t Hash(std::string_view text)
+{
+    uint64_t h = 14695981039346656037ull;
+    for (unsigned char c : text) {
+        h ^= c;
+        h *= 1099511628211ull;
+    }
+    h ^= h >> 30;
+    h *= 0xbf58476d1ce4e5b9ull;
+    h ^= h >> 27;
+    h *= 0x94d049bb133111ebull;
+    h ^= h >> 31;
+    return h;
+}
+
+std::minstd_rand& Random()
+{
+    thread_local std::minstd_rand rng(static_cast<unsigned>(
+        std::hash<std::thread::id>()(std::this_thread::get_id()) ^
+        static_cast<size_t>(std::chrono::steady_clock::now().time_since_epoch().count())));
+    return rng;
+}
+
+size_t DiscardBody(void*, size_t size, size_t nmemb, void*)
+{
+    return size * nmemb;
+}
+
+// Jede Antwort unter 500 zählt: /ping braucht keine Anmeldung, ein 404 heißt nur "ältere Server-Version"
+bool Ping(const std::string& url)
+{
+    CURL* curl = curl_easy_init();
+    if (!curl) return false;
+    std::string target = url + "/ping";
+    curl_easy_setopt(curl, CURLOPT_URL, target.c_str());
+    curl_easy_setopt(curl, CURLOPT_WRITEFUNCTION, DiscardBody);
+    curl_easy_setopt(curl, CURLOPT_CONNECTTIMEOUT, 2L);
+    curl_easy_setopt(curl, CURLOPT_TIMEOUT, 3L);
+    curl_easy_setopt(curl, CURLOPT_NOSIGNAL, 1L);
+    CURLcode res = curl_easy_perform(curl);
+    long status = 0;
+    curl_easy_getinfo(curl, CURLINFO_RESPONSE_CODE, &status);
+    curl_easy_cleanup(curl);
+    return res == CURLE_OK && status > 0 && status < 500;
+}
+
+bool Contains(const std::vector<size_t>& list, size_t value)
+{
+    return std::find(list.begin(), list.end(), value) != list.end();
+}
+
+} // namespace
+
+NodeSet::NodeSet(int healthIntervalSeconds)
+    : healthIntervalSeconds_(healthIntervalSeconds)
+{
+}
+
+NodeSet::~NodeSet()
+{
+    StopHealthChecks();
+}
+
+void NodeSet::SetUrls(const std::vector<std::string>& urls)
+{
+    if (urls.empty()) return;
+    bool multiple = urls.size() > 1;
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        nodes_.clear();
+        ring_.clear();
+        for (size_t i = 0; i < urls.size(); ++i) {
+            Node node;
+            node.url = urls[i];
+            nodes_.push_back(std::move(node));
+            for (int v = 0; v < kVirtualNodes; ++v) ring_.emplace_back(Hash(urls[i] + "#" + std::to_string(v)), i);
+        }
+        std::sort(ring_.begin(), ring_.end());
+        ++generation_;
+    }
+    // Ein einzelner Knoten braucht keine eigene Prüfung, das übernimmt der SyncService
+    if (multiple) StartHealthChecks();
+    else StopHealthChecks();
+}
+
+std::vector<std::string> NodeSet::Urls() const
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    std::vector<std::string> urls;
+    for (const auto& node : nodes_) urls.push_back(node.url);
+    return urls;
+}
+
+size_t NodeSet::Size() const
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    return nodes_.size();
+}
+
+bool NodeSet::UsableLocked(size_t node, const std::vector<size_t>& tried, Clock::time_point now) const
+{
+    return !Contains(tried, node) && (nodes_[node].reachable || now >= nodes_[node].retryAt);
+}
+
+size_t NodeSet::PickLocked(std::string_view affinityKey, const std::vector<size_t>& tried, Clock::time_point now)
+{
+    if (nodes_.size() == 1) return 0;
+
+    // Dokumentbezogen: im Uhrzeigersinn zum ersten nutzbaren Knoten
+    if (!affinityKey.empty()) {
+        auto it = std::lower_bound(ring_.begin(), ring_.end(), std::make_pair(Hash(affinityKey), size_t(0)));
+        for (size_t step = 0; step < ring_.size(); ++step, ++it) {
+            if (it == ring_.end()) it = ring_.begin();
+            if (UsableLocked(it->second, tried, now)) return it->second;
+        }
+    }
+
+    // Zwei zufällige Kandidaten, der weniger ausgelastete gewinnt
+    size_t usable = 0;
+    for (size_t i = 0; i < nodes_.size(); ++i) {
+        if (UsableLocked(i, tried, now)) ++usable;
+    }
+    if (usable > 0) {
+        auto nth = [&](size_t n) {
+            for (size_t i = 0; i < nodes_.size(); ++i) {
+                if (UsableLocked(i, tried, now) && n-- == 0) return i;
+            }
+            return size_t(0);
+        };
+        size_t first = Random()() % usable;
+        size_t second = usable > 1 ? (first + 1 + Random()() % (usable - 1)) % usable : first;
+        size_t a = nth(first);
+        size_t b = nth(second);
+        const Node& na = nodes_[a];
+        const Node& nb = nodes_[b];
+        if (na.outstanding != nb.outstanding) return na.outstanding < nb.outstanding ? a : b;
+        // Latenz entscheidet nur bei deutlichem Abstand, sonst liefe sequentielle Last komplett auf einen Knoten
+        if (na.latencyMs > 2.0 * nb.latencyMs + kLatencySlackMs) return b;
+        return a;
+    }
+
+    // Alles markiert: den Knoten nehmen, der am längsten pausiert
+    size_t best = 0;
+    bool found = false;
+    for (size_t i = 0; i < nodes_.size(); ++i) {
+        if (Contains(tried, i)) continue;
+        if (!found || nodes_[i].retryAt < nodes_[best].retryAt) best = i;
+        found = true;
+    }
+    return best;
+}
+
+NodeSet::Lease NodeSet::Acquire(std::string_view affinityKey, const std::vector<size_t>& tried)
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    Lease lease;
+    if (nodes_.empty()) return lease;
+    lease.node = PickLocked(affinityKey, tried, Clock::now());
+    lease.generation = generation_;
+    lease.url = nodes_[lease.node].url;
+    ++nodes_[lease.node].outstanding;
+    return lease;
+}
+
+void NodeSet::MarkLocked(Node& node, bool reachable)
+{
+    if (reachable) {
+        if (!node.reachable) std::cout << "Knoten wieder erreichbar: " << node.url << std::endl;
+        node.reachable = true;
+        node.backoffSeconds = 0;
+        return;
+    }
+    if (node.reachable && nodes_.size() > 1) std::cout << "Knoten nicht erreichbar: " << node.url << std::endl;
+    node.reachable = false;
+    node.backoffSeconds = node.backoffSeconds == 0 ? 1 : std::min(node.backoffSeconds * 2, kMaxBackoffSeconds);
+    node.retryAt = Clock::now() + std::chrono::seconds(node.backoffSeconds);
+}
+
+void NodeSet::Release(const Lease& lease, bool reachable, double elapsedMs)
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (lease.generation != generation_ || lease.node >= nodes_.size()) return;
+    Node& node = nodes_[lease.node];
+    --node.outstanding;
+    ++node.requests;
+    if (reachable) {
+        node.latencyMs = node.latencyMs == 0.0 ? elapsedMs : node.latencyMs + kLatencyWeight * (elapsedMs - node.latencyMs);
+    } else {
+        ++node.failures;
+    }
+    MarkLocked(node, reachable);
+}
+
+void NodeSet::CheckHealth()
+{
+    std::vector<std::string> urls;
+    uint64_t generation;
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        generation = generation_;
+        for (const auto& node : nodes_) urls.push_back(node.url);
+    }
+
+    std::vector<bool> reachable(urls.size());
+    for (size_t i = 0; i < urls.size(); ++i) reachable[i] = Ping(urls[i]);
+
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (generation != generation_) return;
+    for (size_t i = 0; i < nodes_.size(); ++i) {
+        // Ein erfolgreicher Ping holt den Knoten sofort zurück, ein fehlgeschlagener verlängert die Pause
+        if (reachable[i] || nodes_[i].reachable || Clock::now() >= nodes_[i].retryAt) MarkLocked(nodes_[i], reachable[i]);
+    }
+}
+
+std::vector<NodeSet::NodeStatus> NodeSet::Status() const
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    std::vector<NodeStatus> status;
+    for (const auto& node : nodes_) {
+        NodeStatus entry;
+        entry.url = node.url;
+        entry.reachable = node.reachable;
+        entry.outstanding = node.outstanding;
+        entry.latencyMs = node.latencyMs;
+        entry.requests = node.requests;
+        entry.failures = node.failures;
+        status.push_back(std::move(entry));
+    }
+    return status;
+}
+
+void NodeSet::StartHealthChecks()
+{
+    if (health_.joinable()) return;
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        stop_ = false;
+    }
+    health_ = std::thread(&NodeSet::RunHealthChecks, this);
+}
+
+void NodeSet::StopHealthChecks()
+{
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        stop_ = true;
+    }
+    wake_.notify_all();
+    if (health_.joinable()) health_.join();
+}
+
+void NodeSet::RunHealthChecks()
+{
+    Tracer::SetThreadName("NodeSet");
+    while (true) {
+        CheckHealth();
+        std::unique_lock<std::mutex> lock(mutex_);
+        if (wake_.wait_for(lock, std::chrono::seconds(healthIntervalSeconds_), [this] { return stop_; })) break;
+    }
+}
+
+std::vector<std::string> NodeSet::ParseList(const std::string& text)
+{
+    std::vector<std::string> urls;
+    size_t pos = 0;
+    while (pos < text.size()) {
+        size_t start = text.find_first_not_of(",; \t\r\n", pos);
+        if (start == std::string::npos) break;
+        size_t end = text.find_first_of(",; \t\r\n", start);
+        if (end == std::string::npos) end = text.size();
+        std::string url = text.substr(start, end - start);
+        while (!url.empty() && url.back() == '/') url.pop_back();
+        if (!url.empty() && std::find(urls.begin(), urls.end(), url) == urls.end()) urls.push_back(url);
+        pos = end;
+    }
+    return urls;
+}
+
+std::string_view NodeSet::AffinityKey(std::string_view endpoint)
+{
+    endpoint = endpoint.substr(0, endpoint.find('?'));
+    auto segment = [&](size_t index) {
+        size_t start = 0;
+        for (size_t i = 0; i < index; ++i) {
+            start = endpoint.find('/', start);
+            if (start == std::string_view::npos) return std::string_view();
+            ++start;
+        }
+        return endpoint.substr(start, endpoint.find('/', start) - start);
+    };
+
+    std::string_view controller = segment(0);
+    std::string_view second = segment(1);
+    if (controller == "Extraction") {
+        if (second == "result") return segment(2);
+        if (second == "stats" || second == "results") return {};
+        return second;
+    }
+    if (controller == "Upload") {
+        if (second == "my-documents" || second == "statistics") return {};
+        return second;
+    }
+    return {};
+}
+
+} // namespace Services
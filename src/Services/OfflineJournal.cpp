@@ -0,0 +1,215 @@
+#include "../../include/Services/OfflineJournal.h"
+#include "../../include/Services/AppPaths.h"
+#include <algorithm>
+#include <cstdio>
+#include <cstdlib>
+#include <filesystem>
+
+namespace Services {
+
+namespace {
+
+const std::string kConflictPrefix = "conflict/";
+
+// Zeilenumbrüche würden das Zeilenformat zerstören (nur der Body darf welche enthalten)
+std::string SingleLine(const std::string& text)
+{
+    std::string line = text;
+    std::replace(line.begin(), line.end(), '\n', ' ');
+    std::replace(line.begin(), line.end(), '\r', ' ');
+    return line;
+}
+
+// Liest bis zum nächsten '\n' und setzt data dahinter
+bool NextLine(std::string_view& data, std::string_view& line)
+{
+    size_t end = data.find('\n');
+    if (end == std::string_view::npos) return false;
+    line = data.substr(0, end);
+    data.remove_prefix(end + 1);
+    return true;
+}
+
+// Neue Dateien legt der LocalStore bereits mit 0600 an, das betrifft nur ältere Journale
+void RestrictPermissions(const std::string& path)
+{
+    std::error_code ec;
+    std::filesystem::permissions(path,
+                                 std::filesystem::perms::owner_read | std::filesystem::perms::owner_write,
+                                 std::filesystem::perm_options::replace, ec);
+}
+
+} // namespace
+
+bool OfflineJournal::Open(const std::string& path)
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (!store_.Open(path)) return false;
+    RestrictPermissions(path);
+    RestrictPermissions(path + ".idx");
+
+    // Nächste Sequenznummer hinter der höchsten vorhandenen (auch Konflikte)
+    nextSequence_ = 1;
+    pendingByUser_.clear();
+    auto track = [this](std::string_view key) {
+        uint64_t sequence = std::strtoull(std::string(key).c_str(), nullptr, 16);
+        nextSequence_ = std::max(nextSequence_, sequence + 1);
+    };
+    store_.ForEach(StoreKind::Journal, [&](std::string_view key, std::string_view value) {
+        track(key);
+        JournalEntry entry;
+        if (Deserialize(value, entry)) ++pendingByUser_[entry.user];
+    });
+    store_.ForEach(StoreKind::Meta, [&](std::string_view key, std::string_view) {
+        if (key.substr(0, kConflictPrefix.size()) == kConflictPrefix) track(key.substr(kConflictPrefix.size()));
+    });
+    ++version_;
+    return true;
+}
+
+void OfflineJournal::Close()
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    store_.Close();
+    pendingByUser_.clear();
+    ++version_;
+}
+
+std::string OfflineJournal::SequenceKey(uint64_t sequence)
+{
+    char key[17];
+    std::snprintf(key, sizeof(key), "%016llx", static_cast<unsigned long long>(sequence));
+    return key;
+}
+
+std::string OfflineJournal::Serialize(const JournalEntry& entry)
+{
+    return SingleLine(entry.method) + "\n" + SingleLine(entry.endpoint) + "\n" + SingleLine(entry.user) + "\n" +
+           std::to_string(entry.createdAt) + "\n" + SingleLine(entry.description) + "\n" + entry.body;
+}
+
+bool OfflineJournal::Deserialize(std::string_view data, JournalEntry& entry)
+{
+    std::string_view method, endpoint, user, createdAt, description;
+    if (!NextLine(data, method) || !NextLine(data, endpoint) || !NextLine(data, user) ||
+        !NextLine(data, createdAt) || !NextLine(data, description)) {
+        return false;
+    }
+    entry.method = std::string(method);
+    entry.endpoint = std::string(endpoint);
+    entry.user = std::string(user);
+    entry.createdAt = std::strtoll(std::string(createdAt).c_str(), nullptr, 10);
+    entry.description = std::string(description);
+    entry.body = std::string(data);
+    return true;
+}
+
+uint64_t OfflineJournal::Append(JournalEntry entry)
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (!store_.IsOpen()) return 0;
+
+    entry.sequence = nextSequence_;
+    if (!store_.Put(StoreKind::Journal, SequenceKey(entry.sequence), Serialize(entry)) || !store_.Flush()) {
+        return 0;
+    }
+    ++nextSequence_;
+    ++pendingByUser_[entry.user];
+    ++version_;
+    return entry.sequence;
+}
+
+std::vector<JournalEntry> OfflineJournal::Pending() const
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    std::vector<JournalEntry> entries;
+    store_.ForEach(StoreKind::Journal, [&](std::string_view key, std::string_view value) {
+        JournalEntry entry;
+        if (Deserialize(value, entry)) {
+            entry.sequence = std::strtoull(std::string(key).c_str(), nullptr, 16);
+            entries.push_back(std::move(entry));
+        }
+    });
+    std::sort(entries.begin(), entries.end(),
+              [](const JournalEntry& a, const JournalEntry& b) { return a.sequence < b.sequence; });
+    return entries;
+}
+
+size_t OfflineJournal::PendingCount(const std::string& user) const
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto it = pendingByUser_.find(user);
+    return it == pendingByUser_.end() ? 0 : it->second;
+}
+
+void OfflineJournal::ForgetPendingLocked(std::string_view value)
+{
+    JournalEntry entry;
+    if (!Deserialize(value, entry)) return;
+    auto it = pendingByUser_.find(entry.user);
+    if (it != pendingByUser_.end() && --it->second == 0) pendingByUser_.erase(it);
+}
+
+bool OfflineJournal::Complete(uint64_t sequence)
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto stored = store_.Get(StoreKind::Journal, SequenceKey(sequence));
+    if (!stored) return true;
+    bool ok = store_.Remove(StoreKind::Journal, SequenceKey(sequence)) && store_.Flush();
+    if (ok) {
+        ForgetPendingLocked(*stored);
+        ++version_;
+    }
+    if (store_.NeedsCompaction()) store_.CompactAsync();
+    return ok;
+}
+
+bool OfflineJournal::MarkConflict(const JournalEntry& entry, int statusCode, const std::string& message)
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    std::string key = SequenceKey(entry.sequence);
+    std::string value = std::to_string(statusCode) + "\n" + SingleLine(message) + "\n" + Serialize(entry);
+    if (!store_.Put(StoreKind::Meta, kConflictPrefix + key, value)) return false;
+    ++version_;
+    if (auto stored = store_.Get(StoreKind::Journal, key)) {
+        if (!store_.Remove(StoreKind::Journal, key)) return false;
+        ForgetPendingLocked(*stored);
+    }
+    return store_.Flush();
+}
+
+std::vector<SyncConflict> OfflineJournal::Conflicts() const
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    std::vector<SyncConflict> conflicts;
+    store_.ForEach(StoreKind::Meta, [&](std::string_view key, std::string_view value) {
+        if (key.substr(0, kConflictPrefix.size()) != kConflictPrefix) return;
+        SyncConflict conflict;
+        std::string_view status, message;
+        if (!NextLine(value, status) || !NextLine(value, message) || !Deserialize(value, conflict.entry)) return;
+        conflict.statusCode = std::atoi(std::string(status).c_str());
+        conflict.message = std::string(message);
+        conflict.entry.sequence = std::strtoull(std::string(key.substr(kConflictPrefix.size())).c_str(), nullptr, 16);
+        conflicts.push_back(std::move(conflict));
+    });
+    return conflicts;
+}
+
+void OfflineJournal::ClearConflicts()
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    std::vector<std::string> keys;
+    store_.ForEach(StoreKind::Meta, [&](std::string_view key, std::string_view) {
+        if (key.substr(0, kConflictPrefix.size()) == kConflictPrefix) keys.emplace_back(key);
+    });
+    for (const auto& key : keys) store_.Remove(StoreKind::Meta, key);
+    store_.Flush();
+    ++version_;
+}
+
+std::string OfflineJournal::DefaultPath()
+{
+    return AppDataPath(".text-extraction-journal");
+}
+
+} // namespace Services
@@ -0,0 +1,1562 @@
+#include "../../include/Services/PdfTextExtractor.h"
+#include "../../include/Services/MappedFile.h"
+#include "../../include/Services/Tracer.h"
+#include <zlib.h>
+#include <algorithm>
+#include <atomic>
+#include <cctype>
+#include <cmath>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <filesystem>
+#include <iostream>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <set>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+namespace {
+
+// ============================================================
+// PDF-Objektmodell
+// ============================================================
+
+struct PdfObject;
+using PdfArray = std::vector<PdfObject>;
+using PdfDict = std::vector<std::pair<std::string, PdfObject>>;
+
+struct PdfObject {
+    enum class Type { Null, Bool, Number, String, Name, Array, Dict, Ref, Stream, Keyword };
+
+    Type type = Type::Null;
+    bool boolean = false;
+    double number = 0.0;
+    std::string str;      // String-Bytes, Name (ohne '/') oder Keyword
+    int refNum = 0;
+    int refGen = 0;
+    std::shared_ptr<PdfArray> array;
+    std::shared_ptr<PdfDict> dict;   // auch Stream-Dictionary
+    const char* streamData = nullptr; // Rohdaten im Mapping (nur Stream)
+    size_t streamLength = 0;
+
+    bool Is(Type t) const { return type == t; }
+    bool IsName(const char* name) const { return type == Type::Name && str == name; }
+    int AsInt() const { return static_cast<int>(number); }
+
+    const PdfObject* Get(const std::string& key) const
+    {
+        if (!dict) return nullptr;
+        for (const auto& entry : *dict) {
+            if (entry.first == key) return &entry.second;
+        }
+        return nullptr;
+    }
+};
+
+bool IsWhitespace(char c)
+{
+    return c == ' ' || c == '\n' || c == '\r' || c == '\t' || c == '\f' || c == '\0';
+}
+
+bool IsDelimiter(char c)
+{
+    return c == '(' || c == ')' || c == '<' || c == '>' || c == '[' || c == ']' ||
+           c == '{' || c == '}' || c == '/' || c == '%';
+}
+
+int HexValue(char c)
+{
+    if (c >= '0' && c <= '9') return c - '0';
+    if (c >= 'a' && c <= 'f') return c - 'a' + 10;
+    if (c >= 'A' && c <= 'F') return c - 'A' + 10;
+    return -1;
+}
+
+// ============================================================
+// Lexer / Parser für PDF-Syntax (Objekte und Content-Streams)
+// ============================================================
+
+class PdfLexer {
+public:
+    PdfLexer(const char* begin, const char* end) : p_(begin), begin_(begin), end_(end) {}
+
+    bool AtEnd() { SkipWhitespace(); return p_ >= end_; }
+    size_t Position() const { return static_cast<size_t>(p_ - begin_); }
+    const char* Pointer() const { return p_; }
+    void Seek(const char* p) { p_ = std::min(std::max(p, begin_), end_); }
+
+    // Folgt an der aktuellen Position das Schlüsselwort? Prüft vorher, ob noch genug Bytes übrig sind
+    bool LookingAt(const char* keyword, size_t length) const
+    {
+        return static_cast<size_t>(end_ - p_) >= length && std::memcmp(p_, keyword, length) == 0;
+    }
+
+    void SkipWhitespace()
+    {
+        while (p_ < end_) {
+            if (IsWhitespace(*p_)) {
+                ++p_;
+            } else if (*p_ == '%') {
+                while (p_ < end_ && *p_ != '\n' && *p_ != '\r') ++p_;
+            } else {
+                break;
+            }
+        }
+    }
+
+    // Liest ein vollständiges Objekt; "n g R" wird zu einer Referenz zusammengefasst
+    PdfObject Next(int depth = 0)
+    {
+        PdfObject obj;
+        SkipWhitespace();
+        if (p_ >= end_ || depth > 64) return obj;
+
+        char c = *p_;
+        if (c == '/') {
+            obj.type = PdfObject::Type::Name;
+            obj.str = ReadName();
+        } else if (c == '(') {
+            obj.type = PdfObject::Type::String;
+            obj.str = ReadLiteralString();
+        } else if (c == '<' && p_ + 1 < end_ && p_[1] == '<') {
+            p_ += 2;
+            obj.type = PdfObject::Type::Dict;
+            obj.dict = std::make_shared<PdfDict>();
+            while (true) {
+                SkipWhitespace();
+                if (p_ >= end_) break;
+                if (*p_ == '>' && p_ + 1 < end_ && p_[1] == '>') { p_ += 2; break; }
+                PdfObject key = Next(depth + 1);
+                if (key.type != PdfObject::Type::Name) {
+                    // Defektes Dictionary: Token überspringen
+                    if (key.type == PdfObject::Type::Null && p_ < end_) ++p_;
+                    continue;
+                }
+                PdfObject value = Next(depth + 1);
+                obj.dict->emplace_back(std::move(key.str), std::move(value));
+            }
+        } else if (c == '<') {
+            obj.type = PdfObject::Type::String;
+            obj.str = ReadHexString();
+        } else if (c == '[') {
+            ++p_;
+            obj.type = PdfObject::Type::Array;
+            obj.array = std::make_shared<PdfArray>();
+            while (true) {
+                SkipWhitespace();
+                if (p_ >= end_) break;
+                if (*p_ == ']') { ++p_; break; }
+                const char* before = p_;
+                obj.array->push_back(Next(depth + 1));
+                if (p_ == before) ++p_; // Fortschritt erzwingen
+            }
+        } else if (c == '+' || c == '-' || c == '.' || (c >= '0' && c <= '9')) {
+            obj.type = PdfObject::Type::Number;
+            obj.number = ReadNumber();
+            // Referenz "num gen R"?
+            if (obj.number >= 0 && obj.number == std::floor(obj.number)) {
+                const char* save = p_;
+                SkipWhitespace();
+                if (p_ < end_ && std::isdigit(static_cast<unsigned char>(*p_))) {
+                    double gen = ReadNumber();
+                    SkipWhitespace();
+                    if (p_ < end_ && *p_ == 'R' && (p_ + 1 >= end_ || IsWhitespace(p_[1]) || IsDelimiter(p_[1]))) {
+                        ++p_;
+                        obj.type = PdfObject::Type::Ref;
+                        obj.refNum = static_cast<int>(obj.number);
+                        obj.refGen = static_cast<int>(gen);
+                        return obj;
+                    }
+                }
+                p_ = save;
+            }
+        } else if (c == ')' || c == '>' || c == ']' || c == '{' || c == '}') {
+            ++p_; // Unerwarteter Delimiter
+        } else {
+            std::string word = ReadKeyword();
+            if (word == "true" || word == "false") {
+                obj.type = PdfObject::Type::Bool;
+                obj.boolean = (word == "true");
+            } else if (word == "null") {
+                obj.type = PdfObject::Type::Null;
+            } else {
+                obj.type = PdfObject::Type::Keyword;
+                obj.str = std::move(word);
+            }
+        }
+        return obj;
+    }
+
+    // Überspringt Inline-Image-Daten nach BI ... ID bis EI
+    void SkipInlineImage()
+    {
+        while (p_ < end_) {
+            PdfObject token = Next();
+            if (token.type == PdfObject::Type::Keyword && token.str == "ID") break;
+            if (token.type == PdfObject::Type::Null && p_ >= end_) return;
+        }
+        if (p_ < end_) ++p_; // genau ein Whitespace nach ID
+        while (p_ + 1 < end_) {
+            if (p_[0] == 'E' && p_[1] == 'I' && IsWhitespace(p_[-1]) &&
+                (p_ + 2 >= end_ || IsWhitespace(p_[2]) || IsDelimiter(p_[2]))) {
+                p_ += 2;
+                return;
+            }
+            ++p_;
+        }
+        p_ = end_;
+    }
+
+private:
+    const char* p_;
+    const char* begin_;
+    const char* end_;
+
+    std::string ReadName()
+    {
+        ++p_; // '/'
+        std::string name;
+        while (p_ < end_ && !IsWhitespace(*p_) && !IsDelimiter(*p_)) {
+            if (*p_ == '#' && p_ + 2 < end_ && HexValue(p_[1]) >= 0 && HexValue(p_[2]) >= 0) {
+                name += static_cast<char>(HexValue(p_[1]) * 16 + HexValue(p_[2]));
+                p_ += 3;
+            } else {
+                name += *p_++;
+            }
+        }
+        return name;
+    }
+
+    std::string ReadKeyword()
+    {
+        std::string word;
+        while (p_ < end_ && !IsWhitespace(*p_) && !IsDelimiter(*p_)) {
+            word += *p_++;
+        }
+        if (word.empty() && p_ < end_) ++p_;
+        return word;
+    }
+
+    double ReadNumber()
+    {
+        const char* start = p_;
+        if (p_ < end_ && (*p_ == '+' || *p_ == '-')) ++p_;
+        while (p_ < end_ && (std::isdigit(static_cast<unsigned char>(*p_)) || *p_ == '.')) ++p_;
+        // Zahlen sind kurz; Kopie vermeidet Lesen über das Mapping-Ende hinaus
+        char buffer[64];
+        size_t len = std::min<size_t>(static_cast<size_t>(p_ - start), sizeof(buffer) - 1);
+        std::memcpy(buffer, start, len);
+        buffer[len] = '\0';
+        return std::strtod(buffer, nullptr);
+    }
+
+    std::string ReadLiteralString()
+    {
+        ++p_; // '('
+        std::string result;
+        int depth = 1;
+        while (p_ < end_) {
+            char c = *p_++;
+            if (c == '\\') {
+                if (p_ >= end_) break;
+                char e = *p_++;
+                switch (e) {
+                    case 'n': result += '\n'; break;
+                    case 'r': result += '\r'; break;
+                    case 't': result += '\t'; break;
+                    case 'b': result += '\b'; break;
+                    case 'f': result += '\f'; break;
+                    case '\r': if (p_ < end_ && *p_ == '\n') ++p_; break; // Zeilenfortsetzung
+                    case '\n': break;
+                    default:
+                        if (e >= '0' && e <= '7') {
+                            int value = e - '0';
+                            for (int i = 0; i < 2 && p_ < end_ && *p_ >= '0' && *p_ <= '7'; ++i) {
+                                value = value * 8 + (*p_++ - '0');
+                            }
+                            result += static_cast<char>(value & 0xFF);
+                        } else {
+                            result += e;
+                        }
+                }
+            } else if (c == '(') {
+                ++depth;
+                result += c;
+            } else if (c == ')') {
+                if (--depth == 0) break;
+                result += c;
+            } else {
+                result += c;
+            }
+        }
+        return result;
+    }
+
+    std::string ReadHexString()
+    {
+        ++p_; // '<'
+        std::string result;
+        int high = -1;
+        while (p_ < end_ && *p_ != '>') {
+            int v = HexValue(*p_++);
+            if (v < 0) continue;
+            if (high < 0) {
+                high = v;
+            } else {
+                result += static_cast<char>(high * 16 + v);
+                high = -1;
+            }
+        }
+        if (high >= 0) result += static_cast<char>(high * 16);
+        if (p_ < end_) ++p_; // '>'
+        return result;
+    }
+};
+
+// ============================================================
+// Stream-Filter
+// ============================================================
+
+// Obergrenze für einen dekodierten Stream: schützt vor Kompressionsbomben (wenige KB -> GB)
+constexpr size_t kMaxDecodedBytes = 64u << 20;
+
+// Verschachtelungstiefe beim Auflösen von Referenzen, die selbst wieder Objekte laden
+// (/Length, Filter, Objekt-Streams); zyklische Verweise enden hier statt im Stack-Überlauf
+constexpr int kMaxResolveDepth = 8;
+
+std::string FlateDecode(const char* data, size_t length)
+{
+    std::string out;
+    if (length == 0) return out;
+
+    z_stream zs;
+    std::memset(&zs, 0, sizeof(zs));
+    if (inflateInit(&zs) != Z_OK) return out;
+
+    zs.next_in = reinterpret_cast<Bytef*>(const_cast<char*>(data));
+    zs.avail_in = static_cast<uInt>(length);
+
+    out.resize(std::min(std::max<size_t>(length * 4, 4096), kMaxDecodedBytes));
+    size_t written = 0;
+    int ret = Z_OK;
+    while (ret == Z_OK) {
+        if (written == out.size()) {
+            if (out.size() >= kMaxDecodedBytes) break; // Rest verwerfen, der Anfang bleibt lesbar
+            out.resize(std::min(out.size() * 2, kMaxDecodedBytes));
+        }
+        zs.next_out = reinterpret_cast<Bytef*>(&out[written]);
+        zs.avail_out = static_cast<uInt>(out.size() - written);
+        ret = inflate(&zs, Z_NO_FLUSH);
+        written = out.size() - zs.avail_out;
+        if (ret == Z_BUF_ERROR && zs.avail_in == 0) break; // abgeschnittener Stream
+    }
+    // Bei defekten Streams bleibt der bis dahin dekodierte Teil erhalten
+    inflateEnd(&zs);
+    out.resize(written);
+    return out;
+}
+
+std::string AsciiHexDecode(const std::string& in)
+{
+    std::string out;
+    int high = -1;
+    for (char c : in) {
+        if (c == '>') break;
+        int v = HexValue(c);
+        if (v < 0) continue;
+        if (high < 0) { high = v; } else { out += static_cast<char>(high * 16 + v); high = -1; }
+    }
+    if (high >= 0) out += static_cast<char>(high * 16);
+    return out;
+}
+
+std::string Ascii85Decode(const std::string& in)
+{
+    std::string out;
+    uint32_t tuple = 0;
+    int count = 0;
+    for (size_t i = 0; i < in.size(); ++i) {
+        char c = in[i];
+        if (c == '~') break;
+        if (IsWhitespace(c)) continue;
+        if (c == 'z' && count == 0) { out.append(4, '\0'); continue; }
+        if (c < '!' || c > 'u') continue;
+        tuple = tuple * 85 + static_cast<uint32_t>(c - '!');
+        if (++count == 5) {
+            for (int s = 24; s >= 0; s -= 8) out += static_cast<char>((tuple >> s) & 0xFF);
+            tuple = 0;
+            count = 0;
+        }
+    }
+    if (count > 1) {
+        for (int i = count; i < 5; ++i) tuple = tuple * 85 + 84;
+        for (int i = 0; i < count - 1; ++i) out += static_cast<char>((tuple >> (24 - 8 * i)) & 0xFF);
+    }
+    return out;
+}
+
+// PNG-Prädiktoren (Predictor >= 10), häufig bei xref-Streams
+std::string ApplyPredictor(const std::string& in, const PdfObject* params)
+{
+    if (!params || !params->Is(PdfObject::Type::Dict)) return in;
+    const PdfObject* predictor = params->Get("Predictor");
+    if (!predictor || predictor->AsInt() < 10) return in;
+
+    const PdfObject* colorsObj = params->Get("Colors");
+    const PdfObject* bpcObj = params->Get("BitsPerComponent");
+    const PdfObject* columnsObj = params->Get("Columns");
+    int colors = colorsObj ? std::max(1, colorsObj->AsInt()) : 1;
+    int bpc = bpcObj ? std::max(1, bpcObj->AsInt()) : 8;
+    int columns = columnsObj ? std::max(1, columnsObj->AsInt()) : 1;
+
+    size_t bpp = std::max<size_t>(1, static_cast<size_t>(colors * bpc) / 8);
+    size_t rowLength = (static_cast<size_t>(columns) * colors * bpc + 7) / 8;
+
+    std::string out;
+    out.reserve(in.size());
+    std::vector<unsigned char> prev(rowLength, 0), row(rowLength);
+    size_t pos = 0;
+    while (pos + 1 + rowLength <= in.size()) {
+        int filter = static_cast<unsigned char>(in[pos++]);
+        for (size_t i = 0; i < rowLength; ++i) {
+            unsigned char raw = static_cast<unsigned char>(in[pos + i]);
+            unsigned char left = i >= bpp ? row[i - bpp] : 0;
+            unsigned char up = prev[i];
+            unsigned char upLeft = i >= bpp ? prev[i - bpp] : 0;
+            switch (filter) {
+                case 1: row[i] = raw + left; break;
+                case 2: row[i] = raw + up; break;
+                case 3: row[i] = raw + static_cast<unsigned char>((left + up) / 2); break;
+                case 4: {
+                    int p = left + up - upLeft;
+                    int pa = std::abs(p - left), pb = std::abs(p - up), pc = std::abs(p - upLeft);
+                    unsigned char pred = (pa <= pb && pa <= pc) ? left : (pb <= pc ? up : upLeft);
+                    row[i] = raw + pred;
+                    break;
+                }
+                default: row[i] = raw; break;
+            }
+        }
+        out.append(reinterpret_cast<const char*>(row.data()), rowLength);
+        prev.swap(row);
+        pos += rowLength;
+    }
+    return out;
+}
+
+// ============================================================
+// UTF-8 / UTF-16 Hilfsfunktionen
+// ============================================================
+
+void AppendUtf8(std::string& out, uint32_t cp)
+{
+    if (cp < 0x80) {
+        out += static_cast<char>(cp);
+    } else if (cp < 0x800) {
+        out += static_cast<char>(0xC0 | (cp >> 6));
+        out += static_cast<char>(0x80 | (cp & 0x3F));
+    } else if (cp < 0x10000) {
+        out += static_cast<char>(0xE0 | (cp >> 12));
+        out += static_cast<char>(0x80 | ((cp >> 6) & 0x3F));
+        out += static_cast<char>(0x80 | (cp & 0x3F));
+    } else if (cp <= 0x10FFFF) {
+        out += static_cast<char>(0xF0 | (cp >> 18));
+        out += static_cast<char>(0x80 | ((cp >> 12) & 0x3F));
+        out += static_cast<char>(0x80 | ((cp >> 6) & 0x3F));
+        out += static_cast<char>(0x80 | (cp & 0x3F));
+    }
+}
+
+std::string Utf16BeToUtf8(const std::string& bytes)
+{
+    std::string out;
+    for (size_t i = 0; i + 1 < bytes.size(); i += 2) {
+        uint32_t unit = (static_cast<unsigned char>(bytes[i]) << 8) | static_cast<unsigned char>(bytes[i + 1]);
+        if (unit >= 0xD800 && unit <= 0xDBFF && i + 3 < bytes.size()) {
+            uint32_t low = (static_cast<unsigned char>(bytes[i + 2]) << 8) | static_cast<unsigned char>(bytes[i + 3]);
+            if (low >= 0xDC00 && low <= 0xDFFF) {
+                AppendUtf8(out, 0x10000 + ((unit - 0xD800) << 10) + (low - 0xDC00));
+                i += 2;
+                continue;
+            }
+        }
+        if (unit != 0) AppendUtf8(out, unit);
+    }
+    return out;
+}
+
+// WinAnsiEncoding 0x80-0x9F (Rest entspricht Latin-1)
+const uint16_t kWinAnsiHigh[32] = {
+    0x20AC, 0x0000, 0x201A, 0x0192, 0x201E, 0x2026, 0x2020, 0x2021,
+    0x02C6, 0x2030, 0x0160, 0x2039, 0x0152, 0x0000, 0x017D, 0x0000,
+    0x0000, 0x2018, 0x2019, 0x201C, 0x201D, 0x2022, 0x2013, 0x2014,
+    0x02DC, 0x2122, 0x0161, 0x203A, 0x0153, 0x0000, 0x017E, 0x0178
+};
+
+// MacRomanEncoding 0x80-0xFF
+const uint16_t kMacRomanHigh[128] = {
+    0x00C4, 0x00C5, 0x00C7, 0x00C9, 0x00D1, 0x00D6, 0x00DC, 0x00E1, 0x00E0, 0x00E2, 0x00E4, 0x00E3, 0x00E5, 0x00E7, 0x00E9, 0x00E8,
+    0x00EA, 0x00EB, 0x00ED, 0x00EC, 0x00EE, 0x00EF, 0x00F1, 0x00F3, 0x00F2, 0x00F4, 0x00F6, 0x00F5, 0x00FA, 0x00F9, 0x00FB, 0x00FC,
+    0x2020, 0x00B0, 0x00A2, 0x00A3, 0x00A7, 0x2022, 0x00B6, 0x00DF, 0x00AE, 0x00A9, 0x2122, 0x00B4, 0x00A8, 0x2260, 0x00C6, 0x00D8,
+    0x221E, 0x00B1, 0x2264, 0x2265, 0x00A5, 0x00B5, 0x2202, 0x2211, 0x220F, 0x03C0, 0x222B, 0x00AA, 0x00BA, 0x03A9, 0x00E6, 0x00F8,
+    0x00BF, 0x00A1, 0x00AC, 0x221A, 0x0192, 0x2248, 0x2206, 0x00AB, 0x00BB, 0x2026, 0x00A0, 0x00C0, 0x00C3, 0x00D5, 0x0152, 0x0153,
+    0x2013, 0x2014, 0x201C, 0x201D, 0x2018, 0x2019, 0x00F7, 0x25CA, 0x00FF, 0x0178, 0x2044, 0x20AC, 0x2039, 0x203A, 0xFB01, 0xFB02,
+    0x2021, 0x00B7, 0x201A, 0x201E, 0x2030, 0x00C2, 0x00CA, 0x00C1, 0x00CB, 0x00C8, 0x00CD, 0x00CE, 0x00CF, 0x00CC, 0x00D3, 0x00D4,
+    0xF8FF, 0x00D2, 0x00DA, 0x00DB, 0x00D9, 0x0131, 0x02C6, 0x02DC, 0x00AF, 0x02D8, 0x02D9, 0x02DA, 0x00B8, 0x02DD, 0x02DB, 0x02C7
+};
+
+// Häufige Glyphennamen aus /Differences (Adobe Glyph List, Auszug)
+uint32_t GlyphNameToUnicode(const std::string& name)
+{
+    if (name.size() == 1) return static_cast<unsigned char>(name[0]);
+    if (name.size() == 7 && name.compare(0, 3, "uni") == 0) {
+        return static_cast<uint32_t>(std::strtoul(name.c_str() + 3, nullptr, 16));
+    }
+    if (name.size() >= 5 && name.size() <= 7 && name[0] == 'u') {
+        char* endPtr = nullptr;
+        unsigned long value = std::strtoul(name.c_str() + 1, &endPtr, 16);
+        if (endPtr && *endPtr == '\0') return static_cast<uint32_t>(value);
+    }
+
+    static const std::unordered_map<std::string, uint32_t> names = {
+        {"space", 0x20}, {"exclam", 0x21}, {"quotedbl", 0x22}, {"numbersign", 0x23}, {"dollar", 0x24},
+        {"percent", 0x25}, {"ampersand", 0x26}, {"quotesingle", 0x27}, {"quoteright", 0x2019},
+        {"parenleft", 0x28}, {"parenright", 0x29}, {"asterisk", 0x2A}, {"plus", 0x2B}, {"comma", 0x2C},
+        {"hyphen", 0x2D}, {"minus", 0x2212}, {"period", 0x2E}, {"slash", 0x2F}, {"zero", 0x30},
+        {"one", 0x31}, {"two", 0x32}, {"three", 0x33}, {"four", 0x34}, {"five", 0x35}, {"six", 0x36},
+        {"seven", 0x37}, {"eight", 0x38}, {"nine", 0x39}, {"colon", 0x3A}, {"semicolon", 0x3B},
+        {"less", 0x3C}, {"equal", 0x3D}, {"greater", 0x3E}, {"question", 0x3F}, {"at", 0x40},
+        {"bracketleft", 0x5B}, {"backslash", 0x5C}, {"bracketright", 0x5D}, {"asciicircum", 0x5E},
+        {"underscore", 0x5F}, {"grave", 0x60}, {"quoteleft", 0x2018}, {"braceleft", 0x7B}, {"bar", 0x7C},
+        {"braceright", 0x7D}, {"asciitilde", 0x7E}, {"bullet", 0x2022}, {"endash", 0x2013},
+        {"emdash", 0x2014}, {"ellipsis", 0x2026}, {"quotedblleft", 0x201C}, {"quotedblright", 0x201D},
+        {"quotedblbase", 0x201E}, {"quotesinglbase", 0x201A}, {"guillemotleft", 0xAB},
+        {"guillemotright", 0xBB}, {"section", 0xA7}, {"degree", 0xB0}, {"copyright", 0xA9},
+        {"registered", 0xAE}, {"trademark", 0x2122}, {"Euro", 0x20AC}, {"germandbls", 0xDF},
+        {"Adieresis", 0xC4}, {"Odieresis", 0xD6}, {"Udieresis", 0xDC}, {"adieresis", 0xE4},
+        {"odieresis", 0xF6}, {"udieresis", 0xFC}, {"eacute", 0xE9}, {"egrave", 0xE8},
+        {"ecircumflex", 0xEA}, {"edieresis", 0xEB}, {"Eacute", 0xC9}, {"aacute", 0xE1},
+        {"agrave", 0xE0}, {"acircumflex", 0xE2}, {"ccedilla", 0xE7}, {"Ccedilla", 0xC7},
+        {"iacute", 0xED}, {"oacute", 0xF3}, {"uacute", 0xFA}, {"ntilde", 0xF1}, {"oslash", 0xF8},
+        {"aring", 0xE5}, {"ae", 0xE6}, {"fi", 0xFB01}, {"fl", 0xFB02}, {"ff", 0xFB00},
+        {"ffi", 0xFB03}, {"ffl", 0xFB04}, {"dagger", 0x2020}, {"daggerdbl", 0x2021},
+        {"periodcentered", 0xB7}, {"nbspace", 0xA0}, {"sfthyphen", 0xAD}, {"multiply", 0xD7},
+        {"divide", 0xF7}, {"plusminus", 0xB1}, {"mu", 0xB5}, {"paragraph", 0xB6}
+    };
+    auto it = names.find(name);
+    return it != names.end() ? it->second : 0;
+}
+
+// ============================================================
+// Fonts: ToUnicode-CMap bzw. einfache Kodierung
+// ============================================================
+
+struct CodeSpace {
+    uint32_t low;
+    uint32_t high;
+    int bytes;
+};
+
+struct FontMap {
+    bool isType0 = false;
+    std::vector<CodeSpace> codeSpaces;
+    std::unordered_map<uint32_t, std::string> toUnicode; // Code -> UTF-8
+    uint32_t simpleEncoding[256];
+
+    FontMap()
+    {
+        for (int i = 0; i < 256; ++i) {
+            simpleEncoding[i] = (i >= 0x80 && i < 0xA0) ? kWinAnsiHigh[i - 0x80] : static_cast<uint32_t>(i);
+        }
+    }
+
+    // Dekodiert einen Text-String (Tj-Operand) nach UTF-8
+    void Decode(const std::string& bytes, std::string& out) const
+    {
+        size_t i = 0;
+        while (i < bytes.size()) {
+            int length = CodeLength(bytes, i);
+            uint32_t code = 0;
+            for (int k = 0; k < length; ++k) {
+                code = (code << 8) | static_cast<unsigned char>(bytes[i + k]);
+            }
+            i += length;
+
+            auto it = toUnicode.find(code);
+            if (it != toUnicode.end()) {
+                out += it->second;
+            } else if (!isType0 && code < 256) {
+                uint32_t cp = simpleEncoding[code];
+                if (cp >= 0x20 || cp == '\t') AppendUtf8(out, cp);
+            }
+            // Type0 ohne ToUnicode-Eintrag: CID ist nicht abbildbar
+        }
+    }
+
+    int CodeLength(const std::string& bytes, size_t pos) const
+    {
+        size_t remaining = bytes.size() - pos;
+        if (!codeSpaces.empty()) {
+            for (int length = 1; length <= 4 && static_cast<size_t>(length) <= remaining; ++length) {
+                uint32_t code = 0;
+                for (int k = 0; k < length; ++k) {
+                    code = (code << 8) | static_cast<unsigned char>(bytes[pos + k]);
+                }
+                for (const auto& space : codeSpaces) {
+                    if (space.bytes == length && code >= space.low && code <= space.high) return length;
+                }
+            }
+        }
+        int fallback = isType0 ? 2 : 1;
+        return static_cast<int>(std::min<size_t>(static_cast<size_t>(fallback), remaining));
+    }
+};
+
+uint32_t BytesToCode(const std::string& bytes)
+{
+    uint32_t code = 0;
+    for (size_t i = 0; i < bytes.size() && i < 4; ++i) {
+        code = (code << 8) | static_cast<unsigned char>(bytes[i]);
+    }
+    return code;
+}
+
+void ParseToUnicodeCMap(const std::string& cmap, FontMap& font)
+{
+    PdfLexer lexer(cmap.data(), cmap.data() + cmap.size());
+    std::vector<PdfObject> operands;
+
+    while (!lexer.AtEnd()) {
+        PdfObject token = lexer.Next();
+        if (token.type != PdfObject::Type::Keyword) {
+            operands.push_back(std::move(token));
+            continue;
+        }
+
+        if (token.str == "begincodespacerange") {
+            while (!lexer.AtEnd()) {
+                PdfObject low = lexer.Next();
+                if (low.type == PdfObject::Type::Keyword) break;
+                PdfObject high = lexer.Next();
+                if (low.type == PdfObject::Type::String && high.type == PdfObject::Type::String && !low.str.empty()) {
+                    font.codeSpaces.push_back({BytesToCode(low.str), BytesToCode(high.str),
+                                               static_cast<int>(std::min<size_t>(low.str.size(), 4))});
+                }
+            }
+        } else if (token.str == "beginbfchar") {
+            while (!lexer.AtEnd()) {
+                PdfObject src = lexer.Next();
+                if (src.type == PdfObject::Type::Keyword) break;
+                PdfObject dst = lexer.Next();
+                if (src.type != PdfObject::Type::String) continue;
+                if (dst.type == PdfObject::Type::String) {
+                    font.toUnicode[BytesToCode(src.str)] = Utf16BeToUtf8(dst.str);
+                } else if (dst.type == PdfObject::Type::Name) {
+                    std::string utf8;
+                    AppendUtf8(utf8, GlyphNameToUnicode(dst.str));
+                    font.toUnicode[BytesToCode(src.str)] = utf8;
+                }
+            }
+        } else if (token.str == "beginbfrange") {
+            while (!lexer.AtEnd()) {
+                PdfObject low = lexer.Next();
+                if (low.type == PdfObject::Type::Keyword) break;
+                PdfObject high = lexer.Next();
+                PdfObject dst = lexer.Next();
+                if (low.type != PdfObject::Type::String || high.type != PdfObject::Type::String) continue;
+
+                uint32_t first = BytesToCode(low.str);
+                uint32_t last = BytesToCode(high.str);
+                if (last < first || last - first > 0xFFFF) continue; // Schutz vor defekten CMaps
+
+                if (dst.type == PdfObject::Type::String && dst.str.size() >= 2) {
+                    std::string target = dst.str;
+                    for (uint32_t code = first; code <= last; ++code) {
+                        font.toUnicode[code] = Utf16BeToUtf8(target);
+                        // Letzte UTF-16-Einheit inkrementieren
+                        size_t n = target.size();
+                        uint32_t unit = (static_cast<unsigned char>(target[n - 2]) << 8) | static_cast<unsigned char>(target[n - 1]);
+                        ++unit;
+                        target[n - 2] = static_cast<char>((unit >> 8) & 0xFF);
+                        target[n - 1] = static_cast<char>(unit & 0xFF);
+                    }
+                } else if (dst.type == PdfObject::Type::Array && dst.array) {
+                    uint32_t code = first;
+                    for (const auto& item : *dst.array) {
+                        if (code > last) break;
+                        if (item.type == PdfObject::Type::String) {
+                            font.toUnicode[code] = Utf16BeToUtf8(item.str);
+                        }
+                        ++code;
+                    }
+                }
+            }
+        }
+        operands.clear();
+    }
+}
+
+// ============================================================
+// PDF-Dokument: xref, Objekte, Streams, Seitenbaum
+// ============================================================
+
+struct PageInfo {
+    PdfObject page;
+    PdfObject resources;
+};
+
+class PdfDocument {
+public:
+    bool Load(const char* data, size_t size)
+    {
+        data_ = data;
+        size_ = size;
+
+        size_t startXref = FindStartXref();
+        if (startXref != std::string::npos) {
+            std::set<size_t> visited;
+            ParseXrefChain(startXref, visited);
+        }
+
+        if (!trailer_.Get("Root")) {
+            // Defekte oder fehlende xref-Tabelle: Objekte per Scan rekonstruieren
+            RebuildXrefByScanning();
+        }
+        return trailer_.Get("Root") != nullptr;
+    }
+
+    // depth: wie viele Objekte gerade ineinander geladen werden (siehe kMaxResolveDepth)
+    PdfObject Resolve(const PdfObject& obj, int depth = 0) const
+    {
+        PdfObject current = obj;
+        for (int hops = 0; hops < 16 && current.type == PdfObject::Type::Ref; ++hops) {
+            current = GetObject(current.refNum, depth);
+        }
+        return current;
+    }
+
+    PdfObject ResolveKey(const PdfObject& dict, const char* key, int depth = 0) const
+    {
+        const PdfObject* value = dict.Get(key);
+        return value ? Resolve(*value, depth) : PdfObject();
+    }
+
+    PdfObject GetObject(int num, int depth = 0) const
+    {
+        if (num <= 0 || static_cast<size_t>(num) >= xref_.size() || depth > kMaxResolveDepth) return PdfObject();
+        const XrefEntry& entry = xref_[num];
+        if (entry.type == 1) {
+            return ParseIndirectObjectAt(entry.offset, depth);
+        }
+        if (entry.type == 2) {
+            return GetCompressedObject(entry.container, entry.index, num, depth);
+        }
+        return PdfObject();
+    }
+
+    std::string DecodeStream(const PdfObject& stream, int depth = 0) const
+    {
+        if (stream.type != PdfObject::Type::Stream || !stream.streamData) return std::string();
+
+        PdfObject filter = ResolveKey(stream, "Filter", depth + 1);
+        PdfObject params = ResolveKey(stream, "DecodeParms", depth + 1);
+
+        std::vector<std::string> filters;
+        std::vector<PdfObject> filterParams;
+        if (filter.type == PdfObject::Type::Name) {
+            filters.push_back(filter.str);
+            filterParams.push_back(params);
+        } else if (filter.type == PdfObject::Type::Array && filter.array) {
+            for (size_t i = 0; i < filter.array->size(); ++i) {
+                filters.push_back((*filter.array)[i].str);
+                if (params.type == PdfObject::Type::Array && params.array && i < params.array->size()) {
+                    filterParams.push_back(Resolve((*params.array)[i], depth + 1));
+                } else {
+                    filterParams.push_back(PdfObject());
+                }
+            }
+        }
+
+        std::string data(stream.streamData, stream.streamLength);
+        for (size_t i = 0; i < filters.size(); ++i) {
+            const std::string& name = filters[i];
+            if (name == "FlateDecode" || name == "Fl") {
+                data = ApplyPredictor(FlateDecode(data.data(), data.size()), &filterParams[i]);
+            } else if (name == "ASCIIHexDecode" || name == "AHx") {
+                data = AsciiHexDecode(data);
+            } else if (name == "ASCII85Decode" || name == "A85") {
+                data = Ascii85Decode(data);
+            } else {
+                // Bildfilter (DCT, JBIG2, CCITT) und LZW enthalten keine lesbare Textebene
+                return std::string();
+            }
+        }
+        return data;
+    }
+
+    std::vector<PageInfo> CollectPages(int maxPages, int& totalPages) const
+    {
+        std::vector<PageInfo> pages;
+        totalPages = 0;
+
+        PdfObject root = ResolveKey(trailer_, "Root");
+        PdfObject pagesNode = ResolveKey(root, "Pages");
+        const PdfObject* count = pagesNode.Get("Count");
+        if (count && count->type == PdfObject::Type::Number) totalPages = count->AsInt();
+
+        struct Pending { PdfObject node; PdfObject resources; };
+        std::vector<Pending> stack;
+        stack.push_back({pagesNode, PdfObject()});
+        std::set<int> visited;
+
+        while (!stack.empty()) {
+            Pending current = std::move(stack.back());
+            stack.pop_back();
+
+            PdfObject resources = ResolveKey(current.node, "Resources");
+            if (resources.type != PdfObject::Type::Dict) resources = current.resources;
+
+            PdfObject kids = ResolveKey(current.node, "Kids");
+            const PdfObject* type = current.node.Get("Type");
+            bool isPage = (type && type->IsName("Page")) || (kids.type != PdfObject::Type::Array && current.node.Get("Contents"));
+
+            if (isPage) {
+                pages.push_back({current.node, resources});
+                if (maxPages > 0 && static_cast<int>(pages.size()) >= maxPages) break; // Early-Exit
+                continue;
+            }
+
+            if (kids.type == PdfObject::Type::Array && kids.array) {
+                // Rückwärts auf den Stack, damit die Seitenreihenfolge erhalten bleibt
+                for (auto it = kids.array->rbegin(); it != kids.array->rend(); ++it) {
+                    if (it->type == PdfObject::Type::Ref) {
+                        if (!visited.insert(it->refNum).second) continue; // Zyklus
+                    }
+                    PdfObject kid = Resolve(*it);
+                    if (kid.type == PdfObject::Type::Dict) stack.push_back({kid, resources});
+                }
+            }
+        }
+
+        if (totalPages < static_cast<int>(pages.size())) totalPages = static_cast<int>(pages.size());
+        return pages;
+    }
+
+private:
+    struct XrefEntry {
+        uint8_t type = 0;    // 0 = frei, 1 = Offset, 2 = in Objekt-Stream
+        size_t offset = 0;
+        int container = 0;   // Objekt-Stream-Nummer (type 2)
+        int index = 0;       // Index im Objekt-Stream (type 2)
+        bool set = false;
+    };
+
+    struct ObjectStream {
+        std::string data;
+        std::vector<std::pair<int, size_t>> offsets; // (Objektnummer, Offset)
+    };
+
+    const char* data_ = nullptr;
+    size_t size_ = 0;
+    std::vector<XrefEntry> xref_;
+    PdfObject trailer_;
+
+    mutable std::mutex objectStreamMutex_;
+    mutable std::unordered_map<int, std::shared_ptr<const ObjectStream>> objectStreams_;
+
+    void SetEntry(int num, const XrefEntry& entry)
+    {
+        if (num < 0 || num > 10000000) return;
+        if (static_cast<size_t>(num) >= xref_.size()) xref_.resize(num + 1);
+        // Neuere Abschnitte werden zuerst gelesen und haben Vorrang
+        if (!xref_[num].set) {
+            xref_[num] = entry;
+            xref_[num].set = true;
+        }
+    }
+
+    void MergeTrailer(const PdfObject& dict)
+    {
+        if (dict.type != PdfObject::Type::Dict && dict.type != PdfObject::Type::Stream) return;
+        if (!trailer_.dict) {
+            trailer_.type = PdfObject::Type::Dict;
+            trailer_.dict = std::make_shared<PdfDict>();
+        }
+        for (const auto& entry : *dict.dict) {
+            if (!trailer_.Get(entry.first)) trailer_.dict->push_back(entry);
+        }
+    }
+
+    size_t FindStartXref() const
+    {
+        size_t searchFrom = size_ > 2048 ? size_ - 2048 : 0;
+        std::string_view tail(data_ + searchFrom, size_ - searchFrom);
+        size_t pos = tail.rfind("startxref");
+        if (pos == std::string_view::npos) return std::string::npos;
+
+        PdfLexer lexer(tail.data() + pos + 9, tail.data() + tail.size());
+        PdfObject offset = lexer.Next();
+        if (offset.type != PdfObject::Type::Number || offset.number < 0 || offset.number >= size_) {
+            return std::string::npos;
+        }
+        return static_cast<size_t>(offset.number);
+    }
+
+    void ParseXrefChain(size_t offset, std::set<size_t>& visited)
+    {
+        while (offset < size_ && visited.insert(offset).second) {
+            PdfLexer lexer(data_ + offset, data_ + size_);
+            lexer.SkipWhitespace();
+            PdfObject prev;
+
+            if (lexer.LookingAt("xref", 4)) {
+                lexer.Seek(lexer.Pointer() + 4);
+                PdfObject dict = ParseXrefTable(lexer);
+                MergeTrailer(dict);
+                // Hybrid-Dateien: zusätzlicher xref-Stream
+                const PdfObject* xrefStm = dict.Get("XRefStm");
+                if (xrefStm && xrefStm->type == PdfObject::Type::Number) {
+                    ParseXrefStream(static_cast<size_t>(xrefStm->number));
+                }
+                if (const PdfObject* p = dict.Get("Prev")) prev = *p;
+            } else {
+                PdfObject stream = ParseXrefStream(offset);
+                if (stream.type != PdfObject::Type::Stream) return;
+                MergeTrailer(stream);
+                if (const PdfObject* p = stream.Get("Prev")) prev = *p;
+            }
+
+            if (prev.type != PdfObject::Type::Number) return;
+            offset = static_cast<size_t>(prev.number);
+        }
+    }
+
+    PdfObject ParseXrefTable(PdfLexer& lexer)
+    {
+        while (!lexer.AtEnd()) {
+            PdfObject first = lexer.Next();
+            if (first.type == PdfObject::Type::Keyword && first.str == "trailer") {
+                return lexer.Next();
+            }
+            PdfObject count = lexer.Next();
+            if (first.type != PdfObject::Type::Number || count.type != PdfObject::Type::Number) break;
+
+            int start = first.AsInt();
+            int n = count.AsInt();
+            for (int i = 0; i < n; ++i) {
+                PdfObject off = lexer.Next();
+                PdfObject gen = lexer.Next();
+                PdfObject kind = lexer.Next();
+                if (off.type != PdfObject::Type::Number || kind.type != PdfObject::Type::Keyword) break;
+                XrefEntry entry;
+                entry.type = (kind.str == "n") ? 1 : 0;
+                entry.offset = static_cast<size_t>(off.number);
+                SetEntry(start + i, entry);
+                (void)gen;
+            }
+        }
+        return PdfObject();
+    }
+
+    PdfObject ParseXrefStream(size_t offset)
+    {
+        PdfObject stream = ParseIndirectObjectAt(offset);
+        const PdfObject* type = stream.Get("Type");
+        if (stream.type != PdfObject::Type::Stream || !type || !type->IsName("XRef")) return PdfObject();
+
+        const PdfObject* w = stream.Get("W");
+        if (!w || w->type != PdfObject::Type::Array || !w->array || w->array->size() < 3) return PdfObject();
+        int widths[3] = {(*w->array)[0].AsInt(), (*w->array)[1].AsInt(), (*w->array)[2].AsInt()};
+        int rowSize = widths[0] + widths[1] + widths[2];
+        if (rowSize <= 0) return PdfObject();
+
+        std::vector<std::pair<int, int>> sections;
+        const PdfObject* index = stream.Get("Index");
+        if (index && index->type == PdfObject::Type::Array && index->array) {
+            for (size_t i = 0; i + 1 < index->array->size(); i += 2) {
+                sections.push_back({(*index->array)[i].AsInt(), (*index->array)[i + 1].AsInt()});
+            }
+        } else {
+            const PdfObject* sizeObj = stream.Get("Size");
+            sections.push_back({0, sizeObj ? sizeObj->AsInt() : 0});
+        }
+
+        std::string data = DecodeStream(stream);
+        size_t pos = 0;
+        auto readField = [&](int width, uint64_t defaultValue) -> uint64_t {
+            if (width == 0) return defaultValue;
+            uint64_t value = 0;
+            for (int k = 0; k < width; ++k) value = (value << 8) | static_cast<unsigned char>(data[pos++]);
+            return value;
+        };
+
+        for (const auto& section : sections) {
+            for (int i = 0; i < section.second; ++i) {
+                if (pos + rowSize > data.size()) return stream;
+                XrefEntry entry;
+                entry.type = static_cast<uint8_t>(readField(widths[0], 1));
+                uint64_t f2 = readField(widths[1], 0);
+                uint64_t f3 = readField(widths[2], 0);
+                if (entry.type == 1) {
+                    entry.offset = static_cast<size_t>(f2);
+                } else if (entry.type == 2) {
+                    entry.container = static_cast<int>(f2);
+                    entry.index = static_cast<int>(f3);
+                }
+                SetEntry(section.first + i, entry);
+            }
+        }
+        return stream;
+    }
+
+    void RebuildXrefByScanning()
+    {
+        xref_.clear();
+        std::string_view file(data_, size_);
+        size_t pos = 0;
+        while ((pos = file.find("obj", pos)) != std::string_view::npos) {
+            // Rückwärts "num gen " vor "obj" suchen
+            size_t p = pos;
+            while (p > 0 && IsWhitespace(file[p - 1])) --p;
+            size_t genEnd = p;
+            while (p > 0 && std::isdigit(static_cast<unsigned char>(file[p - 1]))) --p;
+            size_t genStart = p;
+            while (p > 0 && IsWhitespace(file[p - 1])) --p;
+            size_t numEnd = p;
+            while (p > 0 && std::isdigit(static_cast<unsigned char>(file[p - 1]))) --p;
+            if (genStart < genEnd && p < numEnd && numEnd < genStart) {
+                int num = std::atoi(std::string(file.substr(p, numEnd - p)).c_str());
+                if (num > 0 && num < 10000000) {
+                    if (static_cast<size_t>(num) >= xref_.size()) xref_.resize(num + 1);
+                    // Spätere Definitionen (inkrementelle Updates) überschreiben frühere
+                    xref_[num].type = 1;
+                    xref_[num].offset = p;
+                    xref_[num].set = true;
+                }
+            }
+            pos += 3;
+        }
+
+        size_t trailerPos = file.rfind("trailer");
+        if (trailerPos != std::string_view::npos) {
+            PdfLexer lexer(data_ + trailerPos + 7, data_ + size_);
+            MergeTrailer(lexer.Next());
+        }
+        if (!trailer_.Get("Root")) {
+            // Katalog direkt suchen
+            for (size_t num = 1; num < xref_.size(); ++num) {
+                if (xref_[num].type != 1) continue;
+                PdfObject obj = ParseIndirectObjectAt(xref_[num].offset);
+                const PdfObject* type = obj.Get("Type");
+                if (type && type->IsName("Catalog")) {
+                    PdfObject ref;
+                    ref.type = PdfObject::Type::Ref;
+                    ref.refNum = static_cast<int>(num);
+                    if (!trailer_.dict) {
+                        trailer_.type = PdfObject::Type::Dict;
+                        trailer_.dict = std::make_shared<PdfDict>();
+                    }
+                    trailer_.dict->emplace_back("Root", ref);
+                    break;
+                }
+            }
+        }
+    }
+
+    PdfObject ParseIndirectObjectAt(size_t offset, int depth = 0) const
+    {
+        if (offset >= size_) return PdfObject();
+        PdfLexer lexer(data_ + offset, data_ + size_);
+        PdfObject num = lexer.Next();
+        PdfObject gen = lexer.Next();
+        PdfObject keyword = lexer.Next();
+        if (num.type != PdfObject::Type::Number || keyword.type != PdfObject::Type::Keyword || keyword.str != "obj") {
+            return PdfObject();
+        }
+        (void)gen;
+
+        PdfObject obj = lexer.Next();
+        if (obj.type != PdfObject::Type::Dict) return obj;
+
+        const char* afterDict = lexer.Pointer();
+        lexer.SkipWhitespace();
+        if (!lexer.LookingAt("stream", 6)) {
+            lexer.Seek(afterDict);
+            return obj;
+        }
+
+        const char* p = lexer.Pointer() + 6;
+        const char* end = data_ + size_;
+        if (p < end && *p == '\r') ++p;
+        if (p < end && *p == '\n') ++p;
+
+        size_t length = 0;
+        bool lengthValid = false;
+        const PdfObject* lengthObj = obj.Get("Length");
+        if (lengthObj) {
+            PdfObject resolved = *lengthObj;
+            // Zyklen (auch über mehrere Objekte) brechen an der Tiefengrenze ab: Länge ungültig, endstream-Suche
+            if (resolved.type == PdfObject::Type::Ref && resolved.refNum != num.AsInt()) {
+                resolved = Resolve(resolved, depth + 1);
+            }
+            if (resolved.type == PdfObject::Type::Number && resolved.number >= 0 &&
+                p + static_cast<size_t>(resolved.number) <= end) {
+                length = static_cast<size_t>(resolved.number);
+                // Prüfen ob danach wirklich "endstream" folgt
+                const char* q = p + length;
+                while (q < end && IsWhitespace(*q)) ++q;
+                lengthValid = (end - q >= 9 && std::strncmp(q, "endstream", 9) == 0);
+            }
+        }
+        if (!lengthValid) {
+            std::string_view rest(p, static_cast<size_t>(end - p));
+            size_t endPos = rest.find("endstream");
+            if (endPos == std::string_view::npos) endPos = rest.size();
+            length = endPos;
+            while (length > 0 && (p[length - 1] == '\n' || p[length - 1] == '\r')) --length;
+        }
+
+        obj.type = PdfObject::Type::Stream;
+        obj.streamData = p;
+        obj.streamLength = length;
+        return obj;
+    }
+
+    PdfObject GetCompressedObject(int container, int index, int num, int depth = 0) const
+    {
+        std::shared_ptr<const ObjectStream> objStream;
+        {
+            std::lock_guard<std::mutex> lock(objectStreamMutex_);
+            auto it = objectStreams_.find(container);
+            if (it != objectStreams_.end()) objStream = it->second;
+        }
+
+        if (!objStream) {
+            if (container <= 0 || static_cast<size_t>(container) >= xref_.size() || xref_[container].type != 1) {
+                return PdfObject();
+            }
+            PdfObject stream = ParseIndirectObjectAt(xref_[container].offset, depth + 1);
+            if (stream.type != PdfObject::Type::Stream) return PdfObject();
+
+            auto loaded = std::make_shared<ObjectStream>();
+            loaded->data = DecodeStream(stream, depth + 1);
+            const PdfObject* nObj = stream.Get("N");
+            const PdfObject* firstObj = stream.Get("First");
+            int n = nObj ? nObj->AsInt() : 0;
+            size_t first = firstObj ? static_cast<size_t>(firstObj->number) : 0;
+
+            PdfLexer header(loaded->data.data(), loaded->data.data() + loaded->data.size());
+            for (int i = 0; i < n; ++i) {
+                PdfObject objNum = header.Next();
+                PdfObject objOffset = header.Next();
+                if (objNum.type != PdfObject::Type::Number || objOffset.type != PdfObject::Type::Number) break;
+                loaded->offsets.push_back({objNum.AsInt(), first + static_cast<size_t>(objOffset.number)});
+            }
+
+            std::lock_guard<std::mutex> lock(objectStreamMutex_);
+            objStream = objectStreams_.emplace(container, loaded).first->second;
+        }
+
+        size_t offset = std::string::npos;
+        if (index >= 0 && static_cast<size_t>(index) < objStream->offsets.size() &&
+            objStream->offsets[index].first == num) {
+            offset = objStream->offsets[index].second;
+        } else {
+            for (const auto& entry : objStream->offsets) {
+                if (entry.first == num) { offset = entry.second; break; }
+            }
+        }
+        if (offset == std::string::npos || offset >= objStream->data.size()) return PdfObject();
+
+        PdfLexer lexer(objStream->data.data() + offset, objStream->data.data() + objStream->data.size());
+        return lexer.Next();
+    }
+};
+
+// ============================================================
+// Content-Stream-Auswertung (Textoperatoren)
+// ============================================================
+
+class FontCache {
+public:
+    explicit FontCache(const PdfDocument& doc) : doc_(doc) {}
+
+    std::shared_ptr<const FontMap> Get(const PdfObject& resources, const std::string& name)
+    {
+        PdfObject fonts = doc_.ResolveKey(resources, "Font");
+        const PdfObject* fontEntry = fonts.Get(name);
+        if (!fontEntry) return nullptr;
+
+        int key = fontEntry->type == PdfObject::Type::Ref ? fontEntry->refNum : 0;
+        if (key > 0) {
+            std::lock_guard<std::mutex> lock(mutex_);
+            auto it = cache_.find(key);
+            if (it != cache_.end()) return it->second;
+        }
+
+        auto font = Build(doc_.Resolve(*fontEntry));
+        if (key > 0) {
+            std::lock_guard<std::mutex> lock(mutex_);
+            cache_[key] = font;
+        }
+        return font;
+    }
+
+private:
+    const PdfDocument& doc_;
+    std::mutex mutex_;
+    std::unordered_map<int, std::shared_ptr<const FontMap>> cache_;
+
+    std::shared_ptr<const FontMap> Build(const PdfObject& fontDict) const
+    {
+        auto font = std::make_shared<FontMap>();
+        const PdfObject* subtype = fontDict.Get("Subtype");
+        font->isType0 = subtype && subtype->IsName("Type0");
+
+        PdfObject encoding = doc_.ResolveKey(fontDict, "Encoding");
+        if (!font->isType0) {
+            PdfObject baseEncoding = encoding;
+            if (encoding.type == PdfObject::Type::Dict) baseEncoding = doc_.ResolveKey(encoding, "BaseEncoding");
+            if (baseEncoding.IsName("MacRomanEncoding")) {
+                for (int i = 0x80; i < 0x100; ++i) font->simpleEncoding[i] = kMacRomanHigh[i - 0x80];
+            }
+
+            PdfObject differences = doc_.ResolveKey(encoding, "Differences");
+            if (differences.type == PdfObject::Type::Array && differences.array) {
+                int code = 0;
+                for (const auto& item : *differences.array) {
+                    if (item.type == PdfObject::Type::Number) {
+                        code = item.AsInt();
+                    } else if (item.type == PdfObject::Type::Name) {
+                        if (code >= 0 && code < 256) {
+                            uint32_t cp = GlyphNameToUnicode(item.str);
+                            if (cp) font->simpleEncoding[code] = cp;
+                        }
+                        ++code;
+                    }
+                }
+            }
+        }
+
+        PdfObject toUnicode = doc_.ResolveKey(fontDict, "ToUnicode");
+        if (toUnicode.type == PdfObject::Type::Stream) {
+            ParseToUnicodeCMap(doc_.DecodeStream(toUnicode), *font);
+        }
+        return font;
+    }
+};
+
+class TextCollector {
+public:
+    static constexpr int kMaxFormDepth = 8;
+
+    TextCollector(const PdfDocument& doc, FontCache& fonts) : doc_(doc), fonts_(fonts) {}
+
+    void Run(const std::string& content, const PdfObject& resources, std::string& out, int depth = 0)
+    {
+        if (depth > kMaxFormDepth) return; // Verschachtelte Form-XObjects begrenzen
+
+        PdfLexer lexer(content.data(), content.data() + content.size());
+        std::vector<PdfObject> operands;
+        std::shared_ptr<const FontMap> font;
+        double lastLineY = 0.0;
+        bool hasLineY = false;
+
+        while (!lexer.AtEnd()) {
+            PdfObject token = lexer.Next();
+            if (token.type != PdfObject::Type::Keyword) {
+                if (operands.size() < 64) operands.push_back(std::move(token));
+                continue;
+            }
+
+            const std::string& op = token.str;
+            if (op == "Tf" && operands.size() >= 2 && operands[operands.size() - 2].type == PdfObject::Type::Name) {
+                font = fonts_.Get(resources, operands[operands.size() - 2].str);
+            } else if (op == "Tj" && !operands.empty()) {
+                Show(operands.back(), font, out);
+            } else if ((op == "'" || op == "\"") && !operands.empty()) {
+                NewLine(out);
+                Show(operands.back(), font, out);
+            } else if (op == "TJ" && !operands.empty() && operands.back().type == PdfObject::Type::Array) {
+                for (const auto& item : *operands.back().array) {
+                    if (item.type == PdfObject::Type::String) {
+                        Show(item, font, out);
+                    } else if (item.type == PdfObject::Type::Number && item.number < -180.0) {
+                        // Großer Abstand im TJ-Array entspricht einem Wortzwischenraum
+                        Space(out);
+                    }
+                }
+            } else if ((op == "Td" || op == "TD") && operands.size() >= 2) {
+                double tx = operands[operands.size() - 2].number;
+                double ty = operands.back().number;
+                if (std::fabs(ty) > 0.1) {
+                    NewLine(out);
+                } else if (tx > 1.0) {
+                    Space(out);
+                }
+            } else if (op == "Tm" && operands.size() >= 6) {
+                double y = operands.back().number;
+                if (hasLineY && std::fabs(y - lastLineY) > 0.1) {
+                    NewLine(out);
+                } else if (hasLineY) {
+                    Space(out);
+                }
+                lastLineY = y;
+                hasLineY = true;
+            } else if (op == "T*") {
+                NewLine(out);
+            } else if (op == "ET") {
+                Space(out);
+            } else if (op == "Do" && !operands.empty() && operands.back().type == PdfObject::Type::Name) {
+                RunXObject(resources, operands.back().str, out, depth);
+            } else if (op == "BI") {
+                lexer.SkipInlineImage();
+            }
+            operands.clear();
+        }
+    }
+
+private:
+    const PdfDocument& doc_;
+    FontCache& fonts_;
+    std::set<int> expandedForms_;  // Objektnummern der auf dieser Seite bereits ausgeführten Forms
+
+    void Show(const PdfObject& str, const std::shared_ptr<const FontMap>& font, std::string& out)
+    {
+        if (str.type != PdfObject::Type::String) return;
+        if (font) {
+            font->Decode(str.str, out);
+        } else {
+            static const FontMap defaultFont;
+            defaultFont.Decode(str.str, out);
+        }
+    }
+
+    static void NewLine(std::string& out)
+    {
+        while (!out.empty() && out.back() == ' ') out.pop_back();
+        if (!out.empty() && out.back() != '\n') out += '\n';
+    }
+
+    static void Space(std::string& out)
+    {
+        if (!out.empty() && out.back() != ' ' && out.back() != '\n') out += ' ';
+    }
+
+    void RunXObject(const PdfObject& resources, const std::string& name, std::string& out, int depth)
+    {
+        PdfObject xobjects = doc_.ResolveKey(resources, "XObject");
+        const PdfObject* entry = xobjects.Get(name);
+        if (!entry) return;
+
+        // Jede Form nur einmal pro Seite: sich selbst aufrufende oder gegenseitig verzweigende
+        // Forms kosten sonst exponentiell viel Arbeit
+        if (depth + 1 > kMaxFormDepth) return;
+        if (entry->type == PdfObject::Type::Ref && !expandedForms_.insert(entry->refNum).second) return;
+
+        PdfObject xobject = doc_.Resolve(*entry);
+        const PdfObject* subtype = xobject.Get("Subtype");
+        if (xobject.type != PdfObject::Type::Stream || !subtype || !subtype->IsName("Form")) return;
+
+        PdfObject formResources = doc_.ResolveKey(xobject, "Resources");
+        Run(doc_.DecodeStream(xobject), formResources.type == PdfObject::Type::Dict ? formResources : resources,
+            out, depth + 1);
+    }
+};
+
+std::string ExtractPageText(const PdfDocument& doc, FontCache& fonts, const PageInfo& page)
+{
+    std::string content;
+    PdfObject contents = doc.ResolveKey(page.page, "Contents");
+    if (contents.type == PdfObject::Type::Stream) {
+        content = doc.DecodeStream(contents);
+    } else if (contents.type == PdfObject::Type::Array && contents.array) {
+        for (const auto& part : *contents.array) {
+            content += doc.DecodeStream(doc.Resolve(part));
+            content += '\n';
+        }
+    }
+
+    std::string text;
+    TextCollector collector(doc, fonts);
+    collector.Run(content, page.resources, text);
+
+    while (!text.empty() && (text.back() == ' ' || text.back() == '\n')) text.pop_back();
+    return text;
+}
+
+size_t CountNonWhitespace(const std::string& text)
+{
+    size_t count = 0;
+    for (char c : text) {
+        if (!std::isspace(static_cast<unsigned char>(c))) ++count;
+    }
+    return count;
+}
+
+bool EndsWithIgnoreCase(const std::string& value, const std::string& suffix)
+{
+    if (suffix.size() > value.size()) return false;
+    for (size_t i = 0; i < suffix.size(); ++i) {
+        char a = static_cast<char>(std::tolower(static_cast<unsigned char>(value[value.size() - suffix.size() + i])));
+        if (a != suffix[i]) return false;
+    }
+    return true;
+}
+
+// Unterhalb dieser Zeichenzahl pro Seite gilt ein Dokument als gescannt
+// (Seitenzahlen oder Kopfzeilen eines Scans ergeben keine brauchbare Textebene)
+const size_t kMinCharsPerPage = 20;
+
+} // namespace
+
+namespace Services {
+
+PdfTextExtractor::PdfTextExtractor(unsigned int workerCount)
+    : workerCount_(workerCount)
+{
+    if (workerCount_ == 0) {
+        workerCount_ = std::max(1u, std::thread::hardware_concurrency());
+    }
+}
+
+bool PdfTextExtractor::CanHandle(const std::string& path) const
+{
+    return EndsWithIgnoreCase(path, ".pdf");
+}
+
+// Geparstes Dokument samt Mapping; die Objekte zeigen direkt in die gemappten Bytes
+struct PdfTextExtractor::ParsedDocument {
+    MappedFile file;
+    PdfDocument doc;
+    std::filesystem::file_time_type modified;
+};
+
+std::shared_ptr<PdfTextExtractor::ParsedDocument> PdfTextExtractor::Parse(const std::string& path, std::string& error)
+{
+    std::error_code ec;
+    auto modified = std::filesystem::last_write_time(path, ec);
+    {
+        // Der Schnelltest hat die Datei eben schon geparst: xref und Objekt-Streams wiederverwenden
+        std::lock_guard<std::mutex> lock(probeMutex_);
+        if (probed_ && probedPath_ == path && !ec && probed_->modified == modified) {
+            auto parsed = std::move(probed_);
+            probedPath_.clear();
+            return parsed;
+        }
+    }
+
+    TraceSpan span("extract", "PDF parsen");
+    auto parsed = std::make_shared<ParsedDocument>();
+    parsed->modified = modified;
+    if (!parsed->file.Open(path)) {
+        error = "Datei konnte nicht geöffnet werden: " + path;
+        return nullptr;
+    }
+    if (parsed->file.Size() < 8 || std::strncmp(parsed->file.Data(), "%PDF", 4) != 0) {
+        error = "Keine PDF-Datei: " + path;
+        return nullptr;
+    }
+    if (!parsed->doc.Load(parsed->file.Data(), parsed->file.Size())) {
+        error = "PDF-Struktur (xref/Trailer) nicht lesbar";
+        return nullptr;
+    }
+    return parsed;
+}
+
+Core::ExtractionResult PdfTextExtractor::Extract(const std::string& path, const Core::ExtractionOptions& options)
+{
+    TraceSpan span("extract", "PDF lokal");
+    Core::ExtractionResult result;
+    result.method = "LocalPdfTextLayer";
+
+    std::shared_ptr<ParsedDocument> parsed = Parse(path, result.error);
+    if (!parsed) return result;
+    ExtractPages(*parsed, options, result);
+
+    span.SetDetail(std::to_string(result.pagesExtracted) + " Seiten, " + std::to_string(result.text.size()) + " Bytes");
+    std::cout << "PDF lokal extrahiert: " << path << " (" << result.pagesExtracted << "/" << result.pageCount
+              << " Seiten, " << result.text.size() << " Bytes)" << std::endl;
+    return result;
+}
+
+void PdfTextExtractor::ExtractPages(const ParsedDocument& parsed, const Core::ExtractionOptions& options,
+                                    Core::ExtractionResult& result)
+{
+    const PdfDocument& doc = parsed.doc;
+    int totalPages = 0;
+    std::vector<PageInfo> pages = doc.CollectPages(options.maxPages, totalPages);
+    result.pageCount = totalPages;
+    if (pages.empty()) {
+        result.error = "Keine Seiten gefunden";
+        return;
+    }
+
+    // Seiten parallel extrahieren; Fonts werden dokumentweit geteilt
+    std::vector<std::string> pageTexts(pages.size());
+    FontCache fonts(doc);
+    std::atomic<size_t> nextPage{0};
+
+    auto worker = [&]() {
+        size_t index;
+        while ((index = nextPage.fetch_add(1)) < pages.size()) {
+            TraceSpan pageSpan("extract", "Seite ", std::to_string(index + 1));
+            pageTexts[index] = ExtractPageText(doc, fonts, pages[index]);
+        }
+    };
+
+    unsigned int threadCount = std::min<unsigned int>(workerCount_, static_cast<unsigned int>(pages.size()));
+    std::vector<std::thread> threads;
+    for (unsigned int i = 1; i < threadCount; ++i) {
+        threads.emplace_back([&worker]() {
+            if (Tracer::IsEnabled()) Tracer::SetThreadName("PDF-Worker");
+            worker();
+        });
+    }
+    worker();
+    for (auto& t : threads) t.join();
+
+    size_t totalLength = 0;
+    size_t visibleChars = 0;
+    for (const auto& text : pageTexts) {
+        totalLength += text.size() + 2;
+        visibleChars += CountNonWhitespace(text);
+    }
+
+    result.text.reserve(totalLength);
+    for (size_t i = 0; i < pageTexts.size(); ++i) {
+        if (i > 0) result.text += "\n\n";
+        result.text += pageTexts[i];
+    }
+
+    result.pagesExtracted = static_cast<int>(pages.size());
+    result.hasTextLayer = visibleChars >= kMinCharsPerPage * pages.size();
+    result.success = result.hasTextLayer;
+    if (!result.hasTextLayer) {
+        result.error = "Keine Textebene gefunden (gescanntes Dokument) - Server-OCR erforderlich";
+    }
+}
+
+bool PdfTextExtractor::HasTextLayer(const std::string& path, int probePages)
+{
+    TraceSpan span("extract", "PDF Textebene prüfen");
+    Core::ExtractionResult result;
+    std::shared_ptr<ParsedDocument> parsed = Parse(path, result.error);
+    if (!parsed) return false;
+
+    Core::ExtractionOptions options;
+    options.maxPages = probePages;
+    ExtractPages(*parsed, options, result);
+
+    // Für das Extract direkt danach aufheben (nur das zuletzt geprüfte Dokument)
+    std::lock_guard<std::mutex> lock(probeMutex_);
+    probed_ = std::move(parsed);
+    probedPath_ = path;
+    return result.hasTextLayer;
+}
+
+} // namespace Services
@@ -0,0 +1,79 @@
+#include "../../include/Services/RemoteExtractor.h"
+#include "../../include/Services/ApiService.h"
+#include "../../include/Services/JsonUtil.h"
+#include "../../include/Services/Tracer.h"
+#include <cstdlib>
+#include <iostream>
+
+namespace Services {
+
+std::string RemoteExtractor::BuildOptionsJson(const Core::ExtractionOptions& options)
+{
+    std::string json = "{";
+    json += "\"enableOCR\":" + std::string(options.enableOCR ? "true" : "false");
+    json += ",\"language\":\"" + EscapeJson(options.language) + "\"";
+    json += ",\"maxPages\":" + std::to_string(options.maxPages);
+    json += ",\"preserveFormatting\":" + std::string(options.preserveFormatting ? "true" : "false");
+    json += ",\"enableLanguageModel\":false";
+    json += ",\"maxSummaryLength\":0";
+    json += "}";
+    return json;
+}
+
+Core::ExtractionResult RemoteExtractor::Extract(const std::string& fileId, const Core::ExtractionOptions& options)
+{
+    TraceSpan span("extract", "Server-Extraktion ", fileId);
+    Core::ExtractionResult result;
+
+    HttpResponse resp = ApiService::Post("Extraction/" + fileId, BuildOptionsJson(options));
+    if (resp.statusCode == 0) {
+        result.backendUnreachable = true;
+        result.error = "Server nicht erreichbar: " + resp.body;
+        return result;
+    }
+    result.statusCode = resp.statusCode;
+    if (!resp.isSuccess) {
+        result.error = "Fehler bei Extraktion: Status " + std::to_string(resp.statusCode);
+        return result;
+    }
+
+    TraceSpan decodeSpan("json", "Extraktion dekodieren");
+    decodeSpan.SetDetail(std::to_string(resp.body.size()) + " Bytes");
+    result.text = ReadJsonValue(resp.body, "extractedText");
+    if (result.text.empty()) {
+        // Kein Text ist ein Fehler, sonst landet der rohe Antwort-Body als "Text" im Ergebnis
+        result.error = "Server-Antwort ohne extrahierten Text";
+        return result;
+    }
+    result.method = ExtractJsonField(resp.body, "extractionMethod");
+    if (result.method.empty()) result.method = "Server";
+
+    std::string pages = ExtractJsonField(resp.body, "pageCount");
+    if (!pages.empty()) {
+        result.pageCount = std::atoi(pages.c_str());
+        result.pagesExtracted = result.pageCount;
+    }
+    result.hasTextLayer = true;
+    result.success = true;
+    return result;
+}
+
+int RemoteExtractor::QueueDepth()
+{
+    HttpResponse resp = ApiService::Get("Extraction/stats");
+    if (!resp.isSuccess) return -1;
+
+    // Feldnamen sind im Swagger nicht spezifiziert, daher tolerant auswerten
+    static const char* queueFields[] = {"queueLength", "queued", "pending", "inProgress", "processing", "running"};
+    int depth = 0;
+    bool found = false;
+    for (const char* field : queueFields) {
+        std::string value = ExtractJsonField(resp.body, field);
+        if (value.empty()) continue;
+        depth += std::atoi(value.c_str());
+        found = true;
+    }
+    return found ? depth : -1;
+}
+
+} // namespace Services
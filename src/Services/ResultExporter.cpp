@@ -0,0 +1,410 @@
+#include "../../include/Services/ResultExporter.h"
+#include "../../include/Services/ApiService.h"
+#include "../../include/Services/BoundedQueue.h"
+#include "../../include/Services/ColumnarFile.h"
+#include "../../include/Services/JsonUtil.h"
+#include "../../include/Services/Tracer.h"
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <filesystem>
+#include <iostream>
+#include <memory>
+#include <thread>
+#include <unordered_set>
+#include <vector>
+
+namespace Services {
+
+namespace {
+
+constexpr size_t kJsonlBufferBytes = 1u << 20;
+constexpr int kFetchAttempts = 3;
+// Höchstens so viele Durchläufe durch Admin/extractions, bis die Liste zu totalCount passt
+constexpr int kListPasses = 3;
+
+const std::vector<std::string> kColumns = {
+    "extractionId", "documentId", "fileName", "method", "status", "completedAt", "uploadedBy", "error", "text"};
+
+struct PendingRecord {
+    ExportRecord record;
+    bool needsText = false;
+};
+
+// Zerlegt einen JSON-Strom in die Objekte des ersten Arrays, ohne die ganze Antwort zu puffern
+// Funktioniert für ein nacktes Array ebenso wie für {"items":[...], ...}
+class ObjectSplitter {
+public:
+    // onObject gibt false zurück um abzubrechen
+    bool Feed(const char* data, size_t size, const std::function<bool(std::string&)>& onObject)
+    {
+        size_t i = 0;
+        while (i < size) {
+            char c = data[i];
+            if (inString_) {
+                if (escape_) {
+                    escape_ = false;
+                } else if (c == '\\') {
+                    escape_ = true;
+                } else if (c == '"') {
+                    inString_ = false;
+                } else {
+                    // Stringinhalt (z.B. der extrahierte Text) am Stück übernehmen
+                    size_t run = i + 1;
+                    while (run < size && data[run] != '"' && data[run] != '\\') ++run;
+                    if (capturing_) current_.append(data + i, run - i);
+                    i = run;
+                    continue;
+                }
+                if (capturing_) current_ += c;
+                ++i;
+                continue;
+            }
+
+            if (c == '"') {
+                inString_ = true;
+            } else if (c == '[' || c == '{') {
+                if (c == '[' && arrayDepth_ < 0) arrayDepth_ = depth_ + 1;
+                if (c == '{' && depth_ == arrayDepth_ && !capturing_) {
+                    capturing_ = true;
+                    current_.clear();
+                }
+                ++depth_;
+            } else if (c == ']' || c == '}') {
+                --depth_;
+                if (capturing_ && c == '}' && depth_ == arrayDepth_) {
+                    current_ += c;
+                    capturing_ = false;
+                    if (!onObject(current_)) return false;
+                    ++i;
+                    continue;
+                }
+            }
+            if (capturing_) current_ += c;
+            ++i;
+        }
+        return true;
+    }
+
+private:
+    int depth_ = 0;
+    int arrayDepth_ = -1;
+    bool inString_ = false;
+    bool escape_ = false;
+    bool capturing_ = false;
+    std::string current_;
+};
+
+std::string FirstOf(const std::string& obj, std::initializer_list<const char*> keys)
+{
+    for (const char* key : keys) {
+        std::string value = ReadJsonValue(obj, key);
+        if (!value.empty()) return value;
+    }
+    return "";
+}
+
+bool HasField(const std::string& obj, const char* key)
+{
+    return obj.find("\"" + std::string(key) + "\":") != std::string::npos;
+}
+
+// GET mit Wiederholung bei Verbindungs- oder Serverfehlern
+HttpResponse GetWithRetry(const std::string& endpoint)
+{
+    HttpResponse resp;
+    for (int attempt = 0; attempt < kFetchAttempts; ++attempt) {
+        if (attempt > 0) std::this_thread::sleep_for(std::chrono::milliseconds(250 * attempt));
+        resp = ApiService::Get(endpoint);
+        if (resp.statusCode != 0 && resp.statusCode < 500) break;
+    }
+    return resp;
+}
+
+// Lädt den Text einer Extraktion nach; über die extractionId, denn Extraction/result/{documentId}
+// liefert nur die neueste Extraktion eines Dokuments
+void FetchText(ExportRecord& record)
+{
+    std::string endpoint = !record.extractionId.empty() ? "Admin/extractions/" + record.extractionId
+                                                        : "Extraction/result/" + record.documentId;
+    HttpResponse resp = GetWithRetry(endpoint);
+    if (!resp.isSuccess) {
+        record.error = resp.statusCode == 0 ? "Server nicht erreichbar" : "Status " + std::to_string(resp.statusCode);
+        return;
+    }
+
+    TraceSpan span("json", "Ergebnis dekodieren");
+    span.SetDetail(std::to_string(resp.body.size()) + " Bytes");
+    ExportRecord detail = ResultExporter::ParseRecord(resp.body);
+    record.text = std::move(detail.text);
+    if (record.method.empty()) record.method = detail.method;
+    if (record.status.empty()) record.status = detail.status;
+    if (record.completedAt.empty()) record.completedAt = detail.completedAt;
+    if (record.fileName.empty()) record.fileName = detail.fileName;
+    if (record.documentId.empty()) record.documentId = detail.documentId;
+}
+
+std::string PartPath(const std::string& path)
+{
+    return path + ".part";
+}
+
+bool Publish(const std::string& path)
+{
+    std::error_code ec;
+    std::filesystem::rename(PartPath(path), path, ec);
+    return !ec;
+}
+
+} // namespace
+
+ResultExporter::ResultExporter(ExportOptions options)
+    : options_(std::move(options))
+{
+    if (options_.pageSize <= 0) options_.pageSize = 100;
+    if (options_.jobs <= 0) options_.jobs = 1;
+}
+
+ExportRecord ResultExporter::ParseRecord(const std::string& obj)
+{
+    ExportRecord record;
+    record.extractionId = FirstOf(obj, {"extractionId", "id"});
+    record.documentId = FirstOf(obj, {"documentId", "fileId"});
+    record.fileName = FirstOf(obj, {"fileName", "originalFileName"});
+    record.method = FirstOf(obj, {"extractionMethod", "method"});
+    record.status = ReadJsonValue(obj, "status");
+    record.completedAt = ReadJsonValue(obj, "completedAt");
+    record.uploadedBy = ReadJsonValue(obj, "uploadedBy");
+    record.text = ReadJsonValue(obj, "extractedText");
+    return record;
+}
+
+std::string ResultExporter::ToJsonLine(const ExportRecord& record)
+{
+    std::string line;
+    line.reserve(record.text.size() + record.fileName.size() + 192);
+    line += "{\"extractionId\":\"" + EscapeJson(record.extractionId) + "\"";
+    line += ",\"documentId\":\"" + EscapeJson(record.documentId) + "\"";
+    line += ",\"fileName\":\"" + EscapeJson(record.fileName) + "\"";
+    line += ",\"extractionMethod\":\"" + EscapeJson(record.method) + "\"";
+    line += ",\"status\":\"" + EscapeJson(record.status) + "\"";
+    line += ",\"completedAt\":\"" + EscapeJson(record.completedAt) + "\"";
+    line += ",\"uploadedBy\":\"" + EscapeJson(record.uploadedBy) + "\"";
+    if (!record.error.empty()) line += ",\"error\":\"" + EscapeJson(record.error) + "\"";
+    line += ",\"extractedText\":\"";
+    line += EscapeJson(record.text);
+    line += "\"}";
+    return line;
+}
+
+bool ResultExporter::Run(const std::function<void(const ExportProgress&)>& onProgress, std::string& error)
+{
+    cancelled_ = false;
+    error.clear();
+    if (options_.jsonlPath.empty() && options_.columnarPath.empty()) {
+        error = "Kein Ziel angegeben";
+        return false;
+    }
+
+    // .part-Dateien eines gescheiterten Exports nicht liegen lassen
+    auto removeParts = [this] {
+        std::error_code ec;
+        if (!options_.jsonlPath.empty()) std::filesystem::remove(PartPath(options_.jsonlPath), ec);
+        if (!options_.columnarPath.empty()) std::filesystem::remove(PartPath(options_.columnarPath), ec);
+    };
+
+    // Ausgaben öffnen; der setvbuf-Puffer muss die Datei überleben, wird also vor ihr angelegt
+    std::vector<char> jsonlBuffer;
+    std::unique_ptr<std::FILE, int (*)(std::FILE*)> jsonl(nullptr, &std::fclose);
+    if (!options_.jsonlPath.empty()) {
+        jsonl.reset(std::fopen(PartPath(options_.jsonlPath).c_str(), "wb"));
+        if (!jsonl) {
+            error = "Datei kann nicht angelegt werden: " + options_.jsonlPath;
+            return false;
+        }
+        jsonlBuffer.resize(kJsonlBufferBytes);
+        std::setvbuf(jsonl.get(), jsonlBuffer.data(), _IOFBF, jsonlBuffer.size());
+    }
+    ColumnarWriter columnar;
+    if (!options_.columnarPath.empty() && !columnar.Open(PartPath(options_.columnarPath), kColumns)) {
+        error = columnar.LastError();
+        jsonl.reset();
+        removeParts();
+        return false;
+    }
+
+    BoundedQueue<PendingRecord> pending(options_.queueCapacity);
+    BoundedQueue<ExportRecord> ready(options_.queueCapacity);
+    std::string listError;
+    std::atomic<size_t> listed{0};
+
+    // Listen: Seiten bzw. Stream in Einzelobjekte zerlegen
+    std::thread lister([&] {
+        if (Tracer::IsEnabled()) Tracer::SetThreadName("Export-Lister");
+        auto push = [&](std::string& obj) {
+            if (cancelled_) return false;
+            PendingRecord item;
+            item.record = ParseRecord(obj);
+            item.needsText = !HasField(obj, "extractedText");
+            if (item.record.extractionId.empty() && item.record.documentId.empty()) return true;
+            ++listed;
+            return pending.Push(std::move(item));
+        };
+
+        if (options_.source == ExportSource::Results) {
+            ObjectSplitter splitter;
+            HttpResponse resp = ApiService::GetStream("Extraction/results", [&](const char* data, size_t size) {
+                return splitter.Feed(data, size, push);
+            });
+            if (!resp.isSuccess && !cancelled_) {
+                listError = "Extraction/results: " + (resp.statusCode == 0 ? resp.body : "Status " + std::to_string(resp.statusCode));
+            }
+        } else {
+            // Erst die Liste (ohne Texte) vollständig einsammeln, dann nachladen: kommen während des
+            // Blätterns Extraktionen hinzu oder fallen weg, verschieben sich die Seitengrenzen und Zeilen
+            // kämen doppelt oder gar nicht. Doppelte fallen über die Id heraus; passt ein Durchlauf nicht
+            // zu totalCount, ergänzt ein weiterer Durchlauf die übersprungenen Zeilen.
+            std::vector<PendingRecord> snapshot;
+            std::unordered_set<std::string> seen;
+            for (int pass = 0; pass < kListPasses && !cancelled_ && listError.empty(); ++pass) {
+                std::unordered_set<std::string> passIds;
+                long long firstTotal = -1;
+                long long lastTotal = -1;
+                std::string previousFirst;
+                for (int page = 1; !cancelled_; ++page) {
+                    HttpResponse resp = GetWithRetry("Admin/extractions?pageSize=" + std::to_string(options_.pageSize) +
+                                                     "&page=" + std::to_string(page));
+                    if (!resp.isSuccess) {
+                        listError = "Admin/extractions Seite " + std::to_string(page) + ": " +
+                                    (resp.statusCode == 0 ? resp.body : "Status " + std::to_string(resp.statusCode));
+                        break;
+                    }
+
+                    std::vector<std::string> objects;
+                    ObjectSplitter splitter;
+                    splitter.Feed(resp.body.data(), resp.body.size(), [&objects](std::string& obj) {
+                        objects.push_back(obj);
+                        return true;
+                    });
+                    std::string total = ReadJsonValue(resp.body, "totalCount");
+                    if (!total.empty()) {
+                        lastTotal = std::atoll(total.c_str());
+                        if (firstTotal < 0) firstTotal = lastTotal;
+                    }
+                    // Ein Server ohne Paging liefert immer dieselbe Liste
+                    std::string first = objects.empty() ? "" : ReadJsonValue(objects.front(), "id");
+                    if (objects.empty() || (page > 1 && first == previousFirst)) break;
+                    previousFirst = first;
+
+                    for (auto& obj : objects) {
+                        PendingRecord item;
+                        item.record = ParseRecord(obj);
+                        item.needsText = !HasField(obj, "extractedText");
+                        if (item.record.extractionId.empty() && item.record.documentId.empty()) continue;
+                        std::string key = !item.record.extractionId.empty() ? item.record.extractionId
+                                                                            : "document:" + item.record.documentId;
+                        passIds.insert(key);
+                        if (!seen.insert(key).second) continue;
+                        ++listed;
+                        snapshot.push_back(std::move(item));
+                    }
+                    if (objects.size() < static_cast<size_t>(options_.pageSize)) break;
+                }
+                // Ohne totalCount lässt sich nichts prüfen; sonst muss der Durchlauf genau die Gesamtzahl gesehen haben
+                if (firstTotal < 0 || (firstTotal == lastTotal && passIds.size() == static_cast<size_t>(lastTotal))) break;
+            }
+            for (auto& item : snapshot) {
+                if (cancelled_ || !pending.Push(std::move(item))) break;
+            }
+        }
+        pending.Close();
+    });
+
+    // Fehlende Texte parallel nachladen; der letzte Worker schließt die Ausgabeschlange
+    std::atomic<int> activeWorkers{options_.jobs};
+    std::vector<std::thread> workers;
+    for (int i = 0; i < options_.jobs; ++i) {
+        workers.emplace_back([&] {
+            if (Tracer::IsEnabled()) Tracer::SetThreadName("Export-Worker");
+            PendingRecord item;
+            while (pending.Pop(item)) {
+                if (cancelled_) continue;
+                if (item.needsText) FetchText(item.record);
+                ready.Push(std::move(item.record));
+            }
+            if (--activeWorkers == 0) ready.Close();
+        });
+    }
+
+    // Schreiben im aufrufenden Thread
+    ExportProgress progress;
+    bool writeOk = true;
+    auto lastReport = std::chrono::steady_clock::now();
+    ExportRecord record;
+    while (ready.Pop(record)) {
+        if (cancelled_ || !writeOk) {
+            pending.Close();
+            ready.Close();
+            continue;
+        }
+
+        if (jsonl) {
+            std::string line = ToJsonLine(record);
+            line += '\n';
+            if (std::fwrite(line.data(), 1, line.size(), jsonl.get()) != line.size()) {
+                error = "Schreibfehler: " + options_.jsonlPath;
+                writeOk = false;
+            }
+        }
+        if (!options_.columnarPath.empty()) {
+            std::vector<std::string_view> row = {record.extractionId, record.documentId, record.fileName,
+                                                 record.method, record.status, record.completedAt,
+                                                 record.uploadedBy, record.error, record.text};
+            if (!columnar.Append(row)) {
+                error = columnar.LastError() + ": " + options_.columnarPath;
+                writeOk = false;
+            }
+        }
+
+        ++progress.written;
+        if (!record.error.empty()) ++progress.failed;
+        progress.textBytes += record.text.size();
+        progress.listed = listed;
+        auto now = std::chrono::steady_clock::now();
+        if (onProgress && now - lastReport >= std::chrono::milliseconds(250)) {
+            onProgress(progress);
+            lastReport = now;
+        }
+    }
+
+    lister.join();
+    for (auto& worker : workers) worker.join();
+    progress.listed = listed;
+    if (onProgress) onProgress(progress);
+
+    // Abschließen: nur vollständige Exporte ersetzen vorhandene Dateien
+    if (jsonl && std::fclose(jsonl.release()) != 0 && writeOk) {
+        error = "Schreibfehler: " + options_.jsonlPath;
+        writeOk = false;
+    }
+    if (!options_.columnarPath.empty() && !columnar.Close() && writeOk) {
+        error = columnar.LastError() + ": " + options_.columnarPath;
+        writeOk = false;
+    }
+
+    bool ok = writeOk && !cancelled_ && listError.empty();
+    if (ok) {
+        if (!options_.jsonlPath.empty() && !Publish(options_.jsonlPath)) ok = false;
+        if (ok && !options_.columnarPath.empty() && !Publish(options_.columnarPath)) ok = false;
+        if (!ok) error = "Umbenennen der Exportdatei fehlgeschlagen";
+    } else if (error.empty()) {
+        error = cancelled_ ? "Export abgebrochen" : listError;
+    }
+    if (!ok) removeParts();
+
+    std::cout << "Export: " << progress.written << " Extraktionen geschrieben, " << progress.failed
+              << " ohne Text" << (ok ? "" : " (" + error + ")") << std::endl;
+    return ok;
+}
+
+} // namespace Services
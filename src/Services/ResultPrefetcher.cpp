@@ -0,0 +1,284 @@
+#include "../../include/Services/ResultPrefetcher.h"
+#include "../../include/Services/Tracer.h"
+#include <algorithm>
+#include <iostream>
+
+namespace Services {
+
+namespace {
+
+// Wartezeit nach einem fehlgeschlagenen Vorabruf, verdoppelt sich bis kMaxRetrySeconds
+constexpr int kMinRetrySeconds = 2;
+constexpr int kMaxRetrySeconds = 120;
+
+// Dokument oder Ergebnis existiert nicht: erneutes Laden bringt nichts
+bool IsPermanentStatus(int statusCode)
+{
+    return statusCode == 404 || statusCode == 410;
+}
+
+} // namespace
+
+ResultPrefetcher::ResultPrefetcher(size_t budgetBytes, size_t maxResultBytes, int dwellMs)
+    : budgetBytes_(budgetBytes)
+    , maxResultBytes_(std::min(maxResultBytes, budgetBytes))
+    , dwell_(dwellMs)
+{
+}
+
+ResultPrefetcher::~ResultPrefetcher()
+{
+    Stop();
+}
+
+void ResultPrefetcher::Start()
+{
+    if (worker_.joinable()) return;
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        stop_ = false;
+    }
+    worker_ = std::thread(&ResultPrefetcher::Run, this);
+}
+
+void ResultPrefetcher::Stop()
+{
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        stop_ = true;
+        abort_ = true;
+    }
+    wake_.notify_all();
+    if (worker_.joinable()) worker_.join();
+}
+
+void ResultPrefetcher::SetActive(bool active)
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (active_ == active) return;
+    active_ = active;
+    wantedSince_ = std::chrono::steady_clock::now();
+    if (!active && !inFlight_.empty() && !inFlightRequested_) abort_ = true;
+    wake_.notify_all();
+}
+
+void ResultPrefetcher::SetWanted(const std::vector<std::string>& fileIds)
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    wanted_ = fileIds;
+    wantedSince_ = std::chrono::steady_clock::now();
+    if (!inFlight_.empty() && !inFlightRequested_ && std::find(wanted_.begin(), wanted_.end(), inFlight_) == wanted_.end()) {
+        abort_ = true;
+    }
+    wake_.notify_all();
+}
+
+bool ResultPrefetcher::Take(const std::string& fileId, HttpResponse& out)
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto it = cache_.find(fileId);
+    if (it == cache_.end()) {
+        ++stats_.misses;
+        return false;
+    }
+    out = std::move(it->second.response);
+    EraseLocked(it);
+    ++stats_.hits;
+    return true;
+}
+
+void ResultPrefetcher::Request(const std::string& fileId)
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (!inFlight_.empty() && inFlight_ != fileId) {
+        abort_ = true;
+    }
+    // Läuft der Vorabruf schon, wird er zum Request: ohne Limit zu Ende laden
+    inFlightRequested_ = !inFlight_.empty() && inFlight_ == fileId;
+    requested_ = fileId;
+    requestDone_ = false;
+    requestedResponse_ = HttpResponse();
+    wake_.notify_all();
+}
+
+bool ResultPrefetcher::TakeRequested(const std::string& fileId, HttpResponse& out)
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (!requestDone_ || requested_ != fileId) return false;
+    out = std::move(requestedResponse_);
+    requested_.clear();
+    requestDone_ = false;
+    return true;
+}
+
+void ResultPrefetcher::Invalidate(const std::string& fileId)
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto it = cache_.find(fileId);
+    if (it != cache_.end()) EraseLocked(it);
+    failed_.erase(fileId);
+    if (requested_ == fileId) {
+        requested_.clear();
+        requestDone_ = false;
+    }
+    if (inFlight_ == fileId) abort_ = true;
+}
+
+void ResultPrefetcher::Clear()
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    cache_.clear();
+    lru_.clear();
+    failed_.clear();
+    wanted_.clear();
+    requested_.clear();
+    requestDone_ = false;
+    cachedBytes_ = 0;
+    if (!inFlight_.empty()) abort_ = true;
+}
+
+ResultPrefetcher::Stats ResultPrefetcher::GetStats() const
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    Stats stats = stats_;
+    stats.cachedBytes = cachedBytes_;
+    return stats;
+}
+
+std::string ResultPrefetcher::NextWanted(std::chrono::steady_clock::time_point& retryAt) const
+{
+    auto now = std::chrono::steady_clock::now();
+    for (const auto& id : wanted_) {
+        if (id.empty() || cache_.find(id) != cache_.end()) continue;
+        auto failed = failed_.find(id);
+        if (failed != failed_.end() && failed->second.retryAt > now) {
+            retryAt = std::min(retryAt, failed->second.retryAt);
+            continue;
+        }
+        return id;
+    }
+    return std::string();
+}
+
+void ResultPrefetcher::RecordFailure(const std::string& fileId, const HttpResponse& response)
+{
+    Failure& failure = failed_[fileId];
+    if (IsPermanentStatus(response.statusCode)) {
+        failure.retryAt = std::chrono::steady_clock::time_point::max();
+        return;
+    }
+    // Offline, Server überlastet, Anmeldung abgelaufen: später erneut versuchen
+    int delay = kMinRetrySeconds << std::min(failure.attempts, 6);
+    failure.retryAt = std::chrono::steady_clock::now() + std::chrono::seconds(std::min(delay, kMaxRetrySeconds));
+    ++failure.attempts;
+    if (response.statusCode == 0) {
+        std::cout << "Vorabruf fehlgeschlagen: " << response.body << std::endl;
+    }
+}
+
+void ResultPrefetcher::EraseLocked(std::unordered_map<std::string, Entry>::iterator it)
+{
+    cachedBytes_ -= it->second.response.body.size();
+    lru_.erase(it->second.lru);
+    cache_.erase(it);
+}
+
+void ResultPrefetcher::Store(const std::string& fileId, HttpResponse&& response)
+{
+    size_t bytes = response.body.size();
+    // Am längsten liegende Einträge verdrängen, bis das Budget reicht
+    while (cachedBytes_ + bytes > budgetBytes_ && !lru_.empty()) {
+        auto victim = cache_.find(lru_.back());
+        EraseLocked(victim);
+    }
+    lru_.push_front(fileId);
+    Entry& entry = cache_[fileId];
+    entry.response = std::move(response);
+    entry.lru = lru_.begin();
+    cachedBytes_ += bytes;
+}
+
+void ResultPrefetcher::Run()
+{
+    Tracer::SetThreadName("Prefetch");
+    std::unique_lock<std::mutex> lock(mutex_);
+    while (!stop_) {
+        std::string fileId;
+        bool requested = !requested_.empty() && !requestDone_;
+        auto retryAt = std::chrono::steady_clock::time_point::max();
+        if (requested) {
+            fileId = requested_;
+            // Schon vorgeladen (z.B. gerade fertig geworden): direkt übergeben
+            auto cached = cache_.find(fileId);
+            if (cached != cache_.end()) {
+                requestedResponse_ = std::move(cached->second.response);
+                EraseLocked(cached);
+                requestDone_ = true;
+                ++stats_.hits;
+                continue;
+            }
+        } else if (active_) {
+            fileId = NextWanted(retryAt);
+        }
+        if (fileId.empty()) {
+            if (retryAt == std::chrono::steady_clock::time_point::max()) {
+                wake_.wait(lock);
+            } else {
+                wake_.wait_until(lock, retryAt);
+            }
+            continue;
+        }
+        // Erst laden, wenn die Maus kurz ruht; beim schnellen Überfahren der Liste passiert nichts
+        auto due = wantedSince_ + dwell_;
+        if (!requested && std::chrono::steady_clock::now() < due) {
+            wake_.wait_until(lock, due);
+            continue;
+        }
+
+        inFlight_ = fileId;
+        inFlightRequested_ = requested;
+        abort_ = false;
+        lock.unlock();
+
+        bool tooLarge = false;
+        std::string body;
+        HttpResponse response;
+        {
+            TraceSpan span("net", requested ? "Ergebnis laden" : "Ergebnis vorab laden");
+            response = ApiService::GetStream("Extraction/result/" + fileId, [&](const char* data, size_t size) {
+                if (abort_.load(std::memory_order_relaxed)) return false;
+                if (!inFlightRequested_.load(std::memory_order_relaxed) && body.size() + size > maxResultBytes_) {
+                    tooLarge = true;
+                    return false;
+                }
+                body.append(data, size);
+                return true;
+            });
+        }
+
+        lock.lock();
+        bool aborted = abort_.load() || tooLarge;
+        bool forRequest = inFlightRequested_.load() && requested_ == fileId && !requestDone_;
+        inFlight_.clear();
+        inFlightRequested_ = false;
+        if (forRequest && !aborted) {
+            // Auch Fehler gehen an den Aufrufer, er entscheidet über Offline-Kopie und Anzeige
+            if (response.isSuccess) response.body = std::move(body);
+            requestedResponse_ = std::move(response);
+            requestDone_ = true;
+        } else if (aborted) {
+            ++stats_.cancelled;
+            if (tooLarge) failed_[fileId].retryAt = std::chrono::steady_clock::time_point::max();
+        } else if (response.isSuccess) {
+            response.body = std::move(body);
+            Store(fileId, std::move(response));
+            failed_.erase(fileId);
+            ++stats_.fetched;
+        } else {
+            RecordFailure(fileId, response);
+        }
+    }
+    inFlight_.clear();
+}
+
+} // namespace Services
@@ -0,0 +1,808 @@
+#include "../../include/Services/SearchIndex.h"
+#include "../../include/Services/AppPaths.h"
+#include <algorithm>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+
+namespace Services {
+
+namespace {
+
+// Dateiformat (Host-Byte-Reihenfolge, alle Abschnitte 8-Byte-ausgerichtet):
+//   FileHeader | Postings | Begriffs-Pool | DictEntry[termCount] (sortiert)
+//   | uint64 docOffsets[docCount + 1] | Dokumente (hash u64, idLen u16, id, nameLen u16, name)
+// Posting-Liste pro Begriff: (docDelta, freq, freq * posDelta) als varint
+const char kMagic[8] = {'T', 'E', 'F', 'I', 'D', 'X', '0', '1'};
+
+struct FileHeader {
+    char magic[8];
+    uint32_t docCount;
+    uint32_t termCount;
+    uint64_t postingsPos;
+    uint64_t termPoolPos;
+    uint64_t dictPos;
+    uint64_t docOffsetsPos;
+    uint64_t docDataPos;
+    uint64_t fileSize;
+};
+
+// Obergrenze für Präfix-Expansion, damit "a*" nicht den ganzen Index dekodiert
+const size_t kMaxPrefixTerms = 1000;
+const size_t kMaxTermBytes = 64;
+
+void WriteVarint(std::string& out, uint32_t value)
+{
+    while (value >= 0x80) {
+        out += static_cast<char>((value & 0x7F) | 0x80);
+        value >>= 7;
+    }
+    out += static_cast<char>(value);
+}
+
+inline uint32_t ReadVarint(const unsigned char*& p, const unsigned char* end)
+{
+    uint32_t value = 0;
+    int shift = 0;
+    while (p < end) {
+        unsigned char b = *p++;
+        value |= static_cast<uint32_t>(b & 0x7F) << shift;
+        if (!(b & 0x80)) break;
+        shift += 7;
+        if (shift > 28) break;
+    }
+    return value;
+}
+
+// Dekodiert eine Posting-Liste: fn(doc, freq, positions); positions nur wenn withPositions
+template <typename Fn>
+void DecodePostings(const unsigned char* p, const unsigned char* end, bool withPositions,
+                    std::vector<uint32_t>& positions, Fn&& fn)
+{
+    uint32_t doc = 0;
+    while (p < end) {
+        doc += ReadVarint(p, end);
+        uint32_t freq = ReadVarint(p, end);
+        positions.clear();
+        uint32_t pos = 0;
+        for (uint32_t i = 0; i < freq && p < end; ++i) {
+            uint32_t delta = ReadVarint(p, end);
+            if (withPositions) {
+                pos += delta;
+                positions.push_back(pos);
+            }
+        }
+        fn(doc, freq, positions);
+    }
+}
+
+uint64_t HashText(std::string_view text)
+{
+    uint64_t hash = 1469598103934665603ULL; // FNV-1a
+    for (unsigned char c : text) {
+        hash ^= c;
+        hash *= 1099511628211ULL;
+    }
+    return hash;
+}
+
+uint32_t DecodeCodepoint(const unsigned char*& p, const unsigned char* end)
+{
+    unsigned char lead = *p++;
+    if (lead < 0x80) return lead;
+    int extra = lead >= 0xF0 ? 3 : lead >= 0xE0 ? 2 : lead >= 0xC0 ? 1 : 0;
+    uint32_t cp = lead & (0x3F >> extra);
+    for (int i = 0; i < extra; ++i) {
+        if (p >= end || (*p & 0xC0) != 0x80) return 0xFFFD;
+        cp = (cp << 6) | (*p++ & 0x3F);
+    }
+    return extra == 0 ? 0xFFFD : cp;
+}
+
+void AppendUtf8(std::string& out, uint32_t cp)
+{
+    if (cp < 0x80) {
+        out += static_cast<char>(cp);
+    } else if (cp < 0x800) {
+        out += static_cast<char>(0xC0 | (cp >> 6));
+        out += static_cast<char>(0x80 | (cp & 0x3F));
+    } else if (cp < 0x10000) {
+        out += static_cast<char>(0xE0 | (cp >> 12));
+        out += static_cast<char>(0x80 | ((cp >> 6) & 0x3F));
+        out += static_cast<char>(0x80 | (cp & 0x3F));
+    } else {
+        out += static_cast<char>(0xF0 | (cp >> 18));
+        out += static_cast<char>(0x80 | ((cp >> 12) & 0x3F));
+        out += static_cast<char>(0x80 | ((cp >> 6) & 0x3F));
+        out += static_cast<char>(0x80 | (cp & 0x3F));
+    }
+}
+
+uint32_t ToLower(uint32_t cp)
+{
+    if (cp >= 'A' && cp <= 'Z') return cp + 0x20;
+    if (cp < 0xC0) return cp;
+    if (cp <= 0xDE && cp != 0xD7) return cp + 0x20;                          // Latin-1 (ÄÖÜ...)
+    if ((cp >= 0x100 && cp <= 0x137) || (cp >= 0x14A && cp <= 0x177)) return cp | 1; // Latin Extended-A
+    if ((cp >= 0x139 && cp <= 0x148) || (cp >= 0x179 && cp <= 0x17E)) return (cp & 1) ? cp + 1 : cp;
+    if (cp >= 0x391 && cp <= 0x3A9 && cp != 0x3A2) return cp + 0x20;         // Griechisch
+    if (cp >= 0x410 && cp <= 0x42F) return cp + 0x20;                        // Kyrillisch
+    if (cp >= 0x400 && cp <= 0x40F) return cp + 0x50;
+    return cp;
+}
+
+bool IsIdeograph(uint32_t cp)
+{
+    return (cp >= 0x3040 && cp <= 0x9FFF) || (cp >= 0xAC00 && cp <= 0xD7AF) ||
+           (cp >= 0xF900 && cp <= 0xFAFF) || (cp >= 0x20000 && cp <= 0x3FFFF);
+}
+
+bool IsWordChar(uint32_t cp)
+{
+    if (cp < 0x80) {
+        return (cp >= '0' && cp <= '9') || (cp >= 'a' && cp <= 'z') || (cp >= 'A' && cp <= 'Z');
+    }
+    if (cp < 0xC0) return cp == 0xAA || cp == 0xB5 || cp == 0xBA;
+    if (cp == 0xD7 || cp == 0xF7 || cp == 0xFFFD) return false;
+    if (cp >= 0x2000 && cp <= 0x2BFF) return false; // Interpunktion, Symbole, Pfeile
+    if (cp >= 0x3000 && cp <= 0x303F) return false; // CJK-Interpunktion
+    if (cp >= 0xFE30 && cp <= 0xFE4F) return false;
+    if (cp >= 0xFF00 && cp <= 0xFF0F) return false;
+    return true;
+}
+
+// Ruft fn(term) für jeden Begriff auf; term ist nur während des Aufrufs gültig
+template <typename Fn>
+void ForEachToken(std::string_view text, Fn&& fn)
+{
+    const unsigned char* p = reinterpret_cast<const unsigned char*>(text.data());
+    const unsigned char* end = p + text.size();
+    std::string term;
+    term.reserve(kMaxTermBytes + 4);
+
+    auto flush = [&]() {
+        if (!term.empty()) {
+            if (term.size() <= kMaxTermBytes) fn(std::string_view(term));
+            term.clear();
+        }
+    };
+
+    while (p < end) {
+        if (*p < 0x80) {
+            // ASCII ohne Dekodierung
+            unsigned char c = *p++;
+            if ((c >= 'a' && c <= 'z') || (c >= '0' && c <= '9')) {
+                term += static_cast<char>(c);
+            } else if (c >= 'A' && c <= 'Z') {
+                term += static_cast<char>(c + 0x20);
+            } else {
+                flush();
+            }
+            continue;
+        }
+
+        uint32_t cp = DecodeCodepoint(p, end);
+        if (IsIdeograph(cp)) {
+            // CJK ohne Wortgrenzen: jedes Zeichen ist ein Begriff, Phrasen verbinden sie wieder
+            flush();
+            AppendUtf8(term, cp);
+            flush();
+        } else if (IsWordChar(cp)) {
+            AppendUtf8(term, ToLower(cp));
+        } else {
+            flush();
+        }
+    }
+    flush();
+}
+
+void Pad8(std::ofstream& out, uint64_t& pos)
+{
+    static const char zeros[8] = {0, 0, 0, 0, 0, 0, 0, 0};
+    size_t padding = (8 - (pos % 8)) % 8;
+    out.write(zeros, static_cast<std::streamsize>(padding));
+    pos += padding;
+}
+
+} // namespace
+
+std::string SearchIndex::DefaultPath()
+{
+    return AppDataPath(".text-extraction-index");
+}
+
+std::vector<std::string> SearchIndex::Tokenize(std::string_view text)
+{
+    std::vector<std::string> terms;
+    ForEachToken(text, [&terms](std::string_view term) { terms.emplace_back(term); });
+    return terms;
+}
+
+void SearchIndex::ResetBase()
+{
+    file_.Close();
+    baseDocCount_ = 0;
+    baseTermCount_ = 0;
+    docOffsets_ = nullptr;
+    docData_ = nullptr;
+    dict_ = nullptr;
+    termPool_ = nullptr;
+    postings_ = nullptr;
+    delta_.clear();
+    deltaDocs_.clear();
+    deleted_.clear();
+    idToDoc_.clear();
+    idMapBuilt_ = false;
+    liveDocs_ = 0;
+    pendingChanges_ = 0;
+}
+
+bool SearchIndex::Open(const std::string& path)
+{
+    ResetBase();
+    path_ = path;
+
+    if (!file_.Open(path)) {
+        std::cout << "Suchindex: neuer Index unter " << path << std::endl;
+        return true;
+    }
+
+    FileHeader header;
+    bool valid = file_.Size() >= sizeof(FileHeader);
+    if (valid) {
+        std::memcpy(&header, file_.Data(), sizeof(header));
+        valid = std::memcmp(header.magic, kMagic, sizeof(kMagic)) == 0 &&
+                header.fileSize == file_.Size() &&
+                header.dictPos + static_cast<uint64_t>(header.termCount) * sizeof(DictEntry) <= header.fileSize &&
+                header.docOffsetsPos + (static_cast<uint64_t>(header.docCount) + 1) * sizeof(uint64_t) <= header.fileSize &&
+                header.dictPos % 8 == 0 && header.docOffsetsPos % 8 == 0;
+    }
+    // Abschnitte liegen in Schreibreihenfolge hintereinander
+    if (valid) {
+        valid = header.postingsPos >= sizeof(FileHeader) && header.postingsPos <= header.termPoolPos &&
+                header.termPoolPos <= header.dictPos && header.dictPos <= header.docOffsetsPos &&
+                header.docOffsetsPos <= header.docDataPos && header.docDataPos <= header.fileSize;
+    }
+    // Einträge werden später ungeprüft gelesen: jeder Offset muss in seinem Abschnitt bleiben,
+    // sonst wird der Index verworfen und neu aufgebaut
+    if (valid) {
+        const char* base = file_.Data();
+        const uint64_t postingsSize = header.termPoolPos - header.postingsPos;
+        const uint64_t termPoolSize = header.dictPos - header.termPoolPos;
+        const DictEntry* dict = reinterpret_cast<const DictEntry*>(base + header.dictPos);
+        std::string_view previous;
+        for (uint32_t i = 0; valid && i < header.termCount; ++i) {
+            const DictEntry& entry = dict[i];
+            valid = static_cast<uint64_t>(entry.termOffset) + entry.termLength <= termPoolSize &&
+                    entry.postingsOffset <= postingsSize &&
+                    entry.postingsLength <= postingsSize - entry.postingsOffset;
+            if (!valid) break;
+            // FindBaseTerm sucht binär und braucht sortierte, eindeutige Begriffe
+            std::string_view term(base + header.termPoolPos + entry.termOffset, entry.termLength);
+            valid = i == 0 || previous < term;
+            previous = term;
+        }
+
+        const uint64_t docDataSize = header.fileSize - header.docDataPos;
+        const uint64_t* offsets = reinterpret_cast<const uint64_t*>(base + header.docOffsetsPos);
+        valid = valid && header.docOffsetsPos + (static_cast<uint64_t>(header.docCount) + 1) * sizeof(uint64_t) <= header.docDataPos &&
+                offsets[header.docCount] <= docDataSize;
+        for (uint32_t doc = 0; valid && doc < header.docCount; ++doc) {
+            // Datensatz: Hash, Id-Länge, Id, Namenslänge, Name; muss vor dem nächsten Offset enden
+            uint64_t begin = offsets[doc];
+            uint64_t end = offsets[doc + 1];
+            valid = begin <= end && end - begin >= sizeof(uint64_t) + 2 * sizeof(uint16_t);
+            if (!valid) break;
+            const char* p = base + header.docDataPos + begin + sizeof(uint64_t);
+            uint16_t idLength, nameLength;
+            std::memcpy(&idLength, p, sizeof(idLength));
+            valid = sizeof(uint64_t) + 2 * sizeof(uint16_t) + static_cast<uint64_t>(idLength) <= end - begin;
+            if (!valid) break;
+            std::memcpy(&nameLength, p + sizeof(idLength) + idLength, sizeof(nameLength));
+            valid = sizeof(uint64_t) + 2 * sizeof(uint16_t) + static_cast<uint64_t>(idLength) + nameLength <= end - begin;
+        }
+    }
+    if (!valid) {
+        std::cout << "Suchindex beschädigt oder veraltet, wird neu aufgebaut: " << path << std::endl;
+        file_.Close();
+        return false;
+    }
+
+    const char* base = file_.Data();
+    baseDocCount_ = header.docCount;
+    baseTermCount_ = header.termCount;
+    postings_ = reinterpret_cast<const unsigned char*>(base + header.postingsPos);
+    termPool_ = base + header.termPoolPos;
+    dict_ = reinterpret_cast<const DictEntry*>(base + header.dictPos);
+    docOffsets_ = reinterpret_cast<const uint64_t*>(base + header.docOffsetsPos);
+    docData_ = base + header.docDataPos;
+
+    deleted_.assign(baseDocCount_, 0);
+    liveDocs_ = baseDocCount_;
+    std::cout << "Suchindex geladen: " << baseDocCount_ << " Dokumente, " << baseTermCount_ << " Begriffe" << std::endl;
+    return true;
+}
+
+std::string_view SearchIndex::DocId(uint32_t doc) const
+{
+    if (doc >= baseDocCount_) return deltaDocs_[doc - baseDocCount_].id;
+    const char* p = docData_ + docOffsets_[doc] + sizeof(uint64_t);
+    uint16_t length;
+    std::memcpy(&length, p, sizeof(length));
+    return std::string_view(p + sizeof(length), length);
+}
+
+std::string_view SearchIndex::DocName(uint32_t doc) const
+{
+    if (doc >= baseDocCount_) return deltaDocs_[doc - baseDocCount_].name;
+    const char* p = docData_ + docOffsets_[doc] + sizeof(uint64_t);
+    uint16_t length;
+    std::memcpy(&length, p, sizeof(length));
+    p += sizeof(length) + length;
+    std::memcpy(&length, p, sizeof(length));
+    return std::string_view(p + sizeof(length), length);
+}
+
+uint64_t SearchIndex::DocHash(uint32_t doc) const
+{
+    if (doc >= baseDocCount_) return deltaDocs_[doc - baseDocCount_].hash;
+    uint64_t hash;
+    std::memcpy(&hash, docData_ + docOffsets_[doc], sizeof(hash));
+    return hash;
+}
+
+std::string_view SearchIndex::BaseTerm(uint32_t index) const
+{
+    return std::string_view(termPool_ + dict_[index].termOffset, dict_[index].termLength);
+}
+
+const SearchIndex::DictEntry* SearchIndex::FindBaseTerm(std::string_view term) const
+{
+    uint32_t lo = 0, hi = baseTermCount_;
+    while (lo < hi) {
+        uint32_t mid = lo + (hi - lo) / 2;
+        if (BaseTerm(mid) < term) lo = mid + 1; else hi = mid;
+    }
+    return (lo < baseTermCount_ && BaseTerm(lo) == term) ? &dict_[lo] : nullptr;
+}
+
+void SearchIndex::BuildIdMap() const
+{
+    if (idMapBuilt_) return;
+    idToDoc_.reserve(deleted_.size());
+    for (uint32_t doc = 0; doc < deleted_.size(); ++doc) {
+        if (!deleted_[doc]) idToDoc_[std::string(DocId(doc))] = doc;
+    }
+    idMapBuilt_ = true;
+}
+
+bool SearchIndex::AddDocument(const std::string& docId, const std::string& name, std::string_view text)
+{
+    if (docId.empty()) return false;
+    BuildIdMap();
+
+    uint64_t hash = HashText(text);
+    auto existing = idToDoc_.find(docId);
+    if (existing != idToDoc_.end()) {
+        if (DocHash(existing->second) == hash && DocName(existing->second) == name) {
+            return false; // unverändert
+        }
+        deleted_[existing->second] = 1;
+        --liveDocs_;
+    }
+
+    uint32_t doc = baseDocCount_ + static_cast<uint32_t>(deltaDocs_.size());
+    deltaDocs_.push_back({docId, name.substr(0, 0xFFFF), hash});
+    deleted_.push_back(0);
+    idToDoc_[docId] = doc;
+    ++liveDocs_;
+    ++pendingChanges_;
+
+    // Positionen pro Begriff sammeln, dann an die Delta-Postings anhängen
+    std::unordered_map<std::string, std::vector<uint32_t>> termPositions;
+    uint32_t position = 0;
+    ForEachToken(text, [&](std::string_view term) {
+        termPositions[std::string(term)].push_back(position++);
+    });
+
+    for (auto& entry : termPositions) {
+        auto it = delta_.find(entry.first);
+        if (it == delta_.end()) it = delta_.emplace(entry.first, DeltaPostings()).first;
+        DeltaPostings& postings = it->second;
+
+        WriteVarint(postings.bytes, doc - postings.lastDoc);
+        WriteVarint(postings.bytes, static_cast<uint32_t>(entry.second.size()));
+        uint32_t last = 0;
+        for (uint32_t pos : entry.second) {
+            WriteVarint(postings.bytes, pos - last);
+            last = pos;
+        }
+        postings.lastDoc = doc;
+        ++postings.docFreq;
+    }
+    return true;
+}
+
+void SearchIndex::RemoveDocument(const std::string& docId)
+{
+    BuildIdMap();
+    auto it = idToDoc_.find(docId);
+    if (it == idToDoc_.end()) return;
+    deleted_[it->second] = 1;
+    idToDoc_.erase(it);
+    --liveDocs_;
+    ++pendingChanges_;
+}
+
+SearchIndex::DocList SearchIndex::TermDocs(std::string_view term) const
+{
+    DocList docs;
+    std::vector<uint32_t> positions;
+    auto collect = [&docs](uint32_t doc, uint32_t freq, const std::vector<uint32_t>&) {
+        docs.emplace_back(doc, freq);
+    };
+
+    if (const DictEntry* entry = FindBaseTerm(term)) {
+        docs.reserve(entry->docFreq);
+        const unsigned char* p = postings_ + entry->postingsOffset;
+        DecodePostings(p, p + entry->postingsLength, false, positions, collect);
+    }
+    auto it = delta_.find(term);
+    if (it != delta_.end()) {
+        const unsigned char* p = reinterpret_cast<const unsigned char*>(it->second.bytes.data());
+        DecodePostings(p, p + it->second.bytes.size(), false, positions, collect);
+    }
+    return docs;
+}
+
+SearchIndex::DocList SearchIndex::PrefixDocs(std::string_view prefix) const
+{
+    DocList docs;
+    size_t expanded = 0;
+
+    uint32_t lo = 0, hi = baseTermCount_;
+    while (lo < hi) {
+        uint32_t mid = lo + (hi - lo) / 2;
+        if (BaseTerm(mid) < prefix) lo = mid + 1; else hi = mid;
+    }
+    std::vector<std::string_view> terms;
+    for (uint32_t i = lo; i < baseTermCount_ && expanded < kMaxPrefixTerms; ++i, ++expanded) {
+        std::string_view term = BaseTerm(i);
+        if (term.compare(0, prefix.size(), prefix) != 0) break;
+        terms.push_back(term);
+    }
+    for (auto it = delta_.lower_bound(prefix); it != delta_.end() && expanded < kMaxPrefixTerms; ++it, ++expanded) {
+        if (it->first.compare(0, prefix.size(), prefix) != 0) break;
+        terms.push_back(it->first);
+    }
+
+    for (std::string_view term : terms) {
+        DocList termDocs = TermDocs(term);
+        docs.insert(docs.end(), termDocs.begin(), termDocs.end());
+    }
+
+    // Zusammenführen: pro Dokument Trefferzahlen aufsummieren
+    std::sort(docs.begin(), docs.end());
+    size_t out = 0;
+    for (size_t i = 0; i < docs.size(); ++i) {
+        if (out > 0 && docs[out - 1].first == docs[i].first) {
+            docs[out - 1].second += docs[i].second;
+        } else {
+            docs[out++] = docs[i];
+        }
+    }
+    docs.resize(out);
+    return docs;
+}
+
+void SearchIndex::CollectPositions(std::string_view term, const std::vector<uint32_t>& candidates,
+                                   PositionLists& out) const
+{
+    // candidates ist sortiert und enthält nur Dokumente mit diesem Begriff
+    out.offsets.assign(candidates.size() + 1, 0);
+    out.positions.clear();
+    size_t next = 0;
+    std::vector<uint32_t> positions;
+    auto collect = [&](uint32_t doc, uint32_t, const std::vector<uint32_t>& pos) {
+        while (next < candidates.size() && candidates[next] < doc) out.offsets[++next] = out.positions.size();
+        if (next < candidates.size() && candidates[next] == doc) {
+            out.positions.insert(out.positions.end(), pos.begin(), pos.end());
+            out.offsets[++next] = static_cast<uint32_t>(out.positions.size());
+        }
+    };
+
+    if (const DictEntry* entry = FindBaseTerm(term)) {
+        const unsigned char* p = postings_ + entry->postingsOffset;
+        DecodePostings(p, p + entry->postingsLength, true, positions, collect);
+    }
+    auto it = delta_.find(term);
+    if (it != delta_.end()) {
+        const unsigned char* p = reinterpret_cast<const unsigned char*>(it->second.bytes.data());
+        DecodePostings(p, p + it->second.bytes.size(), true, positions, collect);
+    }
+    while (next < candidates.size()) out.offsets[++next] = static_cast<uint32_t>(out.positions.size());
+}
+
+SearchIndex::DocList SearchIndex::PhraseDocs(const std::vector<std::string>& terms) const
+{
+    // Zuerst Dokumente mit allen Begriffen bestimmen, erst dann Positionen dekodieren
+    std::vector<uint32_t> candidates;
+    for (size_t t = 0; t < terms.size(); ++t) {
+        DocList docs = TermDocs(terms[t]);
+        std::vector<uint32_t> ids;
+        ids.reserve(docs.size());
+        for (const auto& d : docs) ids.push_back(d.first);
+        if (t == 0) {
+            candidates.swap(ids);
+        } else {
+            std::vector<uint32_t> merged;
+            std::set_intersection(candidates.begin(), candidates.end(), ids.begin(), ids.end(),
+                                  std::back_inserter(merged));
+            candidates.swap(merged);
+        }
+        if (candidates.empty()) return DocList();
+    }
+
+    std::vector<PositionLists> lists(terms.size());
+    for (size_t t = 0; t < terms.size(); ++t) {
+        CollectPositions(terms[t], candidates, lists[t]);
+    }
+
+    DocList result;
+    for (size_t i = 0; i < candidates.size(); ++i) {
+        const uint32_t* first = lists[0].positions.data() + lists[0].offsets[i];
+        const uint32_t* firstEnd = lists[0].positions.data() + lists[0].offsets[i + 1];
+        uint32_t matches = 0;
+        for (const uint32_t* start = first; start < firstEnd; ++start) {
+            bool match = true;
+            for (size_t t = 1; t < terms.size() && match; ++t) {
+                const uint32_t* begin = lists[t].positions.data() + lists[t].offsets[i];
+                const uint32_t* end = lists[t].positions.data() + lists[t].offsets[i + 1];
+                match = std::binary_search(begin, end, *start + static_cast<uint32_t>(t));
+            }
+            if (match) ++matches;
+        }
+        if (matches > 0) result.emplace_back(candidates[i], matches);
+    }
+    return result;
+}
+
+std::vector<SearchHit> SearchIndex::Search(const std::string& query, size_t maxResults) const
+{
+    // Anfrage zerlegen: "Phrase", begriff, präfix*
+    std::vector<Clause> clauses;
+    size_t i = 0;
+    while (i < query.size()) {
+        char c = query[i];
+        if (c == ' ' || c == '\t') {
+            ++i;
+        } else if (c == '"') {
+            size_t end = query.find('"', i + 1);
+            if (end == std::string::npos) end = query.size();
+            Clause clause;
+            clause.terms = Tokenize(std::string_view(query).substr(i + 1, end - i - 1));
+            if (!clause.terms.empty()) clauses.push_back(std::move(clause));
+            i = end + 1;
+        } else {
+            size_t end = i;
+            while (end < query.size() && query[end] != ' ' && query[end] != '\t' && query[end] != '"') ++end;
+            std::string_view chunk = std::string_view(query).substr(i, end - i);
+            Clause clause;
+            clause.terms = Tokenize(chunk);
+            clause.prefix = chunk.back() == '*' && clause.terms.size() == 1;
+            if (!clause.terms.empty()) clauses.push_back(std::move(clause));
+            i = end;
+        }
+    }
+    if (clauses.empty()) return {};
+
+    std::vector<DocList> lists;
+    for (const Clause& clause : clauses) {
+        if (clause.prefix) {
+            lists.push_back(PrefixDocs(clause.terms[0]));
+        } else if (clause.terms.size() == 1) {
+            lists.push_back(TermDocs(clause.terms[0]));
+        } else {
+            lists.push_back(PhraseDocs(clause.terms));
+        }
+        if (lists.back().empty()) return {};
+    }
+
+    // UND-Verknüpfung, kürzeste Liste zuerst
+    std::sort(lists.begin(), lists.end(), [](const DocList& a, const DocList& b) { return a.size() < b.size(); });
+    DocList result = std::move(lists[0]);
+    for (size_t l = 1; l < lists.size() && !result.empty(); ++l) {
+        DocList merged;
+        const DocList& other = lists[l];
+        size_t a = 0, b = 0;
+        while (a < result.size() && b < other.size()) {
+            if (result[a].first < other[b].first) {
+                ++a;
+            } else if (other[b].first < result[a].first) {
+                ++b;
+            } else {
+                merged.emplace_back(result[a].first, result[a].second + other[b].second);
+                ++a;
+                ++b;
+            }
+        }
+        result.swap(merged);
+    }
+
+    result.erase(std::remove_if(result.begin(), result.end(),
+                                [this](const std::pair<uint32_t, uint32_t>& d) { return deleted_[d.first] != 0; }),
+                 result.end());
+
+    // Nach Trefferzahl, bei Gleichstand neuere Dokumente zuerst
+    auto better = [](const std::pair<uint32_t, uint32_t>& a, const std::pair<uint32_t, uint32_t>& b) {
+        return a.second != b.second ? a.second > b.second : a.first > b.first;
+    };
+    size_t count = std::min(maxResults, result.size());
+    std::partial_sort(result.begin(), result.begin() + count, result.end(), better);
+
+    std::vector<SearchHit> hits;
+    hits.reserve(count);
+    for (size_t h = 0; h < count; ++h) {
+        hits.push_back({std::string(DocId(result[h].first)), std::string(DocName(result[h].first)), result[h].second});
+    }
+    return hits;
+}
+
+bool SearchIndex::Save()
+{
+    if (path_.empty()) return false;
+    if (pendingChanges_ == 0 && file_.IsOpen()) return true;
+
+    std::string tmpPath = path_ + ".tmp";
+    std::ofstream out(tmpPath, std::ios::binary | std::ios::trunc);
+    if (!out.is_open()) {
+        std::cout << "Suchindex konnte nicht gespeichert werden: " << tmpPath << std::endl;
+        return false;
+    }
+
+    // Gelöschte Dokumente entfallen, die übrigen werden fortlaufend neu nummeriert
+    std::vector<uint32_t> remap(deleted_.size(), UINT32_MAX);
+    std::vector<uint32_t> liveDocs;
+    for (uint32_t doc = 0; doc < deleted_.size(); ++doc) {
+        if (!deleted_[doc]) {
+            remap[doc] = static_cast<uint32_t>(liveDocs.size());
+            liveDocs.push_back(doc);
+        }
+    }
+
+    FileHeader header;
+    std::memset(&header, 0, sizeof(header));
+    std::memcpy(header.magic, kMagic, sizeof(kMagic));
+    out.write(reinterpret_cast<const char*>(&header), sizeof(header));
+    uint64_t pos = sizeof(header);
+
+    // Postings: Basis-Wörterbuch und Delta sind beide sortiert -> Merge
+    header.postingsPos = pos;
+    std::vector<DictEntry> dict;
+    std::string termPool;
+    std::string encoded;
+    std::vector<uint32_t> positions;
+
+    auto writeTerm = [&](std::string_view term, const DictEntry* baseEntry, const DeltaPostings* deltaPostings) {
+        encoded.clear();
+        uint32_t lastDoc = 0;
+        uint32_t docFreq = 0;
+        auto reencode = [&](uint32_t doc, uint32_t freq, const std::vector<uint32_t>& pos) {
+            if (remap[doc] == UINT32_MAX) return;
+            WriteVarint(encoded, remap[doc] - lastDoc);
+            WriteVarint(encoded, freq);
+            uint32_t last = 0;
+            for (uint32_t p : pos) {
+                WriteVarint(encoded, p - last);
+                last = p;
+            }
+            lastDoc = remap[doc];
+            ++docFreq;
+        };
+        if (baseEntry) {
+            const unsigned char* p = postings_ + baseEntry->postingsOffset;
+            DecodePostings(p, p + baseEntry->postingsLength, true, positions, reencode);
+        }
+        if (deltaPostings) {
+            const unsigned char* p = reinterpret_cast<const unsigned char*>(deltaPostings->bytes.data());
+            DecodePostings(p, p + deltaPostings->bytes.size(), true, positions, reencode);
+        }
+        if (docFreq == 0) return;
+
+        DictEntry entry;
+        entry.termOffset = static_cast<uint32_t>(termPool.size());
+        entry.termLength = static_cast<uint32_t>(term.size());
+        entry.postingsOffset = pos - header.postingsPos;
+        entry.postingsLength = static_cast<uint32_t>(encoded.size());
+        entry.docFreq = docFreq;
+        dict.push_back(entry);
+        termPool.append(term.data(), term.size());
+        out.write(encoded.data(), static_cast<std::streamsize>(encoded.size()));
+        pos += encoded.size();
+    };
+
+    uint32_t b = 0;
+    auto d = delta_.begin();
+    while (b < baseTermCount_ || d != delta_.end()) {
+        if (d == delta_.end() || (b < baseTermCount_ && BaseTerm(b) < std::string_view(d->first))) {
+            writeTerm(BaseTerm(b), &dict_[b], nullptr);
+            ++b;
+        } else if (b >= baseTermCount_ || std::string_view(d->first) < BaseTerm(b)) {
+            writeTerm(d->first, nullptr, &d->second);
+            ++d;
+        } else {
+            writeTerm(d->first, &dict_[b], &d->second);
+            ++b;
+            ++d;
+        }
+    }
+
+    Pad8(out, pos);
+    header.termPoolPos = pos;
+    out.write(termPool.data(), static_cast<std::streamsize>(termPool.size()));
+    pos += termPool.size();
+
+    Pad8(out, pos);
+    header.dictPos = pos;
+    header.termCount = static_cast<uint32_t>(dict.size());
+    out.write(reinterpret_cast<const char*>(dict.data()), static_cast<std::streamsize>(dict.size() * sizeof(DictEntry)));
+    pos += dict.size() * sizeof(DictEntry);
+
+    // Dokumenttabelle
+    std::string docData;
+    std::vector<uint64_t> docOffsets;
+    docOffsets.reserve(liveDocs.size() + 1);
+    for (uint32_t doc : liveDocs) {
+        docOffsets.push_back(docData.size());
+        uint64_t hash = DocHash(doc);
+        std::string_view id = DocId(doc);
+        std::string_view name = DocName(doc);
+        uint16_t idLength = static_cast<uint16_t>(std::min<size_t>(id.size(), 0xFFFF));
+        uint16_t nameLength = static_cast<uint16_t>(std::min<size_t>(name.size(), 0xFFFF));
+        docData.append(reinterpret_cast<const char*>(&hash), sizeof(hash));
+        docData.append(reinterpret_cast<const char*>(&idLength), sizeof(idLength));
+        docData.append(id.data(), idLength);
+        docData.append(reinterpret_cast<const char*>(&nameLength), sizeof(nameLength));
+        docData.append(name.data(), nameLength);
+    }
+    docOffsets.push_back(docData.size());
+
+    Pad8(out, pos);
+    header.docOffsetsPos = pos;
+    header.docCount = static_cast<uint32_t>(liveDocs.size());
+    out.write(reinterpret_cast<const char*>(docOffsets.data()),
+              static_cast<std::streamsize>(docOffsets.size() * sizeof(uint64_t)));
+    pos += docOffsets.size() * sizeof(uint64_t);
+
+    header.docDataPos = pos;
+    out.write(docData.data(), static_cast<std::streamsize>(docData.size()));
+    pos += docData.size();
+    header.fileSize = pos;
+
+    out.seekp(0);
+    out.write(reinterpret_cast<const char*>(&header), sizeof(header));
+    out.close();
+    if (!out) {
+        std::cout << "Suchindex: Schreibfehler in " << tmpPath << std::endl;
+        std::remove(tmpPath.c_str());
+        return false;
+    }
+
+    // Atomar ersetzen, danach neu mappen (Delta ist jetzt im Basis-Segment).
+    // Das alte Mapping bleibt bis dahin gültig, bei Fehlern geht nichts verloren.
+#ifdef _WIN32
+    std::remove(path_.c_str());
+#endif
+    if (std::rename(tmpPath.c_str(), path_.c_str()) != 0) {
+        std::cout << "Suchindex: Umbenennen fehlgeschlagen: " << tmpPath << std::endl;
+        return false;
+    }
+
+    std::string path = path_;
+    Open(path);
+    return true;
+}
+
+} // namespace Services
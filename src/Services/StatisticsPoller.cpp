@@ -0,0 +1,204 @@
+#include "../../include/Services/StatisticsPoller.h"
+#include "../../include/Services/JsonUtil.h"
+#include "../../include/Services/Tracer.h"
+#include <chrono>
+#include <cstdlib>
+#include <ctime>
+#include <iostream>
+#include <map>
+
+namespace Services {
+
+namespace {
+
+// Wert (Objekt oder Array) hinter "key": inklusive Klammern, leer wenn nicht vorhanden
+std::string Section(const std::string& json, const std::string& key, char open)
+{
+    size_t pos = json.find("\"" + key + "\"");
+    if (pos == std::string::npos) return "";
+    size_t start = json.find(open, pos);
+    if (start == std::string::npos) return "";
+    size_t end = FindMatchingBracket(json, start);
+    if (end == std::string::npos) return "";
+    return json.substr(start, end - start + 1);
+}
+
+int ToInt(const std::string& value)
+{
+    return static_cast<int>(std::strtol(value.c_str(), nullptr, 10));
+}
+
+} // namespace
+
+bool ActivityEntry::operator==(const ActivityEntry& other) const
+{
+    return type == other.type && fileName == other.fileName &&
+           uploadedBy == other.uploadedBy && timestamp == other.timestamp;
+}
+
+bool StatisticsSnapshot::SameValues(const StatisticsSnapshot& other) const
+{
+    return loaded == other.loaded && usersTotal == other.usersTotal && usersActive == other.usersActive &&
+           usersInactive == other.usersInactive && documentsTotal == other.documentsTotal &&
+           extractionsTotal == other.extractionsTotal && recentActivity == other.recentActivity &&
+           error == other.error;
+}
+
+StatisticsPoller::StatisticsPoller(std::string endpoint)
+    : endpoint_(std::move(endpoint)),
+      snapshot_(std::make_shared<const StatisticsSnapshot>())
+{
+}
+
+StatisticsPoller::~StatisticsPoller()
+{
+    Stop();
+}
+
+void StatisticsPoller::Start(int intervalSeconds)
+{
+    if (worker_.joinable()) return;
+    intervalSeconds_ = intervalSeconds > 0 ? intervalSeconds : 10;
+    stop_ = false;
+    worker_ = std::thread(&StatisticsPoller::Run, this);
+}
+
+void StatisticsPoller::Stop()
+{
+    stop_ = true;
+    Wake();
+    if (worker_.joinable()) worker_.join();
+}
+
+void StatisticsPoller::SetInterval(int intervalSeconds)
+{
+    intervalSeconds_ = intervalSeconds > 0 ? intervalSeconds : 10;
+    Wake();
+}
+
+void StatisticsPoller::SetActive(bool active)
+{
+    // Beim Reaktivieren sofort abfragen, der Stand kann alt sein
+    if (!active_.exchange(active) && active) Wake();
+}
+
+void StatisticsPoller::RefreshNow()
+{
+    Wake();
+}
+
+void StatisticsPoller::Wake()
+{
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        wakeRequested_ = true;
+    }
+    wake_.notify_one();
+}
+
+std::shared_ptr<const StatisticsSnapshot> StatisticsPoller::Snapshot() const
+{
+    return std::atomic_load(&snapshot_);
+}
+
+bool StatisticsPoller::Parse(const std::string& json, StatisticsSnapshot& snapshot)
+{
+    TraceSpan span("json", "Statistik dekodieren");
+    if (json.find('{') == std::string::npos) return false;
+
+    std::string users = Section(json, "users", '{');
+    const std::string& usersJson = users.empty() ? json : users;
+    snapshot.usersTotal = ToInt(ExtractJsonField(usersJson, "total"));
+    snapshot.usersActive = ToInt(ExtractJsonField(usersJson, "active"));
+    snapshot.usersInactive = ToInt(ExtractJsonField(usersJson, "inactive"));
+    snapshot.documentsTotal = ToInt(ExtractJsonField(Section(json, "documents", '{'), "total"));
+    snapshot.extractionsTotal = ToInt(ExtractJsonField(Section(json, "extractions", '{'), "total"));
+
+    snapshot.recentActivity.clear();
+    std::string activity = Section(json, "recentActivity", '[');
+    size_t pos = 0;
+    while ((pos = activity.find('{', pos)) != std::string::npos) {
+        size_t end = FindMatchingBracket(activity, pos);
+        if (end == std::string::npos) break;
+        std::string obj = activity.substr(pos, end - pos + 1);
+
+        ActivityEntry entry;
+        entry.type = ExtractJsonField(obj, "type");
+        entry.fileName = ExtractJsonField(obj, "fileName");
+        entry.uploadedBy = ExtractJsonField(obj, "uploadedBy");
+        entry.timestamp = ExtractJsonField(obj, "timestamp");
+        snapshot.recentActivity.push_back(std::move(entry));
+        pos = end + 1;
+    }
+
+    snapshot.loaded = true;
+    return true;
+}
+
+void StatisticsPoller::Publish(StatisticsSnapshot next)
+{
+    auto current = Snapshot();
+    if (next.SameValues(*current)) return;
+
+    next.version = current->version + 1;
+    std::atomic_store(&snapshot_, std::shared_ptr<const StatisticsSnapshot>(
+        std::make_shared<StatisticsSnapshot>(std::move(next))));
+}
+
+void StatisticsPoller::Poll()
+{
+    std::map<std::string, std::string> requestHeaders;
+    if (!etag_.empty()) requestHeaders["If-None-Match"] = etag_;
+    if (!lastModified_.empty()) requestHeaders["If-Modified-Since"] = lastModified_;
+
+    HttpResponse resp = ApiService::Get(endpoint_, requestHeaders);
+    auto current = Snapshot();
+
+    if (resp.statusCode == 304) {
+        // Unverändert: nur einen vorherigen Fehler zurücknehmen
+        if (!current->error.empty()) {
+            StatisticsSnapshot next = *current;
+            next.error.clear();
+            Publish(std::move(next));
+        }
+        return;
+    }
+
+    StatisticsSnapshot next = *current;
+    if (resp.isSuccess && Parse(resp.body, next)) {
+        next.error.clear();
+        next.fetchedAt = static_cast<int64_t>(std::time(nullptr));
+        auto etag = resp.headers.find("etag");
+        etag_ = etag != resp.headers.end() ? etag->second : "";
+        auto modified = resp.headers.find("last-modified");
+        lastModified_ = modified != resp.headers.end() ? modified->second : "";
+
+        // fetchedAt allein ist keine Änderung, sonst würde jede Abfrage neu zeichnen
+        if (next.SameValues(*current)) return;
+    } else {
+        // Letzte Werte bleiben sichtbar, nur der Fehler wird angezeigt
+        next.error = resp.statusCode == 0 ? "Server nicht erreichbar"
+                                          : "Status " + std::to_string(resp.statusCode);
+        etag_.clear();
+        lastModified_.clear();
+        if (next.error != current->error) {
+            std::cout << "Fehler beim Laden der Statistics. Status: " << resp.statusCode << std::endl;
+        }
+    }
+    Publish(std::move(next));
+}
+
+void StatisticsPoller::Run()
+{
+    Tracer::SetThreadName("StatisticsPoller");
+    while (!stop_) {
+        if (active_) Poll();
+
+        std::unique_lock<std::mutex> lock(mutex_);
+        wake_.wait_for(lock, std::chrono::seconds(intervalSeconds_.load()),
+                       [this] { return wakeRequested_ || stop_.load(); });
+        wakeRequested_ = false;
+    }
+}
+
+} // namespace Services
@@ -0,0 +1,269 @@
+#include "../../include/Services/SyncService.h"
+#include "../../include/Services/JsonUtil.h"
+#include "../../include/Services/LoginService.h"
+#include "../../include/Services/Tracer.h"
+#include <algorithm>
+#include <chrono>
+#include <ctime>
+#include <filesystem>
+#include <iostream>
+
+namespace Services {
+
+namespace {
+
+// Während der Verbindung wird seltener geprüft, Fehler melden die Requests selbst
+constexpr int kOnlineProbeSeconds = 30;
+// Wartezeit nach einer vorübergehenden Ablehnung (5xx, 401, 429), verdoppelt sich bis kMaxRetrySeconds
+constexpr int kMinRetrySeconds = 5;
+constexpr int kMaxRetrySeconds = 300;
+
+// Server überlastet, Sitzung abgelaufen oder Rate-Limit: später erneut versuchen statt aufzugeben
+bool IsTransientStatus(int statusCode)
+{
+    return statusCode >= 500 || statusCode == 401 || statusCode == 429;
+}
+
+// Passwörter landen nie im Journal: auf der Platte steht ein Platzhalter, der Wert bleibt nur im Speicher
+const char* const kSecretFields[] = {"password", "newPassword"};
+const std::string kRedacted = "***";
+
+// Bereich des Stringwerts von field im Body, false wenn das Feld fehlt
+bool FindStringValue(const std::string& body, const char* field, size_t& start, size_t& end)
+{
+    std::string search = std::string("\"") + field + "\":\"";
+    start = body.find(search);
+    if (start == std::string::npos) return false;
+    start += search.size();
+    end = start;
+    while (end < body.size() && body[end] != '"') end += body[end] == '\\' ? 2 : 1;
+    end = std::min(end, body.size());
+    return true;
+}
+
+// Ersetzt die Passwortwerte durch kRedacted und gibt sie in Feldreihenfolge zurück
+std::vector<std::string> RedactSecrets(std::string& body)
+{
+    std::vector<std::string> secrets;
+    for (const char* field : kSecretFields) {
+        size_t start, end;
+        if (!FindStringValue(body, field, start, end)) continue;
+        secrets.push_back(body.substr(start, end - start));
+        body.replace(start, end - start, kRedacted);
+    }
+    return secrets;
+}
+
+// Setzt die Werte wieder ein; false wenn ein Platzhalter ohne Wert bleibt (z.B. nach einem Neustart)
+bool RestoreSecrets(std::string& body, const std::vector<std::string>& secrets)
+{
+    size_t next = 0;
+    for (const char* field : kSecretFields) {
+        size_t start, end;
+        if (!FindStringValue(body, field, start, end) || body.compare(start, end - start, kRedacted) != 0) continue;
+        if (next >= secrets.size()) return false;
+        body.replace(start, end - start, secrets[next++]);
+    }
+    return true;
+}
+
+} // namespace
+
+SyncService::SyncService(OfflineJournal& journal)
+    : journal_(journal)
+{
+}
+
+SyncService::~SyncService()
+{
+    Stop();
+}
+
+void SyncService::Start(int probeIntervalSeconds)
+{
+    if (worker_.joinable()) return;
+    probeIntervalSeconds_ = probeIntervalSeconds > 0 ? probeIntervalSeconds : 5;
+    stop_ = false;
+    worker_ = std::thread(&SyncService::Run, this);
+}
+
+void SyncService::Stop()
+{
+    stop_ = true;
+    Wake();
+    if (worker_.joinable()) worker_.join();
+}
+
+void SyncService::Wake()
+{
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        wakeRequested_ = true;
+    }
+    wake_.notify_one();
+}
+
+size_t SyncService::PendingCount() const
+{
+    return journal_.PendingCount(LoginService::GetUsername());
+}
+
+bool SyncService::ShouldQueue() const
+{
+    // Nur eigene Einträge halten die Reihenfolge auf, fremde werden ohnehin erst unter deren Anmeldung übertragen
+    return !online_ || PendingCount() > 0;
+}
+
+void SyncService::ReportOffline()
+{
+    if (online_.exchange(false)) {
+        std::cout << "Backend nicht erreichbar - Offline-Modus" << std::endl;
+        Wake();
+    }
+}
+
+HttpResponse SyncService::Execute(const std::string& method, const std::string& endpoint, const std::string& body)
+{
+    if (method == "POST") return ApiService::Post(endpoint, body);
+    if (method == "PUT") return ApiService::Put(endpoint, body);
+    if (method == "DELETE") return ApiService::Delete(endpoint);
+    if (method == "UPLOAD") return ApiService::UploadFile(body);
+
+    HttpResponse response;
+    response.statusCode = 400;
+    response.body = "Unbekannte Methode: " + method;
+    return response;
+}
+
+HttpResponse SyncService::Enqueue(const std::string& method, const std::string& endpoint,
+                                  const std::string& body, const std::string& description)
+{
+    JournalEntry entry;
+    entry.method = method;
+    entry.endpoint = endpoint;
+    entry.body = body;
+    entry.description = description;
+    entry.user = LoginService::GetUsername();
+    entry.createdAt = static_cast<int64_t>(std::time(nullptr));
+    std::vector<std::string> secrets = method == "UPLOAD" ? std::vector<std::string>() : RedactSecrets(entry.body);
+
+    HttpResponse response;
+    uint64_t sequence = journal_.Append(std::move(entry));
+    response.queued = sequence != 0;
+    if (response.queued && !secrets.empty()) {
+        std::lock_guard<std::mutex> lock(mutex_);
+        secrets_[sequence] = std::move(secrets);
+    }
+    response.body = response.queued ? "Offline gespeichert: " + description
+                                    : "Offline-Journal nicht verfügbar";
+    std::cout << response.body << std::endl;
+    Wake();
+    return response;
+}
+
+HttpResponse SyncService::Submit(const std::string& method, const std::string& endpoint,
+                                 const std::string& body, const std::string& description)
+{
+    if (method == "UPLOAD" && !std::filesystem::exists(body)) {
+        HttpResponse response;
+        response.body = "Datei nicht gefunden: " + body;
+        return response;
+    }
+    if (ShouldQueue()) {
+        return Enqueue(method, endpoint, body, description);
+    }
+
+    HttpResponse response = Execute(method, endpoint, body);
+    if (response.statusCode == 0) {
+        ReportOffline();
+        return Enqueue(method, endpoint, body, description);
+    }
+    return response;
+}
+
+void SyncService::Replay()
+{
+    syncing_ = true;
+    const std::string user = LoginService::GetUsername();
+
+    for (const JournalEntry& entry : journal_.Pending()) {
+        if (stop_) break;
+        // Nur unter der Anmeldung übertragen, unter der die Operation erfasst wurde
+        if (entry.user != user) continue;
+
+        if (entry.method == "UPLOAD" && !std::filesystem::exists(entry.body)) {
+            journal_.MarkConflict(entry, 0, "Datei nicht mehr vorhanden: " + entry.body);
+            continue;
+        }
+
+        std::string body = entry.body;
+        if (entry.method != "UPLOAD") {
+            std::vector<std::string> secrets;
+            {
+                std::lock_guard<std::mutex> lock(mutex_);
+                auto it = secrets_.find(entry.sequence);
+                if (it != secrets_.end()) secrets = it->second;
+            }
+            if (!RestoreSecrets(body, secrets)) {
+                journal_.MarkConflict(entry, 0, "Passwort wurde nicht gespeichert, bitte erneut eingeben");
+                continue;
+            }
+        }
+
+        HttpResponse response = Execute(entry.method, entry.endpoint, body);
+        if (response.statusCode == 0) {
+            ReportOffline();
+            break;
+        }
+        if (IsTransientStatus(response.statusCode)) {
+            // Eintrag bleibt vorn in der Warteschlange, damit die Reihenfolge erhalten bleibt
+            retryDelaySeconds_ = std::min(kMaxRetrySeconds, std::max(kMinRetrySeconds, retryDelaySeconds_ * 2));
+            retryAt_ = std::chrono::steady_clock::now() + std::chrono::seconds(retryDelaySeconds_);
+            std::cout << "Synchronisation pausiert für " << retryDelaySeconds_ << "s: " << entry.description
+                      << " (Status: " << response.statusCode << ")" << std::endl;
+            break;
+        }
+        retryDelaySeconds_ = 0;
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            secrets_.erase(entry.sequence);
+        }
+
+        if (response.isSuccess) {
+            journal_.Complete(entry.sequence);
+            completed_ = true;
+            std::cout << "Synchronisiert: " << entry.description << std::endl;
+        } else {
+            // 409/412 sind Konflikte, übrige 4xx endgültige Ablehnungen; beide wartet der Nutzer in der Liste ab
+            journal_.MarkConflict(entry, response.statusCode, ExtractMessageFromJSON(response.body));
+            std::cout << (IsConflictStatus(response.statusCode) ? "Konflikt bei " : "Abgelehnt: ") << entry.description
+                      << " (Status: " << response.statusCode << ")" << std::endl;
+        }
+    }
+
+    syncing_ = false;
+}
+
+void SyncService::Run()
+{
+    Tracer::SetThreadName("SyncService");
+    while (!stop_) {
+        // Jede HTTP-Antwort (auch 404) bedeutet, dass das Backend erreichbar ist
+        bool reachable = ApiService::Get("").statusCode != 0;
+        if (reachable != online_.exchange(reachable)) {
+            std::cout << (reachable ? "Backend wieder erreichbar" : "Backend nicht erreichbar - Offline-Modus") << std::endl;
+        }
+        auto now = std::chrono::steady_clock::now();
+        if (reachable && PendingCount() > 0 && now >= retryAt_) {
+            Replay();
+        }
+
+        std::unique_lock<std::mutex> lock(mutex_);
+        auto wakeAt = now + std::chrono::seconds(online_ ? kOnlineProbeSeconds : probeIntervalSeconds_);
+        if (retryAt_ > now) wakeAt = std::min(wakeAt, retryAt_);
+        wake_.wait_until(lock, wakeAt, [this]() { return stop_.load() || wakeRequested_; });
+        wakeRequested_ = false;
+    }
+}
+
+} // namespace Services
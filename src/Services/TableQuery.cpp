@@ -0,0 +1,352 @@
+#include "../../include/Services/TableQuery.h"
+#include "../../include/Services/TextFinder.h"
+#include "../../include/Services/Tracer.h"
+#include <algorithm>
+#include <chrono>
+#include <numeric>
+#include <string_view>
+#include <thread>
+
+namespace Services {
+
+namespace {
+
+// Darunter lohnt sich das Aufteilen auf Threads nicht
+constexpr size_t kParallelThreshold = 32768;
+constexpr size_t kMaxThreads = 8;
+constexpr size_t kCancelCheckRows = 4096;
+
+struct SortEntry {
+    uint64_t group;   // Rang des Benutzers bei Gruppierung, sonst 0
+    uint64_t key;
+    uint32_t row;
+};
+
+// Vorzeichenbehaftete Werte so abbilden, dass der vorzeichenlose Vergleich dieselbe Reihenfolge ergibt
+uint64_t SignedKey(int64_t value)
+{
+    return static_cast<uint64_t>(value) ^ (uint64_t(1) << 63);
+}
+
+// Die ersten 8 Bytes als Big-Endian-Zahl: gleiche Reihenfolge wie der Bytevergleich der Präfixe
+uint64_t PrefixKey(std::string_view text)
+{
+    uint64_t key = 0;
+    for (size_t i = 0; i < 8; ++i) {
+        key = (key << 8) | (i < text.size() ? static_cast<unsigned char>(text[i]) : 0u);
+    }
+    return key;
+}
+
+// Rang jedes Wertes eines Wörterbuchs in alphabetischer Reihenfolge ohne Groß-/Kleinschreibung
+std::vector<uint32_t> DictionaryRanks(const StringDictionary& dictionary)
+{
+    std::vector<std::string> folded(dictionary.Size());
+    for (uint32_t id = 0; id < dictionary.Size(); ++id) TextFinder::FoldInto(dictionary.Get(id), folded[id]);
+    std::vector<uint32_t> ids(dictionary.Size());
+    std::iota(ids.begin(), ids.end(), 0u);
+    std::sort(ids.begin(), ids.end(), [&](uint32_t a, uint32_t b) {
+        int c = folded[a].compare(folded[b]);
+        return c != 0 ? c < 0 : dictionary.Get(a) < dictionary.Get(b);
+    });
+    std::vector<uint32_t> ranks(ids.size());
+    for (uint32_t rank = 0; rank < ids.size(); ++rank) ranks[ids[rank]] = rank;
+    return ranks;
+}
+
+// Gefaltete Dateinamen am Stück; nur gebaut wenn gefiltert oder nach Name sortiert wird
+class FoldedNames {
+public:
+    template <typename Table>
+    void Build(const Table& table)
+    {
+        offsets_.resize(table.Size() + 1);
+        data_.clear();
+        for (size_t row = 0; row < table.Size(); ++row) {
+            offsets_[row] = static_cast<uint32_t>(data_.size());
+            TextFinder::FoldInto(table.FileName(row), data_);
+        }
+        offsets_[table.Size()] = static_cast<uint32_t>(data_.size());
+    }
+
+    std::string_view Get(size_t row) const
+    {
+        return std::string_view(data_.data() + offsets_[row], offsets_[row + 1] - offsets_[row]);
+    }
+
+private:
+    std::string data_;
+    std::vector<uint32_t> offsets_;
+};
+
+// false wenn cancelled() zwischen Blöcken oder Mischebenen zugeschlagen hat (entries dann unsortiert)
+template <typename Less, typename Cancelled>
+bool ParallelSort(std::vector<SortEntry>& entries, size_t threads, const Less& less, const Cancelled& cancelled)
+{
+    if (threads <= 1) {
+        std::sort(entries.begin(), entries.end(), less);
+        return !cancelled();
+    }
+
+    // Blöcke parallel sortieren, danach paarweise mischen (jede Ebene wieder parallel)
+    std::vector<size_t> bounds(threads + 1);
+    for (size_t i = 0; i <= threads; ++i) bounds[i] = entries.size() * i / threads;
+    auto at = [&](size_t index) { return entries.begin() + static_cast<std::ptrdiff_t>(bounds[index]); };
+
+    std::vector<std::thread> workers;
+    for (size_t i = 1; i < threads; ++i) {
+        workers.emplace_back([&, i] {
+            if (!cancelled()) std::sort(at(i), at(i + 1), less);
+        });
+    }
+    if (!cancelled()) std::sort(at(0), at(1), less);
+    for (auto& worker : workers) worker.join();
+
+    for (size_t width = 1; width < threads; width *= 2) {
+        if (cancelled()) return false;
+        workers.clear();
+        for (size_t i = 0; i + width < threads; i += 2 * width) {
+            size_t last = std::min(i + 2 * width, threads);
+            workers.emplace_back([&, i, width, last] {
+                if (!cancelled()) std::inplace_merge(at(i), at(i + width), at(last), less);
+            });
+        }
+        for (auto& worker : workers) worker.join();
+    }
+    return !cancelled();
+}
+
+size_t ChooseThreads(size_t rows, size_t requested)
+{
+    if (requested > 0) return std::min(requested, kMaxThreads);
+    if (rows < kParallelThreshold) return 1;
+    size_t cores = std::thread::hardware_concurrency();
+    return std::max<size_t>(1, std::min(cores, kMaxThreads));
+}
+
+// Schlüssel einer Zeile für die gewählte Spalte; Spalten, die die Tabelle nicht hat, sortieren nicht
+uint64_t SortKey(const DocumentTable& table, TableColumn column, size_t row, const std::vector<uint32_t>& userRanks,
+                 const std::vector<uint32_t>&)
+{
+    switch (column) {
+    case TableColumn::User: return userRanks[table.UploadedById(row)];
+    case TableColumn::Date: return SignedKey(table.UploadedAt(row));
+    case TableColumn::Size: return SignedKey(table.FileSize(row));
+    default: return 0;
+    }
+}
+
+uint64_t SortKey(const ExtractionTable& table, TableColumn column, size_t row, const std::vector<uint32_t>& userRanks,
+                 const std::vector<uint32_t>& methodRanks)
+{
+    switch (column) {
+    case TableColumn::User: return userRanks[table.UploadedById(row)];
+    case TableColumn::Date: return SignedKey(table.CompletedAt(row));
+    case TableColumn::Method: return methodRanks[table.MethodId(row)];
+    case TableColumn::Status: return SignedKey(table.Status(row));
+    default: return 0;
+    }
+}
+
+std::vector<uint32_t> MethodRanks(const DocumentTable&) { return {}; }
+std::vector<uint32_t> MethodRanks(const ExtractionTable& table) { return DictionaryRanks(table.Methods()); }
+
+template <typename Table>
+TableQueryResult Execute(const Table& table, const TableQuerySpec& spec, size_t threads, const std::atomic<bool>* cancel)
+{
+    TraceSpan span("table", "Tabelle sortieren");
+    auto start = std::chrono::steady_clock::now();
+    auto cancelled = [cancel] { return cancel && cancel->load(std::memory_order_relaxed); };
+
+    TableQueryResult result;
+    result.totalRows = table.Size();
+
+    // Filter: "abc*" = Präfix, sonst Teilstring, beides auf gefalteten Namen
+    std::string needle = spec.filter;
+    bool prefix = !needle.empty() && needle.back() == '*';
+    if (prefix) needle.pop_back();
+    needle = TextFinder::Fold(needle);
+    const bool byName = spec.sorted && spec.column == TableColumn::Name;
+    FoldedNames names;
+    if (!needle.empty() || byName) names.Build(table);
+
+    std::vector<uint32_t> userRanks;
+    std::vector<uint32_t> methodRanks;
+    if (spec.groupByUser || (spec.sorted && spec.column == TableColumn::User)) userRanks = DictionaryRanks(table.Users());
+    if (spec.sorted && spec.column == TableColumn::Method) methodRanks = MethodRanks(table);
+
+    std::vector<SortEntry> entries;
+    entries.reserve(table.Size());
+    for (size_t row = 0; row < table.Size(); ++row) {
+        if (row % kCancelCheckRows == 0 && cancelled()) return TableQueryResult();
+        if (!needle.empty()) {
+            std::string_view name = names.Get(row);
+            if (prefix ? name.compare(0, needle.size(), needle) != 0 : name.find(needle) == std::string_view::npos) continue;
+        }
+        SortEntry entry;
+        entry.row = static_cast<uint32_t>(row);
+        entry.group = spec.groupByUser ? userRanks[table.UploadedById(row)] : 0;
+        entry.key = !spec.sorted ? 0 : byName ? PrefixKey(names.Get(row))
+                                              : SortKey(table, spec.column, row, userRanks, methodRanks);
+        entries.push_back(entry);
+    }
+
+    if (spec.sorted || spec.groupByUser) {
+        const bool descending = spec.descending;
+        auto less = [&names, byName, descending](const SortEntry& a, const SortEntry& b) {
+            if (a.group != b.group) return a.group < b.group;
+            if (a.key != b.key) return descending ? a.key > b.key : a.key < b.key;
+            if (byName) {
+                int c = names.Get(a.row).compare(names.Get(b.row));
+                if (c != 0) return descending ? c > 0 : c < 0;
+            }
+            return a.row < b.row;  // Gleiche Werte bleiben in Serverreihenfolge
+        };
+        if (!ParallelSort(entries, ChooseThreads(entries.size(), threads), less, cancelled)) return TableQueryResult();
+    }
+
+    result.rows.resize(entries.size());
+    for (size_t i = 0; i < entries.size(); ++i) {
+        result.rows[i] = entries[i].row;
+        if (spec.groupByUser && (i == 0 || entries[i].group != entries[i - 1].group)) {
+            TableGroup group;
+            group.first = static_cast<uint32_t>(i);
+            group.user = table.UploadedBy(entries[i].row);
+            result.groups.push_back(std::move(group));
+        }
+        if (!result.groups.empty()) ++result.groups.back().count;
+    }
+
+    result.elapsedMs = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+    return result;
+}
+
+} // namespace
+
+bool TableQueryResult::IsGroupHeader(size_t displayRow, size_t& index) const
+{
+    if (groups.empty()) {
+        index = displayRow;
+        return false;
+    }
+    // Kopfzeile von Gruppe g liegt bei groups[g].first + g
+    size_t lo = 0;
+    size_t hi = groups.size();
+    while (hi - lo > 1) {
+        size_t mid = (lo + hi) / 2;
+        if (groups[mid].first + mid <= displayRow) lo = mid;
+        else hi = mid;
+    }
+    size_t header = groups[lo].first + lo;
+    if (displayRow == header) {
+        index = lo;
+        return true;
+    }
+    index = displayRow - lo - 1;
+    return false;
+}
+
+TableQueryResult TableQuery::Run(const DocumentTable& table, const TableQuerySpec& spec, size_t threads,
+                                 const std::atomic<bool>* cancel)
+{
+    return Execute(table, spec, threads, cancel);
+}
+
+TableQueryResult TableQuery::Run(const ExtractionTable& table, const TableQuerySpec& spec, size_t threads,
+                                 const std::atomic<bool>* cancel)
+{
+    return Execute(table, spec, threads, cancel);
+}
+
+TableQuery::~TableQuery()
+{
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        CancelLocked();
+        stop_ = true;
+    }
+    wake_.notify_one();
+    if (worker_.joinable()) worker_.join();
+}
+
+void TableQuery::WorkerLoop()
+{
+    Tracer::SetThreadName("TableQuery");
+    std::unique_lock<std::mutex> lock(mutex_);
+    while (true) {
+        wake_.wait(lock, [this] { return stop_ || job_; });
+        if (stop_) return;
+        Job job = std::move(job_);
+        job_ = nullptr;
+        const uint64_t generation = generation_;
+        cancel_ = false;
+
+        lock.unlock();
+        TableQueryResult result = job(cancel_);
+        lock.lock();
+
+        if (generation != generation_) continue;  // Inzwischen abgebrochen oder neu gestartet
+        result_ = std::move(result);
+        hasResult_ = true;
+        running_ = false;
+    }
+}
+
+template <typename Table>
+void TableQuery::StartWorker(std::shared_ptr<const Table> table, const TableQuerySpec& spec)
+{
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        CancelLocked();
+        running_ = true;
+        job_ = [table = std::move(table), spec](const std::atomic<bool>& cancel) {
+            return table ? Run(*table, spec, 0, &cancel) : TableQueryResult();
+        };
+        if (!worker_.joinable()) worker_ = std::thread(&TableQuery::WorkerLoop, this);
+    }
+    wake_.notify_one();
+}
+
+void TableQuery::Start(std::shared_ptr<const DocumentTable> table, const TableQuerySpec& spec)
+{
+    StartWorker(std::move(table), spec);
+}
+
+void TableQuery::Start(std::shared_ptr<const ExtractionTable> table, const TableQuerySpec& spec)
+{
+    StartWorker(std::move(table), spec);
+}
+
+void TableQuery::Cancel()
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    CancelLocked();
+}
+
+void TableQuery::CancelLocked()
+{
+    cancel_ = true;
+    job_ = nullptr;
+    ++generation_;
+    running_ = false;
+    hasResult_ = false;
+    result_ = TableQueryResult();
+}
+
+bool TableQuery::IsRunning() const
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    return running_;
+}
+
+bool TableQuery::TakeResult(TableQueryResult& out)
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (!hasResult_) return false;
+    out = std::move(result_);
+    result_ = TableQueryResult();
+    hasResult_ = false;
+    return true;
+}
+
+} // namespace Services
@@ -0,0 +1,270 @@
+#include "../../include/Services/TextFinder.h"
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#include <emmintrin.h>
+#define TEF_FIND_SSE2 1
+#endif
+
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+#include <immintrin.h>
+#define TEF_FIND_AVX2 1
+#endif
+
+#ifdef _MSC_VER
+#include <intrin.h>
+#endif
+
+namespace Services {
+
+namespace {
+
+// Kandidaten pro Block zwischen zwei Abbruchprüfungen
+constexpr size_t kChunkSize = 1 << 20;
+
+inline unsigned char FoldByte(unsigned char c, unsigned char prev)
+{
+    if (c >= 'A' && c <= 'Z') return static_cast<unsigned char>(c + 0x20);
+    // U+00C0..U+00DE (ohne U+00D7 '×') -> U+00E0..U+00FE, in UTF-8 nur das zweite Byte
+    if (prev == 0xC3 && c >= 0x80 && c <= 0x9E && c != 0x97) return static_cast<unsigned char>(c + 0x20);
+    return c;
+}
+
+inline unsigned int TrailingZeros(uint32_t mask)
+{
+#ifdef _MSC_VER
+    unsigned long index;
+    _BitScanForward(&index, mask);
+    return static_cast<unsigned int>(index);
+#else
+    return static_cast<unsigned int>(__builtin_ctz(mask));
+#endif
+}
+
+// Filter für ein einzelnes Byte des gefalteten Suchbegriffs: (byte | orMask) == value
+struct ByteFilter {
+    unsigned char value = 0;
+    unsigned char orMask = 0;
+};
+
+ByteFilter MakeFilter(const std::string& folded, size_t index)
+{
+    unsigned char b = static_cast<unsigned char>(folded[index]);
+    bool foldable = (b >= 'a' && b <= 'z') ||
+                    (index > 0 && static_cast<unsigned char>(folded[index - 1]) == 0xC3 &&
+                     b >= 0xA0 && b <= 0xBE && b != 0xB7);
+    return ByteFilter{b, static_cast<unsigned char>(foldable ? 0x20 : 0)};
+}
+
+struct Scan {
+    const unsigned char* p;
+    size_t size;
+    const unsigned char* needle;
+    size_t n;
+    ByteFilter first;
+    ByteFilter last;
+    std::vector<size_t>& hits;
+    size_t maxHits;
+    size_t nextAllowed = 0;
+    bool full = false;
+};
+
+inline bool MatchAt(const Scan& s, size_t pos)
+{
+    const unsigned char* p = s.p + pos;
+    // needle[0] ist nie ein Folgebyte, der Vorgänger spielt für p[0] keine Rolle
+    if (FoldByte(p[0], 0) != s.needle[0]) return false;
+    for (size_t j = 1; j < s.n; ++j) {
+        if (FoldByte(p[j], p[j - 1]) != s.needle[j]) return false;
+    }
+    return true;
+}
+
+// Gibt false zurück wenn maxHits erreicht ist
+inline bool Candidate(Scan& s, size_t pos)
+{
+    if (pos < s.nextAllowed || !MatchAt(s, pos)) return true;
+    s.hits.push_back(pos);
+    s.nextAllowed = pos + s.n;
+    if (s.hits.size() >= s.maxHits) {
+        s.full = true;
+        return false;
+    }
+    return true;
+}
+
+// Kandidaten-Startpositionen [from, to); to <= size - n + 1
+size_t ScanScalar(Scan& s, size_t from, size_t to)
+{
+    const size_t off = s.n - 1;
+    for (size_t i = from; i < to; ++i) {
+        if ((s.p[i] | s.first.orMask) == s.first.value && (s.p[i + off] | s.last.orMask) == s.last.value) {
+            if (!Candidate(s, i)) return to;
+        }
+    }
+    return to;
+}
+
+#ifdef TEF_FIND_SSE2
+size_t ScanSse2(Scan& s, size_t from, size_t to)
+{
+    const __m128i first = _mm_set1_epi8(static_cast<char>(s.first.value));
+    const __m128i firstOr = _mm_set1_epi8(static_cast<char>(s.first.orMask));
+    const __m128i last = _mm_set1_epi8(static_cast<char>(s.last.value));
+    const __m128i lastOr = _mm_set1_epi8(static_cast<char>(s.last.orMask));
+    const size_t off = s.n - 1;
+
+    size_t i = from;
+    for (; i + 16 <= to; i += 16) {
+        __m128i a = _mm_or_si128(_mm_loadu_si128(reinterpret_cast<const __m128i*>(s.p + i)), firstOr);
+        __m128i b = _mm_or_si128(_mm_loadu_si128(reinterpret_cast<const __m128i*>(s.p + i + off)), lastOr);
+        unsigned int mask = static_cast<unsigned int>(
+            _mm_movemask_epi8(_mm_and_si128(_mm_cmpeq_epi8(a, first), _mm_cmpeq_epi8(b, last))));
+        while (mask != 0) {
+            unsigned int bit = TrailingZeros(mask);
+            if (!Candidate(s, i + bit)) return to;
+            mask &= mask - 1;
+        }
+    }
+    return ScanScalar(s, i, to);
+}
+#endif
+
+#ifdef TEF_FIND_AVX2
+__attribute__((target("avx2")))
+size_t ScanAvx2(Scan& s, size_t from, size_t to)
+{
+    const __m256i first = _mm256_set1_epi8(static_cast<char>(s.first.value));
+    const __m256i firstOr = _mm256_set1_epi8(static_cast<char>(s.first.orMask));
+    const __m256i last = _mm256_set1_epi8(static_cast<char>(s.last.value));
+    const __m256i lastOr = _mm256_set1_epi8(static_cast<char>(s.last.orMask));
+    const size_t off = s.n - 1;
+
+    size_t i = from;
+    for (; i + 32 <= to; i += 32) {
+        __m256i a = _mm256_or_si256(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(s.p + i)), firstOr);
+        __m256i b = _mm256_or_si256(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(s.p + i + off)), lastOr);
+        uint32_t mask = static_cast<uint32_t>(
+            _mm256_movemask_epi8(_mm256_and_si256(_mm256_cmpeq_epi8(a, first), _mm256_cmpeq_epi8(b, last))));
+        while (mask != 0) {
+            unsigned int bit = TrailingZeros(mask);
+            if (!Candidate(s, i + bit)) return to;
+            mask &= mask - 1;
+        }
+    }
+    return ScanScalar(s, i, to);
+}
+
+bool HasAvx2()
+{
+    static const bool supported = __builtin_cpu_supports("avx2");
+    return supported;
+}
+#endif
+
+} // namespace
+
+std::string TextFinder::Fold(std::string_view text)
+{
+    std::string folded;
+    FoldInto(text, folded);
+    return folded;
+}
+
+void TextFinder::FoldInto(std::string_view text, std::string& out)
+{
+    size_t start = out.size();
+    out.append(text.data(), text.size());
+    unsigned char prev = 0;
+    for (size_t i = start; i < out.size(); ++i) {
+        unsigned char original = static_cast<unsigned char>(out[i]);
+        out[i] = static_cast<char>(FoldByte(original, prev));
+        prev = original;
+    }
+}
+
+std::vector<size_t> TextFinder::FindAll(std::string_view text, std::string_view needle, size_t maxHits,
+                                        const std::atomic<bool>* cancel, bool* truncated)
+{
+    std::vector<size_t> hits;
+    if (truncated) *truncated = false;
+    if (needle.empty() || needle.size() > text.size() || maxHits == 0) return hits;
+
+    const std::string folded = Fold(needle);
+    Scan s{reinterpret_cast<const unsigned char*>(text.data()), text.size(),
+           reinterpret_cast<const unsigned char*>(folded.data()), folded.size(),
+           MakeFilter(folded, 0), MakeFilter(folded, folded.size() - 1),
+           hits, maxHits};
+
+    size_t (*kernel)(Scan&, size_t, size_t) = ScanScalar;
+#ifdef TEF_FIND_SSE2
+    kernel = ScanSse2;
+#endif
+#ifdef TEF_FIND_AVX2
+    if (HasAvx2()) kernel = ScanAvx2;
+#endif
+
+    const size_t end = text.size() - folded.size() + 1;
+    for (size_t from = 0; from < end && !s.full; from += kChunkSize) {
+        if (cancel && cancel->load(std::memory_order_relaxed)) {
+            hits.clear();
+            return hits;
+        }
+        kernel(s, from, std::min(end, from + kChunkSize));
+    }
+
+    if (truncated) *truncated = s.full;
+    return hits;
+}
+
+TextFinder::~TextFinder()
+{
+    Cancel();
+}
+
+void TextFinder::Start(std::shared_ptr<const std::string> text, const std::string& needle)
+{
+    Cancel();
+    cancel_ = false;
+    running_ = true;
+
+    worker_ = std::thread([this, text = std::move(text), needle]() {
+        auto start = std::chrono::steady_clock::now();
+        TextFinderResult result;
+        result.needleLength = needle.size();
+        if (text) {
+            result.hits = FindAll(*text, needle, kMaxHits, &cancel_, &result.truncated);
+        }
+        result.elapsedMs = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+
+        if (!cancel_) {
+            std::lock_guard<std::mutex> lock(mutex_);
+            result_ = std::move(result);
+            hasResult_ = true;
+        }
+        running_ = false;
+    });
+}
+
+void TextFinder::Cancel()
+{
+    cancel_ = true;
+    if (worker_.joinable()) worker_.join();
+    std::lock_guard<std::mutex> lock(mutex_);
+    hasResult_ = false;
+    running_ = false;
+}
+
+bool TextFinder::TakeResult(TextFinderResult& out)
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (!hasResult_) return false;
+    out = std::move(result_);
+    result_ = TextFinderResult();
+    hasResult_ = false;
+    return true;
+}
+
+} // namespace Services
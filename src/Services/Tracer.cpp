@@ -0,0 +1,267 @@
+#include "../../include/Services/Tracer.h"
+#include "../../include/Services/AppPaths.h"
+#include "../../include/Services/JsonUtil.h"
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <ctime>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+namespace Services {
+
+std::atomic<bool> Tracer::enabled_{false};
+
+namespace {
+
+struct TraceEvent {
+    int64_t startNs = 0;
+    int64_t durationNs = 0;
+    double value = 0.0;
+    const char* category = "";
+    uint32_t tid = 0;
+    char phase = 'X';       // X = Spanne, i = Zeitpunkt, C = Zähler
+    char name[55] = {};
+    char detail[40] = {};
+};
+
+// Ringpuffer eines Threads: nur der besitzende Thread schreibt, written wird mit release veröffentlicht
+struct ThreadBuffer {
+    std::unique_ptr<TraceEvent[]> events{new TraceEvent[Tracer::kEventsPerThread]};
+    std::atomic<uint64_t> written{0};
+    std::atomic<bool> inUse{true};
+};
+
+// Erste lesbare Position: bei Stand written beschreibt der Besitzer evtl. schon Slot written % N,
+// also den Platz des Eintrags written - N; der zählt daher nicht mehr
+uint64_t StableBegin(uint64_t written)
+{
+    return written + 1 > Tracer::kEventsPerThread ? written + 1 - Tracer::kEventsPerThread : 0;
+}
+
+std::mutex registryMutex;
+std::vector<std::unique_ptr<ThreadBuffer>> buffers;  // Werden nie freigegeben, nur an neue Threads weitergereicht
+std::map<uint32_t, std::string> threadNames;
+std::atomic<uint32_t> nextTid{1};
+std::atomic<int64_t> sessionStartNs{0};
+
+struct ThreadState {
+    uint32_t tid = nextTid.fetch_add(1);
+    ThreadBuffer* buffer = nullptr;
+    ~ThreadState()
+    {
+        if (buffer) buffer->inUse.store(false, std::memory_order_release);
+    }
+};
+thread_local ThreadState threadState;
+
+ThreadBuffer* AcquireBuffer()
+{
+    if (threadState.buffer) return threadState.buffer;
+    std::lock_guard<std::mutex> lock(registryMutex);
+    for (auto& buffer : buffers) {
+        bool expected = false;
+        if (buffer->inUse.compare_exchange_strong(expected, true, std::memory_order_acquire)) {
+            threadState.buffer = buffer.get();
+            return threadState.buffer;
+        }
+    }
+    buffers.push_back(std::make_unique<ThreadBuffer>());
+    threadState.buffer = buffers.back().get();
+    return threadState.buffer;
+}
+
+// Kopiert höchstens size-1 Bytes, ohne ein UTF-8-Zeichen zu zerschneiden
+void CopyText(char* target, size_t size, std::string_view text)
+{
+    size_t length = std::min(text.size(), size - 1);
+    while (length > 0 && length < text.size() && (static_cast<unsigned char>(text[length]) & 0xC0) == 0x80) --length;
+    std::memcpy(target, text.data(), length);
+    target[length] = '\0';
+}
+
+void Record(char phase, const char* category, std::string_view name, std::string_view detail, int64_t startNs,
+            int64_t durationNs, double value)
+{
+    ThreadBuffer* buffer = AcquireBuffer();
+    uint64_t index = buffer->written.load(std::memory_order_relaxed);
+    TraceEvent& event = buffer->events[index % Tracer::kEventsPerThread];
+    event.startNs = startNs;
+    event.durationNs = durationNs;
+    event.value = value;
+    event.category = category;
+    event.tid = threadState.tid;
+    event.phase = phase;
+    CopyText(event.name, sizeof(event.name), name);
+    CopyText(event.detail, sizeof(event.detail), detail);
+    buffer->written.store(index + 1, std::memory_order_release);
+}
+
+std::string Micros(int64_t ns)
+{
+    char text[32];
+    std::snprintf(text, sizeof(text), "%.3f", static_cast<double>(ns) / 1000.0);
+    return text;
+}
+
+} // namespace
+
+void Tracer::Start()
+{
+    sessionStartNs.store(NowNs());
+    enabled_.store(true);
+}
+
+void Tracer::Stop()
+{
+    enabled_.store(false);
+}
+
+bool Tracer::StartFromEnvironment(std::string& path)
+{
+    const char* value = std::getenv("TEF_TRACE");
+    if (!value || !*value) return false;
+    path = std::string(value) == "1" ? DefaultPath() : value;
+    Start();
+    return true;
+}
+
+void Tracer::SetThreadName(const std::string& name)
+{
+    std::lock_guard<std::mutex> lock(registryMutex);
+    threadNames[threadState.tid] = name;
+}
+
+int64_t Tracer::NowNs()
+{
+    static const auto origin = std::chrono::steady_clock::now();
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - origin).count();
+}
+
+void Tracer::Complete(const char* category, std::string_view name, int64_t startNs, int64_t endNs, std::string_view detail)
+{
+    if (!IsEnabled()) return;
+    Record('X', category, name, detail, startNs, endNs - startNs, 0.0);
+}
+
+void Tracer::Instant(const char* category, std::string_view name, std::string_view detail)
+{
+    if (!IsEnabled()) return;
+    Record('i', category, name, detail, NowNs(), 0, 0.0);
+}
+
+void Tracer::Counter(const char* category, std::string_view name, double value)
+{
+    if (!IsEnabled()) return;
+    Record('C', category, name, {}, NowNs(), 0, value);
+}
+
+size_t Tracer::EventCount()
+{
+    int64_t session = sessionStartNs.load();
+    size_t count = 0;
+    std::lock_guard<std::mutex> lock(registryMutex);
+    for (const auto& buffer : buffers) {
+        uint64_t end = buffer->written.load(std::memory_order_acquire);
+        uint64_t begin = StableBegin(end);
+        for (uint64_t i = begin; i < end; ++i) {
+            if (buffer->events[i % kEventsPerThread].startNs >= session) ++count;
+        }
+    }
+    return count;
+}
+
+bool Tracer::Write(const std::string& path, std::string& error)
+{
+    int64_t session = sessionStartNs.load();
+    std::vector<TraceEvent> events;
+    std::map<uint32_t, std::string> names;
+    {
+        std::lock_guard<std::mutex> lock(registryMutex);
+        names = threadNames;
+        for (const auto& buffer : buffers) {
+            uint64_t end = buffer->written.load(std::memory_order_acquire);
+            uint64_t begin = StableBegin(end);
+            std::vector<TraceEvent> copy;
+            copy.reserve(end - begin);
+            for (uint64_t i = begin; i < end; ++i) copy.push_back(buffer->events[i % kEventsPerThread]);
+            // Während des Kopierens überschriebene Einträge verwerfen
+            uint64_t after = buffer->written.load(std::memory_order_acquire);
+            uint64_t safeBegin = StableBegin(after);
+            for (uint64_t i = std::max(begin, safeBegin); i < end; ++i) {
+                const TraceEvent& event = copy[i - begin];
+                if (event.startNs >= session) events.push_back(event);
+            }
+        }
+    }
+    std::sort(events.begin(), events.end(),
+              [](const TraceEvent& a, const TraceEvent& b) { return a.startNs < b.startNs; });
+
+    std::string json = "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[\n"
+                       "{\"name\":\"process_name\",\"ph\":\"M\",\"pid\":1,\"args\":{\"name\":\"text-extraction\"}}";
+    std::map<uint32_t, bool> seen;
+    for (const auto& event : events) seen[event.tid] = true;
+    for (const auto& entry : seen) {
+        auto it = names.find(entry.first);
+        std::string name = it != names.end() ? it->second : "Thread " + std::to_string(entry.first);
+        json += ",\n{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":" + std::to_string(entry.first) +
+                ",\"args\":{\"name\":\"" + EscapeJson(name) + "\"}}";
+    }
+    for (const auto& event : events) {
+        json += ",\n{\"name\":\"" + EscapeJson(event.name) + "\",\"cat\":\"" + EscapeJson(event.category) + "\",\"ph\":\"";
+        json += event.phase;
+        json += "\",\"ts\":" + Micros(event.startNs - session) + ",\"pid\":1,\"tid\":" + std::to_string(event.tid);
+        if (event.phase == 'X') json += ",\"dur\":" + Micros(event.durationNs);
+        if (event.phase == 'i') json += ",\"s\":\"t\"";
+        if (event.phase == 'C') {
+            char value[32];
+            std::snprintf(value, sizeof(value), "%.3f", event.value);
+            json += ",\"args\":{\"value\":" + std::string(value) + "}";
+        } else if (event.detail[0]) {
+            json += ",\"args\":{\"detail\":\"" + EscapeJson(event.detail) + "\"}";
+        }
+        json += "}";
+    }
+    json += "\n]}\n";
+
+    std::unique_ptr<std::FILE, int (*)(std::FILE*)> file(std::fopen(path.c_str(), "wb"), &std::fclose);
+    if (!file || std::fwrite(json.data(), 1, json.size(), file.get()) != json.size()) {
+        error = "Datei kann nicht geschrieben werden: " + path;
+        return false;
+    }
+    return true;
+}
+
+std::string Tracer::DefaultPath()
+{
+    std::time_t now = std::time(nullptr);
+    char stamp[32];
+    std::strftime(stamp, sizeof(stamp), "%Y%m%d-%H%M%S", std::localtime(&now));
+    return AppDataPath(std::string("tef-trace-") + stamp + ".json");
+}
+
+TraceSpan::TraceSpan(const char* category, std::string_view name, std::string_view suffix)
+    : category_(category), active_(Tracer::IsEnabled())
+{
+    if (!active_) return;
+    name_.reserve(name.size() + suffix.size());
+    name_.append(name.data(), name.size());
+    name_.append(suffix.data(), suffix.size());
+    startNs_ = Tracer::NowNs();
+}
+
+TraceSpan::~TraceSpan()
+{
+    if (active_) Tracer::Complete(category_, name_, startNs_, Tracer::NowNs(), detail_);
+}
+
+void TraceSpan::SetDetail(std::string_view detail)
+{
+    if (active_) detail_.assign(detail.data(), detail.size());
+}
+
+} // namespace Services
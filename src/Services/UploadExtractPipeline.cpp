@@ -0,0 +1,308 @@
+#include "../../include/Services/UploadExtractPipeline.h"
+#include "../../include/Services/ApiService.h"
+#include "../../include/Services/JsonUtil.h"
+#include "../../include/Services/RemoteExtractor.h"
+#include "../../include/Services/Tracer.h"
+#include <algorithm>
+#include <chrono>
+
+namespace Services {
+
+namespace {
+
+double ElapsedMs(std::chrono::steady_clock::time_point start)
+{
+    return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+}
+
+std::string FileNameOf(const std::string& path)
+{
+    size_t slash = path.find_last_of("/\\");
+    return slash == std::string::npos ? path : path.substr(slash + 1);
+}
+
+std::string StatusError(const char* what, const HttpResponse& resp)
+{
+    if (resp.statusCode == 0) return "Server nicht erreichbar";
+    std::string message = ExtractMessageFromJSON(resp.body);
+    return std::string(what) + ": Status " + std::to_string(resp.statusCode) + (message.empty() ? "" : " - " + message);
+}
+
+// Statusobjekt statt Text: Ergebnis muss separat geholt werden (ältere Server liefern den Text roh)
+bool IsStatusObject(const std::string& body)
+{
+    size_t first = body.find_first_not_of(" \t\r\n");
+    return first != std::string::npos && body[first] == '{' && body.find("\"extractedText\":") == std::string::npos;
+}
+
+} // namespace
+
+const char* PipelineStageName(PipelineStage stage)
+{
+    switch (stage) {
+    case PipelineStage::Waiting: return "Wartet";
+    case PipelineStage::Uploading: return "Upload";
+    case PipelineStage::Uploaded: return "Hochgeladen";
+    case PipelineStage::Extracting: return "Extraktion";
+    case PipelineStage::Fetching: return "Ergebnis";
+    case PipelineStage::Done: return "Fertig";
+    case PipelineStage::Failed: return "Fehler";
+    case PipelineStage::Cancelled: return "Abgebrochen";
+    }
+    return "";
+}
+
+UploadExtractPipeline::UploadExtractPipeline(PipelineOptions options)
+    : options_(std::move(options))
+    , uploaded_(options_.aheadCapacity)
+{
+}
+
+UploadExtractPipeline::~UploadExtractPipeline()
+{
+    Stop();
+}
+
+void UploadExtractPipeline::Add(const std::vector<std::string>& paths)
+{
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        if (stop_) return;
+        for (const auto& path : paths) {
+            PipelineItem item;
+            item.path = path;
+            item.fileName = FileNameOf(path);
+            items_.push_back(std::move(item));
+        }
+        ++version_;
+        if (!uploader_.joinable()) {
+            uploader_ = std::thread(&UploadExtractPipeline::UploadLoop, this);
+            for (int i = 0; i < std::max(1, options_.extractJobs); ++i) {
+                extractors_.emplace_back(&UploadExtractPipeline::ExtractLoop, this);
+            }
+        }
+    }
+    uploadReady_.notify_one();
+}
+
+void UploadExtractPipeline::Cancel()
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    for (auto& item : items_) {
+        if (item.stage == PipelineStage::Waiting || item.stage == PipelineStage::Uploaded) {
+            CompleteLocked(item, PipelineStage::Cancelled, "Abgebrochen");
+        }
+    }
+}
+
+void UploadExtractPipeline::Finish()
+{
+    {
+        std::unique_lock<std::mutex> lock(mutex_);
+        idle_.wait(lock, [this] {
+            return std::none_of(items_.begin(), items_.end(),
+                                [](const PipelineItem& item) { return item.stage < PipelineStage::Done; });
+        });
+    }
+    Stop();
+}
+
+void UploadExtractPipeline::Stop()
+{
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        stop_ = true;
+    }
+    uploadReady_.notify_all();
+    uploaded_.Close();
+    if (uploader_.joinable()) uploader_.join();
+    for (auto& extractor : extractors_) extractor.join();
+    extractors_.clear();
+}
+
+size_t UploadExtractPipeline::Pending() const
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    return static_cast<size_t>(std::count_if(items_.begin(), items_.end(),
+                                             [](const PipelineItem& item) { return item.stage < PipelineStage::Done; }));
+}
+
+std::vector<PipelineItem> UploadExtractPipeline::Snapshot() const
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    return std::vector<PipelineItem>(items_.begin(), items_.end());
+}
+
+bool UploadExtractPipeline::TakeCompleted(std::vector<PipelineItem>& out)
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (completed_.empty()) return false;
+    out = std::move(completed_);
+    completed_.clear();
+    return true;
+}
+
+void UploadExtractPipeline::ClearFinished()
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    while (!items_.empty() && items_.front().stage >= PipelineStage::Done) {
+        items_.pop_front();
+        ++firstItem_;
+    }
+    ++version_;
+}
+
+PipelineItem* UploadExtractPipeline::ItemLocked(size_t number)
+{
+    if (number < firstItem_ || number - firstItem_ >= items_.size()) return nullptr;
+    return &items_[number - firstItem_];
+}
+
+void UploadExtractPipeline::CompleteLocked(PipelineItem& item, PipelineStage stage, std::string error, std::string text)
+{
+    item.stage = stage;
+    item.error = std::move(error);
+    if (stage != PipelineStage::Cancelled) {
+        // Der Text geht nur an TakeCompleted, die Statusliste bleibt klein
+        completed_.push_back(item);
+        completed_.back().text = std::move(text);
+    }
+    ++version_;
+    idle_.notify_all();
+}
+
+void UploadExtractPipeline::UploadLoop()
+{
+    Tracer::SetThreadName("Pipeline-Upload");
+    std::unique_lock<std::mutex> lock(mutex_);
+    while (true) {
+        uploadReady_.wait(lock, [this] { return stop_ || nextUpload_ < firstItem_ + items_.size(); });
+        if (stop_) break;
+        size_t number = nextUpload_++;
+        PipelineItem* item = ItemLocked(number);
+        if (!item || item->stage != PipelineStage::Waiting) continue;
+        item->stage = PipelineStage::Uploading;
+        ++version_;
+        std::string path = item->path;
+        std::string fileName = item->fileName;
+        lock.unlock();
+
+        auto start = std::chrono::steady_clock::now();
+        HttpResponse resp;
+        {
+            TraceSpan span("upload", "Upload ", fileName);
+            resp = ApiService::UploadFile(path, [this, number](double progress) {
+                std::lock_guard<std::mutex> progressLock(mutex_);
+                if (PipelineItem* uploading = ItemLocked(number)) uploading->uploadProgress = progress;
+                ++version_;
+            });
+        }
+        std::string fileId = resp.isSuccess ? ExtractJsonField(resp.body, "fileId") : "";
+
+        lock.lock();
+        item = ItemLocked(number);
+        if (!item) continue;
+        item->statusCode = resp.statusCode;
+        item->uploadMs = ElapsedMs(start);
+        if (!resp.isSuccess) {
+            CompleteLocked(*item, PipelineStage::Failed, StatusError("Upload", resp));
+            continue;
+        }
+        if (fileId.empty()) {
+            CompleteLocked(*item, PipelineStage::Failed, "Upload: Antwort ohne fileId");
+            continue;
+        }
+        item->fileId = fileId;
+        item->uploadProgress = 1.0;
+        item->stage = PipelineStage::Uploaded;
+        ++version_;
+
+        // Blockiert, wenn die Extraktion hinterherhängt
+        lock.unlock();
+        uploaded_.Push(number);
+        lock.lock();
+    }
+}
+
+void UploadExtractPipeline::ExtractLoop()
+{
+    Tracer::SetThreadName("Pipeline-Extraktion");
+    size_t number = 0;
+    while (uploaded_.Pop(number)) Extract(number);
+}
+
+void UploadExtractPipeline::Extract(size_t number)
+{
+    std::string fileId;
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        PipelineItem* item = ItemLocked(number);
+        if (!item || item->stage != PipelineStage::Uploaded) return;
+        if (stop_) {
+            CompleteLocked(*item, PipelineStage::Cancelled, "Abgebrochen");
+            return;
+        }
+        item->stage = PipelineStage::Extracting;
+        fileId = item->fileId;
+        ++version_;
+    }
+
+    auto start = std::chrono::steady_clock::now();
+    HttpResponse resp;
+    {
+        TraceSpan span("extract", "Server-Extraktion ", fileId);
+        resp = ApiService::Post("Extraction/" + fileId, RemoteExtractor::BuildOptionsJson(options_.extraction));
+    }
+
+    std::string error;
+    std::string text;
+    std::string method;
+    std::string completedAt;
+    int statusCode = resp.statusCode;
+    if (!resp.isSuccess) {
+        error = StatusError("Extraktion", resp);
+    } else if (IsStatusObject(resp.body)) {
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            if (PipelineItem* item = ItemLocked(number)) item->stage = PipelineStage::Fetching;
+            ++version_;
+        }
+        std::string body;
+        HttpResponse result;
+        {
+            TraceSpan span("net", "Ergebnis laden ", fileId);
+            result = ApiService::GetStream("Extraction/result/" + fileId, [&body](const char* data, size_t size) {
+                body.append(data, size);
+                return true;
+            });
+        }
+        statusCode = result.statusCode;
+        if (!result.isSuccess) {
+            error = StatusError("Ergebnis", result);
+        } else {
+            text = ReadJsonValue(body, "extractedText");
+            method = ExtractJsonField(body, "extractionMethod");
+            completedAt = ExtractJsonField(body, "completedAt");
+        }
+    } else {
+        text = ReadJsonValue(resp.body, "extractedText");
+        if (text.empty()) text = resp.body;
+        method = ExtractJsonField(resp.body, "extractionMethod");
+        completedAt = ExtractJsonField(resp.body, "completedAt");
+    }
+
+    std::lock_guard<std::mutex> lock(mutex_);
+    PipelineItem* item = ItemLocked(number);
+    if (!item) return;
+    item->statusCode = statusCode;
+    item->extractMs = ElapsedMs(start);
+    if (!error.empty()) {
+        CompleteLocked(*item, PipelineStage::Failed, error);
+        return;
+    }
+    item->method = method.empty() ? "Server" : method;
+    item->completedAt = completedAt;
+    CompleteLocked(*item, PipelineStage::Done, "", std::move(text));
+}
+
+} // namespace Services
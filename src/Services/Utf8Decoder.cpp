@@ -0,0 +1,147 @@
+#include "../../include/Services/Utf8Decoder.h"
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#include <emmintrin.h>
+#define TEF_UTF8_SSE2 1
+#endif
+
+namespace Services {
+
+namespace {
+
+// Markiert ungültige Sequenzen intern, damit echte U+FFFD im Text nicht mitgezählt werden
+const uint32_t kInvalid = 0xFFFFFFFFu;
+
+// Dekodiert eine Sequenz ab p. Rückgabe: verbrauchte Bytes (cp ist gesetzt, ggf. kInvalid)
+// oder 0 wenn die Sequenz bis avail gültig, aber abgeschnitten ist.
+// Bei Fehlern wird der maximale gültige Teil übersprungen (Unicode "maximal subpart").
+inline size_t DecodeOne(const unsigned char* p, size_t avail, uint32_t& cp)
+{
+    unsigned char lead = p[0];
+    if (lead < 0x80) {
+        cp = lead;
+        return 1;
+    }
+
+    size_t need;
+    unsigned char lo = 0x80, hi = 0xBF;
+    if (lead >= 0xC2 && lead <= 0xDF) {
+        need = 1;
+        cp = lead & 0x1F;
+    } else if (lead >= 0xE0 && lead <= 0xEF) {
+        need = 2;
+        cp = lead & 0x0F;
+        if (lead == 0xE0) lo = 0xA0;      // Overlong
+        else if (lead == 0xED) hi = 0x9F; // Surrogates
+    } else if (lead >= 0xF0 && lead <= 0xF4) {
+        need = 3;
+        cp = lead & 0x07;
+        if (lead == 0xF0) lo = 0x90;      // Overlong
+        else if (lead == 0xF4) hi = 0x8F; // > U+10FFFF
+    } else {
+        cp = kInvalid;
+        return 1;
+    }
+
+    for (size_t i = 1; i <= need; ++i) {
+        if (i >= avail) return 0;
+        unsigned char b = p[i];
+        if (b < lo || b > hi) {
+            cp = kInvalid;
+            return i;
+        }
+        lo = 0x80;
+        hi = 0xBF;
+        cp = (cp << 6) | (b & 0x3F);
+    }
+    return need + 1;
+}
+
+// Dekodiert bis zum Ende oder bis zu einer abgeschnittenen Sequenz am Ende (consumed < size).
+// offsets (optional) erhält den Byte-Offset jedes geschriebenen Codepoints.
+size_t DecodeBlock(const unsigned char* p, size_t size, uint32_t* out, uint32_t* offsets,
+                   size_t& consumed, size_t& replacements)
+{
+    size_t i = 0;
+    size_t n = 0;
+
+    while (i < size) {
+#ifdef TEF_UTF8_SSE2
+        // ASCII-Fast-Path: 16 Bytes ohne gesetztes High-Bit direkt auf 32 Bit erweitern
+        while (i + 16 <= size) {
+            __m128i chunk = _mm_loadu_si128(reinterpret_cast<const __m128i*>(p + i));
+            if (_mm_movemask_epi8(chunk) != 0) break;
+            __m128i zero = _mm_setzero_si128();
+            __m128i lo16 = _mm_unpacklo_epi8(chunk, zero);
+            __m128i hi16 = _mm_unpackhi_epi8(chunk, zero);
+            __m128i* dst = reinterpret_cast<__m128i*>(out + n);
+            _mm_storeu_si128(dst + 0, _mm_unpacklo_epi16(lo16, zero));
+            _mm_storeu_si128(dst + 1, _mm_unpackhi_epi16(lo16, zero));
+            _mm_storeu_si128(dst + 2, _mm_unpacklo_epi16(hi16, zero));
+            _mm_storeu_si128(dst + 3, _mm_unpackhi_epi16(hi16, zero));
+            if (offsets) {
+                for (size_t k = 0; k < 16; ++k) offsets[n + k] = static_cast<uint32_t>(i + k);
+            }
+            i += 16;
+            n += 16;
+        }
+        if (i >= size) break;
+#endif
+        if (offsets) offsets[n] = static_cast<uint32_t>(i);
+        if (p[i] < 0x80) {
+            out[n++] = p[i++];
+            continue;
+        }
+
+        uint32_t cp;
+        size_t length = DecodeOne(p + i, size - i, cp);
+        if (length == 0) break; // Abgeschnittene Sequenz am Blockende
+        if (cp == kInvalid) {
+            cp = Utf8Decoder::kReplacementChar;
+            ++replacements;
+        }
+        out[n++] = cp;
+        i += length;
+    }
+
+    consumed = i;
+    return n;
+}
+
+} // namespace
+
+size_t Utf8Decoder::Decode(const char* data, size_t size, uint32_t* out, size_t* replacements)
+{
+    const unsigned char* p = reinterpret_cast<const unsigned char*>(data);
+    size_t replaced = 0;
+    size_t consumed = 0;
+    size_t n = DecodeBlock(p, size, out, nullptr, consumed, replaced);
+    if (consumed < size) {
+        // Unvollständige Sequenz am Stringende
+        out[n++] = kReplacementChar;
+        ++replaced;
+    }
+    if (replacements) *replacements = replaced;
+    return n;
+}
+
+size_t Utf8Decoder::DecodeWithOffsets(const char* data, size_t size, uint32_t* out, uint32_t* offsets)
+{
+    const unsigned char* p = reinterpret_cast<const unsigned char*>(data);
+    size_t replaced = 0;
+    size_t consumed = 0;
+    size_t n = DecodeBlock(p, size, out, offsets, consumed, replaced);
+    if (consumed < size) {
+        offsets[n] = static_cast<uint32_t>(consumed);
+        out[n++] = kReplacementChar;
+    }
+    return n;
+}
+
+void Utf8Decoder::Decode(const char* data, size_t size, std::vector<uint32_t>& out)
+{
+    out.resize(size);
+    out.resize(Decode(data, size, out.data()));
+}
+
+} // namespace Services
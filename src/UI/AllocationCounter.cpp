@@ -0,0 +1,23 @@
+// Ersetzt den globalen operator new der GUI, damit der FrameProfiler Allokationen pro Frame zählen kann.
+// Nur im GUI-Target eingebunden; CLI und Benchmarks verwenden die Standardimplementierung.
+// operator new[] und die nothrow-Varianten leiten in der Standardbibliothek an operator new weiter.
+#include "../../include/Services/FrameProfiler.h"
+#include <cstdlib>
+#include <new>
+
+void* operator new(std::size_t size)
+{
+    Services::FrameProfiler::CountAllocation(size);
+    if (void* ptr = std::malloc(size ? size : 1)) return ptr;
+    throw std::bad_alloc();
+}
+
+void operator delete(void* ptr) noexcept
+{
+    std::free(ptr);
+}
+
+void operator delete(void* ptr, std::size_t) noexcept
+{
+    std::free(ptr);
+}
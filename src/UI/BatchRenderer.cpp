@@ -0,0 +1,145 @@
+#include "../../include/UI/BatchRenderer.h"
+
+namespace UI {
+
+namespace {
+
+void AppendQuad(sf::VertexArray& vertices, const sf::FloatRect& rect, const sf::Color& color,
+                const sf::FloatRect& texRect = sf::FloatRect())
+{
+    float right = rect.left + rect.width;
+    float bottom = rect.top + rect.height;
+    float u2 = texRect.left + texRect.width;
+    float v2 = texRect.top + texRect.height;
+    sf::Vertex topLeft(sf::Vector2f(rect.left, rect.top), color, sf::Vector2f(texRect.left, texRect.top));
+    sf::Vertex topRight(sf::Vector2f(right, rect.top), color, sf::Vector2f(u2, texRect.top));
+    sf::Vertex bottomLeft(sf::Vector2f(rect.left, bottom), color, sf::Vector2f(texRect.left, v2));
+    sf::Vertex bottomRight(sf::Vector2f(right, bottom), color, sf::Vector2f(u2, v2));
+    vertices.append(topLeft);
+    vertices.append(topRight);
+    vertices.append(bottomLeft);
+    vertices.append(bottomLeft);
+    vertices.append(topRight);
+    vertices.append(bottomRight);
+}
+
+} // namespace
+
+void AppendGlyphQuads(sf::VertexArray& vertices, const sf::Font& font, unsigned int characterSize, const sf::Uint32* chars,
+                      size_t count, sf::Vector2f position, const sf::Color& color, std::vector<float>* charX)
+{
+    if (charX) charX->clear();
+    if (count == 0) {
+        if (charX) charX->push_back(0.f);
+        return;
+    }
+
+    float whitespace = font.getGlyph(U' ', characterSize, false).advance;
+    float lineSpacing = font.getLineSpacing(characterSize);
+
+    // Wie sf::Text: Grundlinie bei characterSize, 1 px Rand um jede Glyphe gegen Abschneiden beim Filtern
+    const float padding = 1.f;
+    float x = 0.f;
+    float y = static_cast<float>(characterSize);
+    sf::Uint32 prev = 0;
+    for (size_t i = 0; i < count; ++i) {
+        if (charX) charX->push_back(x);
+        sf::Uint32 cp = chars[i];
+        if (cp == U'\r') continue;
+        x += font.getKerning(prev, cp, characterSize);
+        prev = cp;
+
+        if (cp == U' ' || cp == U'\t' || cp == U'\n') {
+            if (cp == U' ') x += whitespace;
+            else if (cp == U'\t') x += whitespace * 4.f;
+            else {
+                y += lineSpacing;
+                x = 0.f;
+            }
+            continue;
+        }
+
+        const sf::Glyph& glyph = font.getGlyph(cp, characterSize, false);
+        sf::FloatRect quad(position.x + x + glyph.bounds.left - padding, position.y + y + glyph.bounds.top - padding,
+                           glyph.bounds.width + 2.f * padding, glyph.bounds.height + 2.f * padding);
+        sf::FloatRect texRect(static_cast<float>(glyph.textureRect.left) - padding,
+                              static_cast<float>(glyph.textureRect.top) - padding,
+                              static_cast<float>(glyph.textureRect.width) + 2.f * padding,
+                              static_cast<float>(glyph.textureRect.height) + 2.f * padding);
+        AppendQuad(vertices, quad, color, texRect);
+        x += glyph.advance;
+    }
+    if (charX) charX->push_back(x);
+}
+
+BatchRenderer::BatchRenderer()
+    : solid_(sf::Triangles)
+{
+}
+
+sf::VertexArray& BatchRenderer::LayerFor(const sf::Texture& texture)
+{
+    for (auto& layer : glyphLayers_) {
+        if (layer.texture == &texture) return layer.vertices;
+    }
+    glyphLayers_.push_back(GlyphLayer{&texture, sf::VertexArray(sf::Triangles)});
+    return glyphLayers_.back().vertices;
+}
+
+void BatchRenderer::AddRect(const sf::FloatRect& rect, const sf::Color& fill)
+{
+    if (fill.a == 0) return;
+    AppendQuad(solid_, rect, fill);
+}
+
+void BatchRenderer::AddRect(const sf::FloatRect& rect, const sf::Color& fill, const sf::Color& outline, float thickness)
+{
+    AddRect(rect, fill);
+    AddOutline(rect, outline, thickness);
+}
+
+void BatchRenderer::AddOutline(const sf::FloatRect& rect, const sf::Color& outline, float thickness)
+{
+    if (outline.a == 0 || thickness <= 0.f) return;
+    float t = thickness;
+    AppendQuad(solid_, sf::FloatRect(rect.left - t, rect.top - t, rect.width + 2.f * t, t), outline);
+    AppendQuad(solid_, sf::FloatRect(rect.left - t, rect.top + rect.height, rect.width + 2.f * t, t), outline);
+    AppendQuad(solid_, sf::FloatRect(rect.left - t, rect.top, t, rect.height), outline);
+    AppendQuad(solid_, sf::FloatRect(rect.left + rect.width, rect.top, t, rect.height), outline);
+}
+
+void BatchRenderer::AddText(const sf::String& text, const sf::Font& font, unsigned int characterSize, sf::Vector2f position,
+                            const sf::Color& color)
+{
+    if (text.getSize() == 0) return;
+    // Leerzeichen-Glyphe vor der Textur anfordern, damit die Seite der Schriftgröße existiert
+    font.getGlyph(U' ', characterSize, false);
+    AppendGlyphQuads(LayerFor(font.getTexture(characterSize)), font, characterSize, text.getData(), text.getSize(), position,
+                     color);
+}
+
+size_t BatchRenderer::Flush(sf::RenderTarget& target)
+{
+    size_t calls = 0;
+    if (solid_.getVertexCount() > 0) {
+        target.draw(solid_);
+        ++calls;
+    }
+    for (auto& layer : glyphLayers_) {
+        if (layer.vertices.getVertexCount() == 0) continue;
+        sf::RenderStates states;
+        states.texture = layer.texture;
+        target.draw(layer.vertices, states);
+        ++calls;
+    }
+    Clear();
+    return calls;
+}
+
+void BatchRenderer::Clear()
+{
+    solid_.clear();
+    for (auto& layer : glyphLayers_) layer.vertices.clear();
+}
+
+} // namespace UI
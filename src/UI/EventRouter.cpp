@@ -0,0 +1,85 @@
+#include "../../include/UI/EventRouter.h"
+#include <algorithm>
+#include <cmath>
+
+namespace UI {
+
+EventRouter::EventRouter(float width, float height, float cellSize)
+    : cellSize_(cellSize),
+      columns_(std::max(1, static_cast<int>(std::ceil(width / cellSize)))),
+      rows_(std::max(1, static_cast<int>(std::ceil(height / cellSize)))),
+      cells_(static_cast<size_t>(columns_ * rows_))
+{
+}
+
+size_t EventRouter::AddHandler(Handler handler)
+{
+    handlers_.push_back(std::move(handler));
+    return handlers_.size() - 1;
+}
+
+int EventRouter::Column(float x) const
+{
+    return std::min(columns_ - 1, std::max(0, static_cast<int>(std::floor(x / cellSize_))));
+}
+
+int EventRouter::Row(float y) const
+{
+    return std::min(rows_ - 1, std::max(0, static_cast<int>(std::floor(y / cellSize_))));
+}
+
+void EventRouter::BeginFrame()
+{
+    regions_.clear();
+    for (auto& cell : cells_) cell.clear();
+}
+
+void EventRouter::AddRegion(const sf::FloatRect& rect, size_t handler, size_t index)
+{
+    if (handler >= handlers_.size() || rect.width < 0.f || rect.height < 0.f) return;
+    // Ganz außerhalb des Rasters (weggescrollte Zeilen): nicht klickbar, Randzellen nicht füllen
+    if (rect.left + rect.width < 0.f || rect.top + rect.height < 0.f ||
+        rect.left >= static_cast<float>(columns_) * cellSize_ || rect.top >= static_cast<float>(rows_) * cellSize_) {
+        return;
+    }
+    uint32_t id = static_cast<uint32_t>(regions_.size());
+    regions_.push_back(Region{rect, static_cast<uint32_t>(handler), index});
+
+    int lastColumn = Column(rect.left + rect.width);
+    int lastRow = Row(rect.top + rect.height);
+    for (int row = Row(rect.top); row <= lastRow; ++row) {
+        for (int column = Column(rect.left); column <= lastColumn; ++column) {
+            cells_[static_cast<size_t>(row * columns_ + column)].push_back(id);
+        }
+    }
+}
+
+bool EventRouter::HitTest(float x, float y, size_t& handler, size_t& index) const
+{
+    const auto& cell = cells_[static_cast<size_t>(Row(y) * columns_ + Column(x))];
+    for (auto it = cell.rbegin(); it != cell.rend(); ++it) {
+        const Region& region = regions_[*it];
+        // Ränder inklusive, wie die bisherigen Vergleiche mit <= in MainView
+        if (x >= region.rect.left && x <= region.rect.left + region.rect.width &&
+            y >= region.rect.top && y <= region.rect.top + region.rect.height) {
+            handler = region.handler;
+            index = region.index;
+            return true;
+        }
+    }
+    return false;
+}
+
+bool EventRouter::Dispatch(const sf::Event& event)
+{
+    if (event.type != sf::Event::MouseButtonPressed) return false;
+    size_t handler = 0;
+    size_t index = 0;
+    if (!HitTest(static_cast<float>(event.mouseButton.x), static_cast<float>(event.mouseButton.y), handler, index)) {
+        return false;
+    }
+    handlers_[handler](index);
+    return true;
+}
+
+} // namespace UI
@@ -0,0 +1,113 @@
+#include "../../include/UI/FrameOverlay.h"
+#include <algorithm>
+#include <cstdio>
+
+namespace UI {
+
+namespace {
+
+const float kPanelX = 1200.f - 430.f;
+const float kPanelY = 60.f;
+const float kPanelWidth = 420.f;
+const float kGraphHeight = 60.f;
+const float kBudgetMs = 1000.f / 60.f;
+
+std::string Format(const char* format, double a, double b = 0.0, double c = 0.0, double d = 0.0)
+{
+    char buffer[160];
+    std::snprintf(buffer, sizeof(buffer), format, a, b, c, d);
+    return buffer;
+}
+
+} // namespace
+
+FrameOverlay::FrameOverlay(const sf::Font& font)
+    : font_(font), graph_(sf::LineStrip), budget_(sf::Lines)
+{
+}
+
+void FrameOverlay::SetMessage(const std::string& message)
+{
+    message_ = message;
+    built_ = false;
+}
+
+void FrameOverlay::Rebuild(const Services::FrameProfiler& profiler)
+{
+    lines_.clear();
+    bars_.clear();
+    graph_.clear();
+    budget_.clear();
+
+    Services::FrameSummary summary = profiler.Summarize();
+    float y = kPanelY + 8.f;
+    auto addLine = [&](const std::string& text, unsigned int size, sf::Color color) {
+        sf::Text line(sf::String::fromUtf8(text.data(), text.data() + text.size()), font_, size);
+        line.setFillColor(color);
+        line.setPosition(kPanelX + 10.f, y);
+        lines_.push_back(line);
+        y += size + 5.f;
+    };
+
+    addLine("Frame-Profiler (F12 aus, F11 speichern, F10 Trace)", 12u, sf::Color::White);
+    addLine(Format("Frame p50 %.2f ms | p99 %.2f ms | max %.1f ms | %.0f fps", summary.p50Ms, summary.p99Ms, summary.maxMs,
+                   summary.fps),
+            11u, summary.p99Ms > kBudgetMs ? sf::Color(255, 170, 120) : sf::Color(190, 230, 190));
+    addLine(Format("Allokationen/Frame %.0f (%.1f KB) | %.0f Frames", summary.allocationsPerFrame,
+                   summary.bytesPerFrame / 1024.0, static_cast<double>(summary.frames)),
+            11u, sf::Color(210, 210, 210));
+
+    // Verlauf der Frame-Zeiten, Linie = 60-fps-Budget
+    std::vector<Services::FrameSample> frames = profiler.Frames(kGraphFrames);
+    float graphTop = y + 4.f;
+    float graphBottom = graphTop + kGraphHeight;
+    float scaleMs = std::max(2.f * kBudgetMs, static_cast<float>(summary.p99Ms) * 1.2f);
+    float step = (kPanelWidth - 20.f) / static_cast<float>(kGraphFrames - 1);
+    for (size_t i = 0; i < frames.size(); ++i) {
+        float ms = std::min(frames[i].frameMs, scaleMs);
+        sf::Color color = frames[i].frameMs > kBudgetMs ? sf::Color(255, 140, 90) : sf::Color(120, 200, 255);
+        graph_.append(sf::Vertex(sf::Vector2f(kPanelX + 10.f + i * step, graphBottom - ms / scaleMs * kGraphHeight), color));
+    }
+    float budgetY = graphBottom - kBudgetMs / scaleMs * kGraphHeight;
+    budget_.append(sf::Vertex(sf::Vector2f(kPanelX + 10.f, budgetY), sf::Color(120, 120, 120)));
+    budget_.append(sf::Vertex(sf::Vector2f(kPanelX + kPanelWidth - 10.f, budgetY), sf::Color(120, 120, 120)));
+    y = graphBottom + 8.f;
+
+    // Abschnitte nach Anteil an der Frame-Zeit (inklusiv, ApiService liegt z.B. innerhalb eines Tabs)
+    size_t rows = std::min(summary.sections.size(), kMaxSectionRows);
+    for (size_t i = 0; i < rows; ++i) {
+        const auto& section = summary.sections[i];
+        sf::RectangleShape bar(sf::Vector2f(std::max(1.f, static_cast<float>(section.share) * 120.f), 10.f));
+        bar.setPosition(kPanelX + kPanelWidth - 130.f, y + 2.f);
+        bar.setFillColor(sf::Color(120, 200, 255));
+        bars_.push_back(bar);
+        addLine(section.name + Format("  avg %.2f | p99 %.2f | max %.1f ms", section.avgMs, section.p99Ms, section.maxMs), 10u,
+                sf::Color(220, 220, 220));
+    }
+    if (!message_.empty()) addLine(message_, 10u, sf::Color(255, 220, 120));
+
+    lastBuild_ = std::chrono::steady_clock::now();
+    built_ = true;
+}
+
+void FrameOverlay::Draw(sf::RenderTarget& target, const Services::FrameProfiler& profiler)
+{
+    if (!visible_) return;
+    if (!built_ || std::chrono::steady_clock::now() - lastBuild_ > std::chrono::milliseconds(250)) Rebuild(profiler);
+
+    float height = 20.f;
+    if (!lines_.empty()) height = lines_.back().getPosition().y + 22.f - kPanelY;
+    sf::RectangleShape panel(sf::Vector2f(kPanelWidth, height));
+    panel.setPosition(kPanelX, kPanelY);
+    panel.setFillColor(sf::Color(20, 20, 30, 215));
+    panel.setOutlineColor(sf::Color(90, 90, 110));
+    panel.setOutlineThickness(1.f);
+    target.draw(panel);
+
+    target.draw(budget_);
+    target.draw(graph_);
+    for (const auto& bar : bars_) target.draw(bar);
+    for (const auto& line : lines_) target.draw(line);
+}
+
+} // namespace UI
@@ -5,9 +5,6 @@ namespace UI {
 Sidebar::Sidebar(const sf::Font &font, float width, float height)
     : font_(font), width_(width), height_(height), toggleButton_("☰", font)
 {
-    background_.setSize(sf::Vector2f(width, height));
-    background_.setFillColor(sf::Color(45, 45, 48)); // Dunkles Grau
-    
     toggleButton_.setPosition(8.f, 8.f);
     toggleButton_.setSize(44.f, 44.f);
     toggleButton_.setBackgroundColor(sf::Color(60, 60, 63));
@@ -28,13 +25,12 @@ Sidebar::Sidebar(const sf::Font &font, float width, float height)
     }
 }
 
-void Sidebar::draw(sf::RenderWindow &window)
+void Sidebar::draw(BatchRenderer &batch)
 {
-    background_.setSize(sf::Vector2f(getWidth(), height_));
-    window.draw(background_);
+    batch.AddRect(sf::FloatRect(0.f, 0.f, getWidth(), height_), sf::Color(45, 45, 48)); // Dunkles Grau
     
     // Draw toggle button
-    toggleButton_.draw(window);
+    toggleButton_.draw(batch);
     
     if (isExpanded_) {
         // Draw expanded menu with full names and items
@@ -45,32 +41,18 @@ void Sidebar::draw(sf::RenderWindow &window)
             // Überspringe unsichtbare Ribbons
             if (!ribbon.visible) continue;
             
-            // Draw ribbon button background
-            sf::RectangleShape ribbonBg(sf::Vector2f(width_ - 10.f, 30.f));
-            ribbonBg.setPosition(5.f, yOffset);
-            ribbonBg.setFillColor(ribbon.hovered ? sf::Color(70, 70, 73) : sf::Color(55, 55, 58));
-            window.draw(ribbonBg);
-            
-            // Draw ribbon text
-            sf::Text ribbonText(ribbon.name, font_, 13u);
-            ribbonText.setFillColor(sf::Color(220, 220, 220));
-            ribbonText.setPosition(15.f, yOffset + 5.f);
-            window.draw(ribbonText);
+            // Draw ribbon button and text
+            batch.AddRect(sf::FloatRect(5.f, yOffset, width_ - 10.f, 30.f),
+                          ribbon.hovered ? sf::Color(70, 70, 73) : sf::Color(55, 55, 58));
+            batch.AddText(ribbon.name, font_, 13u, sf::Vector2f(15.f, yOffset + 5.f), sf::Color(220, 220, 220));
             
             yOffset += 35.f;
             
             // Draw items if ribbon is open
             if (ribbon.isOpen) {
                 for (auto &item : ribbon.items) {
-                    sf::RectangleShape itemBg(sf::Vector2f(width_ - 15.f, 25.f));
-                    itemBg.setPosition(10.f, yOffset);
-                    itemBg.setFillColor(sf::Color(50, 50, 53));
-                    window.draw(itemBg);
-                    
-                    sf::Text itemText("► " + item.name, font_, 11u);
-                    itemText.setFillColor(sf::Color(180, 180, 180));
-                    itemText.setPosition(20.f, yOffset + 4.f);
-                    window.draw(itemText);
+                    batch.AddRect(sf::FloatRect(10.f, yOffset, width_ - 15.f, 25.f), sf::Color(50, 50, 53));
+                    batch.AddText("► " + item.name, font_, 11u, sf::Vector2f(20.f, yOffset + 4.f), sf::Color(180, 180, 180));
                     yOffset += 28.f;
                 }
             }
@@ -84,18 +66,10 @@ void Sidebar::draw(sf::RenderWindow &window)
             // Überspringe unsichtbare Ribbons
             if (!ribbon.visible) continue;
             
-            // Draw icon button background
-            sf::RectangleShape iconBg(sf::Vector2f(45.f, 45.f));
-            iconBg.setPosition(7.f, yOffset);
-            iconBg.setFillColor(ribbon.hovered ? sf::Color(70, 70, 73) : sf::Color(55, 55, 58));
-            window.draw(iconBg);
-            
-            // Draw icon (first letter)
-            std::string iconStr(1, ribbon.icon);
-            sf::Text iconText(iconStr, font_, 20u);
-            iconText.setFillColor(sf::Color(200, 200, 200));
-            iconText.setPosition(17.f, yOffset + 8.f);
-            window.draw(iconText);
+            // Draw icon button and icon (first letter)
+            batch.AddRect(sf::FloatRect(7.f, yOffset, 45.f, 45.f),
+                          ribbon.hovered ? sf::Color(70, 70, 73) : sf::Color(55, 55, 58));
+            batch.AddText(std::string(1, ribbon.icon), font_, 20u, sf::Vector2f(17.f, yOffset + 8.f), sf::Color(200, 200, 200));
             
             yOffset += 52.f;
         }
@@ -0,0 +1,78 @@
+#include "../../include/UI/TextBatch.h"
+#include <algorithm>
+
+namespace UI {
+
+TextBatch::TextBatch(const sf::Font& font, unsigned int characterSize, float lineHeight, const sf::Color& color)
+    : font_(font), characterSize_(characterSize), lineHeight_(lineHeight), color_(color)
+{
+}
+
+void TextBatch::Invalidate()
+{
+    lines_.clear();
+    dirty_ = true;
+}
+
+const TextBatch::LineGeometry& TextBatch::Line(const TextLayout& layout, size_t index)
+{
+    const LineSpan& span = layout.Line(index);
+    auto it = lines_.find(index);
+    if (it != lines_.end() && it->second.byteOffset == span.byteOffset && it->second.byteLength == span.byteLength) {
+        return it->second;
+    }
+
+    // Beim Durchscrollen großer Texte nicht unbegrenzt wachsen; sichtbare Zeilen sind danach schnell neu gebaut
+    if (it == lines_.end() && lines_.size() >= kMaxCachedLines) {
+        lines_.clear();
+        it = lines_.end();
+    }
+    LineGeometry& line = it != lines_.end() ? it->second : lines_[index];
+    line.byteOffset = span.byteOffset;
+    line.byteLength = span.byteLength;
+    line.vertices.clear();
+    static_assert(sizeof(sf::Uint32) == sizeof(uint32_t), "Codepoints werden direkt übergeben");
+    AppendGlyphQuads(line.vertices, font_, characterSize_, reinterpret_cast<const sf::Uint32*>(layout.Chars() + span.firstChar),
+                     span.charCount, sf::Vector2f(0.f, 0.f), color_, &line.charX);
+    return line;
+}
+
+void TextBatch::SetVisibleLines(const TextLayout& layout, size_t first, size_t last)
+{
+    last = std::min(last, layout.LineCount());
+    first = std::min(first, last);
+    if (!dirty_ && first == first_ && last == last_) return;
+
+    visible_.clear();
+    for (size_t i = first; i < last; ++i) {
+        const LineGeometry& line = Line(layout, i);
+        float y = static_cast<float>(i - first) * lineHeight_;
+        for (size_t v = 0; v < line.vertices.getVertexCount(); ++v) {
+            sf::Vertex vertex = line.vertices[v];
+            vertex.position.y += y;
+            visible_.append(vertex);
+        }
+    }
+    first_ = first;
+    last_ = last;
+    dirty_ = false;
+}
+
+float TextBatch::CharX(const TextLayout& layout, size_t line, size_t index)
+{
+    if (line >= layout.LineCount()) return 0.f;
+    const LineGeometry& geometry = Line(layout, line);
+    if (geometry.charX.empty()) return 0.f;
+    return geometry.charX[std::min(index, geometry.charX.size() - 1)];
+}
+
+void TextBatch::Draw(sf::RenderTarget& target, sf::Vector2f origin) const
+{
+    if (visible_.getVertexCount() == 0) return;
+    sf::RenderStates states;
+    states.texture = &font_.getTexture(characterSize_);
+    states.transform.translate(origin.x, origin.y + static_cast<float>(first_) * lineHeight_);
+    target.draw(visible_, states);
+}
+
+} // namespace UI
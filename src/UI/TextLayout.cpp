@@ -0,0 +1,253 @@
+#include "../../include/UI/TextLayout.h"
+#include "../../include/Services/Utf8Decoder.h"
+#include <algorithm>
+#include <cctype>
+
+namespace UI {
+
+void TextLayout::SetAdvanceFunction(AdvanceFn advance, uint32_t fontKey)
+{
+    advanceFn_ = std::move(advance);
+    if (fontKey != fontKey_ || fontKey == 0) {
+        fontKey_ = fontKey;
+        // Gecachte Breiten gelten nur für den alten Font
+        if (!chars_.empty()) Measure();
+    }
+}
+
+bool TextLayout::SetText(std::string_view utf8, uint64_t version)
+{
+    if (!dirty_ && version == version_ && utf8.data() == text_.data() && utf8.size() == text_.size()) return false;
+    text_ = utf8;
+    version_ = version;
+    Measure();
+    return true;
+}
+
+void TextLayout::Clear()
+{
+    text_ = std::string_view();
+    chars_.clear();
+    byteOffsets_.clear();
+    advances_.clear();
+    classes_.clear();
+    lines_.clear();
+    dirty_ = true;
+}
+
+void TextLayout::Measure()
+{
+    // Dekodieren (Puffer werden wiederverwendet); die Byte-Offsets liefert der Decoder selbst,
+    // damit sie auch bei ungültigem UTF-8 (ein U+FFFD pro verworfenem Teil) zu den Codepoints passen
+    chars_.resize(text_.size());
+    byteOffsets_.resize(text_.size());
+    size_t decoded = Services::Utf8Decoder::DecodeWithOffsets(text_.data(), text_.size(), chars_.data(), byteOffsets_.data());
+    chars_.resize(decoded);
+    byteOffsets_.resize(decoded);
+    byteOffsets_.push_back(static_cast<uint32_t>(text_.size()));
+
+    advances_.resize(chars_.size());
+    classes_.resize(chars_.size());
+    for (size_t i = 0; i < chars_.size(); ++i) {
+        uint32_t cp = chars_[i];
+        uint32_t prev = (i > 0 && classes_[i - 1] != kBreakMandatory) ? chars_[i - 1] : 0;
+        classes_[i] = Classify(cp);
+        advances_[i] = (advanceFn_ && classes_[i] != kBreakMandatory) ? advanceFn_(prev, cp) : 0.f;
+        // CR LF ist ein einziger Umbruch (UAX #14 LB5): das CR hängt wie ein Leerzeichen ohne Breite an der Zeile
+        if (cp == '\n' && i > 0 && chars_[i - 1] == '\r') {
+            classes_[i - 1] = kBreakSpace;
+            advances_[i - 1] = 0.f;
+        }
+    }
+    dirty_ = true;
+}
+
+void TextLayout::Wrap(float maxWidth)
+{
+    if (!dirty_ && maxWidth == maxWidth_) return;
+    maxWidth_ = maxWidth;
+    lines_.clear(); // Kapazität bleibt erhalten
+    WrapFrom(0);
+    dirty_ = false;
+}
+
+void TextLayout::WrapFrom(size_t start)
+{
+    const size_t n = chars_.size();
+    size_t lineStart = start;
+
+    while (lineStart < n) {
+        float width = 0.f;
+        size_t contentEnd = lineStart;  // Ende ohne hängende Leerzeichen (exklusiv)
+        size_t lastBreak = lineStart;   // Beginn der nächsten Zeile beim letzten Umbruchpunkt
+        size_t contentEndAtBreak = lineStart;
+        float widthAtBreak = 0.f;
+        bool mandatory = false;
+        bool overflow = false;
+        size_t i = lineStart;
+
+        for (; i < n; ++i) {
+            uint8_t cls = classes_[i];
+            if (cls == kBreakMandatory) {
+                mandatory = true;
+                break;
+            }
+            if (cls == kBreakSpace) {
+                // Leerzeichen dürfen über den Rand hängen und zählen nicht zur Breite
+                lastBreak = i + 1;
+                contentEndAtBreak = contentEnd;
+                widthAtBreak = width;
+                continue;
+            }
+            if (cls == kBreakIdeograph && i > lineStart && !NoBreakBefore(chars_[i])) {
+                lastBreak = i;
+                contentEndAtBreak = contentEnd;
+                widthAtBreak = width;
+            }
+
+            // Breite bis hierher inklusive der Leerzeichen zwischen Inhalt und diesem Zeichen
+            float lineWidth = width;
+            for (size_t k = contentEnd; k < i; ++k) lineWidth += advances_[k];
+            if (lineWidth + advances_[i] > maxWidth_ && i > lineStart) {
+                overflow = true;
+                break;
+            }
+            width = lineWidth + advances_[i];
+            contentEnd = i + 1;
+
+            if (cls == kBreakAfter && (i + 1 >= n || !NoBreakBefore(chars_[i + 1]))) {
+                lastBreak = i + 1;
+                contentEndAtBreak = contentEnd;
+                widthAtBreak = width;
+            }
+        }
+
+        size_t nextStart;
+        size_t visibleEnd;
+        float lineWidth;
+        if (!overflow) {
+            visibleEnd = contentEnd;
+            lineWidth = width;
+            nextStart = mandatory ? i + 1 : n;
+        } else if (lastBreak > lineStart) {
+            visibleEnd = contentEndAtBreak;
+            lineWidth = widthAtBreak;
+            nextStart = lastBreak;
+        } else {
+            // Notumbruch: Wort breiter als die Zeile
+            visibleEnd = i;
+            lineWidth = width;
+            nextStart = i;
+        }
+
+        LineSpan span;
+        span.firstChar = static_cast<uint32_t>(lineStart);
+        span.charCount = static_cast<uint32_t>(visibleEnd - lineStart);
+        span.byteOffset = byteOffsets_[lineStart];
+        span.byteLength = byteOffsets_[visibleEnd] - span.byteOffset;
+        span.width = lineWidth;
+        lines_.push_back(span);
+
+        // Leerzeichen nach einem automatischen Umbruch gehören nicht an den nächsten Zeilenanfang
+        if (overflow) {
+            while (nextStart < n && classes_[nextStart] == kBreakSpace) ++nextStart;
+        }
+        lineStart = nextStart;
+    }
+}
+
+std::string_view TextLayout::LineText(size_t index) const
+{
+    const LineSpan& span = lines_[index];
+    return std::string_view(text_.data() + span.byteOffset, span.byteLength);
+}
+
+size_t TextLayout::LineForByte(size_t byteOffset) const
+{
+    auto it = std::upper_bound(lines_.begin(), lines_.end(), byteOffset,
+                               [](size_t offset, const LineSpan& span) { return offset < span.byteOffset; });
+    return it == lines_.begin() ? 0 : static_cast<size_t>(it - lines_.begin()) - 1;
+}
+
+size_t TextLayout::CharForByte(size_t byteOffset) const
+{
+    // byteOffsets_ endet mit einer Marke für das Textende
+    auto it = std::upper_bound(byteOffsets_.begin(), byteOffsets_.end(), byteOffset);
+    return it == byteOffsets_.begin() ? 0 : static_cast<size_t>(it - byteOffsets_.begin()) - 1;
+}
+
+TextLayout::BreakClass TextLayout::Classify(uint32_t cp)
+{
+    switch (cp) {
+        case '\n': case '\r': case 0x0B: case 0x0C: case 0x85: case 0x2028: case 0x2029:
+            return kBreakMandatory;
+        case ' ': case '\t': case 0x1680: case 0x205F: case 0x3000:
+            return kBreakSpace;
+        case 0x00A0: case 0x202F: case 0x2007: case 0x2060: case 0xFEFF:
+            return kBreakNone; // geschützte Leerzeichen
+        case '-': case 0x00AD: case 0x2010: case 0x2012: case 0x2013: case 0x200B: case '/': case '|':
+            return kBreakAfter;
+        default:
+            break;
+    }
+    if (cp >= 0x2000 && cp <= 0x200A && cp != 0x2007) return kBreakSpace;
+    // CJK, Hiragana/Katakana, Hangul-Silben, Vollbreitenformen
+    if ((cp >= 0x2E80 && cp <= 0x9FFF) || (cp >= 0xAC00 && cp <= 0xD7AF) ||
+        (cp >= 0xF900 && cp <= 0xFAFF) || (cp >= 0xFF00 && cp <= 0xFF60) ||
+        (cp >= 0x20000 && cp <= 0x3FFFF)) {
+        return kBreakIdeograph;
+    }
+    return kBreakNone;
+}
+
+bool TextLayout::NoBreakBefore(uint32_t cp)
+{
+    // Schließende Interpunktion (UAX#14 CL/CP/EX/IS) darf nicht an den Zeilenanfang
+    switch (cp) {
+        case ')': case ']': case '}': case '.': case ',': case ';': case ':': case '!': case '?':
+        case 0x3001: case 0x3002: case 0xFF0C: case 0xFF0E: case 0x300D: case 0x300F: case 0xFF09:
+        case 0x00BB: case 0x201C: case 0x2019:
+            return true;
+        default:
+            return false;
+    }
+}
+
+size_t CountWords(std::string_view utf8)
+{
+    size_t count = 0;
+    bool inWord = false;
+    for (char c : utf8) {
+        if (std::isspace(static_cast<unsigned char>(c))) {
+            inWord = false;
+        } else if (!inWord) {
+            ++count;
+            inWord = true;
+        }
+    }
+    return count;
+}
+
+#ifdef USE_SFML
+TextLayout::AdvanceFn MakeFontAdvance(const sf::Font& font, unsigned int characterSize)
+{
+    const sf::Font* fontPtr = &font;
+    return [fontPtr, characterSize](uint32_t prev, uint32_t cp) -> float {
+        if (cp == '\t') {
+            // sf::Text rendert Tabs als vier Leerzeichen
+            return 4.f * fontPtr->getGlyph(' ', characterSize, false).advance;
+        }
+        float kerning = prev ? fontPtr->getKerning(prev, cp, characterSize) : 0.f;
+        return kerning + fontPtr->getGlyph(cp, characterSize, false).advance;
+    };
+}
+
+sf::String LineString(const TextLayout& layout, size_t index)
+{
+    const LineSpan& span = layout.Line(index);
+    const uint32_t* chars = layout.Chars() + span.firstChar;
+    return sf::String(std::basic_string<sf::Uint32>(chars, chars + span.charCount));
+}
+#endif
+
+} // namespace UI
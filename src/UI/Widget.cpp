@@ -3,6 +3,13 @@
 
 namespace UI {
 
+void Widget::draw(sf::RenderTarget &target)
+{
+    BatchRenderer batch;
+    draw(batch);
+    batch.Flush(target);
+}
+
 // Button implementation
 Button::Button(const std::string &label, const sf::Font &font)
     : label_(label), font_(font)
@@ -10,27 +17,12 @@ Button::Button(const std::string &label, const sf::Font &font)
     size_ = sf::Vector2f(120.f, 40.f);
 }
 
-void Button::draw(sf::RenderWindow &window)
+void Button::draw(BatchRenderer &batch)
 {
-    // Draw background rectangle
-    sf::RectangleShape bg(size_);
-    bg.setPosition(position_);
-    bg.setFillColor(isHovered_ ? hoverColor_ : bgColor_);
-    window.draw(bg);
-    
-    // Draw border
-    sf::RectangleShape border(size_);
-    border.setPosition(position_);
-    border.setFillColor(sf::Color::Transparent);
-    border.setOutlineColor(sf::Color::Black);
-    border.setOutlineThickness(1.f);
-    window.draw(border);
-    
-    // Draw text
-    sf::Text text(label_, font_, 14u);
-    text.setFillColor(textColor_);
-    text.setPosition(position_.x + 10.f, position_.y + 10.f);
-    window.draw(text);
+    // Hintergrund mit Rahmen, Text darüber
+    batch.AddRect(sf::FloatRect(position_.x, position_.y, size_.x, size_.y), isHovered_ ? hoverColor_ : bgColor_,
+                  sf::Color::Black);
+    batch.AddText(label_, font_, 14u, sf::Vector2f(position_.x + 10.f, position_.y + 10.f), textColor_);
 }
 
 void Button::handleEvent(const sf::Event &event)
@@ -56,14 +48,12 @@ void Button::handleEvent(const sf::Event &event)
 RectShape::RectShape(float width, float height, const sf::Color &color)
 {
     size_ = sf::Vector2f(width, height);
-    shape_.setSize(size_);
-    shape_.setFillColor(color);
+    color_ = color;
 }
 
-void RectShape::draw(sf::RenderWindow &window)
+void RectShape::draw(BatchRenderer &batch)
 {
-    shape_.setPosition(position_);
-    window.draw(shape_);
+    batch.AddRect(sf::FloatRect(position_.x, position_.y, size_.x, size_.y), color_);
 }
 
 } // namespace UI
@@ -2,13 +2,20 @@
 
 namespace UseCases {
 
-ExtractTextUseCase::ExtractTextUseCase(std::shared_ptr<Core::IRepository> repo)
-    : repo_(repo)
+ExtractTextUseCase::ExtractTextUseCase(std::shared_ptr<Core::IRepository> repo,
+                                       std::shared_ptr<Core::ITextExtractor> extractor)
+    : repo_(repo), extractor_(extractor)
 {
 }
 
 std::string ExtractTextUseCase::Execute(const std::string &path)
 {
+    // Born-digital PDFs lokal extrahieren, ohne Upload und Server-Roundtrip
+    Core::ExtractionResult local = Extract(path, Core::ExtractionOptions());
+    if (local.success) {
+        return local.text;
+    }
+
     // Stub implementation: attempt to fetch document, return mock result
     auto doc = repo_->GetDocument(path);
     if (doc) {
@@ -17,4 +24,24 @@ std::string ExtractTextUseCase::Execute(const std::string &path)
     return "Failed to extract from " + path;
 }
 
+Core::ExtractionResult ExtractTextUseCase::Extract(const std::string &path, const Core::ExtractionOptions &options)
+{
+    if (!CanExtractLocally(path)) {
+        Core::ExtractionResult result;
+        result.error = "Kein lokaler Extraktor für " + path;
+        return result;
+    }
+    return extractor_->Extract(path, options);
+}
+
+bool ExtractTextUseCase::CanExtractLocally(const std::string &path) const
+{
+    return extractor_ && extractor_->CanHandle(path);
+}
+
+bool ExtractTextUseCase::HasTextLayer(const std::string &path, int probePages)
+{
+    return CanExtractLocally(path) && extractor_->HasTextLayer(path, probePages);
+}
+
 } // namespace UseCases
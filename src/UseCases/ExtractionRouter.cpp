@@ -0,0 +1,297 @@
+#include "../../include/UseCases/ExtractionRouter.h"
+#include "../../include/Services/AppPaths.h"
+#include "../../include/UseCases/ExtractTextUseCase.h"
+#include <algorithm>
+#include <cstdlib>
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+
+namespace UseCases {
+
+namespace {
+
+// Lernrate des LMS-Updates; höher = schnellere Anpassung, mehr Rauschen
+const double kLearningRate = 0.3;
+// Wie lange die Queue-Tiefe aus Extraction/stats wiederverwendet wird
+const std::chrono::seconds kQueueCacheTtl(5);
+// Nach einem Netzwerkfehler wird der Server so lange übersprungen
+const std::chrono::seconds kBackendRetryAfter(30);
+// Mindestabstand zwischen zwei Speicherungen der Kostenmodelle
+const std::chrono::seconds kSaveInterval(30);
+
+double ElapsedMs(std::chrono::steady_clock::time_point start)
+{
+    return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+}
+
+double SizeMB(const DocumentRef &doc)
+{
+    uint64_t sizeBytes = doc.sizeBytes;
+    if (sizeBytes == 0 && !doc.localPath.empty()) {
+        std::error_code ec;
+        auto fileSize = std::filesystem::file_size(doc.localPath, ec);
+        if (!ec) sizeBytes = fileSize;
+    }
+    return static_cast<double>(sizeBytes) / (1024.0 * 1024.0);
+}
+
+} // namespace
+
+void CostModel::Observe(double sizeMB, double elapsedMs)
+{
+    double error = elapsedMs - Estimate(sizeMB);
+    double norm = 1.0 + sizeMB * sizeMB;
+    overheadMs = std::max(0.0, overheadMs + kLearningRate * error / norm);
+    msPerMB = std::max(0.0, msPerMB + kLearningRate * error * sizeMB / norm);
+    ++samples;
+}
+
+ExtractionRouter::ExtractionRouter(std::shared_ptr<ExtractTextUseCase> local,
+                                   std::shared_ptr<Core::IRemoteExtractor> remote,
+                                   std::string modelPath)
+    : local_(local), remote_(remote), modelPath_(std::move(modelPath))
+{
+    LoadModels();
+}
+
+ExtractionRouter::~ExtractionRouter()
+{
+    SaveModels();
+}
+
+std::string ExtractionRouter::DefaultModelPath()
+{
+    return Services::AppDataPath(".text-extraction-router");
+}
+
+// Format: eine Zeile pro Modell "local|remote overheadMs msPerMB samples"
+void ExtractionRouter::LoadModels()
+{
+    if (modelPath_.empty()) return;
+    std::ifstream in(modelPath_);
+    std::string name;
+    CostModel model{0.0, 0.0};
+    while (in >> name >> model.overheadMs >> model.msPerMB >> model.samples) {
+        if (model.overheadMs < 0.0 || model.msPerMB < 0.0 || model.samples < 0) continue;
+        if (name == "local") localModel_ = model;
+        else if (name == "remote") remoteModel_ = model;
+    }
+}
+
+void ExtractionRouter::SaveModelsIfDue()
+{
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        if (std::chrono::steady_clock::now() - savedAt_ < kSaveInterval) return;
+    }
+    SaveModels();
+}
+
+void ExtractionRouter::SaveModels()
+{
+    if (modelPath_.empty()) return;
+    CostModel local;
+    CostModel remote;
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        if (!modelsDirty_) return;
+        local = localModel_;
+        remote = remoteModel_;
+        modelsDirty_ = false;
+        savedAt_ = std::chrono::steady_clock::now();
+    }
+
+    // Erst vollständig schreiben, dann umbenennen: ein Abbruch hinterlässt nie eine halbe Datei
+    std::lock_guard<std::mutex> lock(saveMutex_);
+    std::string tmpPath = modelPath_ + ".tmp";
+    {
+        std::ofstream out(tmpPath, std::ios::trunc);
+        out << "local " << local.overheadMs << " " << local.msPerMB << " " << local.samples << "\n"
+            << "remote " << remote.overheadMs << " " << remote.msPerMB << " " << remote.samples << "\n";
+        if (!out) return;
+    }
+    std::error_code ec;
+    std::filesystem::rename(tmpPath, modelPath_, ec);
+}
+
+CostModel ExtractionRouter::GetLocalModel() const
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    return localModel_;
+}
+
+CostModel ExtractionRouter::GetRemoteModel() const
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    return remoteModel_;
+}
+
+bool ExtractionRouter::BackendAvailable() const
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    return std::chrono::steady_clock::now() >= backendDownUntil_;
+}
+
+void ExtractionRouter::MarkBackendDown()
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    backendDownUntil_ = std::chrono::steady_clock::now() + kBackendRetryAfter;
+    cachedQueueDepth_ = -1;
+    std::cout << "Router: Server nicht erreichbar, lokale Extraktion für "
+              << kBackendRetryAfter.count() << "s bevorzugt" << std::endl;
+}
+
+int ExtractionRouter::QueueDepth()
+{
+    auto now = std::chrono::steady_clock::now();
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        if (queueCheckedAt_.time_since_epoch().count() != 0 && now - queueCheckedAt_ < kQueueCacheTtl) {
+            return cachedQueueDepth_;
+        }
+    }
+
+    int depth = remote_->QueueDepth();
+
+    std::lock_guard<std::mutex> lock(mutex_);
+    cachedQueueDepth_ = depth;
+    queueCheckedAt_ = now;
+    return depth;
+}
+
+bool ExtractionRouter::ProbeTextLayer(const std::string &path)
+{
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        auto it = textLayerCache_.find(path);
+        if (it != textLayerCache_.end()) return it->second;
+    }
+
+    bool hasText = local_->HasTextLayer(path);
+
+    std::lock_guard<std::mutex> lock(mutex_);
+    textLayerCache_[path] = hasText;
+    return hasText;
+}
+
+RouteDecision ExtractionRouter::Decide(const DocumentRef &doc, const Core::ExtractionOptions &options)
+{
+    RouteDecision decision;
+
+    double sizeMB = SizeMB(doc);
+    decision.sizeMB = sizeMB;
+
+    bool canRemote = remote_ && !doc.fileId.empty() && BackendAvailable();
+    bool canLocal = local_ && !doc.localPath.empty() && local_->CanExtractLocally(doc.localPath);
+
+    if (canLocal && options.enableOCR) {
+        canLocal = false;
+        decision.reason = "OCR angefordert";
+    } else if (canLocal && !ProbeTextLayer(doc.localPath)) {
+        // Gescannte Dokumente kann nur der Server (OCR) lesen
+        canLocal = false;
+        decision.reason = "keine Textebene";
+    }
+
+    if (canLocal) {
+        std::lock_guard<std::mutex> lock(mutex_);
+        decision.estimatedLocalMs = localModel_.Estimate(sizeMB);
+    }
+    if (canRemote) {
+        // Queue nur abfragen wenn beide Wege möglich sind
+        decision.queueDepth = canLocal ? QueueDepth() : -1;
+        std::lock_guard<std::mutex> lock(mutex_);
+        double perQueuedJob = remoteModel_.Estimate(1.0);
+        decision.estimatedRemoteMs = remoteModel_.Estimate(sizeMB) + std::max(0, decision.queueDepth) * perQueuedJob;
+    }
+
+    if (!canLocal && !canRemote) {
+        decision.target = RouteDecision::Target::None;
+        if (decision.reason.empty()) decision.reason = "weder lokal noch remote extrahierbar";
+        return decision;
+    }
+
+    if (canLocal && (!canRemote || decision.estimatedLocalMs <= decision.estimatedRemoteMs)) {
+        decision.target = RouteDecision::Target::Local;
+        if (decision.reason.empty()) decision.reason = canRemote ? "lokal schneller" : "nur lokal verfügbar";
+    } else {
+        decision.target = RouteDecision::Target::Remote;
+        if (decision.reason.empty()) decision.reason = canLocal ? "Server schneller" : "nur remote verfügbar";
+    }
+    return decision;
+}
+
+Core::ExtractionResult ExtractionRouter::RunLocal(const DocumentRef &doc, const Core::ExtractionOptions &options,
+                                                  double sizeMB)
+{
+    auto start = std::chrono::steady_clock::now();
+    Core::ExtractionResult result = local_->Extract(doc.localPath, options);
+    result.extractedLocally = true;
+    if (result.success) {
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            localModel_.Observe(sizeMB, ElapsedMs(start));
+            modelsDirty_ = true;
+        }
+        SaveModelsIfDue();
+    } else if (!result.hasTextLayer) {
+        std::lock_guard<std::mutex> lock(mutex_);
+        textLayerCache_[doc.localPath] = false;
+    }
+    return result;
+}
+
+Core::ExtractionResult ExtractionRouter::RunRemote(const DocumentRef &doc, const Core::ExtractionOptions &options,
+                                                   double sizeMB)
+{
+    auto start = std::chrono::steady_clock::now();
+    Core::ExtractionResult result = remote_->Extract(doc.fileId, options);
+    if (result.backendUnreachable) {
+        MarkBackendDown();
+    } else if (result.success) {
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            remoteModel_.Observe(sizeMB, ElapsedMs(start));
+            modelsDirty_ = true;
+        }
+        SaveModelsIfDue();
+    }
+    return result;
+}
+
+Core::ExtractionResult ExtractionRouter::Run(const DocumentRef &doc, const Core::ExtractionOptions &options,
+                                             RouteDecision *decisionOut)
+{
+    RouteDecision decision = Decide(doc, options);
+    double sizeMB = decision.sizeMB;
+
+    Core::ExtractionResult result;
+    if (decision.target == RouteDecision::Target::Local) {
+        result = RunLocal(doc, options, sizeMB);
+        if (!result.success && decision.estimatedRemoteMs >= 0.0) {
+            decision.target = RouteDecision::Target::Remote;
+            decision.reason += ", Fallback auf Server (" + result.error + ")";
+            result = RunRemote(doc, options, sizeMB);
+        }
+    } else if (decision.target == RouteDecision::Target::Remote) {
+        result = RunRemote(doc, options, sizeMB);
+        if (result.backendUnreachable && decision.estimatedLocalMs >= 0.0) {
+            decision.target = RouteDecision::Target::Local;
+            decision.reason += ", Fallback lokal (Server nicht erreichbar)";
+            result = RunLocal(doc, options, sizeMB);
+        }
+    } else {
+        result.error = decision.reason;
+    }
+
+    std::cout << "Router: " << (decision.target == RouteDecision::Target::Local ? "lokal" :
+                                decision.target == RouteDecision::Target::Remote ? "remote" : "keine")
+              << " (" << decision.reason << ", lokal ~" << decision.estimatedLocalMs
+              << "ms, remote ~" << decision.estimatedRemoteMs << "ms)" << std::endl;
+
+    if (decisionOut) *decisionOut = decision;
+    return result;
+}
+
+} // namespace UseCases
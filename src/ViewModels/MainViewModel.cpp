@@ -1,11 +1,13 @@
 #include "../../include/Presentation/ViewModel/MainViewModel.h"
 #include "../../include/UseCases/ExtractTextUseCase.h"
+#include "../../include/UseCases/ExtractionRouter.h"
 #include <iostream>
 
 using namespace Presentation::ViewModel;
 
-MainViewModel::MainViewModel(std::shared_ptr<UseCases::ExtractTextUseCase> usecase)
-    : usecase_(usecase)
+MainViewModel::MainViewModel(std::shared_ptr<UseCases::ExtractTextUseCase> usecase,
+                             std::shared_ptr<UseCases::ExtractionRouter> router)
+    : usecase_(usecase), router_(router)
 {
 }
 
@@ -21,3 +23,42 @@ void MainViewModel::StartExtraction(const std::string &path)
 std::string MainViewModel::GetStatus() const { return status_; }
 
 std::string MainViewModel::GetLastResult() const { return lastResult_; }
+
+void MainViewModel::RememberUpload(const std::string &fileId, const std::string &localPath)
+{
+    if (!fileId.empty() && !localPath.empty()) {
+        localPaths_[fileId] = localPath;
+    }
+}
+
+std::string MainViewModel::GetLocalPath(const std::string &fileId) const
+{
+    auto it = localPaths_.find(fileId);
+    return it != localPaths_.end() ? it->second : std::string();
+}
+
+Core::ExtractionResult MainViewModel::ExtractDocument(const std::string &fileId, const Core::ExtractionOptions &options,
+                                                      std::string *route)
+{
+    Core::ExtractionResult result;
+    if (!router_) {
+        result.error = "Kein Extraktions-Router konfiguriert";
+        return result;
+    }
+
+    status_ = "Running";
+    UseCases::DocumentRef doc;
+    doc.fileId = fileId;
+    doc.localPath = GetLocalPath(fileId);
+
+    UseCases::RouteDecision decision;
+    result = router_->Run(doc, options, &decision);
+    if (route) {
+        *route = (decision.target == UseCases::RouteDecision::Target::Local ? "lokal: " :
+                  decision.target == UseCases::RouteDecision::Target::Remote ? "Server: " : "") + decision.reason;
+    }
+
+    lastResult_ = result.text;
+    status_ = result.success ? "Finished" : "Failed";
+    return result;
+}
@@ -1,6 +1,9 @@
 #include "../include/Presentation/ViewModel/MainViewModel.h"
 #include "../include/Presentation/View/MainView.hpp"
 #include "../include/UseCases/ExtractTextUseCase.h"
+#include "../include/UseCases/ExtractionRouter.h"
+#include "../include/Services/PdfTextExtractor.h"
+#include "../include/Services/RemoteExtractor.h"
 #include <iostream>
 #include <memory>
 
@@ -15,8 +18,11 @@ struct StubRepo : Core::IRepository {
 int main()
 {
     auto repo = std::make_shared<StubRepo>();
-    auto usecase = std::make_shared<UseCases::ExtractTextUseCase>(repo);
-    Presentation::ViewModel::MainViewModel vm(usecase);
+    auto extractor = std::make_shared<Services::PdfTextExtractor>();
+    auto usecase = std::make_shared<UseCases::ExtractTextUseCase>(repo, extractor);
+    auto router = std::make_shared<UseCases::ExtractionRouter>(usecase, std::make_shared<Services::RemoteExtractor>(),
+                                                               UseCases::ExtractionRouter::DefaultModelPath());
+    Presentation::ViewModel::MainViewModel vm(usecase, router);
 
     RunGui(vm);
 